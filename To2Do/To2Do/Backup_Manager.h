@@ -2,89 +2,280 @@
 #define BACKUP_MANAGER_H
 
 #include <ArduinoJson.h>
+#include <FS.h>
+#include <vector>
+#include <algorithm>
 #include "Data_Manager.h"
 
+/*
+ * BACKUP MANAGER
+ * Export: canlı veriden bölüm bölüm yazılır (projects, tasks shard shard, settings).
+ * Import: yüklenen dosya flash'tan okunur, tamamı hiçbir zaman RAM'e alınmaz:
+ *   1. Tarama : yapı ve her görev tek tek doğrulanır, görevin dosyadaki konumu not edilir
+ *   2. Yazma  : her proje için görevleri konumlarından okunur, shard .new adıyla
+ *               yazılır; hepsi yazılınca eski verinin yerine geçer (DataManager::replaceAll)
+ * Bellek: projects + settings + tek shard + görev başına 8 byte.
+ * Ağ ayarları (şifreler) yedekte yoktur, cihazdakiler korunur.
+ */
+
 class BackupManager {
 private:
     DataManager* dataManager;
-    const size_t BACKUP_JSON_CAPACITY = 24576;
+    
+    // Where a task object starts in the uploaded file
+    struct TaskRef {
+        int projectId;
+        uint32_t offset;
+        
+        bool operator<(const TaskRef& o) const {
+            return projectId != o.projectId ? projectId < o.projectId : offset < o.offset;
+        }
+    };
+    
+    // ==================== JSON SCANNING ====================
+    // Only the top-level object is walked by hand; projects, settings and each
+    // task are handed to ArduinoJson, which stops right after the closing bracket.
+    
+    static void skipSpace(Stream& in) {
+        while (in.available() && isspace(in.peek())) {
+            in.read();
+        }
+    }
+    
+    static int nextChar(Stream& in) {
+        skipSpace(in);
+        return in.read();
+    }
+    
+    // Rest of a string whose opening quote is already consumed; longer values are cut
+    static bool readString(Stream& in, char* buffer, size_t size) {
+        size_t length = 0;
+        for (;;) {
+            int c = in.read();
+            if (c < 0) return false;
+            if (c == '"') break;
+            if (c == '\\') {
+                c = in.read();
+                if (c < 0) return false;
+            }
+            if (length + 1 < size) buffer[length++] = (char)c;
+        }
+        buffer[length] = '\0';
+        return true;
+    }
+    
+    // Values the import does not use (version, app, timestamp...) - never parsed
+    static bool skipValue(Stream& in) {
+        skipSpace(in);
+        int depth = 0;
+        while (in.available()) {
+            int c = in.peek();
+            if (depth == 0 && (c == ',' || c == '}' || c == ']')) {
+                return true;
+            }
+            in.read();
+            if (c == '"') {
+                char unused[1];
+                if (!readString(in, unused, sizeof(unused))) return false;
+            } else if (c == '{' || c == '[') {
+                depth++;
+            } else if (c == '}' || c == ']') {
+                if (--depth == 0) return true;
+            }
+        }
+        return false;
+    }
+    
+    // Pass 1 for the tasks array: every element is parsed and checked, then dropped
+    static bool scanTasks(File& in, std::vector<TaskRef>& refs, std::vector<int>& taskIds, String& error) {
+        if (nextChar(in) != '[') {
+            error = "tasks must be an array";
+            return false;
+        }
+        skipSpace(in);
+        if (in.peek() == ']') {
+            in.read();
+            return true;
+        }
+        
+        JsonDocument task;
+        for (;;) {
+            skipSpace(in);
+            uint32_t offset = in.position();
+            if (in.peek() != '{' || deserializeJson(task, in)) {
+                error = "Invalid task at byte " + String(offset);
+                return false;
+            }
+            if (!task["id"].is<int>() || !task["projectId"].is<int>() || !task["title"].is<const char*>()) {
+                error = "Task at byte " + String(offset) + " needs id, projectId and title";
+                return false;
+            }
+            if (task["id"].as<int>() <= 0 || task["id"].as<int>() > DataManager::MAX_TASK_ID) {
+                error = "Task at byte " + String(offset) + " has an id out of range";
+                return false;
+            }
+            refs.push_back(TaskRef{task["projectId"].as<int>(), offset});
+            taskIds.push_back(task["id"].as<int>());
+            
+            int c = nextChar(in);
+            if (c == ']') return true;
+            if (c != ',') {
+                error = "Malformed tasks array";
+                return false;
+            }
+        }
+    }
+    
+    static bool hasDuplicates(std::vector<int>& ids) {
+        std::sort(ids.begin(), ids.end());
+        return std::adjacent_find(ids.begin(), ids.end()) != ids.end();
+    }
     
 public:
     BackupManager(DataManager* dm) : dataManager(dm) {}
     
-    String exportBackup() {
+    // Streams the backup section by section from the live data
+    bool exportBackup(Print& out) {
         if (!dataManager) {
-            return "{\"error\":\"DataManager not initialized\"}";
+            out.print("{\"error\":\"DataManager not initialized\"}");
+            return false;
         }
         
-        DynamicJsonDocument backupDoc(BACKUP_JSON_CAPACITY);
-        
-        backupDoc["version"] = "1.0";
-        backupDoc["app"] = "SmartKraft-ToDo";
-        backupDoc["timestamp"] = millis();
-        
-        String todosData = dataManager->getTodosData();
-        String settingsData = dataManager->getSettings();
-        
-        DynamicJsonDocument todosDoc(BACKUP_JSON_CAPACITY);
-        DeserializationError error = deserializeJson(todosDoc, todosData);
-        if (error) {
-            return "{\"error\":\"Failed to parse todos\"}";
+        bool first = true;
+        for (size_t part = 0; writeExportPart(out, part, first); part++) {
         }
-        
-        DynamicJsonDocument settingsDoc(4096);
-        error = deserializeJson(settingsDoc, settingsData);
-        if (error) {
-            return "{\"error\":\"Failed to parse settings\"}";
+        return true;
+    }
+    
+    // exportBackup in parts for a chunked response, at most one shard each:
+    // 0 = header and projects, 1..N = tasks of the N projects, N+1 = settings.
+    // Call under DataLock per part; false past the last part.
+    bool writeExportPart(Print& out, size_t part, bool& first) {
+        size_t projectCount = dataManager->getProjectList().size();
+        if (part == 0) {
+            out.print("{\"version\":\"1.0\",\"app\":\"SmartKraft-ToDo\",\"timestamp\":");
+            out.print(millis());
+            out.print(",\"projects\":");
+            dataManager->writeProjects(out);
+            out.print(",\"tasks\":[");
+        } else if (part <= projectCount) {
+            dataManager->writeShardTasks(out, part - 1, first);
+        } else if (part == projectCount + 1) {
+            out.print("],\"settings\":");
+            dataManager->writeSettings(out);
+            out.print('}');
+        } else {
+            return false;
         }
-        
-        backupDoc["projects"] = todosDoc["projects"];
-        backupDoc["tasks"] = todosDoc["tasks"];
-        backupDoc["settings"] = settingsDoc.as<JsonObject>();
-        
-        String output;
-        serializeJson(backupDoc, output);
-        return output;
+        return true;
     }
     
-    bool importBackup(const String& backupJson) {
+    // upload: the backup file as received. Nothing is changed unless the
+    // whole file validates; error says why it was rejected.
+    bool importBackup(File& upload, String& error) {
         if (!dataManager) {
+            error = "DataManager not initialized";
             return false;
         }
         
-        DynamicJsonDocument backupDoc(BACKUP_JSON_CAPACITY);
-        DeserializationError error = deserializeJson(backupDoc, backupJson);
+        JsonDocument projects;
+        JsonDocument settings;
+        std::vector<TaskRef> refs;
+        std::vector<int> taskIds;
+        bool hasTasks = false;
         
-        if (error) {
+        if (nextChar(upload) != '{') {
+            error = "Not a JSON object";
             return false;
         }
+        for (int c = nextChar(upload); c != '}'; ) {
+            char key[16];
+            if (c != '"' || !readString(upload, key, sizeof(key)) || nextChar(upload) != ':') {
+                error = "Malformed backup";
+                return false;
+            }
+            
+            if (strcmp(key, "projects") == 0) {
+                DeserializationError result = deserializeJson(projects, upload);
+                if (result) {
+                    error = String("projects: ") + result.c_str();
+                    return false;
+                }
+            } else if (strcmp(key, "settings") == 0) {
+                DeserializationError result = deserializeJson(settings, upload);
+                if (result) {
+                    error = String("settings: ") + result.c_str();
+                    return false;
+                }
+            } else if (strcmp(key, "tasks") == 0) {
+                if (!scanTasks(upload, refs, taskIds, error)) {
+                    return false;
+                }
+                hasTasks = true;
+            } else if (!skipValue(upload)) {
+                error = "Malformed backup";
+                return false;
+            }
+            
+            c = nextChar(upload);
+            if (c == ',') {
+                c = nextChar(upload);
+            } else if (c != '}') {
+                error = "Malformed backup";
+                return false;
+            }
+        }
         
-        if (!backupDoc.containsKey("projects") || !backupDoc.containsKey("tasks") || !backupDoc.containsKey("settings")) {
+        if (!projects.is<JsonArray>() || !hasTasks || !settings.is<JsonObject>()) {
+            error = "Backup needs projects, tasks and settings";
             return false;
         }
         
-        String currentNetworkSettings = dataManager->getNetworkSettings();
-        
-        DynamicJsonDocument todosDoc(BACKUP_JSON_CAPACITY);
-        todosDoc["projects"] = backupDoc["projects"];
-        todosDoc["tasks"] = backupDoc["tasks"];
-        
-        String todosJson;
-        serializeJson(todosDoc, todosJson);
-        
-        if (!dataManager->setTodosData(todosJson)) {
+        std::vector<int> projectIds;
+        for (JsonObjectConst project : projects.as<JsonArrayConst>()) {
+            if (!project["id"].is<int>()) {
+                error = "Project without id";
+                return false;
+            }
+            projectIds.push_back(project["id"].as<int>());
+        }
+        if (projectIds.size() != projects.size() || hasDuplicates(projectIds)) {
+            error = "Invalid project list";
             return false;
         }
-        
-        String settingsJson;
-        serializeJson(backupDoc["settings"], settingsJson);
-        
-        if (!dataManager->setSettings(settingsJson)) {
+        if (hasDuplicates(taskIds)) {
+            error = "Duplicate task id";
             return false;
         }
+        for (const TaskRef& ref : refs) {
+            if (!std::binary_search(projectIds.begin(), projectIds.end(), ref.projectId)) {
+                error = "Task of unknown project " + String(ref.projectId);
+                return false;
+            }
+        }
+        taskIds.clear();
+        taskIds.shrink_to_fit();
         
-        dataManager->setNetworkSettings(currentNetworkSettings);
+        // Pass 2: shard by shard, each task read back from its offset
+        std::sort(refs.begin(), refs.end());
+        JsonDocument task;
+        bool replaced = dataManager->replaceAll(projects.as<JsonArrayConst>(), settings.as<JsonObjectConst>(),
+                                                [&](int projectId, JsonArray tasks) {
+            auto ref = std::lower_bound(refs.begin(), refs.end(), TaskRef{projectId, 0});
+            for (; ref != refs.end() && ref->projectId == projectId; ++ref) {
+                if (!upload.seek(ref->offset) || deserializeJson(task, upload) || !tasks.add(task)) {
+                    return false;
+                }
+            }
+            return true;
+        });
         
+        if (!replaced) {
+            error = "Write failed";
+            return false;
+        }
+        Serial.printf("[Backup] Imported %u projects, %u tasks\n",
+                      (unsigned)projectIds.size(), (unsigned)refs.size());
         return true;
     }
 };
@@ -0,0 +1,515 @@
+#ifndef BENCHMARK_MANAGER_H
+#define BENCHMARK_MANAGER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "Task_Index.h"
+#include "Storage_Backend.h"
+#include "MsgPack_Codec.h"
+#include "Data_Manager.h"
+#include "Notification_Manager.h"
+#include "Backup_Manager.h"
+#include <vector>
+#include <algorithm>
+
+/*
+ * BENCHMARK MANAGER
+ * Cihaz üzerinde sentetik veri ile ölçüm yapar (GET /api/bench/...)
+ * Kullanıcı verisine dokunmaz; sonuçlar JSON olarak döner.
+ * /api/bench/managers gerçek DataManager / NotificationManager / BackupManager
+ * kodunu /bench/ altındaki ayrı bir veri kopyası üzerinde çalıştırır.
+ */
+
+class BenchmarkManager {
+private:
+    static const int QUERY_REPEAT = 100;
+
+    // Storage bench: short names so SPIFFS' 31 char limit is never hit
+    static constexpr const char* BENCH_DIR = "/bench/";
+    static const int BENCH_FILES = 16;
+    static const int FILLER_FILES = 96;
+    static const size_t BENCH_BLOCK = 1024;
+    static const size_t FILLER_BLOCK = 256;
+    static const size_t BENCH_MIN_FREE = 96 * 1024;
+
+    // Managers bench: shards of about this many tasks, like a busy project
+    static const int TASKS_PER_PROJECT = 50;
+    static const size_t FLASH_PER_TASK = 320;   // shard + export spool + rewrite temp
+    static const size_t HEAP_PER_TASK = 48;     // task index + week list
+    static const size_t MANAGERS_MIN_HEAP = 48 * 1024;
+
+    // Deterministic synthetic task: dates spread over +-60 days around baseDay
+    static void fillTask(JsonDocument& task, int i, DateCore::Day baseDay) {
+        static const char* priorities[] = {"high", "medium", "low"};
+        DateCore::Day day = baseDay + (i * 37) % 121 - 60;
+
+        char date[11];
+        DateCore::formatDate(day, date);
+
+        task.clear();
+        task["id"] = i + 1;
+        task["projectId"] = i % 8 + 1;
+        task["title"] = "Synthetic task";
+        task["date"] = date;
+        task["completed"] = (i % 5) == 0;
+        task["priority"] = priorities[i % 3];
+    }
+
+    // The pre-index notification path: serialize, reparse, String date compare
+    static int jsonWeekCount(JsonDocument& todos, const char* from, const char* to) {
+        String text;
+        serializeJson(todos, text);
+
+        JsonDocument doc;
+        if (deserializeJson(doc, text)) {
+            return -1;
+        }
+
+        int count = 0;
+        for (JsonObject task : doc["tasks"].as<JsonArray>()) {
+            String date = task["date"].as<String>();
+            if (date.length() < 10) continue;
+            if (date.substring(0, 10) >= from && date.substring(0, 10) <= to) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    static String benchPath(const char* kind, int i) {
+        return String(BENCH_DIR) + kind + i;
+    }
+
+    static bool writeBlock(StorageBackend& fs, const String& path, const uint8_t* data, size_t length) {
+        File file = fs.open(path, "w");
+        if (!file) {
+            return false;
+        }
+        size_t written = file.write(data, length);
+        file.close();
+        return written == length;
+    }
+
+    // exists / open / read / write / rename averages over BENCH_FILES files
+    static void measureStorage(Print& out, StorageBackend& fs, const char* phase, int fillerFiles) {
+        uint8_t block[BENCH_BLOCK];
+        for (size_t i = 0; i < BENCH_BLOCK; i++) block[i] = (uint8_t)(i * 31);
+
+        unsigned long start = micros();
+        int failures = 0;
+        for (int i = 0; i < BENCH_FILES; i++) {
+            if (!writeBlock(fs, benchPath("f", i), block, BENCH_BLOCK)) failures++;
+            yield();
+        }
+        unsigned long writeMicros = (micros() - start) / BENCH_FILES;
+
+        start = micros();
+        for (int i = 0; i < BENCH_FILES; i++) {
+            if (!fs.exists(benchPath("f", i))) failures++;
+        }
+        unsigned long existsMicros = (micros() - start) / BENCH_FILES;
+
+        start = micros();
+        for (int i = 0; i < BENCH_FILES; i++) {
+            if (fs.exists(benchPath("m", i))) failures++;
+        }
+        unsigned long missingMicros = (micros() - start) / BENCH_FILES;
+
+        unsigned long openMicros = 0;
+        unsigned long readMicros = 0;
+        for (int i = 0; i < BENCH_FILES; i++) {
+            start = micros();
+            File file = fs.open(benchPath("f", i), "r");
+            openMicros += micros() - start;
+            if (!file) {
+                failures++;
+                continue;
+            }
+            start = micros();
+            if (file.read(block, BENCH_BLOCK) != BENCH_BLOCK) failures++;
+            readMicros += micros() - start;
+            file.close();
+        }
+        openMicros /= BENCH_FILES;
+        readMicros /= BENCH_FILES;
+
+        // Same pattern as DataManager::writeAtomically: remove target, rename temp
+        start = micros();
+        for (int i = 0; i < BENCH_FILES; i++) {
+            if (!fs.rename(benchPath("f", i), benchPath("r", i))) failures++;
+            yield();
+        }
+        unsigned long renameMicros = (micros() - start) / BENCH_FILES;
+
+        for (int i = 0; i < BENCH_FILES; i++) {
+            fs.remove(benchPath("r", i));
+        }
+
+        out.printf("{\"phase\":\"%s\",\"files\":%d,\"fillerFiles\":%d,\"usedBytes\":%u,"
+                   "\"existsUs\":%lu,\"missingUs\":%lu,\"openUs\":%lu,\"read1kUs\":%lu,"
+                   "\"write1kUs\":%lu,\"renameUs\":%lu,\"failures\":%d}",
+                   phase, BENCH_FILES, fillerFiles, (unsigned)fs.usedBytes(),
+                   existsMicros, missingMicros, openMicros, readMicros,
+                   writeMicros, renameMicros, failures);
+    }
+
+    static void removeBenchFiles(StorageBackend& fs) {
+        std::vector<String> paths;
+        fs.listFiles(BENCH_DIR, [&](const String& path) {
+            paths.push_back(path);
+        });
+        for (const String& path : paths) {
+            fs.remove(path);
+        }
+        if (fs.hasDirectories()) {
+            fs.fs().rmdir("/bench/t"); // shards of the managers bench
+            fs.fs().rmdir("/bench");
+        }
+    }
+
+    // Task i of an n-task data set lives in project i % projects + 1
+    static int projectCount(int n) {
+        return n / TASKS_PER_PROJECT > 0 ? n / TASKS_PER_PROJECT : 1;
+    }
+
+    // One size of runManagers; the data set is written, reloaded, queried,
+    // exported and imported again through the real managers
+    static void measureManagers(Print& out, StorageBackend& fs, TimeManager* timeManager, int n) {
+        const DateCore::Day baseDay = DateCore::daysFromCivil(2025, 10, 21);
+        int projects = projectCount(n);
+
+        JsonDocument projectList;
+        JsonArray projectArray = projectList.to<JsonArray>();
+        for (int p = 1; p <= projects; p++) {
+            JsonObject project = projectArray.add<JsonObject>();
+            project["id"] = p;
+            project["name"] = "Project";
+            project["category"] = "Work";
+        }
+        JsonDocument settings;
+        settings.to<JsonObject>();
+
+        // Save: every shard plus the snapshot, as after a restore
+        size_t usedBefore = fs.usedBytes();
+        unsigned long saveMicros;
+        uint32_t savedBytes;
+        bool saved;
+        {
+            DataManager writer(BENCH_DIR);
+            JsonDocument task;
+            unsigned long start = micros();
+            saved = writer.replaceAll(projectList.as<JsonArrayConst>(), settings.as<JsonObjectConst>(),
+                                      [&](int projectId, JsonArray tasks) {
+                for (int i = projectId - 1; i < n; i += projects) {
+                    fillTask(task, i, baseDay);
+                    task["projectId"] = projectId;
+                    if (!tasks.add(task)) return false;
+                }
+                yield();
+                return true;
+            });
+            saveMicros = micros() - start;
+            savedBytes = writer.getStorageStats().lastSaveBytes;
+        }
+        size_t flashUsed = fs.usedBytes() - usedBefore;
+
+        // Load: a fresh instance, as at boot
+        uint32_t heapBefore = ESP.getFreeHeap();
+        DataManager data(BENCH_DIR);
+        unsigned long start = micros();
+        bool loaded = saved && data.loadFromFile() && data.getTaskCount() == (size_t)n;
+        unsigned long loadMicros = micros() - start;
+        int heapUsed = (int)(heapBefore - ESP.getFreeHeap());
+
+        // Notification queries: first (uncached) counts, then the week list
+        NotificationManager notifications(&data);
+        notifications.setTimeManager(timeManager);
+        start = micros();
+        TaskCounts counts = notifications.getTaskCounts();
+        unsigned long countsMicros = micros() - start;
+        start = micros();
+        size_t weekBytes = notifications.getNotifications("week").length();
+        unsigned long weekMicros = micros() - start;
+
+        // Backup: export to a flash spool, import it back over the same data
+        BackupManager backup(&data);
+        String spoolPath = String(BENCH_DIR) + "backup";
+        size_t exportBytes = 0;
+        unsigned long exportMicros = 0;
+        unsigned long importMicros = 0;
+        String importError;
+        bool imported = false;
+        File spool = fs.open(spoolPath, "w");
+        if (spool) {
+            start = micros();
+            backup.exportBackup(spool);
+            exportMicros = micros() - start;
+            exportBytes = spool.position();
+            spool.close();
+
+            spool = fs.open(spoolPath, "r");
+            start = micros();
+            imported = spool && backup.importBackup(spool, importError);
+            importMicros = micros() - start;
+            spool.close();
+            fs.remove(spoolPath);
+        }
+
+        out.printf("{\"tasks\":%d,\"projects\":%d,\"saveUs\":%lu,\"savedBytes\":%u,\"flashUsed\":%u,"
+                   "\"loadUs\":%lu,\"heapUsed\":%d,\"largestBlock\":%u,\"countsUs\":%lu,\"week\":%d,"
+                   "\"weekUs\":%lu,\"weekBytes\":%u,\"exportUs\":%lu,\"exportBytes\":%u,\"importUs\":%lu,",
+                   n, projects, saveMicros, (unsigned)savedBytes, (unsigned)flashUsed,
+                   loadMicros, heapUsed, (unsigned)ESP.getMaxAllocHeap(), countsMicros, counts.week,
+                   weekMicros, (unsigned)weekBytes, exportMicros, (unsigned)exportBytes, importMicros);
+        if (loaded && imported) {
+            out.print("\"ok\":true}");
+        } else {
+            out.printf("\"ok\":false,\"error\":\"%s\"}",
+                       !loaded ? "load" : importError.length() ? "import" : "export");
+        }
+    }
+
+public:
+    // Task index vs. JSON reparse at 100 / 1,000 / 5,000 tasks
+    static void runTaskIndex(Print& out) {
+        static const int sizes[] = {100, 1000, 5000};
+        const DateCore::Day baseDay = DateCore::daysFromCivil(2025, 10, 21);
+
+        out.print("{\"bench\":\"taskIndex\",\"results\":[");
+
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            int n = sizes[s];
+            JsonDocument task;
+
+            // Index build
+            TaskIndex index;
+            uint32_t heapBefore = ESP.getFreeHeap();
+            unsigned long start = micros();
+            index.reserve(n);
+            for (int i = 0; i < n; i++) {
+                fillTask(task, i, baseDay);
+                index.append(task.as<JsonObjectConst>(), task["projectId"].as<int>());
+            }
+            index.sort();
+            unsigned long buildMicros = micros() - start;
+
+            // Week window query
+            size_t matches = 0;
+            start = micros();
+            for (int r = 0; r < QUERY_REPEAT; r++) {
+                matches = index.countDue(baseDay, baseDay + 7, false);
+            }
+            unsigned long queryMicros = (micros() - start) / QUERY_REPEAT;
+
+            if (s > 0) out.print(',');
+            out.printf("{\"tasks\":%d,\"indexBytes\":%u,\"heapUsed\":%d,\"buildUs\":%lu,"
+                       "\"queryUs\":%lu,\"matches\":%u,",
+                       n, (unsigned)index.memoryUsage(), (int)(heapBefore - ESP.getFreeHeap()),
+                       buildMicros, queryMicros, (unsigned)matches);
+
+            // Old path - needs the document plus its serialized copy in RAM
+            size_t estimate = (size_t)n * 320;
+            if (ESP.getMaxAllocHeap() < estimate || ESP.getFreeHeap() < estimate * 2) {
+                out.print("\"jsonUs\":null,\"jsonSkipped\":\"heap\"}");
+                continue;
+            }
+
+            JsonDocument todos;
+            JsonArray tasks = todos["tasks"].to<JsonArray>();
+            for (int i = 0; i < n; i++) {
+                fillTask(task, i, baseDay);
+                tasks.add(task.as<JsonObjectConst>());
+            }
+
+            start = micros();
+            int jsonMatches = jsonWeekCount(todos, "2025-10-21", "2025-10-28");
+            unsigned long jsonMicros = micros() - start;
+
+            out.printf("\"jsonUs\":%lu,\"jsonMatches\":%d}", jsonMicros, jsonMatches);
+        }
+
+        out.print("]}");
+    }
+
+    // Project resolution for matched tasks: per-task scan vs. grouped ids
+    // and one walk. Projects scale with tasks (1 per 10), so the scan is O(n^2).
+    static void runProjectLookup(Print& out) {
+        static const int sizes[] = {100, 1000, 5000};
+
+        out.print("{\"bench\":\"projectLookup\",\"results\":[");
+
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            int tasks = sizes[s];
+            int projectCount = tasks / 10;
+
+            JsonDocument doc;
+            JsonArray projects = doc.to<JsonArray>();
+            for (int p = 0; p < projectCount; p++) {
+                JsonObject project = projects.add<JsonObject>();
+                project["id"] = projectCount - p; // unsorted on purpose
+                project["name"] = "Project";
+                project["category"] = "Work";
+            }
+
+            // Old: scan the projects array for every task
+            unsigned long start = micros();
+            int found = 0;
+            for (int t = 0; t < tasks; t++) {
+                int projectId = t % projectCount + 1;
+                for (JsonObjectConst project : projects) {
+                    if ((project["id"] | -1) == projectId) {
+                        found++;
+                        break;
+                    }
+                }
+            }
+            unsigned long scanMicros = micros() - start;
+
+            // New: group task project ids, then one walk with binary search
+            start = micros();
+            std::vector<int> groupIds;
+            groupIds.reserve(tasks);
+            for (int t = 0; t < tasks; t++) {
+                groupIds.push_back(t % projectCount + 1);
+            }
+            std::sort(groupIds.begin(), groupIds.end());
+            groupIds.erase(std::unique(groupIds.begin(), groupIds.end()), groupIds.end());
+            int resolved = 0;
+            for (JsonObjectConst project : projects) {
+                int id = project["id"] | -1;
+                if (std::binary_search(groupIds.begin(), groupIds.end(), id)) {
+                    resolved++;
+                }
+            }
+            unsigned long groupedMicros = micros() - start;
+
+            if (s > 0) out.print(',');
+            out.printf("{\"tasks\":%d,\"projects\":%d,\"scanUs\":%lu,\"groupedUs\":%lu,"
+                       "\"scanFound\":%d,\"resolvedProjects\":%d}",
+                       tasks, projectCount, scanMicros, groupedMicros, found, resolved);
+        }
+
+        out.print("]}");
+    }
+
+    // On-flash format: JSON vs. MessagePack with interned keys, for one shard
+    // of n tasks. Sizes are what a shard file takes; parse times are a shard load.
+    static void runFormat(Print& out) {
+        static const int sizes[] = {50, 200, 500};
+        const DateCore::Day baseDay = DateCore::daysFromCivil(2025, 10, 21);
+
+        out.print("{\"bench\":\"format\",\"results\":[");
+
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            int n = sizes[s];
+            if (s > 0) out.print(',');
+
+            // Document + JSON text + MessagePack text + parsed copy
+            size_t estimate = (size_t)n * 400 * 3;
+            if (ESP.getMaxAllocHeap() < (size_t)n * 400 || ESP.getFreeHeap() < estimate) {
+                out.printf("{\"tasks\":%d,\"skipped\":\"heap\"}", n);
+                continue;
+            }
+
+            JsonDocument shardDoc;
+            JsonArray tasks = shardDoc.to<JsonArray>();
+            JsonDocument task;
+            for (int i = 0; i < n; i++) {
+                fillTask(task, i, baseDay);
+                task["description"] = "Synthetic task description";
+                task["type"] = "task";
+                JsonArray checklist = task["checklist"].to<JsonArray>();
+                JsonObject item = checklist.add<JsonObject>();
+                item["id"] = 1;
+                item["text"] = "Step";
+                item["completed"] = false;
+                task["dependencies"].to<JsonArray>();
+                tasks.add(task.as<JsonObjectConst>());
+            }
+
+            String json;
+            serializeJson(shardDoc, json);
+            String packed;
+            MsgPackCodec::write(packed, shardDoc);
+
+            JsonDocument parsed;
+            unsigned long start = micros();
+            bool jsonOk = !deserializeJson(parsed, json);
+            unsigned long jsonMicros = micros() - start;
+
+            start = micros();
+            bool packedOk = !MsgPackCodec::read(packed, parsed);
+            unsigned long packedMicros = micros() - start;
+
+            out.printf("{\"tasks\":%d,\"jsonBytes\":%u,\"msgpackBytes\":%u,"
+                       "\"jsonParseUs\":%lu,\"msgpackParseUs\":%lu,\"ok\":%s}",
+                       n, (unsigned)json.length(), (unsigned)packed.length(),
+                       jsonMicros, packedMicros, (jsonOk && packedOk) ? "true" : "false");
+        }
+
+        out.print("]}");
+    }
+
+    // File latency on the active backend, on a clean filesystem and after
+    // fragmenting it (many small files, every other one deleted).
+    // Flash each backend variant and compare the two result sets.
+    static void runStorage(Print& out, StorageBackend& fs) {
+        out.printf("{\"bench\":\"storage\",\"backend\":\"%s\",\"totalBytes\":%u,\"results\":[",
+                   fs.name(), (unsigned)fs.totalBytes());
+
+        removeBenchFiles(fs);
+        if (fs.totalBytes() - fs.usedBytes() < BENCH_MIN_FREE) {
+            out.print("],\"skipped\":\"space\"}");
+            return;
+        }
+
+        measureStorage(out, fs, "clean", 0);
+
+        uint8_t filler[FILLER_BLOCK];
+        memset(filler, 0xA5, sizeof(filler));
+        for (int i = 0; i < FILLER_FILES; i++) {
+            writeBlock(fs, benchPath("s", i), filler, FILLER_BLOCK);
+            yield();
+        }
+        for (int i = 0; i < FILLER_FILES; i += 2) {
+            fs.remove(benchPath("s", i));
+        }
+
+        out.print(',');
+        measureStorage(out, fs, "fragmented", FILLER_FILES / 2);
+
+        removeBenchFiles(fs);
+        out.print("]}");
+    }
+
+    // The managers end to end at 10 / 100 / 1,000 / 10,000 tasks: save,
+    // boot load, notification queries, backup export and import, plus the
+    // heap the loaded data keeps. Sizes that do not fit in the free flash
+    // or heap are skipped, so compare the same sizes across firmwares.
+    static void runManagers(Print& out, StorageBackend& fs, TimeManager* timeManager) {
+        static const int sizes[] = {10, 100, 1000, 10000};
+
+        out.printf("{\"bench\":\"managers\",\"backend\":\"%s\",\"results\":[", fs.name());
+
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            int n = sizes[s];
+            if (s > 0) out.print(',');
+
+            removeBenchFiles(fs);
+            if (fs.totalBytes() - fs.usedBytes() < (size_t)n * FLASH_PER_TASK + BENCH_MIN_FREE) {
+                out.printf("{\"tasks\":%d,\"skipped\":\"space\"}", n);
+                continue;
+            }
+            if (ESP.getFreeHeap() < (size_t)n * HEAP_PER_TASK + MANAGERS_MIN_HEAP) {
+                out.printf("{\"tasks\":%d,\"skipped\":\"heap\"}", n);
+                continue;
+            }
+            measureManagers(out, fs, timeManager, n);
+        }
+
+        removeBenchFiles(fs);
+        out.print("]}");
+    }
+};
+
+#endif
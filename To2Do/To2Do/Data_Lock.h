@@ -0,0 +1,53 @@
+#ifndef DATA_LOCK_H
+#define DATA_LOCK_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+/*
+ * DATA LOCK
+ * Kullanıcı verisine birden fazla FreeRTOS görevi dokunur:
+ *   async_tcp : HTTP route'ları, chunk'lı cevap parçaları, SSE bağlantısı
+ *   net       : ertelenen istekler (benchmark, yedek içe aktarma), SSE
+ *               olayları, yeni ağ ayarlarının alınması
+ *   ui        : OLED başlığı/dili ve görev sayaçları
+ *   storage   : write-behind flush (persistence.loop) ve tarihin kaydı
+ *   time      : gün değişimi kontrolü
+ * DataManager ve ona bağlı yöneticiler thread-safe değildir; her görev
+ * kullanıcı verisine dokunmadan önce bu kilidi alır (RAII).
+ *
+ *   { DataLock lock; dataManager->patchTask(...); }
+ *
+ * Recursive mutex: kilit tutulurken çağrılan kod tekrar alabilir.
+ * Uzun işler (benchmark, WiFi taraması) kilidi tutmamalı.
+ */
+
+class DataLock {
+public:
+    // Call once from setup(), before the web server starts
+    static void begin() {
+        if (!handle()) {
+            handle() = xSemaphoreCreateRecursiveMutex();
+        }
+    }
+
+    DataLock() {
+        xSemaphoreTakeRecursive(handle(), portMAX_DELAY);
+    }
+
+    ~DataLock() {
+        xSemaphoreGiveRecursive(handle());
+    }
+
+    DataLock(const DataLock&) = delete;
+    DataLock& operator=(const DataLock&) = delete;
+
+private:
+    static SemaphoreHandle_t& handle() {
+        static SemaphoreHandle_t mutex = nullptr;
+        return mutex;
+    }
+};
+
+#endif
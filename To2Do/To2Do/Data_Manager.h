@@ -1,255 +1,2163 @@
 #ifndef DATA_MANAGER_H
 #define DATA_MANAGER_H
 
-#include <SPIFFS.h>
 #include <ArduinoJson.h>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include "Task_Index.h"
+#include "Project_Index.h"
+#include "Search_Index.h"
+#include "Dependency_Graph.h"
+#include "Storage_Backend.h"
+#include "MsgPack_Codec.h"
 
 /*
  * UNIFIED DATA MANAGER
- * Tüm kullanıcı verileri tek bir JSON dosyasında (/userdata.json)
- * - Projects & Tasks (Projeler ve Todo'lar)
- * - GUI Settings (Tema, kategori isimleri, app başlığı)
- * - Network Settings (WiFi credentials - Primary & Backup)
+ * Dosya düzeni (layout 3):
+ * - /userdata.mp : GUI Settings, Network Settings, Projects (index)
+ * - /t/<projectId>.mp : O projenin görevleri (shard)
+ * - /userdata.log : Journal - her değişiklik küçük bir kayıt olarak eklenir (JSON satırları)
+ * 
+ * Snapshot ve shard'lar MessagePack + kısa anahtarlar (MsgPack_Codec.h).
+ * Layout 2 (aynı dosyalar, .json) ilk açılışta dönüştürülür.
+ * 
+ * RAM'de sadece çekirdek doküman ve tek bir shard (cache) tutulur; bellek
+ * kullanımı en büyük shard ile sınırlıdır. Görev id -> proje eşlemesi ve
+ * tarih/durum alanları TaskIndex içinde tutulur: id ile erişim tek shard
+ * yükler, tarih sorguları hiç shard yüklemez.
+ * 
+ * Write-behind: Değişiklik RAM'e uygulanır ve hemen onaylanır; kayıtlar
+ * FLUSH_IDLE_MS boşta kalınca ya da FLUSH_MAX_RECORDS/BYTES dolunca tek
+ * seferde log'a eklenir. Yazma başarısız olursa kayıtlar kuyrukta kalır ve
+ * tick() tekrar dener. Elektrik kesintisinde en fazla son ~1.5 sn kaybolur;
+ * yarım kalan son kayıt açılışta yok sayılır.
+ * 
+ * Journal: Log JOURNAL_COMPACT_THRESHOLD boyutunu geçince kayıtlar shard'lara
+ * ve snapshot'a katlanır (compaction). Açılışta snapshot + log uygulanır.
+ * Eski düzendeki (layout 1) "tasks" dizisi ilk açılışta shard'lara bölünür.
  * 
  * Factory Reset: Tüm kullanıcı verilerini siler, demo içeriği yükler
  */
 
+// Save cost counters - exposed through /api/system/info
+struct StorageStats {
+    uint32_t journalAppends = 0;     // committed changes (acknowledged saves)
+    uint32_t journalRecords = 0;     // records queued for the log
+    uint32_t flushes = 0;            // physical log appends
+    uint32_t coalescedSaves = 0;     // saves that shared a flush/compaction with another
+    uint32_t compactions = 0;        // snapshot + shard rewrites
+    uint32_t bytesWritten = 0;       // total bytes written to flash
+    uint32_t lastSaveBytes = 0;      // bytes written by the last save
+    uint32_t lastSaveMicros = 0;     // duration of the last save
+    uint32_t maxSaveMicros = 0;      // slowest save since boot
+    uint32_t lastCompactionBytes = 0; // bytes written by the last compaction
+    uint32_t snapshotBytes = 0;      // size of the snapshot file at boot
+    uint32_t loadMicros = 0;         // boot load: snapshot + journal replay + index
+    uint32_t legacyJsonBytes = 0;    // JSON snapshot + shards before the MessagePack migration
+    uint32_t migratedBytes = 0;      // the same data after it
+};
+
+// Factory values: written by resetToDefaults() and used wherever a settings
+// or network field is missing or empty
+namespace SettingsDefaults {
+const char* const APP_TITLE = "To2Do-SmartKraft";
+const char* const LANGUAGE = "EN";
+const char* const THEME = "dark";
+const char* const CATEGORY1 = "WORK";
+const char* const CATEGORY2 = "PERSONAL";
+const char* const CATEGORY3 = "PROJECTS";
+const char* const AP_SSID = "SmartKraft-To2Do";
+const char* const AP_MDNS = "to2do";
+const char* const PRIMARY_MDNS = "smartkraft-to2do";
+const char* const BACKUP_MDNS = "smartkraft-to2do-backup";
+}
+
+// Typed copies of userData["settings"] / ["network"], refreshed on every merge.
+// Firmware code reads these instead of parsing the JSON.
+struct Settings {
+    String appTitle;
+    String language;
+    String theme;
+    String category1;
+    String category2;
+    String category3;
+    
+    bool operator==(const Settings& o) const {
+        return appTitle == o.appTitle && language == o.language && theme == o.theme &&
+               category1 == o.category1 && category2 == o.category2 && category3 == o.category3;
+    }
+    bool operator!=(const Settings& o) const { return !(*this == o); }
+};
+
+struct NetworkSettings {
+    String apSSID;
+    String apMDNS;
+    String primarySSID;
+    String primaryPassword;
+    String primaryIP;
+    String primaryMDNS;
+    String backupSSID;
+    String backupPassword;
+    String backupIP;
+    String backupMDNS;
+    
+    bool operator==(const NetworkSettings& o) const {
+        return apSSID == o.apSSID && apMDNS == o.apMDNS &&
+               primarySSID == o.primarySSID && primaryPassword == o.primaryPassword &&
+               primaryIP == o.primaryIP && primaryMDNS == o.primaryMDNS &&
+               backupSSID == o.backupSSID && backupPassword == o.backupPassword &&
+               backupIP == o.backupIP && backupMDNS == o.backupMDNS;
+    }
+    bool operator!=(const NetworkSettings& o) const { return !(*this == o); }
+};
+
+// One committed batch as seen by push clients (/api/events). Only task and
+// project records are carried - merges may contain WiFi passwords.
+struct ChangeSet {
+    uint32_t revision;
+    String records;   // JSON array of journal records, empty when truncated
+    bool truncated;   // too large to push - clients reload instead
+    bool settings;    // batch merged into settings
+    bool network;     // batch merged into network
+};
+
+// Result of a single-entity mutation (mapped to HTTP status by the API layer)
+enum MutationStatus {
+    MUTATION_OK,
+    MUTATION_NOT_FOUND,
+    MUTATION_INVALID,
+    MUTATION_CYCLE,     // the dependencies would make a task wait on itself
+    MUTATION_FAILED
+};
+
 class DataManager {
 private:
-    const char* DATA_FILE = "/userdata.json";
-    const size_t JSON_CAPACITY = 24576; // 24KB buffer (reduced from 32KB)
+    const String ROOT;                // "/" for the user's data, benchmarks use their own directory
+    const String DATA_FILE;           // <root>userdata.mp
+    const String LEGACY_DATA_FILE;    // <root>userdata.json - layout 1/2, JSON
+    const String JOURNAL_FILE;        // <root>userdata.log
+    const String SHARD_PREFIX;        // <root>t/
+    const String SWAP_FILE;           // <root>userdata.swp - replaceAll's staged files are complete
+    const size_t JOURNAL_COMPACT_THRESHOLD = 8192; // Fold log into shards/snapshot after 8KB
+    const unsigned long FLUSH_IDLE_MS = 1500;      // Flush queued records after this much quiet
+    const uint32_t FLUSH_MAX_RECORDS = 32;         // ...or as soon as this many are queued
+    const size_t FLUSH_MAX_BYTES = 4096;           // ...or this many bytes
+    const size_t CHANGE_PUSH_MAX_BYTES = 2048;     // bigger batches are announced without records
+    
+    JsonDocument userData;            // settings, network, projects
+    JsonDocument shard;               // tasks of shardProject (single-entry cache)
+    int shardProject = -1;
+    std::vector<int> pendingShards;   // projects with task records not yet folded into their shard
+    TaskIndex taskIndex;              // id -> project, due dates, flags
+    ProjectIndex projectIndex;        // id -> position in userData["projects"]
+    SearchIndex searchIndex;          // token -> tasks / projects
+    DependencyGraph dependencyGraph;  // task <-> dependencies, blocked tasks
+    
+    String pendingLog;                // acknowledged records not yet on flash (JSON lines)
+    uint32_t pendingRecords = 0;
+    uint32_t pendingSaves = 0;
+    unsigned long lastCommitMillis = 0;
+    bool journalTorn = false;         // a short write left half a record - only a compaction may follow
+    uint32_t batchRecords = 0;
+    size_t batchBytes = 0;
+    ChangeSet batchChanges;           // what the open batch touched, handed to changeListeners
+    
+    Settings settingsCache;
+    NetworkSettings networkCache;
+    std::vector<std::function<void(const Settings&)>> settingsListeners;
+    std::vector<std::function<void(const NetworkSettings&)>> networkListeners;
+    std::vector<std::function<void(const ChangeSet&)>> changeListeners;
+    
+    StorageStats stats;
+    uint32_t revision = 0; // Bumped on every committed change
+    uint32_t bootId = 0;   // Random per boot - revisions restart at 0 after a reset
+    bool migratingFormat = false; // layout 2 JSON files not converted yet - loadShard falls back to them
+    
+public:
+    // Largest task id a client may propose; keeps nextTaskId (= id + 1) in range
+    static constexpr int MAX_TASK_ID = 1000000000;
+    
+    explicit DataManager(const char* root = "/")
+        : ROOT(root),
+          DATA_FILE(ROOT + "userdata.mp"),
+          LEGACY_DATA_FILE(ROOT + "userdata.json"),
+          JOURNAL_FILE(ROOT + "userdata.log"),
+          SHARD_PREFIX(ROOT + "t/"),
+          SWAP_FILE(ROOT + "userdata.swp") {
+        // Initialize empty structure
+        resetToDefaults();
+    }
+    
+    // ==================== INITIALIZATION ====================
+    
+    bool begin() {
+        if (!storage().begin(true)) {
+            return false;
+        }
+        
+        bootId = esp_random();
+        recoverTempFiles();
+        recoverStagedFiles();
+        
+        if (storage().exists(DATA_FILE) || storage().exists(LEGACY_DATA_FILE)) {
+            if (loadFromFile()) {
+                return true;
+            }
+        }
+        
+        resetToDefaults();
+        saveToFile();
+        
+        return true;
+    }
+    
+    // ==================== CORE PERSISTENCE ====================
+    
+    // Load snapshot, replay the journal, then build the task id lookup from the shards.
+    // A JSON snapshot (layout 1/2) is converted to MessagePack on the way.
+    bool loadFromFile() {
+        unsigned long start = micros();
+        bool legacyFormat = !storage().exists(DATA_FILE);
+        
+        File file = storage().open(legacyFormat ? LEGACY_DATA_FILE : DATA_FILE, "r");
+        if (!file) {
+            return false;
+        }
+        
+        stats.snapshotBytes = file.size();
+        DeserializationError error = legacyFormat ? deserializeJson(userData, file)
+                                                  : MsgPackCodec::read(file, userData);
+        file.close();
+        
+        if (error) {
+            Serial.printf("[Data] Snapshot read failed: %s\n", error.c_str());
+            return false;
+        }
+        
+        shard.clear();
+        shardProject = -1;
+        pendingShards.clear();
+        migratingFormat = legacyFormat;
+        rebuildProjectIndex();
+        refreshSettingsCache();
+        
+        bool hadJournal = replayJournal();
+        bool legacyLayout = userData["tasks"].is<JsonArray>();
+        
+        if (legacyFormat) {
+            migrateToMsgPack();
+        } else if (hadJournal || legacyLayout) {
+            if (legacyLayout) {
+                Serial.println("[Data] Migrating tasks to per-project shards...");
+            }
+            saveToFile();
+        }
+        
+        rebuildTaskIndex();
+        stats.loadMicros = micros() - start;
+        Serial.printf("[Data] Loaded %u projects, %u tasks (%u B snapshot, %lu us)\n",
+                      (unsigned)userData["projects"].size(), (unsigned)taskIndex.size(),
+                      (unsigned)stats.snapshotBytes, (unsigned long)stats.loadMicros);
+        return true;
+    }
+    
+    // Compaction: fold pending task records into their shards, rewrite the
+    // snapshot (temp file + rename) and clear the journal
+    bool saveToFile() {
+        unsigned long start = micros();
+        size_t bytesWritten = 0;
+        
+        if (migrateLegacyTasks(bytesWritten)) {
+            rebuildTaskIndex();
+        }
+        
+        // Until a MessagePack snapshot exists every shard still has to be converted
+        if (migratingFormat) {
+            for (JsonObjectConst project : userData["projects"].as<JsonArrayConst>()) {
+                markPending(project["id"] | -1);
+            }
+        }
+        
+        // loadShard replays the journal for pending projects, so clear the set only afterwards
+        for (int projectId : pendingShards) {
+            loadShard(projectId);
+            bytesWritten += writeShard(projectId);
+        }
+        pendingShards.clear();
+        
+        size_t snapshotBytes = writeAtomically(DATA_FILE.c_str(), userData);
+        if (snapshotBytes == 0) {
+            return false;
+        }
+        bytesWritten += snapshotBytes;
+        storage().remove(JOURNAL_FILE);
+        
+        if (migratingFormat) {
+            removeLegacyFiles();
+            migratingFormat = false;
+        }
+        
+        // Queued records are part of the snapshot/shards now
+        if (pendingSaves > 1) {
+            stats.coalescedSaves += pendingSaves - 1;
+        }
+        clearPending();
+        
+        stats.compactions++;
+        stats.lastCompactionBytes = bytesWritten;
+        recordSave(bytesWritten, micros() - start);
+        return true;
+    }
+    
+    const StorageStats& getStorageStats() const {
+        return stats;
+    }
+    
+    size_t getJournalSize() {
+        File file = storage().open(JOURNAL_FILE, "r");
+        if (!file) return 0;
+        size_t size = file.size();
+        file.close();
+        return size;
+    }
+    
+    // ==================== DATA ACCESS ====================
+    
+    // Get projects array as JSON string
+    String getProjects() {
+        String output;
+        JsonArray projects = userData["projects"];
+        serializeJson(projects, output);
+        return output;
+    }
+    
+    size_t getTaskCount() const {
+        return taskIndex.size();
+    }
+    
+    // Kept in sync with every task mutation
+    const TaskIndex& getTaskIndex() const {
+        return taskIndex;
+    }
+    
+    JsonArrayConst getProjectList() {
+        return userData["projects"].as<JsonArrayConst>();
+    }
+    
+    bool hasProject(int projectId) const {
+        return projectIndex.find(projectId) >= 0;
+    }
+    
+    // Index hit is O(log P); element access still walks the array slots,
+    // so callers resolving many projects should walk getProjectList() once
+    JsonObjectConst findProject(int projectId) {
+        int position = projectIndex.find(projectId);
+        if (position < 0) {
+            return JsonObjectConst();
+        }
+        return userData["projects"][position].as<JsonObjectConst>();
+    }
+    
+    // Loads the owning shard; the result is valid until another shard is loaded
+    JsonObjectConst getTask(int taskId) {
+        int pos = taskIndex.find(taskId);
+        if (pos < 0) {
+            return JsonObjectConst();
+        }
+        loadShard(taskIndex.projectId(pos));
+        int index = findById(shard.as<JsonArray>(), taskId);
+        return index >= 0 ? shard[index].as<JsonObjectConst>() : JsonObjectConst();
+    }
+    
+    // Update projects and tasks (bulk)
+    // Validated like the entity API first - nothing is journaled if any
+    // task fails. Only records that differ from the current state are journaled.
+    MutationStatus setTodosData(const String& jsonString) {
+        JsonDocument doc;
+        DeserializationError error = deserializeJson(doc, jsonString);
+        
+        if (error) {
+            return MUTATION_INVALID;
+        }
+        
+        if (!doc["projects"].is<JsonArray>() || !doc["tasks"].is<JsonArray>()) {
+            return MUTATION_INVALID;
+        }
+        
+        MutationStatus valid = checkTodos(doc["projects"].as<JsonArrayConst>(), doc["tasks"].as<JsonArrayConst>());
+        if (valid != MUTATION_OK) {
+            Serial.printf("[Data] Bulk update rejected (%s)\n", valid == MUTATION_CYCLE ? "dependency cycle" : "invalid data");
+            return valid;
+        }
+        
+        beginBatch();
+        
+        diffProjects(doc["projects"].as<JsonArray>());
+        diffTasks(doc["tasks"].as<JsonArray>());
+        
+        commitBatch();
+        return MUTATION_OK;
+    }
+    
+    // Replace everything except the network settings (backup import).
+    // fill(projectId, tasks) adds that project's tasks; each shard goes straight
+    // to flash, so memory stays at one shard (plus a copy of the snapshot)
+    // whatever the size of the backup. Everything is staged as <file>.new
+    // first; the old data and journal stay untouched until all of it is
+    // written. SWAP_FILE then marks the staged set complete and finishSwap()
+    // renames it into place - after a power cut begin() finishes the swap if
+    // the marker exists and drops the staged files otherwise.
+    bool replaceAll(JsonArrayConst projects, JsonObjectConst settings,
+                    std::function<bool(int, JsonArray)> fill) {
+        unsigned long start = micros();
+        size_t bytesWritten = 0;
+        
+        Settings oldSettings = settingsCache;
+        NetworkSettings oldNetwork = networkCache;
+        
+        JsonDocument snapshot = userData;
+        snapshot.remove("tasks");
+        snapshot["projects"] = projects;
+        JsonObject target = snapshot["settings"].as<JsonObject>();
+        if (target.isNull()) {
+            target = snapshot["settings"].to<JsonObject>();
+        }
+        for (JsonPairConst kv : settings) {
+            target[kv.key()] = kv.value();
+        }
+        
+        // The cached shard is reused as the fill buffer
+        bool staged = true;
+        for (JsonObjectConst project : projects) {
+            int projectId = project["id"] | -1;
+            shard.clear();
+            shardProject = -1;
+            if (!fill(projectId, shard.to<JsonArray>())) {
+                staged = false;
+                break;
+            }
+            if (shard.as<JsonArray>().size() == 0) {
+                continue;  // no staged file: finishSwap removes the old shard
+            }
+            size_t shardBytes = writeStaged(shardPath(projectId), shard);
+            if (shardBytes == 0) {
+                staged = false;
+                break;
+            }
+            bytesWritten += shardBytes;
+        }
+        shard.clear();
+        
+        size_t snapshotBytes = staged ? writeStaged(DATA_FILE, snapshot) : 0;
+        File marker;
+        if (snapshotBytes > 0) {
+            marker = storage().open(SWAP_FILE, "w");
+        }
+        if (!marker || marker.print(revision) == 0) {
+            if (marker) marker.close();
+            storage().remove(SWAP_FILE);
+            removeStagedFiles();
+            Serial.println("[Data] Replace failed - old data kept");
+            return false;
+        }
+        marker.close();
+        bytesWritten += snapshotBytes;
+        
+        // Committed: the journal's records belong to the old data
+        clearPending();
+        pendingShards.clear();
+        finishSwap();
+        migratingFormat = false;
+        
+        userData = snapshot;
+        rebuildProjectIndex();
+        refreshSettingsCache();
+        rebuildTaskIndex();
+        
+        revision++;
+        stats.compactions++;
+        stats.lastCompactionBytes = bytesWritten;
+        recordSave(bytesWritten, micros() - start);
+        
+        notifyChangeListeners(ChangeSet{revision, String(), true, settingsCache != oldSettings, false});
+        notifySettingsListeners(oldSettings, oldNetwork);
+        return true;
+    }
+    
+    // ==================== SEARCH ====================
+    
+    // Ranked matches for a free-text query over task title / description /
+    // checklist and project names; every query token must prefix-match.
+    // The index narrows the candidates, the text of each candidate decides
+    // (SearchIndex::scoreTask). Each involved shard is loaded once.
+    // scan: skip the index and score every document, as after an overflow -
+    // the result must be the same (host tests compare the two).
+    // {"query","count","indexed","tasks":[{id,projectId,title,score}],"projects":[{id,name,score}]}
+    String search(const char* query, size_t limit, bool scan = false) {
+        std::vector<String> tokens = SearchIndex::queryTokens(query);
+        std::vector<SearchHit> taskHits;
+        std::vector<SearchHit> projectHits;
+        bool indexed = !scan && searchIndex.isAvailable();
+        
+        if (!tokens.empty()) {
+            std::vector<uint32_t> refs = searchCandidates(tokens, indexed);
+            
+            for (uint32_t ref : refs) {
+                if (!SearchIndex::isProject(ref)) {
+                    int pos = taskIndex.find(SearchIndex::refId(ref));
+                    if (pos >= 0) {
+                        taskHits.push_back(SearchHit{0, taskIndex.id(pos), taskIndex.projectId(pos)});
+                    }
+                    continue;
+                }
+                int projectId = SearchIndex::refId(ref);
+                int score = SearchIndex::scoreProject(findProject(projectId), tokens);
+                if (score > 0) {
+                    projectHits.push_back(SearchHit{score, projectId, projectId});
+                }
+            }
+            
+            // Grouped by project so each shard is loaded once
+            std::sort(taskHits.begin(), taskHits.end(), [](const SearchHit& a, const SearchHit& b) {
+                return a.projectId != b.projectId ? a.projectId < b.projectId : a.id < b.id;
+            });
+            for (SearchHit& hit : taskHits) {
+                loadShard(hit.projectId);
+                int index = findById(shard.as<JsonArray>(), hit.id);
+                if (index >= 0) {
+                    hit.score = SearchIndex::scoreTask(shard[index].as<JsonObjectConst>(), tokens);
+                }
+            }
+            taskHits.erase(std::remove_if(taskHits.begin(), taskHits.end(),
+                                          [](const SearchHit& hit) { return hit.score <= 0; }),
+                           taskHits.end());
+        }
+        
+        size_t count = taskHits.size() + projectHits.size();
+        rankHits(taskHits, limit);
+        rankHits(projectHits, limit);
+        
+        // Titles of the ranked tasks, again one shard load per project
+        std::vector<size_t> order(taskHits.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return taskHits[a].projectId < taskHits[b].projectId;
+        });
+        std::vector<String> titles(taskHits.size());
+        for (size_t i : order) {
+            loadShard(taskHits[i].projectId);
+            int index = findById(shard.as<JsonArray>(), taskHits[i].id);
+            if (index >= 0) {
+                titles[i] = shard[index]["title"] | "";
+            }
+        }
+        
+        JsonDocument result;
+        result["query"] = query;
+        result["count"] = count;
+        result["indexed"] = indexed;
+        JsonArray taskList = result["tasks"].to<JsonArray>();
+        for (size_t i = 0; i < taskHits.size(); i++) {
+            JsonObject item = taskList.add<JsonObject>();
+            item["id"] = taskHits[i].id;
+            item["projectId"] = taskHits[i].projectId;
+            item["title"] = titles[i];
+            item["score"] = taskHits[i].score;
+        }
+        JsonArray projectList = result["projects"].to<JsonArray>();
+        for (const SearchHit& hit : projectHits) {
+            JsonObject item = projectList.add<JsonObject>();
+            item["id"] = hit.id;
+            item["name"] = findProject(hit.id)["name"];
+            item["score"] = hit.score;
+        }
+        
+        String output;
+        serializeJson(result, output);
+        return output;
+    }
+    
+    size_t getSearchIndexMemory() const {
+        return searchIndex.memoryUsage();
+    }
+    
+    // ==================== DEPENDENCIES ====================
+    
+    // Kept in sync with every task mutation, like the task index
+    const DependencyGraph& getDependencyGraph() const {
+        return dependencyGraph;
+    }
+    
+    // Tasks of one project in dependency order, the longest chain of open
+    // tasks and the blocked ones; read from the graph, no shard is loaded.
+    // {"projectId","order":[ids],"criticalPath":[ids],"blocked":[ids]}
+    size_t writeDependencyView(Print& out, int projectId) {
+        std::vector<int> ids;
+        for (size_t i = 0; i < taskIndex.size(); i++) {
+            if (taskIndex.projectId(i) == projectId) ids.push_back(taskIndex.id(i));
+        }
+        DependencyGraph::View view = dependencyGraph.view(ids, taskIndex);
+        
+        auto writeIds = [&](const std::vector<int>& list) {
+            size_t n = out.print('[');
+            for (size_t i = 0; i < list.size(); i++) {
+                if (i > 0) n += out.print(',');
+                n += out.print(list[i]);
+            }
+            return n + out.print(']');
+        };
+        std::vector<int> blocked;
+        for (int id : ids) {
+            if (dependencyGraph.isBlocked(id)) blocked.push_back(id);
+        }
+        
+        size_t n = out.print("{\"projectId\":");
+        n += out.print(projectId);
+        n += out.print(",\"order\":");
+        n += writeIds(view.order);
+        n += out.print(",\"criticalPath\":");
+        n += writeIds(view.criticalPath);
+        n += out.print(",\"blocked\":");
+        n += writeIds(blocked);
+        n += out.print('}');
+        return n;
+    }
+    
+    // ==================== STREAMING ACCESS ====================
+    // Serialize straight from the live documents - no intermediate copies
+    
+    size_t writeProjects(Print& out) {
+        return serializeJson(userData["projects"], out);
+    }
+    
+    // Tasks of all projects as one array, loading one shard at a time
+    size_t writeTasks(Print& out) {
+        size_t n = out.print('[');
+        bool first = true;
+        size_t projectCount = userData["projects"].size();
+        for (size_t i = 0; i < projectCount; i++) {
+            n += writeShardTasks(out, i, first);
+        }
+        n += out.print(']');
+        return n;
+    }
+    
+    // Tasks of the project at position index of the project list, as array
+    // items; first: no item written yet (no leading comma)
+    size_t writeShardTasks(Print& out, size_t index, bool& first) {
+        JsonObjectConst project = userData["projects"][index];
+        if (project.isNull()) {
+            return 0;
+        }
+        loadShard(project["id"] | -1);
+        size_t n = 0;
+        for (JsonObjectConst task : shard.as<JsonArrayConst>()) {
+            if (!first) n += out.print(',');
+            first = false;
+            n += serializeJson(task, out);
+        }
+        return n;
+    }
+    
+    size_t writeTodos(Print& out) {
+        size_t n = out.print("{\"projects\":");
+        n += writeProjects(out);
+        n += out.print(",\"tasks\":");
+        n += writeTasks(out);
+        n += out.print('}');
+        return n;
+    }
+    
+    // writeTodos in parts for a chunked response, at most one shard each:
+    // 0 = projects, 1..N = tasks of the N projects, N+1 = closing brackets.
+    // Call under DataLock per part; false past the last part.
+    bool writeTodosPart(Print& out, size_t part, bool& first) {
+        size_t projectCount = userData["projects"].size();
+        if (part == 0) {
+            out.print("{\"projects\":");
+            writeProjects(out);
+            out.print(",\"tasks\":[");
+        } else if (part <= projectCount) {
+            writeShardTasks(out, part - 1, first);
+        } else if (part == projectCount + 1) {
+            out.print("]}");
+        } else {
+            return false;
+        }
+        return true;
+    }
+    
+    // ==================== PAGED QUERIES ====================
+    // One screen of the UI at a time: the payload depends on the page size,
+    // not on how many tasks the archive holds. Filtering and counting run on
+    // the task index; only the shard of the requested project is read.
+    
+    // {"projects":[{...,"taskCount","openCount"}],"totals":{"projects","tasks","open"},
+    //  "nextProjectId","nextTaskId"}
+    // category nullptr: every project
+    size_t writeProjectPage(Print& out, const char* category) {
+        JsonArrayConst projects = userData["projects"].as<JsonArrayConst>();
+        std::vector<uint32_t> taskCounts(projects.size(), 0);
+        std::vector<uint32_t> openCounts(projects.size(), 0);
+        size_t openTasks = 0;
+        for (size_t i = 0; i < taskIndex.size(); i++) {
+            bool open = !taskIndex.isCompleted(i);
+            openTasks += open;
+            int position = projectIndex.find(taskIndex.projectId(i));
+            if (position >= 0) {
+                taskCounts[position]++;
+                openCounts[position] += open;
+            }
+        }
+        
+        size_t n = out.print("{\"projects\":[");
+        size_t position = 0;
+        size_t activeProjects = 0;
+        int maxProjectId = 0;
+        bool first = true;
+        for (JsonObjectConst project : projects) {
+            if (!(project["archived"] | false)) activeProjects++;
+            maxProjectId = std::max(maxProjectId, project["id"] | 0);
+            if (!category || strcmp(category, project["category"] | "") == 0) {
+                JsonDocument item;
+                item.set(project);
+                item["taskCount"] = taskCounts[position];
+                item["openCount"] = openCounts[position];
+                if (!first) n += out.print(',');
+                first = false;
+                n += serializeJson(item, out);
+            }
+            position++;
+        }
+        n += out.print("],\"totals\":{\"projects\":");
+        n += out.print((unsigned)activeProjects);
+        n += out.print(",\"tasks\":");
+        n += out.print((unsigned)taskIndex.size());
+        n += out.print(",\"open\":");
+        n += out.print((unsigned)openTasks);
+        n += out.print("},\"nextProjectId\":");
+        n += out.print(maxProjectId + 1);
+        n += out.print(",\"nextTaskId\":");
+        n += out.print(nextTaskId());
+        n += out.print('}');
+        return n;
+    }
+    
+    // Tasks of one project in id order, starting after task id `cursor` (0: first page).
+    // {"tasks":[...],"next":<cursor of the following page, or null>}
+    size_t writeTaskPage(Print& out, int projectId, int cursor, size_t limit) {
+        std::vector<int> ids;
+        bool more = false;
+        for (size_t i = 0; i < taskIndex.size(); i++) {
+            if (taskIndex.projectId(i) != projectId || taskIndex.id(i) <= cursor) continue;
+            if (ids.size() == limit) {
+                more = true;
+                break;
+            }
+            ids.push_back(taskIndex.id(i));
+        }
+        
+        // One walk over the shard puts the page back in id order
+        std::vector<JsonObjectConst> page(ids.size());
+        if (!ids.empty()) {
+            loadShard(projectId);
+            for (JsonObjectConst task : shard.as<JsonArrayConst>()) {
+                auto it = std::lower_bound(ids.begin(), ids.end(), task["id"] | -1);
+                if (it != ids.end() && *it == (task["id"] | -1)) {
+                    page[it - ids.begin()] = task;
+                }
+            }
+        }
+        
+        size_t n = out.print("{\"tasks\":[");
+        for (size_t i = 0; i < page.size(); i++) {
+            if (i > 0) n += out.print(',');
+            n += serializeJson(page[i], out);
+        }
+        n += out.print("],\"next\":");
+        if (more) {
+            n += out.print(ids.back());
+        } else {
+            n += out.print("null");
+        }
+        n += out.print('}');
+        return n;
+    }
+    
+    // Task occurrences dated in [fromDay, toDay], ordered by (date, id); a
+    // recurring task comes once per occurrence. Starts after (afterDay, afterId),
+    // the cursor "<epoch day>:<id>" of the previous page.
+    // {"items":[{"date","completed","task":{...}}],"next":"<cursor>" or null}
+    size_t writeDuePage(Print& out, DateCore::Day fromDay, DateCore::Day toDay,
+                        DateCore::Day afterDay, int afterId, size_t limit) {
+        std::vector<DueItem> items;
+        taskIndex.forEachDue(fromDay, toDay, false, [&](size_t pos, DateCore::Day day, bool completed) {
+            int id = taskIndex.id(pos);
+            if (day > afterDay || (day == afterDay && id > afterId)) {
+                items.push_back(DueItem{day, id, taskIndex.projectId(pos), completed});
+            }
+        });
+        
+        bool more = items.size() > limit;
+        size_t count = std::min(items.size(), limit);
+        std::partial_sort(items.begin(), items.begin() + count, items.end());
+        items.resize(count);
+        
+        // Serialized grouped by project (one shard load each), written in date order
+        std::vector<size_t> order(count);
+        for (size_t i = 0; i < count; i++) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return items[a].projectId < items[b].projectId;
+        });
+        std::vector<String> bodies(count);
+        for (size_t i : order) {
+            loadShard(items[i].projectId);
+            int index = findById(shard.as<JsonArray>(), items[i].id);
+            if (index >= 0) {
+                serializeJson(shard[index], bodies[i]);
+            }
+        }
+        
+        size_t n = out.print("{\"items\":[");
+        char date[11];
+        for (size_t i = 0; i < count; i++) {
+            if (i > 0) n += out.print(',');
+            DateCore::formatDate(items[i].day, date);
+            n += out.print("{\"date\":\"");
+            n += out.print(date);
+            n += out.print(items[i].completed ? "\",\"completed\":true,\"task\":" : "\",\"completed\":false,\"task\":");
+            n += out.print(bodies[i].length() > 0 ? bodies[i] : String("null"));
+            n += out.print('}');
+        }
+        n += out.print("],\"next\":");
+        if (more) {
+            n += out.print('"');
+            n += out.print(items.back().day);
+            n += out.print(':');
+            n += out.print(items.back().id);
+            n += out.print('"');
+        } else {
+            n += out.print("null");
+        }
+        n += out.print('}');
+        return n;
+    }
+    
+    size_t writeSettings(Print& out) {
+        return serializeJson(userData["settings"], out);
+    }
+    
+    size_t writeNetworkSettings(Print& out) {
+        return serializeJson(userData["network"], out);
+    }
+    
+    // Get GUI settings as JSON string
+    String getSettings() {
+        String output;
+        JsonObject settings = userData["settings"];
+        serializeJson(settings, output);
+        return output;
+    }
+    
+    // Update GUI settings
+    bool setSettings(const String& jsonString) {
+        return mergeObject("settings", jsonString);
+    }
+    
+    // Get network settings as JSON string
+    String getNetworkSettings() {
+        String output;
+        JsonObject network = userData["network"];
+        serializeJson(network, output);
+        return output;
+    }
+    
+    // Update network settings
+    bool setNetworkSettings(const String& jsonString) {
+        return mergeObject("network", jsonString);
+    }
+    
+    const Settings& getCachedSettings() const {
+        return settingsCache;
+    }
+    
+    const NetworkSettings& getCachedNetworkSettings() const {
+        return networkCache;
+    }
+    
+    // Called after a committed change that actually altered a value
+    void onSettingsChanged(std::function<void(const Settings&)> listener) {
+        settingsListeners.push_back(listener);
+    }
+    
+    void onNetworkSettingsChanged(std::function<void(const NetworkSettings&)> listener) {
+        networkListeners.push_back(listener);
+    }
+    
+    // Called after every committed batch and after a factory reset (truncated).
+    // Runs in the mutating context - listeners should only queue work.
+    void onChange(std::function<void(const ChangeSet&)> listener) {
+        changeListeners.push_back(listener);
+    }
+    
+    // ==================== ENTITY MUTATIONS ====================
+    // Each call touches only the affected record(s) and bumps the revision
+    
+    uint32_t getRevision() const {
+        return revision;
+    }
+    
+    // Weak validator for conditional GETs; changes with every committed mutation
+    String getETag(int32_t extra) const {
+        char tag[40];
+        snprintf(tag, sizeof(tag), "W/\"%08lx-%lu-%ld\"",
+                 (unsigned long)bootId, (unsigned long)revision, (long)extra);
+        return String(tag);
+    }
+    
+    MutationStatus createTask(JsonObject task, int& newId) {
+        if (task.isNull() || !task["title"].is<const char*>()) {
+            return MUTATION_INVALID;
+        }
+        if (!hasProject(task["projectId"] | -1) || !Recurrence::isValidTask(task)) {
+            return MUTATION_INVALID;
+        }
+        
+        // A client-proposed id is kept only if it was never handed out
+        int id = task["id"] | 0;
+        if (id > MAX_TASK_ID) {
+            return MUTATION_INVALID;
+        }
+        if (id < nextTaskId() || taskIndex.find(id) >= 0) {
+            id = nextTaskId();
+            if (id > MAX_TASK_ID) {
+                return MUTATION_FAILED; // every id up to the limit is taken
+            }
+        }
+        task["id"] = id;
+        if (task["checklist"].isNull()) task["checklist"].to<JsonArray>();
+        if (task["dependencies"].isNull()) task["dependencies"].to<JsonArray>();
+        
+        MutationStatus dependencies = checkDependencies(id, task);
+        if (dependencies != MUTATION_OK) {
+            return dependencies;
+        }
+        
+        beginBatch();
+        journalTaskPut(task);
+        newId = id;
+        commitBatch();
+        return MUTATION_OK;
+    }
+    
+    // Overlay fields on a copy of the stored task; the id is never patched.
+    // Changing projectId moves the task to the other shard.
+    // {"occurrence":"YYYY-MM-DD","completed":bool} marks a single occurrence
+    // of a recurring task instead; a new "repeat" keeps the completed ones.
+    MutationStatus patchTask(int id, JsonObjectConst fields) {
+        JsonObjectConst stored = getTask(id);
+        if (stored.isNull()) {
+            return MUTATION_NOT_FOUND;
+        }
+        
+        int oldProjectId = stored["projectId"] | -1;
+        JsonDocument task;
+        task.set(stored);
+        
+        if (!fields["occurrence"].isNull()) {
+            DateCore::Day day = DateCore::parseDate(fields["occurrence"].as<const char*>());
+            if (!Recurrence::setDone(task.as<JsonObject>(), day, fields["completed"] | true)) {
+                return MUTATION_INVALID;
+            }
+            beginBatch();
+            journalTaskPut(task.as<JsonObjectConst>());
+            commitBatch();
+            return MUTATION_OK;
+        }
+        
+        overlayFields(task.as<JsonObject>(), fields);
+        if (fields["repeat"].is<JsonObjectConst>() && fields["repeat"]["done"].isNull() &&
+            !stored["repeat"]["done"].isNull()) {
+            task["repeat"]["done"] = stored["repeat"]["done"];
+        }
+        
+        int newProjectId = task["projectId"] | -1;
+        if (newProjectId != oldProjectId && !hasProject(newProjectId)) {
+            return MUTATION_INVALID;
+        }
+        if (!Recurrence::isValidTask(task.as<JsonObjectConst>())) {
+            return MUTATION_INVALID;
+        }
+        if (!fields["dependencies"].isNull()) {
+            MutationStatus dependencies = checkDependencies(id, task.as<JsonObjectConst>());
+            if (dependencies != MUTATION_OK) {
+                return dependencies;
+            }
+        }
+        
+        beginBatch();
+        if (newProjectId != oldProjectId) {
+            journalTaskDel(oldProjectId, id);
+        }
+        journalTaskPut(task.as<JsonObjectConst>());
+        commitBatch();
+        return MUTATION_OK;
+    }
+    
+    // Also drops the deleted id from other tasks' dependency lists
+    MutationStatus deleteTask(int id) {
+        int pos = taskIndex.find(id);
+        if (pos < 0) {
+            return MUTATION_NOT_FOUND;
+        }
+        int projectId = taskIndex.projectId(pos);
+        
+        // Collect dependents first - the graph changes with every record
+        std::vector<int> dependents;
+        dependencyGraph.forEachDependent(id, [&](int dependent) {
+            dependents.push_back(dependent);
+        });
+        
+        beginBatch();
+        journalTaskDel(projectId, id);
+        unlinkDependents(dependents, std::vector<int>{id});
+        commitBatch();
+        return MUTATION_OK;
+    }
+    
+    MutationStatus createProject(JsonObject project, int& newId) {
+        if (project.isNull() || !project["name"].is<const char*>()) {
+            return MUTATION_INVALID;
+        }
+        
+        JsonArray projects = userData["projects"].as<JsonArray>();
+        int id = project["id"] | 0;
+        if (id <= 0 || projectIndex.find(id) >= 0) {
+            id = nextId(projects);
+        }
+        project["id"] = id;
+        
+        beginBatch();
+        journalPut("projects", project);
+        newId = id;
+        commitBatch();
+        return MUTATION_OK;
+    }
+    
+    MutationStatus patchProject(int id, JsonObjectConst fields) {
+        JsonObjectConst stored = findProject(id);
+        if (stored.isNull()) {
+            return MUTATION_NOT_FOUND;
+        }
+        
+        JsonDocument project;
+        project.set(stored);
+        overlayFields(project.as<JsonObject>(), fields);
+        
+        beginBatch();
+        journalPut("projects", project.as<JsonObjectConst>());
+        commitBatch();
+        return MUTATION_OK;
+    }
+    
+    // Deletes the project together with its task shard; tasks of other
+    // projects stop depending on the deleted tasks
+    MutationStatus deleteProject(int id) {
+        if (!hasProject(id)) {
+            return MUTATION_NOT_FOUND;
+        }
+        
+        std::vector<int> deleted;   // sorted: the index is in id order
+        std::vector<int> dependents;
+        for (size_t i = 0; i < taskIndex.size(); i++) {
+            if (taskIndex.projectId(i) == id) {
+                deleted.push_back(taskIndex.id(i));
+            }
+        }
+        for (int taskId : deleted) {
+            dependencyGraph.forEachDependent(taskId, [&](int dependent) {
+                int pos = taskIndex.find(dependent);
+                if (pos >= 0 && taskIndex.projectId(pos) != id) {
+                    dependents.push_back(dependent);
+                }
+            });
+        }
+        std::sort(dependents.begin(), dependents.end());
+        dependents.erase(std::unique(dependents.begin(), dependents.end()), dependents.end());
+        
+        beginBatch();
+        journalDel("projects", id);
+        journalTaskDrop(id);
+        unlinkDependents(dependents, deleted);
+        commitBatch();
+        return MUTATION_OK;
+    }
+    
+    MutationStatus addChecklistItem(int taskId, JsonObjectConst item, int& newId) {
+        if (!item["text"].is<const char*>()) {
+            return MUTATION_INVALID;
+        }
+        return updateChecklist(taskId, -1, item, false, newId);
+    }
+    
+    MutationStatus patchChecklistItem(int taskId, int itemId, JsonObjectConst fields) {
+        int unused;
+        return updateChecklist(taskId, itemId, fields, false, unused);
+    }
+    
+    MutationStatus deleteChecklistItem(int taskId, int itemId) {
+        int unused;
+        return updateChecklist(taskId, itemId, JsonObjectConst(), true, unused);
+    }
+    
+private:
+    // Inside a batch: drops the removed ids (sorted) from each dependent's list
+    void unlinkDependents(const std::vector<int>& dependents, const std::vector<int>& removed) {
+        JsonDocument task;
+        for (int dependentId : dependents) {
+            JsonObjectConst stored = getTask(dependentId);
+            if (stored.isNull()) continue;
+            task.set(stored);
+            JsonArray deps = task["dependencies"].to<JsonArray>();
+            for (JsonVariantConst dep : stored["dependencies"].as<JsonArrayConst>()) {
+                if (!std::binary_search(removed.begin(), removed.end(), dep | -1)) deps.add(dep);
+            }
+            journalTaskPut(task.as<JsonObjectConst>());
+        }
+    }
+    
+    // itemId < 0 appends a new item; otherwise patches or removes the item
+    MutationStatus updateChecklist(int taskId, int itemId, JsonObjectConst fields, bool remove, int& newId) {
+        JsonObjectConst stored = getTask(taskId);
+        if (stored.isNull()) {
+            return MUTATION_NOT_FOUND;
+        }
+        
+        JsonDocument task;
+        task.set(stored);
+        JsonArray checklist = task["checklist"].as<JsonArray>();
+        if (checklist.isNull()) {
+            checklist = task["checklist"].to<JsonArray>();
+        }
+        
+        if (itemId < 0) {
+            newId = nextId(checklist);
+            JsonObject item = checklist.add<JsonObject>();
+            item["id"] = newId;
+            item["text"] = fields["text"];
+            item["completed"] = fields["completed"] | false;
+        } else {
+            int itemIndex = findById(checklist, itemId);
+            if (itemIndex < 0) {
+                return MUTATION_NOT_FOUND;
+            }
+            if (remove) {
+                checklist.remove(itemIndex);
+            } else {
+                overlayFields(checklist[itemIndex].as<JsonObject>(), fields);
+            }
+        }
+        
+        beginBatch();
+        journalTaskPut(task.as<JsonObjectConst>());
+        commitBatch();
+        return MUTATION_OK;
+    }
+    
+    static void overlayFields(JsonObject target, JsonObjectConst fields) {
+        for (JsonPairConst kv : fields) {
+            if (strcmp(kv.key().c_str(), "id") == 0) continue;
+            target[kv.key()] = kv.value();
+        }
+    }
+    
+    bool mergeObject(const char* c, const String& jsonString) {
+        JsonDocument doc;
+        DeserializationError error = deserializeJson(doc, jsonString);
+        
+        if (error) {
+            return false;
+        }
+        
+        beginBatch();
+        
+        Settings oldSettings = settingsCache;
+        NetworkSettings oldNetwork = networkCache;
+        
+        JsonDocument record;
+        record["op"] = "merge";
+        record["c"] = c;
+        record["v"] = doc.as<JsonObject>();
+        appendRecord(record);
+        
+        commitBatch();
+        notifySettingsListeners(oldSettings, oldNetwork);
+        return true;
+    }
+    
+    void notifyChangeListeners(const ChangeSet& changes) {
+        for (auto& listener : changeListeners) listener(changes);
+    }
     
-    DynamicJsonDocument userData;
+    void notifySettingsListeners(const Settings& oldSettings, const NetworkSettings& oldNetwork) {
+        if (settingsCache != oldSettings) {
+            for (auto& listener : settingsListeners) listener(settingsCache);
+        }
+        if (networkCache != oldNetwork) {
+            for (auto& listener : networkListeners) listener(networkCache);
+        }
+    }
     
-public:
-    DataManager() : userData(JSON_CAPACITY) {
-        // Initialize empty structure
-        resetToDefaults();
+    // Defaults match the fallbacks the UI and WiFiManager always used
+    void refreshSettingsCache() {
+        JsonObjectConst s = userData["settings"].as<JsonObjectConst>();
+        settingsCache.appTitle = s["appTitle"] | SettingsDefaults::APP_TITLE;
+        settingsCache.language = s["language"] | SettingsDefaults::LANGUAGE;
+        settingsCache.theme = s["theme"] | SettingsDefaults::THEME;
+        settingsCache.category1 = s["category1"] | SettingsDefaults::CATEGORY1;
+        settingsCache.category2 = s["category2"] | SettingsDefaults::CATEGORY2;
+        settingsCache.category3 = s["category3"] | SettingsDefaults::CATEGORY3;
+        
+        JsonObjectConst n = userData["network"].as<JsonObjectConst>();
+        networkCache.apSSID = n["apSSID"] | SettingsDefaults::AP_SSID;
+        networkCache.apMDNS = n["apMDNS"] | SettingsDefaults::AP_MDNS;
+        networkCache.primarySSID = n["primarySSID"] | "";
+        networkCache.primaryPassword = n["primaryPassword"] | "";
+        networkCache.primaryIP = n["primaryIP"] | "";
+        networkCache.primaryMDNS = n["primaryMDNS"] | SettingsDefaults::PRIMARY_MDNS;
+        networkCache.backupSSID = n["backupSSID"] | "";
+        networkCache.backupPassword = n["backupPassword"] | "";
+        networkCache.backupIP = n["backupIP"] | "";
+        networkCache.backupMDNS = n["backupMDNS"] | SettingsDefaults::BACKUP_MDNS;
     }
     
-    // ==================== INITIALIZATION ====================
+    // ==================== SHARDS ====================
     
-    bool begin() {
-        if (!SPIFFS.begin(true)) {
-            return false;
+    String shardPath(int projectId) const {
+        return SHARD_PREFIX + projectId + ".mp";
+    }
+    
+    String legacyShardPath(int projectId) const {
+        return SHARD_PREFIX + projectId + ".json";
+    }
+    
+    bool isPending(int projectId) const {
+        return std::find(pendingShards.begin(), pendingShards.end(), projectId) != pendingShards.end();
+    }
+    
+    void markPending(int projectId) {
+        if (!isPending(projectId)) {
+            pendingShards.push_back(projectId);
+        }
+    }
+    
+    // Shard file + that project's journal records
+    void loadShard(int projectId) {
+        if (shardProject == projectId) {
+            return;
         }
         
-        if (SPIFFS.exists(DATA_FILE)) {
-            if (loadFromFile()) {
-                return true;
+        shard.clear();
+        File file = storage().open(shardPath(projectId), "r");
+        if (file) {
+            if (MsgPackCodec::read(file, shard)) {
+                shard.clear();
+            }
+            file.close();
+        } else if (migratingFormat) {
+            file = storage().open(legacyShardPath(projectId), "r");
+            if (file) {
+                if (deserializeJson(shard, file)) {
+                    shard.clear();
+                }
+                file.close();
             }
         }
+        if (!shard.is<JsonArray>()) {
+            shard.to<JsonArray>();
+        }
+        shardProject = projectId;
         
-        resetToDefaults();
-        saveToFile();
-        
-        return true;
+        if (isPending(projectId)) {
+            forEachJournalRecord([&](JsonObjectConst record) {
+                if (strcmp(record["c"] | "", "tasks") == 0 && (record["p"] | -1) == projectId) {
+                    applyShardRecord(record);
+                }
+            });
+        }
     }
     
-    // ==================== CORE PERSISTENCE ====================
+    // Empty shards are removed instead of written
+    size_t writeShard(int projectId) {
+        String path = shardPath(projectId);
+        if (shard.as<JsonArray>().size() == 0) {
+            storage().remove(path);
+            return 0;
+        }
+        return writeAtomically(path.c_str(), shard);
+    }
     
-    bool loadFromFile() {
-        File file = SPIFFS.open(DATA_FILE, "r");
-        if (!file) {
+    // Layout 1 kept every task inside /userdata.json - split them into shards
+    bool migrateLegacyTasks(size_t& bytesWritten) {
+        JsonArray legacy = userData["tasks"].as<JsonArray>();
+        if (legacy.isNull()) {
             return false;
         }
         
-        DeserializationError error = deserializeJson(userData, file);
-        file.close();
+        std::vector<int> projectIds;
+        for (JsonObject task : legacy) {
+            projectIds.push_back(task["projectId"] | -1);
+        }
+        std::sort(projectIds.begin(), projectIds.end());
+        projectIds.erase(std::unique(projectIds.begin(), projectIds.end()), projectIds.end());
         
-        if (error) {
-            return false;
+        for (int projectId : projectIds) {
+            shard.clear();
+            JsonArray tasks = shard.to<JsonArray>();
+            for (JsonObject task : legacy) {
+                if ((task["projectId"] | -1) == projectId) {
+                    tasks.add(task);
+                }
+            }
+            shardProject = projectId;
+            bytesWritten += writeShard(projectId);
         }
         
+        userData.remove("tasks");
+        Serial.printf("[Data] %u task shards written\n", (unsigned)projectIds.size());
         return true;
     }
     
-    bool saveToFile() {
-        File file = SPIFFS.open(DATA_FILE, "w");
+    // Temp file + rename; a crash between remove and rename is repaired by recoverTempFiles()
+    size_t writeAtomically(const char* path, JsonDocument& doc) {
+        String tempPath = String(path) + ".tmp";
+        File file = storage().open(tempPath, "w");
         if (!file) {
-            return false;
+            return 0;
         }
         
-        size_t bytesWritten = serializeJson(userData, file);
+        size_t bytesWritten = MsgPackCodec::write(file, doc);
+        file.flush();
         file.close();
         
-        return (bytesWritten > 0);
+        if (bytesWritten == 0) {
+            storage().remove(tempPath);
+            return 0;
+        }
+        
+        storage().remove(path);
+        if (!storage().rename(tempPath, path)) {
+            return 0;
+        }
+        return bytesWritten;
     }
     
-    // ==================== DATA ACCESS ====================
+    // A leftover .tmp is complete if its target is missing (crash after remove), stale otherwise
+    void recoverTempFiles() {
+        std::vector<String> temps;
+        storage().listFiles(ROOT.c_str(), [&](const String& path) {
+            if (path.endsWith(".tmp")) {
+                temps.push_back(path);
+            }
+        });
+        
+        for (const String& tempPath : temps) {
+            String target = tempPath.substring(0, tempPath.length() - 4);
+            if (tempPath == ROOT + "userdata.tmp") {
+                target = LEGACY_DATA_FILE; // layout 1 temp name
+            }
+            if (storage().exists(target)) {
+                storage().remove(tempPath);
+            } else {
+                storage().rename(tempPath, target);
+            }
+        }
+    }
     
-    // Get complete user data as JSON string
-    String getAllData() {
-        String output;
-        serializeJson(userData, output);
-        return output;
+    // ==================== STAGED REPLACE ====================
+    
+    size_t writeStaged(const String& path, JsonDocument& doc) {
+        File file = storage().open(path + ".new", "w");
+        if (!file) {
+            return 0;
+        }
+        size_t bytesWritten = MsgPackCodec::write(file, doc);
+        file.flush();
+        file.close();
+        return bytesWritten;
+    }
+    
+    void removeStagedFiles() {
+        std::vector<String> staged;
+        storage().listFiles(ROOT.c_str(), [&](const String& path) {
+            if (path.endsWith(".new")) {
+                staged.push_back(path);
+            }
+        });
+        for (const String& path : staged) {
+            storage().remove(path);
+        }
     }
     
-    // Update complete user data from JSON string
-    bool setAllData(const String& jsonString) {
-        DynamicJsonDocument newDoc(JSON_CAPACITY);
-        DeserializationError error = deserializeJson(newDoc, jsonString);
+    // Second half of replaceAll. Every step can be repeated, so an
+    // interrupted swap is finished by running it again from begin().
+    void finishSwap() {
+        storage().remove(JOURNAL_FILE);
         
-        if (error) {
-            return false;
+        // Shards without a staged copy are gone from the new data (or legacy JSON)
+        std::vector<String> shards;
+        std::vector<String> staged;
+        storage().listFiles(SHARD_PREFIX.c_str(), [&](const String& path) {
+            (path.endsWith(".new") ? staged : shards).push_back(path);
+        });
+        for (const String& path : shards) {
+            if (!path.endsWith(".mp") || !storage().exists(path + ".new")) {
+                storage().remove(path);
+            }
         }
         
-        userData = newDoc;
-        return saveToFile();
+        staged.push_back(DATA_FILE + ".new");
+        for (const String& stagedPath : staged) {
+            String path = stagedPath.substring(0, stagedPath.length() - 4);
+            if (storage().exists(stagedPath)) {
+                storage().remove(path);
+                storage().rename(stagedPath, path);
+            }
+        }
+        storage().remove(LEGACY_DATA_FILE);
+        storage().remove(SWAP_FILE);
     }
     
-    // Get projects array as JSON string
-    String getProjects() {
-        String output;
-        JsonArray projects = userData["projects"];
-        serializeJson(projects, output);
-        return output;
+    // replaceAll interrupted by a power cut: finish it if everything was
+    // staged, otherwise the old data is still intact
+    void recoverStagedFiles() {
+        if (storage().exists(SWAP_FILE)) {
+            Serial.println("[Data] Finishing an interrupted replace");
+            finishSwap();
+        } else {
+            removeStagedFiles();
+        }
     }
     
-    // Get tasks array as JSON string
-    String getTasks() {
-        String output;
-        JsonArray tasks = userData["tasks"];
-        serializeJson(tasks, output);
-        return output;
+    void removeShardFiles() {
+        std::vector<String> shards;
+        storage().listFiles(SHARD_PREFIX.c_str(), [&](const String& path) {
+            shards.push_back(path);
+        });
+        
+        for (const String& path : shards) {
+            storage().remove(path);
+        }
     }
     
-    // Get projects and tasks together (frontend format)
-    String getTodosData() {
-        String output;
-        JsonObject root = userData.as<JsonObject>();
+    // Layout 2 -> 3: the compaction rewrites every shard and the snapshot as
+    // MessagePack, then drops the JSON files. Until the snapshot is written the
+    // JSON files stay authoritative, so a power cut just repeats the migration.
+    void migrateToMsgPack() {
+        Serial.println("[Data] Converting data files to MessagePack...");
         
-        DynamicJsonDocument doc(JSON_CAPACITY);
-        doc["projects"] = root["projects"];
-        doc["tasks"] = root["tasks"];
+        uint32_t jsonBytes = stats.snapshotBytes;
+        storage().listFiles(SHARD_PREFIX.c_str(), [&](const String& path) {
+            if (path.endsWith(".json")) {
+                File file = storage().open(path, "r");
+                if (file) {
+                    jsonBytes += file.size();
+                    file.close();
+                }
+            }
+        });
         
-        serializeJson(doc, output);
-        return output;
+        if (!saveToFile()) {
+            Serial.println("[Data] MessagePack conversion failed, retrying on the next save");
+            return;
+        }
+        
+        stats.legacyJsonBytes = jsonBytes;
+        stats.migratedBytes = stats.lastCompactionBytes;
+        Serial.printf("[Data] MessagePack conversion: %u B JSON -> %u B\n",
+                      (unsigned)stats.legacyJsonBytes, (unsigned)stats.migratedBytes);
     }
     
-    // Update projects and tasks
-    bool setTodosData(const String& jsonString) {
-        DynamicJsonDocument doc(JSON_CAPACITY);
-        DeserializationError error = deserializeJson(doc, jsonString);
+    void removeLegacyFiles() {
+        std::vector<String> legacyShards;
+        storage().listFiles(SHARD_PREFIX.c_str(), [&](const String& path) {
+            if (path.endsWith(".json")) {
+                legacyShards.push_back(path);
+            }
+        });
         
-        if (error) {
-            return false;
+        for (const String& path : legacyShards) {
+            storage().remove(path);
         }
+        storage().remove(LEGACY_DATA_FILE);
+    }
+    
+    // ==================== QUERY HELPERS ====================
+    
+    struct DueItem {
+        DateCore::Day day;
+        int id;
+        int projectId;
+        bool completed;
         
-        if (!doc.containsKey("projects") || !doc.containsKey("tasks")) {
-            return false;
+        bool operator<(const DueItem& other) const {
+            return day != other.day ? day < other.day : id < other.id;
+        }
+    };
+    
+    // ==================== SEARCH HELPERS ====================
+    
+    struct SearchHit {
+        int score;
+        int id;
+        int projectId;
+    };
+    
+    // Refs containing every query token; all documents without the index
+    std::vector<uint32_t> searchCandidates(const std::vector<String>& tokens, bool indexed) {
+        std::vector<uint32_t> refs;
+        if (!indexed) {
+            for (JsonObjectConst project : userData["projects"].as<JsonArrayConst>()) {
+                refs.push_back(SearchIndex::projectRef(project["id"] | -1));
+            }
+            for (size_t i = 0; i < taskIndex.size(); i++) {
+                refs.push_back(SearchIndex::taskRef(taskIndex.id(i)));
+            }
+            return refs;
+        }
+        
+        for (size_t t = 0; t < tokens.size(); t++) {
+            std::vector<uint32_t> hits = searchIndex.candidates(tokens[t].c_str(), tokens[t].length());
+            if (t == 0) {
+                refs.swap(hits);
+            } else {
+                std::vector<uint32_t> both;
+                std::set_intersection(refs.begin(), refs.end(), hits.begin(), hits.end(), std::back_inserter(both));
+                refs.swap(both);
+            }
+            if (refs.empty()) break;
+        }
+        return refs;
+    }
+    
+    // Best score first, then lowest id; keeps the first limit
+    static void rankHits(std::vector<SearchHit>& hits, size_t limit) {
+        std::sort(hits.begin(), hits.end(), [](const SearchHit& a, const SearchHit& b) {
+            return a.score != b.score ? a.score > b.score : a.id < b.id;
+        });
+        if (hits.size() > limit) {
+            hits.resize(limit);
+        }
+    }
+    
+    // ==================== TASK INDEX ====================
+    
+    void rebuildProjectIndex() {
+        projectIndex.rebuild(userData["projects"].as<JsonArrayConst>());
+    }
+    
+    // Also rebuilds the search index and the dependency graph: all need one
+    // pass over every shard
+    void rebuildTaskIndex() {
+        taskIndex.clear();
+        searchIndex.clear();
+        dependencyGraph.clear();
+        for (JsonObjectConst project : userData["projects"].as<JsonArrayConst>()) {
+            int projectId = project["id"] | -1;
+            searchIndex.appendProject(project);
+            loadShard(projectId);
+            for (JsonObjectConst task : shard.as<JsonArrayConst>()) {
+                taskIndex.append(task, projectId);
+                searchIndex.appendTask(task);
+                dependencyGraph.append(task);
+            }
+        }
+        taskIndex.sort();
+        searchIndex.sort();
+        dependencyGraph.build(taskIndex);
+        noteTaskId(taskIndex.maxId());
+    }
+    
+    // Task ids are never reused: the next free one lives in the snapshot and
+    // is raised by every task put, including those only in the journal
+    int nextTaskId() const {
+        return userData["nextTaskId"] | 1;
+    }
+    
+    void noteTaskId(int id) {
+        if (id >= nextTaskId() && id <= MAX_TASK_ID) {
+            userData["nextTaskId"] = id + 1;
+        }
+    }
+    
+    bool isOpenTask(int id) const {
+        int pos = taskIndex.find(id);
+        return pos >= 0 && !taskIndex.isCompleted(pos);
+    }
+    
+    // "dependencies" must be an array of task ids, not the task itself, and
+    // must not close a cycle. Ids of tasks that do not exist are allowed.
+    MutationStatus checkDependencies(int id, JsonObjectConst task) {
+        JsonVariantConst list = task["dependencies"];
+        if (!list.is<JsonArrayConst>()) {
+            return MUTATION_INVALID;
+        }
+        for (JsonVariantConst dep : list.as<JsonArrayConst>()) {
+            if (!dep.is<int>() || dep.as<int>() == id) {
+                return MUTATION_INVALID;
+            }
+        }
+        if (dependencyGraph.wouldCycle(id, DependencyGraph::dependenciesOf(task))) {
+            return MUTATION_CYCLE;
+        }
+        return MUTATION_OK;
+    }
+    
+    // setTodosData replaces everything: each task is checked as createTask
+    // would, the cycle check runs on the incoming graph as a whole
+    static MutationStatus checkTodos(JsonArrayConst projects, JsonArrayConst tasks) {
+        std::vector<int> projectIds;
+        for (JsonObjectConst project : projects) {
+            if (!project["id"].is<int>() || !project["name"].is<const char*>()) {
+                return MUTATION_INVALID;
+            }
+            projectIds.push_back(project["id"].as<int>());
+        }
+        std::sort(projectIds.begin(), projectIds.end());
+        
+        std::vector<int> taskIds;
+        DependencyGraph graph;
+        for (JsonObjectConst task : tasks) {
+            int id = task["id"] | 0;
+            if (id <= 0 || id > MAX_TASK_ID || !task["title"].is<const char*>() ||
+                !std::binary_search(projectIds.begin(), projectIds.end(), task["projectId"] | -1) ||
+                !Recurrence::isValidTask(task)) {
+                return MUTATION_INVALID;
+            }
+            JsonVariantConst list = task["dependencies"];
+            if (!list.isNull() && !list.is<JsonArrayConst>()) {
+                return MUTATION_INVALID;
+            }
+            for (JsonVariantConst dep : list.as<JsonArrayConst>()) {
+                if (!dep.is<int>() || dep.as<int>() == id) {
+                    return MUTATION_INVALID;
+                }
+            }
+            taskIds.push_back(id);
+            graph.append(task);
         }
+        std::sort(taskIds.begin(), taskIds.end());
+        if (std::adjacent_find(taskIds.begin(), taskIds.end()) != taskIds.end()) {
+            return MUTATION_INVALID;
+        }
+        
+        graph.build(TaskIndex());
+        return graph.hasCycle() ? MUTATION_CYCLE : MUTATION_OK;
+    }
+    
+    // ==================== JOURNAL ====================
+    // Records (JSON lines):
+    //   {"op":"put","c":"projects","v":{...}}          upsert by id
+    //   {"op":"del","c":"projects","id":N}
+    //   {"op":"merge","c":"settings","v":{...}}        settings / network
+    //   {"op":"put","c":"tasks","p":P,"v":{...}}       task in shard P
+    //   {"op":"del","c":"tasks","p":P,"id":N}
+    //   {"op":"drop","c":"tasks","p":P}                 empty shard P
+    
+    // All records of one mutation go out through a single append handle
+    void beginBatch() {
+        batchRecords = 0;
+        batchBytes = 0;
+        batchChanges = ChangeSet{0, String(), false, false, false};
+    }
+    
+    // Applied to RAM right away, queued for the next flush
+    void appendRecord(JsonDocument& record) {
+        applyRecord(record.as<JsonObjectConst>());
+        
+        String line;
+        serializeJson(record, line);
+        line += '\n';
+        pendingLog += line;
+        pendingRecords++;
         
-        userData["projects"] = doc["projects"];
-        userData["tasks"] = doc["tasks"];
+        batchBytes += line.length();
+        batchRecords++;
         
-        return saveToFile();
+        if (changeListeners.empty()) {
+            return;
+        }
+        const char* c = record["c"] | "";
+        if (strcmp(c, "settings") == 0) {
+            batchChanges.settings = true;
+        } else if (strcmp(c, "network") == 0) {
+            batchChanges.network = true;
+        } else if (!batchChanges.truncated) {
+            if (batchChanges.records.length() + line.length() > CHANGE_PUSH_MAX_BYTES) {
+                batchChanges.truncated = true;
+                batchChanges.records = "";
+            } else {
+                batchChanges.records += batchChanges.records.length() ? ',' : '[';
+                batchChanges.records.concat(line.c_str(), line.length() - 1);
+            }
+        }
     }
     
-    // Get GUI settings as JSON string
-    String getSettings() {
-        String output;
-        JsonObject settings = userData["settings"];
-        serializeJson(settings, output);
-        return output;
+    // The change is in RAM and pushed to clients from here on, so a failed
+    // flush does not fail the mutation: the records stay queued for tick()
+    void commitBatch() {
+        if (batchRecords == 0) {
+            return;
+        }
+        
+        revision++;
+        stats.journalAppends++;
+        stats.journalRecords += batchRecords;
+        pendingSaves++;
+        lastCommitMillis = millis();
+        
+        if (batchChanges.records.length()) {
+            batchChanges.records += ']';
+        }
+        batchChanges.revision = revision;
+        notifyChangeListeners(batchChanges);
+        
+        if (pendingRecords >= FLUSH_MAX_RECORDS || pendingLog.length() >= FLUSH_MAX_BYTES) {
+            if (!flush()) {
+                Serial.println("[Data] Journal flush failed - retrying later");
+            }
+        }
     }
     
-    // Update GUI settings
-    bool setSettings(const String& jsonString) {
-        DynamicJsonDocument doc(4096);
-        DeserializationError error = deserializeJson(doc, jsonString);
+    void clearPending() {
+        pendingLog = "";
+        pendingRecords = 0;
+        pendingSaves = 0;
+        journalTorn = false;
+    }
+    
+public:
+    // Main loop hook: flush once the burst of changes has settled; after a
+    // failed flush the next attempt waits another idle period
+    void tick() {
+        if (pendingSaves > 0 && millis() - lastCommitMillis >= FLUSH_IDLE_MS) {
+            if (!flush()) {
+                Serial.println("[Data] Journal flush failed - retrying");
+                lastCommitMillis = millis();
+            }
+        }
+    }
+    
+    // One open/write/fsync for every queued record. A torn tail is skipped by
+    // replay; on a short write the compaction rewrites everything from RAM.
+    bool flush() {
+        if (pendingLog.length() == 0) {
+            return true;
+        }
+        if (journalTorn) {
+            return saveToFile(); // replay stops at the broken record, so nothing may be appended after it
+        }
         
-        if (error) {
+        unsigned long start = micros();
+        File file = storage().open(JOURNAL_FILE, "a");
+        if (!file) {
             return false;
         }
         
-        JsonObject settings = userData["settings"].as<JsonObject>();
-        for (JsonPair kv : doc.as<JsonObject>()) {
-            settings[kv.key()] = kv.value();
+        size_t written = file.write((const uint8_t*)pendingLog.c_str(), pendingLog.length());
+        file.flush();
+        size_t logSize = file.size();
+        file.close();
+        
+        if (written != pendingLog.length()) {
+            Serial.println("[Data] Journal short write - compacting");
+            journalTorn = true;
+            return saveToFile();
         }
         
-        return saveToFile();
+        stats.flushes++;
+        stats.coalescedSaves += pendingSaves - 1;
+        recordSave(written, micros() - start);
+        Serial.printf("[Data] Journal +%u bytes (%u records, %u saves)\n",
+                      (unsigned)written, (unsigned)pendingRecords, (unsigned)pendingSaves);
+        clearPending();
+        
+        if (logSize >= JOURNAL_COMPACT_THRESHOLD) {
+            Serial.printf("[Data] Journal %u bytes - compacting\n", (unsigned)logSize);
+            return saveToFile();
+        }
+        return true;
     }
     
-    // Get network settings as JSON string
-    String getNetworkSettings() {
-        String output;
-        JsonObject network = userData["network"];
-        serializeJson(network, output);
-        return output;
+    uint32_t getPendingSaves() const {
+        return pendingSaves;
     }
     
-    // Update network settings
-    bool setNetworkSettings(const String& jsonString) {
-        DynamicJsonDocument doc(4096);
-        DeserializationError error = deserializeJson(doc, jsonString);
+    size_t getPendingBytes() const {
+        return pendingLog.length();
+    }
+    
+private:
+    
+    void recordSave(size_t bytes, unsigned long elapsedMicros) {
+        stats.bytesWritten += bytes;
+        stats.lastSaveBytes = bytes;
+        stats.lastSaveMicros = elapsedMicros;
+        if (elapsedMicros > stats.maxSaveMicros) {
+            stats.maxSaveMicros = elapsedMicros;
+        }
+    }
+    
+    // Reads records until the end of the log; a torn last record (power loss) ends the scan
+    void forEachJournalRecord(std::function<void(JsonObjectConst)> visit) {
+        JsonDocument record;
+        File file = storage().open(JOURNAL_FILE, "r");
+        if (file) {
+            while (file.available()) {
+                if (deserializeJson(record, file)) {
+                    break;
+                }
+                visit(record.as<JsonObjectConst>());
+            }
+            file.close();
+        }
         
-        if (error) {
+        // Queued records come after everything on flash
+        unsigned int lineStart = 0;
+        while (lineStart < pendingLog.length()) {
+            int lineEnd = pendingLog.indexOf('\n', lineStart);
+            if (lineEnd < 0) lineEnd = pendingLog.length();
+            if (!deserializeJson(record, pendingLog.c_str() + lineStart, lineEnd - lineStart)) {
+                visit(record.as<JsonObjectConst>());
+            }
+            lineStart = lineEnd + 1;
+        }
+    }
+    
+    // Boot: core records are applied, task records only mark their shard pending.
+    // Task records without "p" come from layout 1 and still target the legacy array.
+    bool replayJournal() {
+        if (!storage().exists(JOURNAL_FILE)) {
             return false;
         }
         
-        JsonObject network = userData["network"].as<JsonObject>();
-        for (JsonPair kv : doc.as<JsonObject>()) {
-            network[kv.key()] = kv.value();
+        uint32_t count = 0;
+        forEachJournalRecord([&](JsonObjectConst record) {
+            if (strcmp(record["c"] | "", "tasks") == 0) {
+                if (strcmp(record["op"] | "", "put") == 0) {
+                    noteTaskId(record["v"]["id"] | 0);
+                }
+                if (record["p"].is<int>()) {
+                    markPending(record["p"].as<int>());
+                } else {
+                    applyToArray(userData["tasks"].as<JsonArray>(), record);
+                }
+            } else {
+                applyRecord(record);
+            }
+            count++;
+        });
+        
+        Serial.printf("[Data] Replayed %u journal records\n", (unsigned)count);
+        return true;
+    }
+    
+    static int findById(JsonArray items, int id) {
+        for (size_t i = 0; i < items.size(); i++) {
+            if ((items[i]["id"] | -1) == id) {
+                return (int)i;
+            }
+        }
+        return -1;
+    }
+    
+    static int nextId(JsonArray items) {
+        int maxId = 0;
+        for (JsonObject item : items) {
+            int id = item["id"] | 0;
+            if (id > maxId) maxId = id;
+        }
+        return maxId + 1;
+    }
+    
+    // put / del / drop on an array of objects with ids
+    static void applyToArray(JsonArray items, JsonObjectConst record) {
+        if (items.isNull()) {
+            return;
         }
         
-        return saveToFile();
+        const char* op = record["op"] | "";
+        if (strcmp(op, "put") == 0) {
+            JsonVariantConst value = record["v"];
+            int index = findById(items, value["id"] | -1);
+            if (index >= 0) {
+                items[index].set(value);
+            } else {
+                items.add(value);
+            }
+        } else if (strcmp(op, "del") == 0) {
+            int index = findById(items, record["id"] | -1);
+            if (index >= 0) {
+                items.remove(index);
+            }
+        } else if (strcmp(op, "drop") == 0) {
+            items.clear();
+        }
     }
     
-
+    void applyShardRecord(JsonObjectConst record) {
+        applyToArray(shard.as<JsonArray>(), record);
+    }
+    
+    // Live mutation: update the in-memory state the record describes
+    void applyRecord(JsonObjectConst record) {
+        const char* op = record["op"] | "";
+        const char* c = record["c"] | "";
+        
+        if (strcmp(c, "tasks") == 0) {
+            int projectId = record["p"] | -1;
+            loadShard(projectId);
+            applyShardRecord(record);
+            markPending(projectId);
+            
+            // The graph needs the open state from before the change
+            if (strcmp(op, "put") == 0) {
+                JsonObjectConst task = record["v"].as<JsonObjectConst>();
+                bool wasOpen = isOpenTask(task["id"] | -1);
+                noteTaskId(task["id"] | 0);
+                taskIndex.put(task, projectId);
+                searchIndex.putTask(task);
+                dependencyGraph.put(task, wasOpen, taskIndex);
+            } else if (strcmp(op, "del") == 0) {
+                int id = record["id"] | -1;
+                bool wasOpen = isOpenTask(id);
+                taskIndex.remove(id);
+                searchIndex.remove(SearchIndex::taskRef(id));
+                dependencyGraph.remove(id, wasOpen);
+            } else if (strcmp(op, "drop") == 0) {
+                std::vector<std::pair<int, bool>> dropped;
+                for (size_t i = 0; i < taskIndex.size(); i++) {
+                    if (taskIndex.projectId(i) == projectId) {
+                        dropped.push_back(std::make_pair(taskIndex.id(i), !taskIndex.isCompleted(i)));
+                        searchIndex.remove(SearchIndex::taskRef(taskIndex.id(i)));
+                    }
+                }
+                taskIndex.removeProject(projectId);
+                for (const auto& task : dropped) {
+                    dependencyGraph.remove(task.first, task.second);
+                }
+            }
+            return;
+        }
+        
+        if (strcmp(c, "projects") == 0) {
+            JsonArray projects = userData["projects"].as<JsonArray>();
+            if (projects.isNull()) {
+                projects = userData["projects"].to<JsonArray>();
+            }
+            applyToArray(projects, record);
+            rebuildProjectIndex();
+            if (strcmp(op, "put") == 0) {
+                searchIndex.putProject(record["v"].as<JsonObjectConst>());
+            } else if (strcmp(op, "del") == 0) {
+                searchIndex.remove(SearchIndex::projectRef(record["id"] | -1));
+            }
+        } else if ((strcmp(c, "settings") == 0 || strcmp(c, "network") == 0) && strcmp(op, "merge") == 0) {
+            JsonObject target = userData[c].as<JsonObject>();
+            if (target.isNull()) {
+                target = userData[c].to<JsonObject>();
+            }
+            for (JsonPairConst kv : record["v"].as<JsonObjectConst>()) {
+                target[kv.key()] = kv.value();
+            }
+            refreshSettingsCache();
+        }
+    }
+    
+    void journalPut(const char* c, JsonVariantConst value) {
+        JsonDocument record;
+        record["op"] = "put";
+        record["c"] = c;
+        record["v"] = value;
+        appendRecord(record);
+    }
+    
+    void journalDel(const char* c, int id) {
+        JsonDocument record;
+        record["op"] = "del";
+        record["c"] = c;
+        record["id"] = id;
+        appendRecord(record);
+    }
+    
+    void journalTaskPut(JsonObjectConst task) {
+        JsonDocument record;
+        record["op"] = "put";
+        record["c"] = "tasks";
+        record["p"] = task["projectId"] | -1;
+        record["v"] = task;
+        appendRecord(record);
+    }
+    
+    void journalTaskDel(int projectId, int id) {
+        JsonDocument record;
+        record["op"] = "del";
+        record["c"] = "tasks";
+        record["p"] = projectId;
+        record["id"] = id;
+        appendRecord(record);
+    }
+    
+    void journalTaskDrop(int projectId) {
+        JsonDocument record;
+        record["op"] = "drop";
+        record["c"] = "tasks";
+        record["p"] = projectId;
+        appendRecord(record);
+    }
+    
+    // Journal puts for new/changed projects and dels for projects missing from the incoming array
+    void diffProjects(JsonArray incoming) {
+        for (JsonObject project : incoming) {
+            JsonObjectConst current = findProject(project["id"] | -1);
+            if (!current.isNull() && current == project) {
+                continue;
+            }
+            journalPut("projects", project);
+        }
+        
+        JsonArray current = userData["projects"].as<JsonArray>();
+        for (size_t i = 0; i < current.size(); ) {
+            int id = current[i]["id"] | -1;
+            if (findById(incoming, id) >= 0) {
+                i++;
+                continue;
+            }
+            journalDel("projects", id);
+            journalTaskDrop(id);
+        }
+    }
+    
+    // Same for tasks, grouped by project so each shard is loaded once
+    void diffTasks(JsonArray incoming) {
+        std::vector<int> projectIds;
+        std::vector<int> incomingIds;
+        for (JsonObject task : incoming) {
+            projectIds.push_back(task["projectId"] | -1);
+            incomingIds.push_back(task["id"] | -1);
+        }
+        std::sort(projectIds.begin(), projectIds.end());
+        projectIds.erase(std::unique(projectIds.begin(), projectIds.end()), projectIds.end());
+        std::sort(incomingIds.begin(), incomingIds.end());
+        
+        for (int projectId : projectIds) {
+            for (JsonObject task : incoming) {
+                if ((task["projectId"] | -1) != projectId) continue;
+                
+                int id = task["id"] | -1;
+                int pos = taskIndex.find(id);
+                if (pos >= 0 && taskIndex.projectId(pos) != projectId) {
+                    journalTaskDel(taskIndex.projectId(pos), id);
+                }
+                
+                loadShard(projectId);
+                int index = findById(shard.as<JsonArray>(), id);
+                if (index >= 0 && shard[index] == task) {
+                    continue;
+                }
+                journalTaskPut(task);
+            }
+        }
+        
+        // (projectId, id) pairs, sorted so each shard is loaded once
+        std::vector<std::pair<int, int>> removed;
+        for (size_t i = 0; i < taskIndex.size(); i++) {
+            if (!std::binary_search(incomingIds.begin(), incomingIds.end(), taskIndex.id(i))) {
+                removed.push_back(std::make_pair(taskIndex.projectId(i), taskIndex.id(i)));
+            }
+        }
+        std::sort(removed.begin(), removed.end());
+        for (const std::pair<int, int>& task : removed) {
+            journalTaskDel(task.first, task.second);
+        }
+    }
     
+public:
     // ==================== FACTORY RESET ====================
     
     bool factoryReset() {
-        if (SPIFFS.exists(DATA_FILE)) {
-            if (!SPIFFS.remove(DATA_FILE)) {
+        if (storage().exists(DATA_FILE)) {
+            if (!storage().remove(DATA_FILE)) {
                 return false;
             }
         }
+        storage().remove(LEGACY_DATA_FILE);
+        storage().remove(JOURNAL_FILE);
+        removeShardFiles();
         
-
+        Settings oldSettings = settingsCache;
+        NetworkSettings oldNetwork = networkCache;
         
         resetToDefaults();
+        revision++;
         
         if (!saveToFile()) {
             return false;
         }
         
+        notifyChangeListeners(ChangeSet{revision, String(), true, true, true});
+        notifySettingsListeners(oldSettings, oldNetwork);
         return true;
     }
     
     // ==================== DEFAULT DATA ====================
     
+    // Demo tasks are created in the layout-1 "tasks" array and split into
+    // shards by the next saveToFile()
     void resetToDefaults() {
         userData.clear();
+        shard.clear();
+        shardProject = -1;
+        pendingShards.clear();
+        migratingFormat = false;
+        taskIndex.clear();
+        searchIndex.clear();
+        dependencyGraph.clear();
+        clearPending();
         
         // GUI Settings
-        JsonObject settings = userData.createNestedObject("settings");
-        settings["appTitle"] = "ToDo - SmartKraft";
-        settings["category1"] = "WORK";
-        settings["category2"] = "PERSONAL";
-        settings["category3"] = "PROJECTS";
-        settings["theme"] = "dark";
+        JsonObject settings = userData["settings"].to<JsonObject>();
+        settings["appTitle"] = SettingsDefaults::APP_TITLE;
+        settings["category1"] = SettingsDefaults::CATEGORY1;
+        settings["category2"] = SettingsDefaults::CATEGORY2;
+        settings["category3"] = SettingsDefaults::CATEGORY3;
+        settings["theme"] = SettingsDefaults::THEME;
         
         // Network Settings
-        JsonObject network = userData.createNestedObject("network");
-        network["apSSID"] = "SmartKraft-To2Do";
-        network["apMDNS"] = "to2do";
+        JsonObject network = userData["network"].to<JsonObject>();
+        network["apSSID"] = SettingsDefaults::AP_SSID;
+        network["apMDNS"] = SettingsDefaults::AP_MDNS;
         network["primarySSID"] = "";
         network["primaryPassword"] = "";
         network["primaryIP"] = "";
-        network["primaryMDNS"] = "smartkraft-todo";
+        network["primaryMDNS"] = SettingsDefaults::PRIMARY_MDNS;
         network["backupSSID"] = "";
         network["backupPassword"] = "";
         network["backupIP"] = "";
-        network["backupMDNS"] = "smartkraft-todo-backup";
+        network["backupMDNS"] = SettingsDefaults::BACKUP_MDNS;
         
 
         
         // Demo Projects
-        JsonArray projects = userData.createNestedArray("projects");
+        JsonArray projects = userData["projects"].to<JsonArray>();
         
-        JsonObject p1 = projects.createNestedObject();
+        JsonObject p1 = projects.add<JsonObject>();
         p1["id"] = 1;
         p1["name"] = "Website Redesign";
         p1["category"] = "Work";
@@ -257,7 +2165,7 @@ public:
         p1["priority"] = "high";
         p1["archived"] = false;
         
-        JsonObject p2 = projects.createNestedObject();
+        JsonObject p2 = projects.add<JsonObject>();
         p2["id"] = 2;
         p2["name"] = "Team Meeting Prep";
         p2["category"] = "Work";
@@ -265,7 +2173,7 @@ public:
         p2["priority"] = "medium";
         p2["archived"] = false;
         
-        JsonObject p3 = projects.createNestedObject();
+        JsonObject p3 = projects.add<JsonObject>();
         p3["id"] = 3;
         p3["name"] = "Home Improvement";
         p3["category"] = "Personal";
@@ -273,7 +2181,7 @@ public:
         p3["priority"] = "medium";
         p3["archived"] = false;
         
-        JsonObject p4 = projects.createNestedObject();
+        JsonObject p4 = projects.add<JsonObject>();
         p4["id"] = 4;
         p4["name"] = "Fitness Goals";
         p4["category"] = "Personal";
@@ -281,7 +2189,7 @@ public:
         p4["priority"] = "high";
         p4["archived"] = false;
         
-        JsonObject p5 = projects.createNestedObject();
+        JsonObject p5 = projects.add<JsonObject>();
         p5["id"] = 5;
         p5["name"] = "Smart Home System";
         p5["category"] = "Projects";
@@ -290,9 +2198,9 @@ public:
         p5["archived"] = false;
         
         // Demo Tasks (Sample - will add more)
-        JsonArray tasks = userData.createNestedArray("tasks");
+        JsonArray tasks = userData["tasks"].to<JsonArray>();
         
-        JsonObject t1 = tasks.createNestedObject();
+        JsonObject t1 = tasks.add<JsonObject>();
         t1["id"] = 1;
         t1["projectId"] = 1;
         t1["title"] = "Design homepage mockup";
@@ -301,18 +2209,18 @@ public:
         t1["priority"] = "high";
         t1["completed"] = false;
         t1["date"] = "2025-10-15";
-        JsonArray t1_checklist = t1.createNestedArray("checklist");
-        JsonObject t1_c1 = t1_checklist.createNestedObject();
+        JsonArray t1_checklist = t1["checklist"].to<JsonArray>();
+        JsonObject t1_c1 = t1_checklist.add<JsonObject>();
         t1_c1["id"] = 1;
         t1_c1["text"] = "Research competitor websites";
         t1_c1["completed"] = true;
-        JsonObject t1_c2 = t1_checklist.createNestedObject();
+        JsonObject t1_c2 = t1_checklist.add<JsonObject>();
         t1_c2["id"] = 2;
         t1_c2["text"] = "Create wireframe layout";
         t1_c2["completed"] = false;
-        t1.createNestedArray("dependencies");
+        t1["dependencies"].to<JsonArray>();
         
-        JsonObject t2 = tasks.createNestedObject();
+        JsonObject t2 = tasks.add<JsonObject>();
         t2["id"] = 2;
         t2["projectId"] = 1;
         t2["title"] = "Setup development environment";
@@ -321,10 +2229,10 @@ public:
         t2["priority"] = "high";
         t2["completed"] = true;
         t2["date"] = "2025-10-13";
-        t2.createNestedArray("checklist");
-        t2.createNestedArray("dependencies");
+        t2["checklist"].to<JsonArray>();
+        t2["dependencies"].to<JsonArray>();
         
-        JsonObject t3 = tasks.createNestedObject();
+        JsonObject t3 = tasks.add<JsonObject>();
         t3["id"] = 3;
         t3["projectId"] = 3;
         t3["title"] = "Paint living room walls";
@@ -333,18 +2241,18 @@ public:
         t3["priority"] = "medium";
         t3["completed"] = false;
         t3["date"] = "2025-10-16";
-        JsonArray t3_checklist = t3.createNestedArray("checklist");
-        JsonObject t3_c1 = t3_checklist.createNestedObject();
+        JsonArray t3_checklist = t3["checklist"].to<JsonArray>();
+        JsonObject t3_c1 = t3_checklist.add<JsonObject>();
         t3_c1["id"] = 1;
         t3_c1["text"] = "Buy paint and supplies";
         t3_c1["completed"] = true;
-        JsonObject t3_c2 = t3_checklist.createNestedObject();
+        JsonObject t3_c2 = t3_checklist.add<JsonObject>();
         t3_c2["id"] = 2;
         t3_c2["text"] = "Prepare walls";
         t3_c2["completed"] = false;
-        t3.createNestedArray("dependencies");
+        t3["dependencies"].to<JsonArray>();
         
-        JsonObject t4 = tasks.createNestedObject();
+        JsonObject t4 = tasks.add<JsonObject>();
         t4["id"] = 4;
         t4["projectId"] = 4;
         t4["title"] = "Morning workout routine";
@@ -353,10 +2261,10 @@ public:
         t4["priority"] = "high";
         t4["completed"] = true;
         t4["date"] = "2025-10-13";
-        t4.createNestedArray("checklist");
-        t4.createNestedArray("dependencies");
+        t4["checklist"].to<JsonArray>();
+        t4["dependencies"].to<JsonArray>();
         
-        JsonObject t5 = tasks.createNestedObject();
+        JsonObject t5 = tasks.add<JsonObject>();
         t5["id"] = 5;
         t5["projectId"] = 5;
         t5["title"] = "Setup WiFi sensors";
@@ -365,16 +2273,19 @@ public:
         t5["priority"] = "high";
         t5["completed"] = false;
         t5["date"] = "2025-10-17";
-        JsonArray t5_checklist = t5.createNestedArray("checklist");
-        JsonObject t5_c1 = t5_checklist.createNestedObject();
+        JsonArray t5_checklist = t5["checklist"].to<JsonArray>();
+        JsonObject t5_c1 = t5_checklist.add<JsonObject>();
         t5_c1["id"] = 1;
         t5_c1["text"] = "Order ESP32 modules";
         t5_c1["completed"] = true;
-        JsonObject t5_c2 = t5_checklist.createNestedObject();
+        JsonObject t5_c2 = t5_checklist.add<JsonObject>();
         t5_c2["id"] = 2;
         t5_c2["text"] = "Mount sensors in rooms";
         t5_c2["completed"] = false;
-        t5.createNestedArray("dependencies");
+        t5["dependencies"].to<JsonArray>();
+        
+        rebuildProjectIndex();
+        refreshSettingsCache();
     }
 };
 
@@ -0,0 +1,111 @@
+#ifndef DATE_CORE_H
+#define DATE_CORE_H
+
+#include <Arduino.h>
+
+/*
+ * DATE CORE
+ * Tarih/saat tek bir tamsayı temsilinde tutulur:
+ *   Day     : 1970-01-01'den beri gün (epoch gün), görev tarihleri ve pencereler
+ *   Seconds : 1970-01-01 00:00'dan beri saniye (yerel saat), cihaz saati
+ * Takvim alanlarına (yıl/ay/gün) sadece parse ve ekrana yazarken dönülür;
+ * karşılaştırmalar düz tamsayı karşılaştırmasıdır, ay/yıl geçişi kendiliğinden
+ * doğrudur. Dönüşümler constexpr ve dallanmasızdır (proleptik Gregoryen,
+ * H. Hinnant'ın days_from_civil / civil_from_days algoritmaları).
+ */
+
+class DateCore {
+public:
+    typedef int32_t Day;
+    typedef int64_t Seconds;
+
+    static constexpr Day NO_DATE = INT32_MIN;
+    static constexpr int32_t SECONDS_PER_DAY = 86400;
+
+    struct Civil {
+        int year;
+        int month;  // 1..12
+        int day;    // 1..31
+    };
+
+    // Days since 1970-01-01 for a proleptic Gregorian date
+    static constexpr Day daysFromCivil(int year, int month, int day) {
+        year -= month <= 2;
+        const int32_t era = (year >= 0 ? year : year - 399) / 400;
+        const uint32_t yoe = (uint32_t)(year - era * 400);
+        const uint32_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + (int32_t)doe - 719468;
+    }
+
+    // Inverse of daysFromCivil
+    static constexpr Civil civilFromDays(Day days) {
+        const int32_t z = days + 719468;
+        const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+        const uint32_t doe = (uint32_t)(z - era * 146097);
+        const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const uint32_t mp = (5 * doy + 2) / 153;
+        const int day = (int)(doy - (153 * mp + 2) / 5 + 1);
+        const int month = mp < 10 ? (int)mp + 3 : (int)mp - 9;
+        return Civil{(int)yoe + era * 400 + (month <= 2), month, day};
+    }
+
+    // 0 = Monday ... 6 = Sunday (1970-01-01 was a Thursday)
+    static constexpr int weekday(Day days) {
+        return (int)(((days % 7) + 10) % 7);
+    }
+
+    // Floor division, correct before 1970 too
+    static constexpr Day dayOf(Seconds seconds) {
+        return (Day)((seconds >= 0 ? seconds : seconds - (SECONDS_PER_DAY - 1)) / SECONDS_PER_DAY);
+    }
+
+    static constexpr int32_t secondOfDay(Seconds seconds) {
+        return (int32_t)(seconds - (Seconds)dayOf(seconds) * SECONDS_PER_DAY);
+    }
+
+    static constexpr Seconds toSeconds(Day day, int hour, int minute, int second) {
+        return (Seconds)day * SECONDS_PER_DAY + hour * 3600 + minute * 60 + second;
+    }
+
+    // "YYYY-MM-DD" (anything may follow, e.g. "T10:00") -> epoch day; otherwise NO_DATE
+    static Day parseDate(const char* text) {
+        if (!text) return NO_DATE;
+
+        int fields[3] = {0, 0, 0};
+        const int widths[3] = {4, 2, 2};
+        const char* p = text;
+        for (int f = 0; f < 3; f++) {
+            for (int i = 0; i < widths[f]; i++, p++) {
+                if (*p < '0' || *p > '9') return NO_DATE;
+                fields[f] = fields[f] * 10 + (*p - '0');
+            }
+            if (f < 2 && *p++ != '-') return NO_DATE;
+        }
+
+        if (fields[0] == 0 || fields[1] < 1 || fields[1] > 12 || fields[2] < 1 || fields[2] > 31) {
+            return NO_DATE;
+        }
+        return daysFromCivil(fields[0], fields[1], fields[2]);
+    }
+
+    // buffer: at least 11 bytes, gets "YYYY-MM-DD"
+    static void formatDate(Day day, char* buffer) {
+        Civil date = civilFromDays(day);
+        sprintf(buffer, "%04d-%02d-%02d", date.year, date.month, date.day);
+    }
+
+    static String formatDate(Day day) {
+        char buffer[11];
+        formatDate(day, buffer);
+        return String(buffer);
+    }
+};
+
+static_assert(DateCore::daysFromCivil(1970, 1, 1) == 0, "epoch");
+static_assert(DateCore::daysFromCivil(2000, 3, 1) == 11017, "leap year 2000");
+static_assert(DateCore::civilFromDays(DateCore::daysFromCivil(2024, 2, 29)).day == 29, "round trip");
+static_assert(DateCore::weekday(DateCore::daysFromCivil(2025, 10, 21)) == 1, "2025-10-21 is a Tuesday");
+
+#endif
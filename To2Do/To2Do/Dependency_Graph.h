@@ -0,0 +1,341 @@
+#ifndef DEPENDENCY_GRAPH_H
+#define DEPENDENCY_GRAPH_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <vector>
+#include <queue>
+#include <functional>
+#include <algorithm>
+#include "Task_Index.h"
+
+/*
+ * DEPENDENCY GRAPH
+ * Görevlerin "dependencies" listesinden kurulan graf: görev -> beklediği
+ * görevler. Kenarlar iki yönlü, sıralı dizilerde durur; bir görevin
+ * bağımlılıkları da onu bekleyenler de binary search ile bulunur.
+ *
+ * Engelli (blocked) görev = tamamlanmamış en az bir bağımlılığı olan görev.
+ * Görev başına açık bağımlılık sayısı tutulur: bir görev tamamlanınca ya da
+ * yeniden açılınca sadece onu bekleyenlerin sayacı değişir, graf yeniden
+ * hesaplanmaz. Var olmayan bir göreve bağımlılık engellemez.
+ *
+ * Döngü kontrolü kayıt yazılmadan önce yapılır (wouldCycle); grafa giren
+ * kayıtlar zaten geçerlidir. DataManager her görev değişikliğinde grafı
+ * TaskIndex ile birlikte günceller.
+ */
+
+class DependencyGraph {
+public:
+    void clear() {
+        edges.clear();
+        reverse.clear();
+        openCounts.clear();
+    }
+
+    // ==================== MAINTENANCE ====================
+
+    // Bulk load: append every task, then build() once the task index is sorted
+    void append(JsonObjectConst task) {
+        int id = task["id"] | -1;
+        for (int dep : dependenciesOf(task)) {
+            if (dep != id) edges.push_back(Edge{id, dep});
+        }
+    }
+
+    void build(const TaskIndex& index) {
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+        reverse.clear();
+        reverse.reserve(edges.size());
+        for (const Edge& edge : edges) {
+            reverse.push_back(Edge{edge.to, edge.from});
+        }
+        std::sort(reverse.begin(), reverse.end());
+
+        openCounts.clear();
+        for (const Edge& edge : edges) {
+            if (isOpen(index, edge.to)) addOpen(edge.from, 1);
+        }
+    }
+
+    // Call after the task index took the new version of the task;
+    // wasOpen: the task existed and was not completed before
+    void put(JsonObjectConst task, bool wasOpen, const TaskIndex& index) {
+        int id = task["id"] | -1;
+        removeEdgesFrom(id);
+
+        uint16_t open = 0;
+        for (int dep : dependenciesOf(task)) {
+            if (dep == id) continue;
+            insertSorted(edges, Edge{id, dep});
+            insertSorted(reverse, Edge{dep, id});
+            open += isOpen(index, dep);
+        }
+        setOpen(id, open);
+
+        bool nowOpen = isOpen(index, id);
+        if (nowOpen != wasOpen) {
+            addToDependents(id, nowOpen ? 1 : -1);
+        }
+    }
+
+    // Edges pointing at a removed task stay (they mirror the dependents'
+    // JSON) but no longer block
+    void remove(int id, bool wasOpen) {
+        removeEdgesFrom(id);
+        setOpen(id, 0);
+        if (wasOpen) {
+            addToDependents(id, -1);
+        }
+    }
+
+    // ==================== QUERY ====================
+
+    bool isBlocked(int id) const {
+        auto it = findCount(id);
+        return it != openCounts.end() && it->id == id;
+    }
+
+    size_t blockedCount() const { return openCounts.size(); }
+
+    // visit(dependencyId) for each task id depends on
+    template <typename Visitor>
+    void forEachDependency(int id, Visitor visit) const {
+        for (auto it = lowerBound(edges, id); it != edges.end() && it->from == id; ++it) {
+            visit(it->to);
+        }
+    }
+
+    // visit(dependentId) for each task waiting on id
+    template <typename Visitor>
+    void forEachDependent(int id, Visitor visit) const {
+        for (auto it = lowerBound(reverse, id); it != reverse.end() && it->from == id; ++it) {
+            visit(it->to);
+        }
+    }
+
+    // Would giving id these dependencies close a cycle? True if id is
+    // reachable from any of them (id's current edges are being replaced,
+    // reaching id at all is enough).
+    bool wouldCycle(int id, const std::vector<int>& dependencies) const {
+        std::vector<int> stack(dependencies.begin(), dependencies.end());
+        std::vector<int> visited;
+        while (!stack.empty()) {
+            int current = stack.back();
+            stack.pop_back();
+            if (current == id) return true;
+
+            auto seen = std::lower_bound(visited.begin(), visited.end(), current);
+            if (seen != visited.end() && *seen == current) continue;
+            visited.insert(seen, current);
+
+            forEachDependency(current, [&](int next) { stack.push_back(next); });
+        }
+        return false;
+    }
+
+    // ==================== VIEWS ====================
+
+    struct View {
+        std::vector<int> order;         // dependencies before dependents, ties by id
+        std::vector<int> criticalPath;  // longest chain of open tasks, first to do first
+    };
+
+    // ids: sorted tasks of one project. Edges leaving the set are ignored.
+    // O(V log V + E) over the set only.
+    View view(const std::vector<int>& ids, const TaskIndex& index) const {
+        const size_t count = ids.size();
+        auto local = [&](int id) -> int {
+            auto it = std::lower_bound(ids.begin(), ids.end(), id);
+            return (it != ids.end() && *it == id) ? (int)(it - ids.begin()) : -1;
+        };
+
+        // Kahn's algorithm; a min-heap of positions keeps the order stable
+        std::vector<uint16_t> waiting(count, 0);
+        for (size_t i = 0; i < count; i++) {
+            forEachDependency(ids[i], [&](int dep) {
+                if (local(dep) >= 0) waiting[i]++;
+            });
+        }
+        std::priority_queue<int, std::vector<int>, std::greater<int>> ready;
+        for (size_t i = 0; i < count; i++) {
+            if (waiting[i] == 0) ready.push((int)i);
+        }
+
+        View result;
+        std::vector<uint16_t> chain(count, 0);  // open tasks on the longest chain ending here
+        std::vector<int> previous(count, -1);
+        std::vector<bool> placed(count, false);
+        int longest = -1;
+
+        while (!ready.empty()) {
+            int i = ready.top();
+            ready.pop();
+            place(i, ids, index, result, chain, previous, placed, longest, local);
+            forEachDependent(ids[i], [&](int dependent) {
+                int j = local(dependent);
+                if (j >= 0 && --waiting[j] == 0) ready.push(j);
+            });
+        }
+        // Only cycles are left (data written before the check existed)
+        for (size_t i = 0; i < count; i++) {
+            if (!placed[i]) place((int)i, ids, index, result, chain, previous, placed, longest, local);
+        }
+
+        for (int i = longest; i >= 0; i = previous[i]) {
+            result.criticalPath.push_back(ids[i]);
+        }
+        std::reverse(result.criticalPath.begin(), result.criticalPath.end());
+        return result;
+    }
+
+    // Kahn's algorithm over every task with edges: tasks left unplaced sit
+    // on a cycle. For a whole incoming data set, where wouldCycle() per task
+    // would check against the old graph.
+    bool hasCycle() const {
+        std::vector<int> nodes;
+        nodes.reserve(edges.size() * 2);
+        for (const Edge& edge : edges) {
+            nodes.push_back(edge.from);
+            nodes.push_back(edge.to);
+        }
+        std::sort(nodes.begin(), nodes.end());
+        nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+        auto local = [&](int id) {
+            return (size_t)(std::lower_bound(nodes.begin(), nodes.end(), id) - nodes.begin());
+        };
+
+        std::vector<uint32_t> waiting(nodes.size(), 0);
+        for (const Edge& edge : edges) {
+            waiting[local(edge.from)]++;
+        }
+        std::vector<size_t> ready;
+        for (size_t i = 0; i < nodes.size(); i++) {
+            if (waiting[i] == 0) ready.push_back(i);
+        }
+        size_t placed = 0;
+        while (!ready.empty()) {
+            size_t i = ready.back();
+            ready.pop_back();
+            placed++;
+            forEachDependent(nodes[i], [&](int dependent) {
+                size_t j = local(dependent);
+                if (--waiting[j] == 0) ready.push_back(j);
+            });
+        }
+        return placed < nodes.size();
+    }
+
+    // The (sorted, unique) dependency ids listed by a task
+    static std::vector<int> dependenciesOf(JsonObjectConst task) {
+        std::vector<int> ids;
+        for (JsonVariantConst dep : task["dependencies"].as<JsonArrayConst>()) {
+            if (dep.is<int>()) ids.push_back(dep.as<int>());
+        }
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        return ids;
+    }
+
+    size_t memoryUsage() const {
+        return (edges.capacity() + reverse.capacity()) * sizeof(Edge) +
+               openCounts.capacity() * sizeof(OpenCount);
+    }
+
+private:
+    struct Edge {
+        int from;
+        int to;
+
+        bool operator<(const Edge& o) const {
+            return from != o.from ? from < o.from : to < o.to;
+        }
+        bool operator==(const Edge& o) const {
+            return from == o.from && to == o.to;
+        }
+    };
+
+    struct OpenCount {
+        int id;
+        uint16_t open;  // dependencies not completed yet, > 0
+    };
+
+    std::vector<Edge> edges;            // task -> dependency, sorted
+    std::vector<Edge> reverse;          // dependency -> task, sorted
+    std::vector<OpenCount> openCounts;  // blocked tasks only, sorted by id
+
+    static bool isOpen(const TaskIndex& index, int id) {
+        int pos = index.find(id);
+        return pos >= 0 && !index.isCompleted(pos);
+    }
+
+    static std::vector<Edge>::const_iterator lowerBound(const std::vector<Edge>& list, int from) {
+        return std::lower_bound(list.begin(), list.end(), Edge{from, INT_MIN});
+    }
+
+    static void insertSorted(std::vector<Edge>& list, const Edge& edge) {
+        auto it = std::lower_bound(list.begin(), list.end(), edge);
+        if (it == list.end() || !(*it == edge)) list.insert(it, edge);
+    }
+
+    void removeEdgesFrom(int id) {
+        auto first = lowerBound(edges, id);
+        auto last = first;
+        while (last != edges.end() && last->from == id) {
+            auto back = std::lower_bound(reverse.begin(), reverse.end(), Edge{last->to, id});
+            if (back != reverse.end() && *back == Edge{last->to, id}) reverse.erase(back);
+            ++last;
+        }
+        edges.erase(first, last);
+    }
+
+    std::vector<OpenCount>::const_iterator findCount(int id) const {
+        return std::lower_bound(openCounts.begin(), openCounts.end(), id,
+                                [](const OpenCount& c, int value) { return c.id < value; });
+    }
+
+    void setOpen(int id, uint16_t open) {
+        auto it = openCounts.begin() + (findCount(id) - openCounts.begin());
+        bool present = it != openCounts.end() && it->id == id;
+        if (open == 0) {
+            if (present) openCounts.erase(it);
+        } else if (present) {
+            it->open = open;
+        } else {
+            openCounts.insert(it, OpenCount{id, open});
+        }
+    }
+
+    void addOpen(int id, int delta) {
+        auto it = findCount(id);
+        int open = (it != openCounts.end() && it->id == id) ? it->open : 0;
+        setOpen(id, (uint16_t)std::max(0, open + delta));
+    }
+
+    // The only incremental step a completion needs: its dependents' counters
+    void addToDependents(int id, int delta) {
+        forEachDependent(id, [&](int dependent) { addOpen(dependent, delta); });
+    }
+
+    template <typename Local>
+    void place(int i, const std::vector<int>& ids, const TaskIndex& index, View& result,
+               std::vector<uint16_t>& chain, std::vector<int>& previous,
+               std::vector<bool>& placed, int& longest, Local local) const {
+        placed[i] = true;
+        result.order.push_back(ids[i]);
+        if (!isOpen(index, ids[i])) return;
+
+        chain[i] = 1;
+        forEachDependency(ids[i], [&](int dep) {
+            int j = local(dep);
+            if (j >= 0 && placed[j] && chain[j] + 1 > chain[i]) {
+                chain[i] = chain[j] + 1;
+                previous[i] = j;
+            }
+        });
+        if (longest < 0 || chain[i] > chain[longest]) longest = i;
+    }
+};
+
+#endif
@@ -18,6 +18,15 @@
 
 // Button Settings
 #define DEBOUNCE_DELAY 50  // ms
+#define INPUT_LATENCY_TARGET_US 50000 // button edge -> new page on screen
+
+// Button-to-screen latency, measured from the pin interrupt
+struct InputLatencyStats {
+  uint32_t inputs = 0;
+  uint32_t lastMicros = 0;
+  uint32_t maxMicros = 0;
+  uint32_t overTarget = 0; // presses slower than INPUT_LATENCY_TARGET_US
+};
 
 class DisplayManager {
 private:
@@ -69,6 +78,17 @@ private:
   // Language (EN, DE, TR)
   String currentLanguage;
   
+  // Set by the button ISR, consumed by checkButton()
+  static inline volatile uint32_t buttonEdgeMicros = 0;
+  InputLatencyStats inputLatency;
+  
+  // First edge of a press wins; bounce edges leave it alone
+  static void IRAM_ATTR onButtonEdge() {
+    if (buttonEdgeMicros == 0) {
+      buttonEdgeMicros = micros();
+    }
+  }
+  
 public:
   DisplayManager() 
     : display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET),
@@ -107,6 +127,7 @@ public:
     delay(100); // 100ms delay only at startup, prevents initial detection failure
     
     pinMode(BUTTON_PIN, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(BUTTON_PIN), onButtonEdge, FALLING);
     
     // Immediately try to detect OLED (synchronous detection at startup)
     bool detected = false;
@@ -445,14 +466,39 @@ public:
     if (buttonState == LOW && lastButtonState == HIGH) {
       if (currentTime - lastButtonPress > 500) { // 500ms debounce
         lastButtonPress = currentTime;
-        Serial.printf("[Display] Button pressed - Page %d -> %d\n", currentPage, (currentPage + 1) % 5);
+        uint32_t edge = buttonEdgeMicros;
+        buttonEdgeMicros = 0;
         nextPage();
+        if (edge) {
+          recordInputLatency(micros() - edge);
+        }
+        Serial.printf("[Display] Button pressed - Page %d (%lu us)\n", currentPage, (unsigned long)inputLatency.lastMicros);
       }
     }
     
+    // Stable release: forget edges left over from release bounce
+    if (buttonState == HIGH && lastButtonState == HIGH) {
+      buttonEdgeMicros = 0;
+    }
+    
     lastButtonState = buttonState;
   }
   
+  void recordInputLatency(uint32_t elapsed) {
+    inputLatency.inputs++;
+    inputLatency.lastMicros = elapsed;
+    if (elapsed > inputLatency.maxMicros) {
+      inputLatency.maxMicros = elapsed;
+    }
+    if (elapsed > INPUT_LATENCY_TARGET_US) {
+      inputLatency.overTarget++;
+    }
+  }
+  
+  const InputLatencyStats& getInputLatency() const {
+    return inputLatency;
+  }
+  
   void nextPage() {
     currentPage++;
     if (currentPage > 4) {  // 5 pages: 0=title, 1=today, 2=tomorrow, 3=week, 4=network
@@ -0,0 +1,90 @@
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include <ESPAsyncWebServer.h>
+#include <functional>
+#include <vector>
+#include "Data_Lock.h"
+
+/*
+ * EVENT STREAM
+ * GET /api/events (Server-Sent Events). Açık sekmeler değişiklikleri buradan
+ * alır, polling yapmaz:
+ *   hello   : bağlanınca anlık durum (revision, etag, counts, network, time)
+ *   change  : commit edilen görev/proje kayıtları (journal formatında)
+ *   counts  : bugün/yarın/hafta/gecikmiş sayıları değişti
+ *   network : WiFi modu / bağlantı / IP değişti
+ *   time    : cihaz saati tarayıcıdan ayarlandı
+ *   resync  : olay kaçtı - istemci /api/todos'u yeniden alır
+ *
+ * Olaylar DataLock altında kuyruğa alınır (mutasyonun içinden), net görevi
+ * kilidi bırakıp gönderir. Bağlı istemci yoksa hiçbir şey kuyruğa girmez.
+ */
+
+class EventStream {
+public:
+    static const size_t MAX_PENDING = 16;   // beyond this clients are told to resync
+    static const uint32_t RETRY_MS = 3000;  // browser reconnect delay after a drop
+
+    EventStream() : source("/api/events") {}
+
+    // hello() builds the initial state; it runs in the async_tcp task under DataLock
+    void begin(AsyncWebServer& server, std::function<String()> hello) {
+        source.onConnect([hello](AsyncEventSourceClient* client) {
+            String data;
+            {
+                DataLock lock;
+                data = hello();
+            }
+            client->send(data.c_str(), "hello", 0, RETRY_MS);
+        });
+        server.addHandler(&source);
+    }
+
+    size_t clients() {
+        return source.count();
+    }
+
+    // Caller holds DataLock
+    void queue(const char* event, const String& data) {
+        if (clients() == 0) {
+            return;
+        }
+        if (pending.size() >= MAX_PENDING) {
+            overflowed = true;
+            return;
+        }
+        pending.push_back(Event{event, data});
+    }
+
+    // Net task: drains the queue without holding the lock
+    void publish() {
+        std::vector<Event> batch;
+        bool resync;
+        {
+            DataLock lock;
+            if (pending.empty() && !overflowed) return;
+            batch.swap(pending);
+            resync = overflowed;
+            overflowed = false;
+        }
+        for (const Event& event : batch) {
+            source.send(event.data.c_str(), event.name);
+        }
+        if (resync) {
+            source.send("{}", "resync");
+        }
+    }
+
+private:
+    struct Event {
+        const char* name;
+        String data;
+    };
+
+    AsyncEventSource source;
+    std::vector<Event> pending;
+    bool overflowed = false;
+};
+
+#endif
@@ -0,0 +1,280 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "Data_Manager.h"
+#include "Task_Monitor.h"
+
+/*
+ * METRICS
+ * GET /api/metrics                   -> JSON
+ * GET /api/metrics?format=prometheus -> Prometheus text format (scrape)
+ *
+ * Her route için istek sayısı, hata (>= 400), yanıt byte'ı ve gecikme
+ * histogramı; yanında heap (en düşük boş, en büyük blok), flash'a yazılan
+ * byte'lar ve görev döngü süreleri (TaskMonitor). Sayaçlar açılıştan beri
+ * birikir - iki firmware karşılaştırılırken aynı yük iki kez koşulur.
+ *
+ * Gecikme: handler'ın başından yanıtın kuyruğa girmesine kadar; ertelenen
+ * (net görevi) isteklerde kuyrukta bekleme de dahil.
+ *
+ * Byte: gövdenin yazıldığı yerde sayılır (ResponseStream, beginPartResponse,
+ * sendText). Route sarmalayıcıları slotu isteğe bağlar (bind); chunked
+ * yanıtların byte'ları gönderim sürdükçe eklenir.
+ */
+
+class Metrics {
+public:
+    static const int MAX_ROUTES = 64;
+    static const int BUCKETS = 10;
+
+    struct Route {
+        const char* path;
+        const char* method;
+        uint32_t count;
+        uint32_t errors;            // status >= 400
+        uint64_t bytes;             // response bodies
+        uint64_t sumMicros;
+        uint32_t maxMicros;
+        uint32_t buckets[BUCKETS];  // requests per latency bucket, not cumulative
+        uint32_t overflow;          // slower than the last bucket
+    };
+
+    // Upper bucket bounds in microseconds
+    static uint32_t bucketBound(int i) {
+        static const uint32_t bounds[BUCKETS] = {
+            1000, 2000, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000
+        };
+        return bounds[i];
+    }
+
+    // Called while the routes are registered; returns the slot for record()
+    static int add(const char* path, const char* method) {
+        if (count() >= MAX_ROUTES) {
+            Serial.printf("[Metrics] ✗ No slot for %s %s\n", method, path);
+            return -1;
+        }
+        int slot = count()++;
+        Route& route = routes()[slot];
+        memset(&route, 0, sizeof(route));
+        route.path = path;
+        route.method = method;
+        return slot;
+    }
+
+    // Route wrappers tag the request so the body writers can find its slot
+    static void bind(AsyncWebServerRequest* request, int slot) {
+        request->setAttribute(SLOT_ATTRIBUTE, (long)slot);
+    }
+
+    static int slotOf(AsyncWebServerRequest* request) {
+        return (int)request->getAttribute(SLOT_ATTRIBUTE, -1L);
+    }
+
+    // Response body bytes, counted by whoever writes the body; safe from any task
+    static void countBytes(int slot, size_t bytes) {
+        if (slot < 0) return;
+        portENTER_CRITICAL(&lock());
+        routes()[slot].bytes += bytes;
+        portEXIT_CRITICAL(&lock());
+    }
+
+    static void countBytes(AsyncWebServerRequest* request, size_t bytes) {
+        countBytes(slotOf(request), bytes);
+    }
+
+    // Safe from any task (async_tcp, net)
+    static void record(int slot, uint32_t elapsedMicros, int status) {
+        if (slot < 0) return;
+        int bucket = 0;
+        while (bucket < BUCKETS && elapsedMicros > bucketBound(bucket)) {
+            bucket++;
+        }
+
+        portENTER_CRITICAL(&lock());
+        Route& route = routes()[slot];
+        route.count++;
+        if (status >= 400) route.errors++;
+        route.sumMicros += elapsedMicros;
+        if (elapsedMicros > route.maxMicros) route.maxMicros = elapsedMicros;
+        if (bucket < BUCKETS) {
+            route.buckets[bucket]++;
+        } else {
+            route.overflow++;
+        }
+        portEXIT_CRITICAL(&lock());
+    }
+
+    // Response queued by the handler: its status (the body counts itself)
+    static void record(int slot, uint32_t elapsedMicros, AsyncWebServerRequest* request) {
+        AsyncWebServerResponse* response = request->getResponse();
+        record(slot, elapsedMicros, response ? response->code() : 0);
+    }
+
+    // Output comes in parts - system values, then one route per part - so a
+    // chunked response holds a single part in RAM; every route hit makes the
+    // Prometheus text tens of KB. Returns false past the last part.
+    static bool writePart(Print& out, bool prometheus, int part, const StorageStats& storage) {
+        int routeCount = count();
+        if (part == 0) {
+            if (prometheus) {
+                writeSystemPrometheus(out, storage);
+            } else {
+                writeSystemJson(out, storage);
+            }
+            return true;
+        }
+        part--;
+
+        if (!prometheus) {
+            if (part < routeCount) {
+                writeRouteJson(out, part);
+            } else if (part == routeCount) {
+                out.print("]}");
+            } else {
+                return false;
+            }
+            return true;
+        }
+
+        // Prometheus wants each metric family in one block: family-major order
+        if (routeCount == 0 || part >= 3 * routeCount) {
+            return false;
+        }
+        writeRoutePrometheus(out, part / routeCount, part % routeCount);
+        return true;
+    }
+
+private:
+    static constexpr const char* SLOT_ATTRIBUTE = "metrics.slot";
+
+    static void writeSystemJson(Print& out, const StorageStats& storage) {
+        out.printf("{\"uptimeMs\":%lu,\"heap\":{\"free\":%u,\"minFree\":%u,\"largestBlock\":%u,\"size\":%u}",
+                   millis(), (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMinFreeHeap(),
+                   (unsigned)ESP.getMaxAllocHeap(), (unsigned)ESP.getHeapSize());
+        out.printf(",\"storage\":{\"bytesWritten\":%u,\"flushes\":%u,\"compactions\":%u,\"maxSaveUs\":%u}",
+                   (unsigned)storage.bytesWritten, (unsigned)storage.flushes,
+                   (unsigned)storage.compactions, (unsigned)storage.maxSaveMicros);
+
+        out.print(",\"tasks\":");
+        TaskMonitor::writeJson(out);
+
+        out.print(",\"bucketsUs\":[");
+        for (int i = 0; i < BUCKETS; i++) {
+            out.printf(i ? ",%u" : "%u", (unsigned)bucketBound(i));
+        }
+        out.print("],\"routes\":[");
+    }
+
+    static void writeRouteJson(Print& out, int slot) {
+        Route route = snapshot(slot);
+        out.printf("%s{\"method\":\"%s\",\"path\":\"%s\",\"count\":%u,\"errors\":%u,\"bytes\":%llu,\"sumUs\":%llu,\"maxUs\":%u,\"buckets\":[",
+                   slot ? "," : "", route.method, route.path, (unsigned)route.count, (unsigned)route.errors,
+                   (unsigned long long)route.bytes, (unsigned long long)route.sumMicros, (unsigned)route.maxMicros);
+        for (int b = 0; b < BUCKETS; b++) {
+            out.printf(b ? ",%u" : "%u", (unsigned)route.buckets[b]);
+        }
+        out.printf("],\"overflow\":%u}", (unsigned)route.overflow);
+    }
+
+    static void writeSystemPrometheus(Print& out, const StorageStats& storage) {
+        gauge(out, "to2do_uptime_seconds", "Seconds since boot", millis() / 1000.0);
+        gauge(out, "to2do_heap_free_bytes", "Free heap", ESP.getFreeHeap());
+        gauge(out, "to2do_heap_min_free_bytes", "Lowest free heap since boot", ESP.getMinFreeHeap());
+        gauge(out, "to2do_heap_largest_block_bytes", "Largest allocatable heap block", ESP.getMaxAllocHeap());
+        counter(out, "to2do_storage_written_bytes_total", "Bytes written to flash by the data layer", storage.bytesWritten);
+        counter(out, "to2do_storage_flushes_total", "Journal appends on flash", storage.flushes);
+        counter(out, "to2do_storage_compactions_total", "Snapshot and shard rewrites", storage.compactions);
+        gauge(out, "to2do_storage_max_save_seconds", "Slowest save since boot", storage.maxSaveMicros / 1e6);
+
+        out.print("# HELP to2do_task_cycles_total Loop turns per task\n# TYPE to2do_task_cycles_total counter\n");
+        forEachLoopTask([&](const TaskMonitor::Entry& task) {
+            out.printf("to2do_task_cycles_total{task=\"%s\"} %u\n", task.name, (unsigned)task.cycles);
+        });
+        out.print("# HELP to2do_task_busy_seconds_total Time spent inside loop turns\n# TYPE to2do_task_busy_seconds_total counter\n");
+        forEachLoopTask([&](const TaskMonitor::Entry& task) {
+            out.printf("to2do_task_busy_seconds_total{task=\"%s\"} %.6f\n", task.name, task.busyMicros / 1e6);
+        });
+        out.print("# HELP to2do_task_max_cycle_seconds Longest loop turn since boot\n# TYPE to2do_task_max_cycle_seconds gauge\n");
+        forEachLoopTask([&](const TaskMonitor::Entry& task) {
+            out.printf("to2do_task_max_cycle_seconds{task=\"%s\"} %.6f\n", task.name, task.maxCycleMicros / 1e6);
+        });
+    }
+
+    // family 0: latency histogram, 1: errors, 2: response bytes
+    static void writeRoutePrometheus(Print& out, int family, int slot) {
+        static const char* const names[] = {
+            "to2do_http_request_duration_seconds", "to2do_http_errors_total", "to2do_http_response_bytes_total"
+        };
+        static const char* const help[] = {
+            "Handler latency per route", "Responses with status >= 400", "Response body bytes"
+        };
+        static const char* const types[] = {"histogram", "counter", "counter"};
+        const char* name = names[family];
+        if (slot == 0) {
+            out.printf("# HELP %s %s\n# TYPE %s %s\n", name, help[family], name, types[family]);
+        }
+
+        Route route = snapshot(slot);
+        if (family == 1) {
+            out.printf("%s{method=\"%s\",path=\"%s\"} %u\n", name, route.method, route.path, (unsigned)route.errors);
+            return;
+        }
+        if (family == 2) {
+            out.printf("%s{method=\"%s\",path=\"%s\"} %llu\n", name, route.method, route.path, (unsigned long long)route.bytes);
+            return;
+        }
+        uint32_t cumulative = 0;
+        for (int b = 0; b < BUCKETS; b++) {
+            cumulative += route.buckets[b];
+            out.printf("%s_bucket{method=\"%s\",path=\"%s\",le=\"%g\"} %u\n",
+                       name, route.method, route.path, bucketBound(b) / 1e6, (unsigned)cumulative);
+        }
+        out.printf("%s_bucket{method=\"%s\",path=\"%s\",le=\"+Inf\"} %u\n", name, route.method, route.path, (unsigned)route.count);
+        out.printf("%s_sum{method=\"%s\",path=\"%s\"} %.6f\n", name, route.method, route.path, route.sumMicros / 1e6);
+        out.printf("%s_count{method=\"%s\",path=\"%s\"} %u\n", name, route.method, route.path, (unsigned)route.count);
+    }
+
+    static Route* routes() {
+        static Route table[MAX_ROUTES];
+        return table;
+    }
+
+    static int& count() {
+        static int used = 0;
+        return used;
+    }
+
+    static portMUX_TYPE& lock() {
+        static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+        return mux;
+    }
+
+    // Consistent copy - the writers print without holding the spinlock
+    static Route snapshot(int slot) {
+        portENTER_CRITICAL(&lock());
+        Route route = routes()[slot];
+        portEXIT_CRITICAL(&lock());
+        return route;
+    }
+
+    // Tasks started through TaskMonitor::start (library tasks have no cycle data)
+    template <typename Visit>
+    static void forEachLoopTask(Visit visit) {
+        for (int i = 0; i < TaskMonitor::taskCount(); i++) {
+            const TaskMonitor::Entry& task = TaskMonitor::task(i);
+            if (task.stackSize > 0) visit(task);
+        }
+    }
+
+    static void gauge(Print& out, const char* name, const char* help, double value) {
+        out.printf("# HELP %s %s\n# TYPE %s gauge\n%s %.9g\n", name, help, name, name, value);
+    }
+
+    static void counter(Print& out, const char* name, const char* help, double value) {
+        out.printf("# HELP %s %s\n# TYPE %s counter\n%s %.0f\n", name, help, name, name, value);
+    }
+};
+
+#endif
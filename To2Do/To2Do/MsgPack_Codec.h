@@ -0,0 +1,114 @@
+#ifndef MSGPACK_CODEC_H
+#define MSGPACK_CODEC_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <FS.h>
+
+/*
+ * MSGPACK CODEC
+ * Flash'taki snapshot ve shard dosyalarının ikili (MessagePack) formatı.
+ * Sık tekrarlanan anahtarlar ("projectId", "completed", ...) tek baytlık
+ * kodlara çevrilir (interned keys): "\x02" <-> "projectId".
+ *
+ * KEYS tablosu dosya formatının parçasıdır: sadece sona ekleme yapın,
+ * sıra değiştirmek/silmek eski dosyaları bozar. Tablo dışındaki anahtarlar
+ * olduğu gibi yazılır. REST API ve yedekler JSON kalır; bu sadece disk formatı.
+ */
+
+class MsgPackCodec {
+public:
+    // Compacts keys and writes MessagePack; returns bytes written (0 on failure)
+    static size_t write(File& file, JsonVariantConst source) {
+        JsonDocument packed;
+        copy(source, packed.to<JsonVariant>(), true);
+        return serializeMsgPack(packed, file);
+    }
+
+    static DeserializationError read(File& file, JsonDocument& doc) {
+        JsonDocument packed;
+        DeserializationError error = deserializeMsgPack(packed, file);
+        if (error) {
+            return error;
+        }
+        doc.clear();
+        copy(packed.as<JsonVariantConst>(), doc.to<JsonVariant>(), false);
+        return DeserializationError::Ok;
+    }
+
+    // In-memory variants, used by the format benchmark
+    static size_t write(String& output, JsonVariantConst source) {
+        JsonDocument packed;
+        copy(source, packed.to<JsonVariant>(), true);
+        return serializeMsgPack(packed, output);
+    }
+
+    static DeserializationError read(const String& input, JsonDocument& doc) {
+        JsonDocument packed;
+        DeserializationError error = deserializeMsgPack(packed, input);
+        if (error) {
+            return error;
+        }
+        doc.clear();
+        copy(packed.as<JsonVariantConst>(), doc.to<JsonVariant>(), false);
+        return DeserializationError::Ok;
+    }
+
+private:
+    static constexpr size_t KEY_COUNT = 24;
+
+    static const char* key(size_t i) {
+        static const char* const KEYS[KEY_COUNT] = {
+            "id", "projectId", "title", "description", "type", "priority",
+            "date", "completed", "checklist", "dependencies", "text", "name",
+            "category", "archived", "settings", "network", "projects", "tasks",
+            "repeat", "freq", "every", "days", "until", "done"
+        };
+        return KEYS[i];
+    }
+
+    static const char* code(size_t i) {
+        static const char CODES[KEY_COUNT][2] = {
+            {1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 0}, {6, 0}, {7, 0}, {8, 0}, {9, 0},
+            {10, 0}, {11, 0}, {12, 0}, {13, 0}, {14, 0}, {15, 0}, {16, 0}, {17, 0}, {18, 0},
+            {19, 0}, {20, 0}, {21, 0}, {22, 0}, {23, 0}, {24, 0}
+        };
+        return CODES[i];
+    }
+
+    static const char* compactKey(const char* name) {
+        for (size_t i = 0; i < KEY_COUNT; i++) {
+            if (strcmp(name, key(i)) == 0) {
+                return code(i);
+            }
+        }
+        return name;
+    }
+
+    static const char* expandKey(const char* name) {
+        uint8_t c = (uint8_t)name[0];
+        if (c >= 1 && c <= KEY_COUNT && name[1] == '\0') {
+            return key(c - 1);
+        }
+        return name;
+    }
+
+    static void copy(JsonVariantConst source, JsonVariant target, bool compact) {
+        if (source.is<JsonObjectConst>()) {
+            JsonObject object = target.to<JsonObject>();
+            for (JsonPairConst pair : source.as<JsonObjectConst>()) {
+                const char* name = pair.key().c_str();
+                copy(pair.value(), object[compact ? compactKey(name) : expandKey(name)].to<JsonVariant>(), compact);
+            }
+        } else if (source.is<JsonArrayConst>()) {
+            JsonArray array = target.to<JsonArray>();
+            for (JsonVariantConst item : source.as<JsonArrayConst>()) {
+                copy(item, array.add<JsonVariant>(), compact);
+            }
+        } else {
+            target.set(source);
+        }
+    }
+};
+
+#endif
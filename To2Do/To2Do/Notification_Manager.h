@@ -4,6 +4,17 @@
 #include <ArduinoJson.h>
 #include "Data_Manager.h"
 #include "Time_Manager.h"
+#include "Task_Index.h"
+#include <vector>
+#include <algorithm>
+
+// Task counts per notification window (OLED summary)
+struct TaskCounts {
+    int today = 0;
+    int tomorrow = 0;
+    int week = 0;
+    int overdue = 0;
+};
 
 class NotificationManager {
 private:
@@ -11,196 +22,206 @@ private:
     TimeManager* timeManager;
     int timezoneOffset; // in hours (fallback)
     
-    struct DateInfo {
-        int year;
-        int month;
-        int day;
+    // One task occurrence in a notification window
+    struct Match {
+        int projectId;
+        int taskId;
+        DateCore::Day day;
+        bool completed;
+        bool recurring;
+        
+        bool operator<(const Match& o) const {
+            if (projectId != o.projectId) return projectId < o.projectId;
+            if (taskId != o.taskId) return taskId < o.taskId;
+            return day < o.day;
+        }
     };
     
+    // Counts cache - valid while data revision and current day are unchanged
+    TaskCounts cachedCounts;
+    uint32_t countsRevision;
+    DateCore::Day countsDay;
+    bool countsValid;
+    
 public:
-    NotificationManager(DataManager* dm) : dataManager(dm), timeManager(nullptr), timezoneOffset(0) {}
+    NotificationManager(DataManager* dm) : dataManager(dm), timeManager(nullptr), timezoneOffset(0),
+                                           countsRevision(0), countsDay(0), countsValid(false) {}
     
     void setTimeManager(TimeManager* tm) {
         timeManager = tm;
     }
     
     void setTimezoneOffset(int offset) {
-        timezoneOffset = offset;
+        timezoneOffset = constrain(offset, -14, 14);
     }
     
-    DateInfo getCurrentDate() {
-        DateInfo date;
-        
-        // Try to get date from TimeManager first (browser-synced date from SPIFFS)
-        if (timeManager) {
-            int year, month, day;
-            timeManager->getDateComponents(year, month, day);
-            
-            if (year > 2024) { // Valid date
-                date.year = year;
-                date.month = month;
-                date.day = day;
-                return date;
-            }
+    int getTimezoneOffset() const {
+        return timezoneOffset;
+    }
+    
+    // Today as an epoch day: browser-synced clock, else system time, else a fixed date
+    DateCore::Day getCurrentDay() {
+        if (timeManager && timeManager->isDateValid()) {
+            return timeManager->today();
         }
         
-        // Fallback to system time (ESP32 built-in)
+        // Fallback to system time (ESP32 built-in, UTC) shifted by the offset
         time_t now;
         struct tm timeinfo;
         time(&now);
-        localtime_r(&now, &timeinfo);
+        now += (time_t)timezoneOffset * 3600;
+        gmtime_r(&now, &timeinfo);
         
         // Check if time is valid (after 2024)
         if (timeinfo.tm_year + 1900 > 2024) {
-            date.year = timeinfo.tm_year + 1900;
-            date.month = timeinfo.tm_mon + 1;
-            date.day = timeinfo.tm_mday;
-            return date;
+            return DateCore::daysFromCivil(timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday);
         }
         
         // Final fallback: use current actual date (October 21, 2025)
-        date.year = 2025;
-        date.month = 10;
-        date.day = 21;
-        
-        return date;
-    }
-    
-    String dateToString(DateInfo date) {
-        char buffer[11];
-        sprintf(buffer, "%04d-%02d-%02d", date.year, date.month, date.day);
-        return String(buffer);
+        return DateCore::daysFromCivil(2025, 10, 21);
     }
     
-    DateInfo stringToDate(String dateStr) {
-        DateInfo date;
-        if (dateStr.length() >= 10) {
-            date.year = dateStr.substring(0, 4).toInt();
-            date.month = dateStr.substring(5, 7).toInt();
-            date.day = dateStr.substring(8, 10).toInt();
-        } else {
-            date.year = 0;
-            date.month = 0;
-            date.day = 0;
+    // All four windows from two walks over the task index (the coming week,
+    // then overdue); cached until the data revision or the date changes
+    TaskCounts getTaskCounts() {
+        if (!dataManager) {
+            return TaskCounts();
         }
-        return date;
-    }
-    
-    DateInfo addDays(DateInfo date, int days) {
-        struct tm timeinfo = {0};
-        timeinfo.tm_year = date.year - 1900;
-        timeinfo.tm_mon = date.month - 1;
-        timeinfo.tm_mday = date.day + days;
-        
-        time_t timestamp = mktime(&timeinfo);
-        struct tm* newTime = localtime(&timestamp);
-        
-        DateInfo newDate;
-        newDate.year = newTime->tm_year + 1900;
-        newDate.month = newTime->tm_mon + 1;
-        newDate.day = newTime->tm_mday;
-        return newDate;
-    }
-    
-    int compareDates(DateInfo date1, DateInfo date2) {
-        if (date1.year != date2.year) return date1.year - date2.year;
-        if (date1.month != date2.month) return date1.month - date2.month;
-        return date1.day - date2.day;
+        
+        DateCore::Day todayDay = getCurrentDay();
+        uint32_t revision = dataManager->getRevision();
+        
+        if (countsValid && countsRevision == revision && countsDay == todayDay) {
+            return cachedCounts;
+        }
+        
+        TaskCounts counts;
+        const TaskIndex& index = dataManager->getTaskIndex();
+        index.forEachDue(todayDay, todayDay + 7, false, [&](size_t, DateCore::Day day, bool) {
+            int32_t offset = day - todayDay;
+            if (offset == 0) counts.today++;
+            if (offset == 1) counts.tomorrow++;
+            counts.week++;
+        });
+        counts.overdue = index.forEachOverdue(todayDay, [](size_t, DateCore::Day) {});
+        
+        cachedCounts = counts;
+        countsRevision = revision;
+        countsDay = todayDay;
+        countsValid = true;
+        return counts;
     }
     
-    String getNotifications(String filterType) {
+    // excludeBlocked: leave out tasks still waiting on an open dependency
+    String getNotifications(String filterType, bool excludeBlocked = false) {
         if (!dataManager) {
             return "{\"error\":\"DataManager not initialized\"}";
         }
         
-        DateInfo today = getCurrentDate();
-        
-        if (today.year == 0) {
-            return "{\"error\":\"No valid date available\",\"count\":0}";
+        // Window over epoch days - matched on the task index, no JSON parsing
+        DateCore::Day todayDay = getCurrentDay();
+        DateCore::Day fromDay = todayDay;
+        DateCore::Day toDay = todayDay;
+        
+        if (filterType == "tomorrow") {
+            fromDay = toDay = todayDay + 1;
+        } else if (filterType == "week") {
+            toDay = todayDay + 7;
+        } else if (filterType != "today" && filterType != "overdue") {
+            fromDay = 1;
+            toDay = 0; // unknown filter: empty result
         }
         
-        String todosData = dataManager->getTodosData();
-        DynamicJsonDocument doc(24576);
-        DeserializationError error = deserializeJson(doc, todosData);
-        
-        if (error) {
-            return "{\"error\":\"Failed to parse data\"}";
+        // Recurring tasks come back once per occurrence in the window
+        const TaskIndex& index = dataManager->getTaskIndex();
+        std::vector<Match> matches;
+        if (filterType == "overdue") {
+            index.forEachOverdue(todayDay, [&](size_t pos, DateCore::Day day) {
+                matches.push_back(Match{index.projectId(pos), index.id(pos), day, false, index.isRecurring(pos)});
+            });
+        } else {
+            index.forEachDue(fromDay, toDay, false, [&](size_t pos, DateCore::Day day, bool completed) {
+                matches.push_back(Match{index.projectId(pos), index.id(pos), day, completed, index.isRecurring(pos)});
+            });
         }
         
-        DateInfo tomorrow = addDays(today, 1);
-        DateInfo weekEnd = addDays(today, 7);
-        
-        JsonArray tasks = doc["tasks"];
-        JsonArray projects = doc["projects"];
+        // Blocked state is kept current by the dependency graph: one lookup per match
+        const DependencyGraph& graph = dataManager->getDependencyGraph();
+        if (excludeBlocked) {
+            matches.erase(std::remove_if(matches.begin(), matches.end(),
+                                         [&](const Match& match) { return graph.isBlocked(match.taskId); }),
+                          matches.end());
+        }
         
-        DynamicJsonDocument result(24576);
-        JsonObject categories = result.createNestedObject("categories");
-        int totalCount = 0;
+        // Grouped by project id: each task shard is loaded at most once
+        std::sort(matches.begin(), matches.end());
         
-        for (JsonObject task : tasks) {
-            String taskDateStr = task["date"].as<String>();
-            
-            // Skip tasks without date
-            if (taskDateStr.length() == 0 || taskDateStr == "null" || taskDateStr == "") {
-                continue;
-            }
-            
-            DateInfo taskDate = stringToDate(taskDateStr);
-            if (taskDate.year == 0) {
-                continue;
+        // Resolve the matched projects in a single walk over the project list
+        std::vector<int> groupIds;
+        for (const Match& match : matches) {
+            if (groupIds.empty() || groupIds.back() != match.projectId) {
+                groupIds.push_back(match.projectId);
             }
-            
-            bool include = false;
-            
-            if (filterType == "today") {
-                include = (compareDates(taskDate, today) == 0);
-            } else if (filterType == "tomorrow") {
-                include = (compareDates(taskDate, tomorrow) == 0);
-            } else if (filterType == "week") {
-                include = (compareDates(taskDate, today) >= 0 && compareDates(taskDate, weekEnd) <= 0);
-            } else if (filterType == "overdue") {
-                include = (compareDates(taskDate, today) < 0 && !task["completed"].as<bool>());
+        }
+        std::vector<JsonObjectConst> groupProjects(groupIds.size());
+        for (JsonObjectConst project : dataManager->getProjectList()) {
+            auto it = std::lower_bound(groupIds.begin(), groupIds.end(), project["id"] | -1);
+            if (it != groupIds.end() && *it == (project["id"] | -1)) {
+                groupProjects[it - groupIds.begin()] = project;
             }
-            
-            if (!include) continue;
-            
-            totalCount++;
-            
-            // Find project
-            int projectId = task["projectId"];
-            String projectName = "Unknown";
-            String category = "Uncategorized";
-            
-            for (JsonObject project : projects) {
-                if (project["id"] == projectId) {
-                    projectName = project["name"].as<String>();
-                    category = project["category"].as<String>();
-                    break;
+        }
+        
+        JsonDocument result;
+        JsonObject categories = result["categories"].to<JsonObject>();
+        int totalCount = matches.size();
+        
+        JsonArray projectTasks;
+        int currentProject = INT32_MIN;
+        size_t group = 0;
+        
+        for (const Match& match : matches) {
+            if (match.projectId != currentProject) {
+                if (currentProject != INT32_MIN) group++;
+                currentProject = match.projectId;
+                
+                JsonObjectConst project = groupProjects[group];
+                const char* projectName = project.isNull() ? "Unknown" : (project["name"] | "Unknown");
+                const char* category = project.isNull() ? "Uncategorized" : (project["category"] | "Uncategorized");
+                
+                // Build nested structure (one lookup per project, not per task)
+                JsonObject categoryObj = categories[category];
+                if (categoryObj.isNull()) {
+                    categoryObj = categories[category].to<JsonObject>();
+                }
+                projectTasks = categoryObj[projectName];
+                if (projectTasks.isNull()) {
+                    projectTasks = categoryObj[projectName].to<JsonArray>();
                 }
             }
             
-            // Build nested structure
-            if (!categories.containsKey(category)) {
-                categories.createNestedObject(category);
-            }
-            
-            JsonObject categoryObj = categories[category];
-            if (!categoryObj.containsKey(projectName)) {
-                categoryObj.createNestedArray(projectName);
-            }
-            
-            JsonArray projectTasks = categoryObj[projectName];
-            JsonObject taskInfo = projectTasks.createNestedObject();
-            taskInfo["id"] = task["id"];
+            JsonObjectConst task = dataManager->getTask(match.taskId);
+            JsonObject taskInfo = projectTasks.add<JsonObject>();
+            taskInfo["id"] = match.taskId;
             taskInfo["title"] = task["title"];
-            taskInfo["date"] = taskDateStr;
-            taskInfo["completed"] = task["completed"];
+            if (match.recurring) {
+                // The occurrence date; a time after the first date carries over
+                const char* time = task["date"].as<const char*>();
+                taskInfo["date"] = DateCore::formatDate(match.day) + (time && strlen(time) > 10 ? time + 10 : "");
+                taskInfo["completed"] = match.completed;
+                taskInfo["recurring"] = true;
+            } else {
+                taskInfo["date"] = task["date"];
+                taskInfo["completed"] = task["completed"];
+            }
             taskInfo["priority"] = task["priority"];
+            if (graph.isBlocked(match.taskId)) {
+                taskInfo["blocked"] = true;
+            }
         }
         
         result["count"] = totalCount;
         result["filter"] = filterType;
-        result["currentDate"] = dateToString(today);
+        result["currentDate"] = DateCore::formatDate(todayDay);
         
         String output;
         serializeJson(result, output);
@@ -23,13 +23,13 @@ public:
         return dataManager->begin();
     }
     
-    String loadTodos() {
-        if (!dataManager) return "{}";
-        return dataManager->getTodosData();
+    size_t streamTodos(Print& out) {
+        if (!dataManager) return out.print("{}");
+        return dataManager->writeTodos(out);
     }
     
-    bool saveTodos(const String& todosJson) {
-        if (!dataManager) return false;
+    MutationStatus saveTodos(const String& todosJson) {
+        if (!dataManager) return MUTATION_FAILED;
         return dataManager->setTodosData(todosJson);
     }
     
@@ -38,6 +38,11 @@ public:
         return dataManager->getSettings();
     }
     
+    size_t streamSettings(Print& out) {
+        if (!dataManager) return out.print("{}");
+        return dataManager->writeSettings(out);
+    }
+    
     bool saveSettings(const String& settingsJson) {
         if (!dataManager) return false;
         return dataManager->setSettings(settingsJson);
@@ -48,6 +53,11 @@ public:
         return dataManager->getNetworkSettings();
     }
     
+    size_t streamNetworkSettings(Print& out) {
+        if (!dataManager) return out.print("{}");
+        return dataManager->writeNetworkSettings(out);
+    }
+    
     bool saveNetworkSettings(const String& networkJson) {
         if (!dataManager) return false;
         return dataManager->setNetworkSettings(networkJson);
@@ -58,6 +68,11 @@ public:
         return dataManager->factoryReset();
     }
     
+    // Call from loop(): flushes queued changes once they have settled
+    void loop() {
+        if (dataManager) dataManager->tick();
+    }
+    
     DataManager* getDataManager() {
         return dataManager;
     }
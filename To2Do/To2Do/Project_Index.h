@@ -0,0 +1,54 @@
+#ifndef PROJECT_INDEX_H
+#define PROJECT_INDEX_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <vector>
+#include <algorithm>
+
+/*
+ * PROJECT INDEX
+ * Proje id -> "projects" dizisindeki konum. Id'ye göre sıralı vektör,
+ * binary search ile O(log P) erişim. Proje dizisi her değiştiğinde
+ * yeniden kurulur (proje değişiklikleri seyrek, okumalar sık).
+ */
+
+class ProjectIndex {
+public:
+    void rebuild(JsonArrayConst projects) {
+        entries.clear();
+        entries.reserve(projects.size());
+
+        uint16_t position = 0;
+        for (JsonObjectConst project : projects) {
+            entries.push_back(Entry{project["id"] | -1, position++});
+        }
+        std::sort(entries.begin(), entries.end(),
+                  [](const Entry& a, const Entry& b) { return a.id < b.id; });
+    }
+
+    void clear() {
+        entries.clear();
+    }
+
+    // Position in the projects array, or -1
+    int find(int id) const {
+        auto it = std::lower_bound(entries.begin(), entries.end(), id,
+                                   [](const Entry& entry, int value) { return entry.id < value; });
+        return (it != entries.end() && it->id == id) ? it->position : -1;
+    }
+
+    size_t size() const {
+        return entries.size();
+    }
+
+private:
+    struct Entry {
+        int32_t id;
+        uint16_t position;
+    };
+
+    std::vector<Entry> entries;
+};
+
+#endif
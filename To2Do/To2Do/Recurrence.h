@@ -0,0 +1,225 @@
+#ifndef RECURRENCE_H
+#define RECURRENCE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <vector>
+#include <algorithm>
+#include "Date_Core.h"
+
+/*
+ * RECURRENCE
+ * Tekrarlayan görev = tek görev kaydı + kural. Tekrarlar hiçbir zaman
+ * kayıt olarak üretilmez; bildirim pencereleri (bugün/yarın/hafta/gecikmiş)
+ * sorgu anında kuraldan açılır. Flash'ta yer O(kural), O(tekrar) değil.
+ *
+ *   "date"   : ilk tekrar (kuralın başlangıcı)
+ *   "repeat" : {"freq":"daily|weekly|monthly", "every":N,
+ *               "days":[0..6]   (weekly, 0 = Pazartesi; yoksa ilk günün günü),
+ *               "until":"YYYY-MM-DD" (opsiyonel, dahil),
+ *               "done":[epoch gün, ...]}  (tamamlanan tekrarlar, artan sırada)
+ *   "completed": true -> seri bitti, hiç tekrar üretilmez
+ *
+ * "Her N günde bir" = daily + every N. Aylık tekrar ayın kısa olduğu
+ * aylarda son güne kayar (31 -> 30/28). "done" en yeni MAX_DONE günü tutar;
+ * gecikmiş penceresi sadece bugünden önceki son tekrara baktığı için eskiler
+ * hiçbir sorguyu etkilemez.
+ */
+
+class Recurrence {
+public:
+    enum Frequency : uint8_t {
+        NONE = 0,
+        DAILY,
+        WEEKLY,
+        MONTHLY
+    };
+
+    static const size_t MAX_DONE = 32;
+    static const int MAX_EVERY = 366;
+
+    struct Rule {
+        DateCore::Day start = DateCore::NO_DATE;
+        DateCore::Day until = INT32_MAX;
+        uint16_t every = 1;
+        uint8_t frequency = NONE;
+        uint8_t weekdays = 0;            // weekly: bit 0 = Monday ... bit 6 = Sunday
+        std::vector<DateCore::Day> done; // sorted ascending
+
+        bool isValid() const { return frequency != NONE; }
+    };
+
+    // ==================== PARSING ====================
+
+    // Rule of a stored task; frequency NONE for one-off tasks and malformed rules
+    static Rule parse(JsonObjectConst task) {
+        Rule rule;
+        JsonObjectConst repeat = task["repeat"];
+        if (repeat.isNull()) return rule;
+
+        rule.start = DateCore::parseDate(task["date"].as<const char*>());
+        int every = repeat["every"] | 1;
+        uint8_t frequency = parseFrequency(repeat["freq"].as<const char*>());
+        if (rule.start == DateCore::NO_DATE || every < 1 || every > MAX_EVERY || frequency == NONE) {
+            return rule;
+        }
+        rule.every = (uint16_t)every;
+
+        if (!repeat["until"].isNull()) {
+            rule.until = DateCore::parseDate(repeat["until"].as<const char*>());
+            if (rule.until == DateCore::NO_DATE) return rule;
+        }
+
+        if (frequency == WEEKLY) {
+            for (JsonVariantConst day : repeat["days"].as<JsonArrayConst>()) {
+                int weekday = day | -1;
+                if (weekday < 0 || weekday > 6) return rule;
+                rule.weekdays |= 1 << weekday;
+            }
+            if (rule.weekdays == 0) {
+                rule.weekdays = 1 << DateCore::weekday(rule.start);
+            }
+        }
+
+        for (JsonVariantConst day : repeat["done"].as<JsonArrayConst>()) {
+            if (day.is<int32_t>()) rule.done.push_back(day.as<int32_t>());
+        }
+        std::sort(rule.done.begin(), rule.done.end());
+
+        rule.frequency = frequency;
+        return rule;
+    }
+
+    // A task without "repeat" is fine; one with a rule parse() rejects is not
+    static bool isValidTask(JsonObjectConst task) {
+        return task["repeat"].isNull() || parse(task).isValid();
+    }
+
+    // ==================== EXPANSION ====================
+
+    static bool occursOn(const Rule& rule, DateCore::Day day) {
+        if (!rule.isValid() || day < rule.start || day > rule.until) return false;
+
+        switch (rule.frequency) {
+            case DAILY:
+                return (day - rule.start) % rule.every == 0;
+            case WEEKLY:
+                return (rule.weekdays & (1 << DateCore::weekday(day))) &&
+                       ((weekStart(day) - weekStart(rule.start)) / 7) % rule.every == 0;
+            case MONTHLY: {
+                DateCore::Civil date = DateCore::civilFromDays(day);
+                int months = monthsSinceStart(rule, date);
+                return months % rule.every == 0 && day == monthlyDay(rule, months);
+            }
+        }
+        return false;
+    }
+
+    // visit(day) for each occurrence in [fromDay, toDay], ascending
+    template <typename Visitor>
+    static void forEach(const Rule& rule, DateCore::Day fromDay, DateCore::Day toDay, Visitor visit) {
+        if (!rule.isValid()) return;
+        fromDay = std::max(fromDay, rule.start);
+        toDay = std::min(toDay, rule.until);
+
+        if (rule.frequency == DAILY) {
+            int32_t offset = fromDay - rule.start;
+            DateCore::Day day = rule.start + (offset + rule.every - 1) / rule.every * rule.every;
+            for (; day <= toDay; day += rule.every) {
+                visit(day);
+            }
+            return;
+        }
+        // Notification windows are at most 8 days: checking each day is cheapest
+        for (DateCore::Day day = fromDay; day <= toDay; day++) {
+            if (occursOn(rule, day)) visit(day);
+        }
+    }
+
+    // Last occurrence strictly before day, or NO_DATE
+    static DateCore::Day latestBefore(const Rule& rule, DateCore::Day day) {
+        if (!rule.isValid()) return DateCore::NO_DATE;
+        DateCore::Day last = std::min(day - 1, rule.until);
+        if (last < rule.start) return DateCore::NO_DATE;
+
+        switch (rule.frequency) {
+            case DAILY:
+                return last - (last - rule.start) % rule.every;
+            case WEEKLY: {
+                DateCore::Day limit = std::max(rule.start, last - 7 * rule.every);
+                for (DateCore::Day d = last; d >= limit; d--) {
+                    if (occursOn(rule, d)) return d;
+                }
+                return DateCore::NO_DATE;
+            }
+            case MONTHLY: {
+                int months = monthsSinceStart(rule, DateCore::civilFromDays(last));
+                months -= months % rule.every;
+                if (monthlyDay(rule, months) > last) months -= rule.every;
+                return months >= 0 ? monthlyDay(rule, months) : DateCore::NO_DATE;
+            }
+        }
+        return DateCore::NO_DATE;
+    }
+
+    static bool isDone(const Rule& rule, DateCore::Day day) {
+        return std::binary_search(rule.done.begin(), rule.done.end(), day);
+    }
+
+    // ==================== COMPLETION ====================
+
+    // Marks one occurrence of a stored task (whole document, updated in place).
+    // False if the task has no rule or the rule has no occurrence on that day.
+    static bool setDone(JsonObject task, DateCore::Day day, bool done) {
+        Rule rule = parse(task);
+        if (!occursOn(rule, day)) return false;
+
+        auto it = std::lower_bound(rule.done.begin(), rule.done.end(), day);
+        bool present = it != rule.done.end() && *it == day;
+        if (done && !present) {
+            rule.done.insert(it, day);
+        } else if (!done && present) {
+            rule.done.erase(it);
+        }
+        if (rule.done.size() > MAX_DONE) {
+            rule.done.erase(rule.done.begin(), rule.done.end() - MAX_DONE);
+        }
+
+        JsonArray list = task["repeat"]["done"].to<JsonArray>();
+        for (DateCore::Day d : rule.done) {
+            list.add(d);
+        }
+        return true;
+    }
+
+private:
+    static uint8_t parseFrequency(const char* text) {
+        if (!text) return NONE;
+        if (strcmp(text, "daily") == 0) return DAILY;
+        if (strcmp(text, "weekly") == 0) return WEEKLY;
+        if (strcmp(text, "monthly") == 0) return MONTHLY;
+        return NONE;
+    }
+
+    static DateCore::Day weekStart(DateCore::Day day) {
+        return day - DateCore::weekday(day);
+    }
+
+    static int monthsSinceStart(const Rule& rule, const DateCore::Civil& date) {
+        DateCore::Civil start = DateCore::civilFromDays(rule.start);
+        return (date.year - start.year) * 12 + date.month - start.month;
+    }
+
+    // Occurrence in the month `months` after the start month; short months clamp the day
+    static DateCore::Day monthlyDay(const Rule& rule, int months) {
+        DateCore::Civil start = DateCore::civilFromDays(rule.start);
+        int index = start.month - 1 + months;
+        int year = start.year + index / 12;
+        int month = index % 12 + 1;
+        DateCore::Day first = DateCore::daysFromCivil(year, month, 1);
+        DateCore::Day next = DateCore::daysFromCivil(month == 12 ? year + 1 : year, month == 12 ? 1 : month + 1, 1);
+        return first + std::min(start.day, (int)(next - first)) - 1;
+    }
+};
+
+#endif
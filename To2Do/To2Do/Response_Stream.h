@@ -0,0 +1,146 @@
+#ifndef RESPONSE_STREAM_H
+#define RESPONSE_STREAM_H
+
+#include <ESPAsyncWebServer.h>
+
+#include <StreamString.h>
+#include <functional>
+#include <memory>
+#include "Metrics.h"
+
+/*
+ * Response Stream Writer
+ * Print adapter for serializeJson() and the DataManager writers: output is
+ * appended to an AsyncResponseStream and sent by the async server once the
+ * handler is done, so the handler never builds a String of its own.
+ * The whole body sits in RAM until it is sent - only for bodies whose size
+ * does not grow with the data (pages, settings, status). Use
+ * beginPartResponse() for the rest.
+ *
+ * Usage:
+ *   ResponseStream out(request);
+ *   out.begin(200, "application/json");
+ *   out.addHeader("ETag", etag);
+ *   serializeJson(doc, out);
+ *   out.end();
+ */
+
+class ResponseStream : public Print {
+private:
+    AsyncWebServerRequest* request;
+    AsyncResponseStream* stream;
+    size_t total;
+
+public:
+    ResponseStream(AsyncWebServerRequest* req)
+        : request(req), stream(nullptr), total(0) {}
+
+    void begin(int code, const char* contentType) {
+        stream = request->beginResponseStream(contentType);
+        stream->setCode(code);
+    }
+
+    void addHeader(const char* name, const String& value) {
+        if (stream) {
+            stream->addHeader(name, value);
+        }
+    }
+
+    size_t write(uint8_t c) override {
+        return write(&c, 1);
+    }
+
+    size_t write(const uint8_t* data, size_t len) override {
+        if (!stream) return 0;
+        size_t written = stream->write(data, len);
+        total += written;
+        return written;
+    }
+
+    // Hands the buffered body to the server
+    void end() {
+        if (!stream) return;
+        Metrics::countBytes(request, total);
+        request->send(stream);
+        stream = nullptr;
+    }
+
+    size_t bytesSent() const {
+        return total;
+    }
+};
+
+/*
+ * Part Response
+ * Chunked response for bodies that grow with the data (all todos, metrics,
+ * backup export). writePart(out, part) renders one part at a time - a shard,
+ * a route - into a small buffer the server drains across as many TCP chunks
+ * as it needs, then asks for the next part; false ends the body. RAM use is
+ * bounded by the largest part, not by the body.
+ *
+ * writePart runs later, in the async_tcp task, after the handler returned:
+ * it takes DataLock itself if it reads user data.
+ *
+ *   AsyncWebServerResponse* response = beginPartResponse(request, "application/json",
+ *       [](Print& out, size_t part) { ...; return part < last; });
+ *   request->send(response);
+ */
+
+struct PartResponseStats {
+    size_t bytes = 0;
+    size_t parts = 0;
+    size_t largestPart = 0;
+    uint32_t peakHeapUse = 0;   // heap taken at the worst point, measured after each part
+};
+
+using PartWriter = std::function<bool(Print& out, size_t part)>;
+
+inline AsyncWebServerResponse* beginPartResponse(AsyncWebServerRequest* request, const char* contentType,
+                                                 PartWriter writePart,
+                                                 std::function<void(const PartResponseStats&)> onEnd = nullptr) {
+    struct State {
+        PartWriter writePart;
+        std::function<void(const PartResponseStats&)> onEnd;
+        StreamString pending;   // current part
+        size_t offset = 0;
+        size_t part = 0;
+        bool done = false;
+        uint32_t heapAtStart = ESP.getFreeHeap();
+        int metricsSlot = -1;   // the request may be gone by the time a chunk is sent
+        PartResponseStats stats;
+    };
+    auto state = std::make_shared<State>();
+    state->metricsSlot = Metrics::slotOf(request);
+    state->writePart = std::move(writePart);
+    state->onEnd = std::move(onEnd);
+
+    return request->beginChunkedResponse(contentType,
+        [state](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+        while (state->offset >= state->pending.length()) {
+            state->pending = "";
+            state->offset = 0;
+            if (state->done || !state->writePart(state->pending, state->part++)) {
+                if (!state->done && state->onEnd) {
+                    state->onEnd(state->stats);
+                }
+                state->done = true;
+                return 0;
+            }
+            size_t length = state->pending.length();
+            uint32_t freeHeap = ESP.getFreeHeap();
+            state->stats.parts++;
+            state->stats.largestPart = max(state->stats.largestPart, length);
+            if (state->heapAtStart > freeHeap) {
+                state->stats.peakHeapUse = max(state->stats.peakHeapUse, state->heapAtStart - freeHeap);
+            }
+        }
+        size_t length = min(maxLen, state->pending.length() - state->offset);
+        memcpy(buffer, state->pending.c_str() + state->offset, length);
+        state->offset += length;
+        state->stats.bytes += length;
+        Metrics::countBytes(state->metricsSlot, length);
+        return length;
+    });
+}
+
+#endif
@@ -0,0 +1,266 @@
+#ifndef SEARCH_INDEX_H
+#define SEARCH_INDEX_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <vector>
+#include <algorithm>
+
+/*
+ * SEARCH INDEX
+ * Görev başlığı, açıklaması, checklist metinleri ve proje adları üzerinde
+ * token tabanlı ters index (GET /api/search?q=...).
+ *
+ * Token: küçük harfe çevrilmiş harf/rakam dizisi (UTF-8 baytları harf sayılır,
+ * sadece ASCII büyük/küçük harf katlanır). Her (token, belge) çifti 8 byte'lık
+ * bir posting'dir: tokenin ilk 4 baytı (sıralanabilir anahtar) + belge.
+ * Bir sorgu tokeni anahtar aralığıyla aday belgelere iner; 4 bayttan uzun
+ * önekler ve puanlama aday belgenin metni üzerinde doğrulanır (scoreTask).
+ * Maliyet eşleşme sayısıyla ölçeklenir, veri boyutuyla değil. Tek harfli
+ * tokenler de indexlenir: index'li arama ile tarama aynı sonucu vermeli.
+ *
+ * MAX_POSTINGS aşılırsa index kapanır (overflowed) ve arama tüm veriyi tarar -
+ * sonuç aynı, sadece yavaş.
+ */
+
+class SearchIndex {
+public:
+    static const size_t MAX_POSTINGS = 12288;   // 96 KB
+    static const size_t MAX_TOKEN = 32;         // longer tokens are cut
+
+    // Document reference: task and project ids share one space
+    static uint32_t taskRef(int id) { return (uint32_t)id << 1; }
+    static uint32_t projectRef(int id) { return ((uint32_t)id << 1) | 1; }
+    static bool isProject(uint32_t ref) { return ref & 1; }
+    static int refId(uint32_t ref) { return (int)(ref >> 1); }
+
+    // ==================== TOKENS ====================
+
+    // Calls visit(token, length) for each token of text, lowercased
+    template <typename Visitor>
+    static void tokenize(const char* text, Visitor visit) {
+        if (!text) return;
+        char token[MAX_TOKEN + 1];
+        size_t length = 0;
+        for (const char* p = text; ; p++) {
+            uint8_t c = (uint8_t)*p;
+            bool wordChar = isalnum(c) || c >= 0x80;
+            if (wordChar) {
+                if (length < MAX_TOKEN) token[length++] = (char)tolower(c);
+                continue;
+            }
+            if (length > 0) {
+                token[length] = '\0';
+                visit((const char*)token, length);
+                length = 0;
+            }
+            if (c == '\0') break;
+        }
+    }
+
+    static std::vector<String> queryTokens(const char* query) {
+        std::vector<String> tokens;
+        tokenize(query, [&](const char* token, size_t) {
+            tokens.push_back(String(token));
+        });
+        return tokens;
+    }
+
+    static bool hasPrefix(JsonVariantConst text, const String& prefix) {
+        return hasPrefix(text.as<const char*>(), prefix.c_str(), prefix.length());
+    }
+
+    // True if text has a token starting with prefix (already lowercase)
+    static bool hasPrefix(const char* text, const char* prefix, size_t prefixLength) {
+        bool found = false;
+        tokenize(text, [&](const char* token, size_t length) {
+            if (!found && length >= prefixLength && memcmp(token, prefix, prefixLength) == 0) {
+                found = true;
+            }
+        });
+        return found;
+    }
+
+    // ==================== SCORING ====================
+    // Run on the text of a candidate: every query token must prefix-match a
+    // token of the document. Title / name hits weigh 3, checklist 2,
+    // description 1; 0 means no match.
+
+    static int scoreTask(JsonObjectConst task, const std::vector<String>& query) {
+        int total = 0;
+        for (const String& token : query) {
+            int best = 0;
+            if (hasPrefix(task["title"], token)) {
+                best = 3;
+            } else {
+                for (JsonObjectConst item : task["checklist"].as<JsonArrayConst>()) {
+                    if (hasPrefix(item["text"], token)) {
+                        best = 2;
+                        break;
+                    }
+                }
+                if (best == 0 && hasPrefix(task["description"], token)) best = 1;
+            }
+            if (best == 0) return 0;
+            total += best;
+        }
+        return total;
+    }
+
+    static int scoreProject(JsonObjectConst project, const std::vector<String>& query) {
+        for (const String& token : query) {
+            if (!hasPrefix(project["name"], token)) return 0;
+        }
+        return 3 * query.size();
+    }
+
+    // ==================== MAINTENANCE ====================
+
+    void clear() {
+        postings.clear();
+        overflowed = false;
+    }
+
+    // Replace the tokens of one task / project
+    void putTask(JsonObjectConst task) {
+        uint32_t ref = taskRef(task["id"] | -1);
+        remove(ref);
+        std::vector<Posting> added = taskPostings(task, ref);
+        insertSorted(added);
+    }
+
+    void putProject(JsonObjectConst project) {
+        uint32_t ref = projectRef(project["id"] | -1);
+        remove(ref);
+        std::vector<Posting> added = projectPostings(project, ref);
+        insertSorted(added);
+    }
+
+    void remove(uint32_t ref) {
+        postings.erase(std::remove_if(postings.begin(), postings.end(),
+                                      [ref](const Posting& p) { return p.ref == ref; }),
+                       postings.end());
+    }
+
+    // Bulk load: append in any order, then call sort() once
+    void appendTask(JsonObjectConst task) {
+        std::vector<Posting> added = taskPostings(task, taskRef(task["id"] | -1));
+        append(added);
+    }
+
+    void appendProject(JsonObjectConst project) {
+        std::vector<Posting> added = projectPostings(project, projectRef(project["id"] | -1));
+        append(added);
+    }
+
+    void sort() {
+        std::sort(postings.begin(), postings.end());
+    }
+
+    // ==================== QUERY ====================
+
+    bool isAvailable() const { return !overflowed; }
+
+    // Sorted, unique refs of documents with a token whose first (up to) 4
+    // bytes match the prefix. Longer prefixes need verification on the text.
+    std::vector<uint32_t> candidates(const char* prefix, size_t length) const {
+        uint32_t low = key(prefix, length);
+        uint32_t high = length >= 4 ? low : (low | (0xFFFFFFFFu >> (8 * length)));
+
+        auto first = std::lower_bound(postings.begin(), postings.end(), Posting{low, 0});
+        std::vector<uint32_t> refs;
+        for (auto it = first; it != postings.end() && it->key <= high; ++it) {
+            refs.push_back(it->ref);
+        }
+        std::sort(refs.begin(), refs.end());
+        refs.erase(std::unique(refs.begin(), refs.end()), refs.end());
+        return refs;
+    }
+
+    size_t size() const { return postings.size(); }
+
+    size_t memoryUsage() const {
+        return postings.capacity() * sizeof(Posting);
+    }
+
+private:
+    struct Posting {
+        uint32_t key;   // first 4 token bytes, big-endian: sorts like the text
+        uint32_t ref;
+
+        bool operator<(const Posting& o) const {
+            return key != o.key ? key < o.key : ref < o.ref;
+        }
+        bool operator==(const Posting& o) const {
+            return key == o.key && ref == o.ref;
+        }
+    };
+
+    std::vector<Posting> postings;   // sorted by (key, ref), unique
+    bool overflowed = false;
+
+    static uint32_t key(const char* token, size_t length) {
+        uint32_t value = 0;
+        for (size_t i = 0; i < 4; i++) {
+            value = (value << 8) | (i < length ? (uint8_t)token[i] : 0);
+        }
+        return value;
+    }
+
+    static void addText(std::vector<Posting>& out, const char* text, uint32_t ref) {
+        tokenize(text, [&](const char* token, size_t length) {
+            out.push_back(Posting{key(token, length), ref});
+        });
+    }
+
+    static std::vector<Posting> taskPostings(JsonObjectConst task, uint32_t ref) {
+        std::vector<Posting> out;
+        addText(out, task["title"].as<const char*>(), ref);
+        addText(out, task["description"].as<const char*>(), ref);
+        for (JsonObjectConst item : task["checklist"].as<JsonArrayConst>()) {
+            addText(out, item["text"].as<const char*>(), ref);
+        }
+        unique(out);
+        return out;
+    }
+
+    static std::vector<Posting> projectPostings(JsonObjectConst project, uint32_t ref) {
+        std::vector<Posting> out;
+        addText(out, project["name"].as<const char*>(), ref);
+        unique(out);
+        return out;
+    }
+
+    static void unique(std::vector<Posting>& out) {
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+
+    bool reserveFor(size_t count) {
+        if (overflowed) return false;
+        if (postings.size() + count > MAX_POSTINGS) {
+            Serial.printf("[Search] Index full (%u postings), falling back to scans\n", (unsigned)postings.size());
+            overflowed = true;
+            postings.clear();
+            postings.shrink_to_fit();
+            return false;
+        }
+        return true;
+    }
+
+    void append(const std::vector<Posting>& added) {
+        if (reserveFor(added.size())) {
+            postings.insert(postings.end(), added.begin(), added.end());
+        }
+    }
+
+    // added is sorted; one merge instead of an insert per token
+    void insertSorted(const std::vector<Posting>& added) {
+        if (added.empty() || !reserveFor(added.size())) return;
+        size_t middle = postings.size();
+        postings.insert(postings.end(), added.begin(), added.end());
+        std::inplace_merge(postings.begin(), postings.begin() + middle, postings.end());
+    }
+};
+
+#endif
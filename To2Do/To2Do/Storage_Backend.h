@@ -0,0 +1,197 @@
+#ifndef STORAGE_BACKEND_H
+#define STORAGE_BACKEND_H
+
+#include <Arduino.h>
+#include <FS.h>
+#ifdef ARDUINO
+#include <SPIFFS.h>
+#include <LittleFS.h>
+#else
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+#endif
+#include <functional>
+
+/*
+ * STORAGE BACKEND
+ * Yöneticiler dosya sistemine doğrudan değil, bu arayüz üzerinden erişir.
+ * - SpiffsBackend   : düz (flat) isim alanı, "/t/1.mp" tek bir dosya adıdır
+ * - LittleFsBackend : gerçek dizinler, yazmadan önce üst dizin oluşturulur
+ * - PosixBackend    : PC derlemesi (host/, test ve benchmark), bir dizin
+ *                     altındaki sıradan dosyalar; kök TO2DO_FS_ROOT ortam
+ *                     değişkeninden, yoksa ./to2do_fs
+ *
+ * Seçim derleme zamanında: -DTO2DO_STORAGE_LITTLEFS (varsayılan SPIFFS);
+ * ARDUINO tanımlı değilse PosixBackend.
+ * Her ikisi de "spiffs" bölümünü kullanır; backend değiştirmek bölümü
+ * formatlar - önce yedek alın (/api/backup/export).
+ */
+
+class StorageBackend {
+public:
+    virtual ~StorageBackend() {}
+
+    virtual const char* name() const = 0;
+    virtual bool begin(bool formatOnFail) = 0;
+    virtual fs::FS& fs() = 0;
+    virtual size_t totalBytes() = 0;
+    virtual size_t usedBytes() = 0;
+    virtual bool hasDirectories() const = 0;
+
+    // Full paths of all files below dir (recursive where directories exist)
+    virtual void listFiles(const char* dir, std::function<void(const String&)> visit) = 0;
+
+    File open(const String& path, const char* mode) {
+        if (hasDirectories() && mode[0] != 'r') {
+            makeParentDirs(path);
+        }
+        return fs().open(path, mode);
+    }
+
+    bool exists(const String& path) { return fs().exists(path); }
+    bool remove(const String& path) { return fs().remove(path); }
+    bool rename(const String& from, const String& to) { return fs().rename(from, to); }
+
+private:
+    void makeParentDirs(const String& path) {
+        int slash = path.indexOf('/', 1);
+        while (slash > 0) {
+            String dir = path.substring(0, slash);
+            if (!fs().exists(dir)) {
+                fs().mkdir(dir);
+            }
+            slash = path.indexOf('/', slash + 1);
+        }
+    }
+};
+
+#ifdef ARDUINO
+
+class SpiffsBackend : public StorageBackend {
+public:
+    const char* name() const override { return "SPIFFS"; }
+    bool begin(bool formatOnFail) override { return SPIFFS.begin(formatOnFail); }
+    fs::FS& fs() override { return SPIFFS; }
+    size_t totalBytes() override { return SPIFFS.totalBytes(); }
+    size_t usedBytes() override { return SPIFFS.usedBytes(); }
+    bool hasDirectories() const override { return false; }
+
+    // Flat name space: directories are just name prefixes
+    void listFiles(const char* dir, std::function<void(const String&)> visit) override {
+        File root = SPIFFS.open("/");
+        File entry = root.openNextFile();
+        while (entry) {
+            String path = entry.path();
+            entry = root.openNextFile();
+            if (path.startsWith(dir)) {
+                visit(path);
+            }
+        }
+    }
+};
+
+class LittleFsBackend : public StorageBackend {
+public:
+    const char* name() const override { return "LittleFS"; }
+    bool begin(bool formatOnFail) override { return LittleFS.begin(formatOnFail); }
+    fs::FS& fs() override { return LittleFS; }
+    size_t totalBytes() override { return LittleFS.totalBytes(); }
+    size_t usedBytes() override { return LittleFS.usedBytes(); }
+    bool hasDirectories() const override { return true; }
+
+    void listFiles(const char* dir, std::function<void(const String&)> visit) override {
+        String path = dir;
+        if (path.length() > 1 && path.endsWith("/")) {
+            path.remove(path.length() - 1);
+        }
+        File root = LittleFS.open(path);
+        if (!root || !root.isDirectory()) {
+            return;
+        }
+        File entry = root.openNextFile();
+        while (entry) {
+            String entryPath = entry.path();
+            bool isDir = entry.isDirectory();
+            entry = root.openNextFile();
+            if (isDir) {
+                listFiles(entryPath.c_str(), visit);
+            } else {
+                visit(entryPath);
+            }
+        }
+    }
+};
+
+#else
+
+class PosixBackend : public StorageBackend {
+public:
+    explicit PosixBackend(const char* root) : files(root) {}
+
+    const char* name() const override { return "POSIX"; }
+
+    // The root directory plays the partition: created on demand, never formatted
+    bool begin(bool formatOnFail) override {
+        (void)formatOnFail;
+        std::error_code error;
+        std::filesystem::create_directories(files.rootPath(), error);
+        return std::filesystem::is_directory(files.rootPath(), error);
+    }
+
+    fs::FS& fs() override { return files; }
+
+    size_t totalBytes() override {
+        std::error_code error;
+        std::filesystem::space_info space = std::filesystem::space(files.rootPath(), error);
+        return error ? 0 : (size_t)space.capacity;
+    }
+
+    // Sum of the file sizes below the root - what the data layer put there
+    size_t usedBytes() override {
+        size_t used = 0;
+        std::error_code error;
+        for (std::filesystem::recursive_directory_iterator it(files.rootPath(), error), end; !error && it != end; it.increment(error)) {
+            if (it->is_regular_file(error)) {
+                used += (size_t)it->file_size(error);
+            }
+        }
+        return used;
+    }
+
+    bool hasDirectories() const override { return true; }
+
+    void listFiles(const char* dir, std::function<void(const String&)> visit) override {
+        std::filesystem::path base = files.rootPath();
+        std::error_code error;
+        std::vector<String> paths;  // collected first: visit() may remove files
+        for (std::filesystem::recursive_directory_iterator it(files.hostPath(dir), error), end; !error && it != end; it.increment(error)) {
+            if (it->is_regular_file(error)) {
+                paths.push_back(String("/" + it->path().lexically_relative(base).generic_string()));
+            }
+        }
+        for (const String& path : paths) {
+            visit(path);
+        }
+    }
+
+private:
+    fs::FS files;
+};
+
+#endif
+
+// The backend every manager uses
+inline StorageBackend& storage() {
+#if !defined(ARDUINO)
+    static const char* root = getenv("TO2DO_FS_ROOT");
+    static PosixBackend backend(root && *root ? root : "to2do_fs");
+#elif defined(TO2DO_STORAGE_LITTLEFS)
+    static LittleFsBackend backend;
+#else
+    static SpiffsBackend backend;
+#endif
+    return backend;
+}
+
+#endif
@@ -0,0 +1,271 @@
+#ifndef TASK_INDEX_H
+#define TASK_INDEX_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <vector>
+#include <algorithm>
+#include "Date_Core.h"
+#include "Recurrence.h"
+
+/*
+ * TASK INDEX
+ * Görevlerin sorgu için gereken alanları RAM'de, struct-of-arrays düzeninde
+ * (id'ye göre sıralı paralel diziler) tutulur:
+ * - id, projectId, bitiş tarihi (epoch gün, bkz. Date_Core.h), durum bitleri, öncelik
+ *
+ * Tarih penceresi sorguları (bugün / yarın / hafta / gecikmiş) bu diziler
+ * üzerinde çalışır: JSON parse yok, String yok. DataManager her görev
+ * değişikliğinde index'i günceller; görev başına ~14 byte.
+ *
+ * Tekrarlayan görevlerin tarihi NO_DATE'dir; kuralları ayrı bir listede
+ * (id'ye göre sıralı) durur ve pencereye göre açılır (Recurrence.h).
+ */
+
+class TaskIndex {
+public:
+    static const uint8_t FLAG_COMPLETED = 0x01;
+    static const uint8_t FLAG_RECURRING = 0x02; // dated by a rule, see rules
+
+    enum Priority : uint8_t {
+        PRIORITY_NONE = 0,
+        PRIORITY_LOW,
+        PRIORITY_MEDIUM,
+        PRIORITY_HIGH
+    };
+
+    // ==================== PARSING ====================
+
+    static uint8_t parsePriority(const char* text) {
+        if (!text) return PRIORITY_NONE;
+        if (strcmp(text, "high") == 0) return PRIORITY_HIGH;
+        if (strcmp(text, "medium") == 0) return PRIORITY_MEDIUM;
+        if (strcmp(text, "low") == 0) return PRIORITY_LOW;
+        return PRIORITY_NONE;
+    }
+
+    // ==================== MAINTENANCE ====================
+
+    void clear() {
+        ids.clear();
+        projectIds.clear();
+        dueDays.clear();
+        flags.clear();
+        priorities.clear();
+        rules.clear();
+    }
+
+    void reserve(size_t count) {
+        ids.reserve(count);
+        projectIds.reserve(count);
+        dueDays.reserve(count);
+        flags.reserve(count);
+        priorities.reserve(count);
+    }
+
+    // Insert or update by task id
+    void put(JsonObjectConst task, int projectId) {
+        int id = task["id"] | -1;
+        size_t pos = lowerBound(id);
+
+        if (pos == ids.size() || ids[pos] != id) {
+            ids.insert(ids.begin() + pos, id);
+            projectIds.insert(projectIds.begin() + pos, projectId);
+            dueDays.insert(dueDays.begin() + pos, DateCore::NO_DATE);
+            flags.insert(flags.begin() + pos, 0);
+            priorities.insert(priorities.begin() + pos, PRIORITY_NONE);
+        }
+
+        projectIds[pos] = projectId;
+        priorities[pos] = parsePriority(task["priority"].as<const char*>());
+        setDates(pos, task);
+    }
+
+    // Bulk load: append in any order, then call sort() once
+    void append(JsonObjectConst task, int projectId) {
+        Recurrence::Rule rule = Recurrence::parse(task);
+        ids.push_back(task["id"] | -1);
+        projectIds.push_back(projectId);
+        dueDays.push_back(rule.isValid() ? DateCore::NO_DATE : DateCore::parseDate(task["date"].as<const char*>()));
+        flags.push_back(taskFlags(task, rule));
+        priorities.push_back(parsePriority(task["priority"].as<const char*>()));
+        if (rule.isValid()) {
+            rules.push_back(RuleEntry{ids.back(), rule});
+        }
+    }
+
+    void sort() {
+        std::vector<uint32_t> order(ids.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = i;
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return ids[a] < ids[b]; });
+
+        permute(ids, order);
+        permute(projectIds, order);
+        permute(dueDays, order);
+        permute(flags, order);
+        permute(priorities, order);
+        std::sort(rules.begin(), rules.end(), [](const RuleEntry& a, const RuleEntry& b) { return a.id < b.id; });
+    }
+
+    void remove(int id) {
+        int pos = find(id);
+        if (pos >= 0) {
+            erase(pos);
+        }
+    }
+
+    void removeProject(int projectId) {
+        for (size_t i = ids.size(); i-- > 0; ) {
+            if (projectIds[i] == projectId) {
+                erase(i);
+            }
+        }
+    }
+
+    // ==================== ACCESS ====================
+
+    size_t size() const { return ids.size(); }
+
+    // Position of the task id, or -1
+    int find(int id) const {
+        size_t pos = lowerBound(id);
+        return (pos < ids.size() && ids[pos] == id) ? (int)pos : -1;
+    }
+
+    int maxId() const { return ids.empty() ? 0 : ids.back(); }
+
+    int id(size_t pos) const { return ids[pos]; }
+    int projectId(size_t pos) const { return projectIds[pos]; }
+    DateCore::Day dueDay(size_t pos) const { return dueDays[pos]; }
+    bool isCompleted(size_t pos) const { return flags[pos] & FLAG_COMPLETED; }
+    bool isRecurring(size_t pos) const { return flags[pos] & FLAG_RECURRING; }
+    uint8_t priority(size_t pos) const { return priorities[pos]; }
+
+    // Calls visit(pos, day, completed) for every occurrence in [fromDay, toDay]:
+    // one-off tasks on their date, recurring tasks expanded from their rule
+    // (finished series are skipped). openOnly skips completed occurrences.
+    template <typename Visitor>
+    size_t forEachDue(DateCore::Day fromDay, DateCore::Day toDay, bool openOnly, Visitor visit) const {
+        size_t matches = 0;
+        const size_t count = ids.size();
+        for (size_t i = 0; i < count; i++) {
+            DateCore::Day due = dueDays[i];
+            if (due == DateCore::NO_DATE || due < fromDay || due > toDay) continue;
+            bool completed = flags[i] & FLAG_COMPLETED;
+            if (openOnly && completed) continue;
+            visit(i, due, completed);
+            matches++;
+        }
+        for (const RuleEntry& entry : rules) {
+            int pos = find(entry.id);
+            if (pos < 0 || (flags[pos] & FLAG_COMPLETED)) continue;
+            Recurrence::forEach(entry.rule, fromDay, toDay, [&](DateCore::Day day) {
+                bool done = Recurrence::isDone(entry.rule, day);
+                if (openOnly && done) return;
+                visit((size_t)pos, day, done);
+                matches++;
+            });
+        }
+        return matches;
+    }
+
+    size_t countDue(DateCore::Day fromDay, DateCore::Day toDay, bool openOnly) const {
+        return forEachDue(fromDay, toDay, openOnly, [](size_t, DateCore::Day, bool) {});
+    }
+
+    // Calls visit(pos, day) for open one-off tasks dated before today and for
+    // recurring tasks whose last occurrence before today is not done - a
+    // missed daily routine is one overdue entry, not one per day
+    template <typename Visitor>
+    size_t forEachOverdue(DateCore::Day today, Visitor visit) const {
+        size_t matches = 0;
+        const size_t count = ids.size();
+        for (size_t i = 0; i < count; i++) {
+            DateCore::Day due = dueDays[i];
+            if (due == DateCore::NO_DATE || due >= today || (flags[i] & FLAG_COMPLETED)) continue;
+            visit(i, due);
+            matches++;
+        }
+        for (const RuleEntry& entry : rules) {
+            int pos = find(entry.id);
+            if (pos < 0 || (flags[pos] & FLAG_COMPLETED)) continue;
+            DateCore::Day day = Recurrence::latestBefore(entry.rule, today);
+            if (day == DateCore::NO_DATE || Recurrence::isDone(entry.rule, day)) continue;
+            visit((size_t)pos, day);
+            matches++;
+        }
+        return matches;
+    }
+
+    size_t memoryUsage() const {
+        return ids.capacity() * sizeof(int32_t) + projectIds.capacity() * sizeof(int32_t) +
+               dueDays.capacity() * sizeof(DateCore::Day) + flags.capacity() + priorities.capacity() +
+               rules.capacity() * sizeof(RuleEntry);
+    }
+
+private:
+    std::vector<int32_t> ids;        // sorted ascending
+    std::vector<int32_t> projectIds;
+    std::vector<DateCore::Day> dueDays; // DateCore::NO_DATE when undated
+    std::vector<uint8_t> flags;
+    std::vector<uint8_t> priorities;
+
+    struct RuleEntry {
+        int32_t id;
+        Recurrence::Rule rule;
+    };
+    std::vector<RuleEntry> rules;    // recurring tasks only, sorted by id (after sort())
+
+    // Date or rule of the task at pos; keeps rules in step with the flags
+    void setDates(size_t pos, JsonObjectConst task) {
+        Recurrence::Rule rule = Recurrence::parse(task);
+        auto entry = std::lower_bound(rules.begin(), rules.end(), ids[pos],
+                                      [](const RuleEntry& e, int32_t id) { return e.id < id; });
+        bool hasEntry = entry != rules.end() && entry->id == ids[pos];
+
+        if (rule.isValid()) {
+            dueDays[pos] = DateCore::NO_DATE;
+            if (hasEntry) {
+                entry->rule = rule;
+            } else {
+                rules.insert(entry, RuleEntry{ids[pos], rule});
+            }
+        } else {
+            dueDays[pos] = DateCore::parseDate(task["date"].as<const char*>());
+            if (hasEntry) rules.erase(entry);
+        }
+        flags[pos] = taskFlags(task, rule);
+    }
+
+    static uint8_t taskFlags(JsonObjectConst task, const Recurrence::Rule& rule) {
+        return ((task["completed"] | false) ? FLAG_COMPLETED : 0) | (rule.isValid() ? FLAG_RECURRING : 0);
+    }
+
+    size_t lowerBound(int id) const {
+        return std::lower_bound(ids.begin(), ids.end(), id) - ids.begin();
+    }
+
+    void erase(size_t pos) {
+        if (flags[pos] & FLAG_RECURRING) {
+            rules.erase(std::lower_bound(rules.begin(), rules.end(), ids[pos],
+                                         [](const RuleEntry& e, int32_t id) { return e.id < id; }));
+        }
+        ids.erase(ids.begin() + pos);
+        projectIds.erase(projectIds.begin() + pos);
+        dueDays.erase(dueDays.begin() + pos);
+        flags.erase(flags.begin() + pos);
+        priorities.erase(priorities.begin() + pos);
+    }
+
+    template <typename T>
+    static void permute(std::vector<T>& values, const std::vector<uint32_t>& order) {
+        std::vector<T> sorted;
+        sorted.reserve(values.size());
+        for (uint32_t from : order) {
+            sorted.push_back(values[from]);
+        }
+        values.swap(sorted);
+    }
+};
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef TASK_MONITOR_H
+#define TASK_MONITOR_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_timer.h>
+
+/*
+ * TASK MONITOR
+ * Uygulama görevlerini (net, storage, ui, time) oluşturur ve her biri için
+ * stack boşluğu ile CPU süresini izler (GET /api/system/tasks).
+ *
+ * CPU süresi: FreeRTOS run-time stats Arduino derlemesinde kapalı, bu yüzden
+ * her görev bir döngü turundaki işini Cycle ile ölçer (bekleme hariç).
+ * Kütüphane görevleri (async_tcp) sadece stack için eklenebilir.
+ */
+
+class TaskMonitor {
+public:
+    static const int MAX_TASKS = 8;
+
+    struct Entry {
+        const char* name;
+        TaskHandle_t handle;
+        uint32_t stackSize;       // bytes, 0 if unknown (library task)
+        UBaseType_t priority;
+        uint64_t busyMicros;      // time spent inside Cycle scopes
+        uint32_t cycles;
+        uint32_t maxCycleMicros;
+    };
+
+    // Measures one loop turn of the calling task
+    class Cycle {
+    public:
+        explicit Cycle(int slot) : slot(slot), start(micros()) {}
+        ~Cycle() {
+            if (slot < 0) return;
+            uint32_t elapsed = micros() - start;
+            Entry& entry = entries()[slot];
+            entry.busyMicros += elapsed;
+            entry.cycles++;
+            if (elapsed > entry.maxCycleMicros) {
+                entry.maxCycleMicros = elapsed;
+            }
+        }
+    private:
+        int slot;
+        uint32_t start;
+    };
+
+    // Creates the task; it receives its monitor slot as (int)(intptr_t)parameter
+    static bool start(const char* name, TaskFunction_t function, uint32_t stackSize, UBaseType_t priority) {
+        int slot = reserve(name, stackSize, priority);
+        if (slot < 0) {
+            return false;
+        }
+        TaskHandle_t handle = nullptr;
+        if (xTaskCreate(function, name, stackSize, (void*)(intptr_t)slot, priority, &handle) != pdPASS) {
+            Serial.printf("[Tasks] ✗ Could not start %s\n", name);
+            count()--;
+            return false;
+        }
+        entries()[slot].handle = handle;
+        return true;
+    }
+
+    // Stack reporting for a task created elsewhere
+    static void watch(const char* name) {
+        TaskHandle_t handle = xTaskGetHandle(name);
+        if (!handle) return;
+        int slot = reserve(name, 0, uxTaskPriorityGet(handle));
+        if (slot >= 0) {
+            entries()[slot].handle = handle;
+        }
+    }
+
+    static int taskCount() {
+        return count();
+    }
+
+    static const Entry& task(int slot) {
+        return entries()[slot];
+    }
+
+    static void writeJson(Print& out) {
+        uint64_t uptime = (uint64_t)esp_timer_get_time();
+        out.print("[");
+        for (int i = 0; i < count(); i++) {
+            const Entry& entry = entries()[i];
+            if (i > 0) out.print(',');
+            out.printf("{\"name\":\"%s\",\"priority\":%u,\"stackSize\":%u,\"stackFree\":%u",
+                       entry.name, (unsigned)entry.priority, (unsigned)entry.stackSize,
+                       entry.handle ? (unsigned)uxTaskGetStackHighWaterMark(entry.handle) : 0u);
+            if (entry.stackSize > 0) {
+                out.printf(",\"busyPercent\":%.2f,\"cycles\":%u,\"maxCycleUs\":%u",
+                           uptime ? 100.0 * (double)entry.busyMicros / (double)uptime : 0.0,
+                           (unsigned)entry.cycles, (unsigned)entry.maxCycleMicros);
+            }
+            out.print('}');
+        }
+        out.print("]");
+    }
+
+private:
+    static Entry* entries() {
+        static Entry table[MAX_TASKS];
+        return table;
+    }
+
+    static int& count() {
+        static int used = 0;
+        return used;
+    }
+
+    static int reserve(const char* name, uint32_t stackSize, UBaseType_t priority) {
+        if (count() >= MAX_TASKS) {
+            return -1;
+        }
+        int slot = count()++;
+        entries()[slot] = Entry{name, nullptr, stackSize, priority, 0, 0, 0};
+        return slot;
+    }
+};
+
+#endif
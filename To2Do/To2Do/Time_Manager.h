@@ -1,96 +1,44 @@
 #ifndef TIME_MANAGER_H
 #define TIME_MANAGER_H
 
-#include <SPIFFS.h>
+#include "Storage_Backend.h"
 #include <ArduinoJson.h>
 #include <time.h>
+#include <esp_timer.h>
+#include "Date_Core.h"
 
 class TimeManager {
 private:
-    struct DateTimeInfo {
-        int year;
-        int month;
-        int day;
-        int hour;
-        int minute;
-        int second;
-        String timezone;
-        int offset; // UTC offset in seconds
-        unsigned long lastSync; // millis() when last synced
-    };
-    
-    DateTimeInfo currentDateTime;
+    // Local time as seconds since 1970 (DateCore), anchored to the 64-bit
+    // esp_timer clock: no carry arithmetic, no month lengths, no millis() wrap
+    DateCore::Seconds anchorSeconds;
+    int64_t anchorMicros;       // esp_timer_get_time() when anchorSeconds was true
+    int64_t lastSyncMicros;     // browser sync in this boot, -1 if none yet
+    String timezone;
+    int offset;                 // UTC offset in seconds
     bool isInitialized;
-    unsigned long lastMillis;  // For real-time updates
+    uint32_t syncCount = 0;     // setManualDate calls since boot - pushed to web clients
     
-    // Update time based on millis() elapsed
-    void updateCurrentTime() {
-        if (!isInitialized || currentDateTime.lastSync == 0) {
-            return;
-        }
-        
-        unsigned long currentMillis = millis();
-        unsigned long elapsed = currentMillis - currentDateTime.lastSync;
-        
-        // Add elapsed seconds to the time
-        unsigned long totalSeconds = elapsed / 1000;
-        
-        if (totalSeconds > 0) {
-            currentDateTime.second += totalSeconds;
-            
-            // Handle overflow
-            if (currentDateTime.second >= 60) {
-                currentDateTime.minute += currentDateTime.second / 60;
-                currentDateTime.second %= 60;
-                
-                if (currentDateTime.minute >= 60) {
-                    currentDateTime.hour += currentDateTime.minute / 60;
-                    currentDateTime.minute %= 60;
-                    
-                    if (currentDateTime.hour >= 24) {
-                        currentDateTime.day += currentDateTime.hour / 24;
-                        currentDateTime.hour %= 24;
-                        
-                        // Simple month overflow (not perfect but good enough)
-                        if (currentDateTime.day > 31) {
-                            currentDateTime.month++;
-                            currentDateTime.day = 1;
-                            
-                            if (currentDateTime.month > 12) {
-                                currentDateTime.year++;
-                                currentDateTime.month = 1;
-                            }
-                        }
-                    }
-                }
-            }
-            
-            // Update the sync time to current millis
-            currentDateTime.lastSync = currentMillis;
-        }
+    void setClock(DateCore::Seconds seconds) {
+        anchorSeconds = seconds;
+        anchorMicros = esp_timer_get_time();
     }
     
-public:
-    TimeManager() : isInitialized(false), lastMillis(0) {
-        currentDateTime.year = 0;
-        currentDateTime.month = 0;
-        currentDateTime.day = 0;
-        currentDateTime.hour = 0;
-        currentDateTime.minute = 0;
-        currentDateTime.second = 0;
-        currentDateTime.timezone = "";
-        currentDateTime.offset = 0;
-        currentDateTime.lastSync = 0;
+    DateCore::Seconds now() const {
+        return anchorSeconds + (esp_timer_get_time() - anchorMicros) / 1000000;
     }
     
-    // Load date from SPIFFS
+public:
+    TimeManager() : anchorSeconds(0), anchorMicros(0), lastSyncMicros(-1), offset(0), isInitialized(false) {}
+    
+    // Load date from flash (SPIFFS or LittleFS, see Storage_Backend.h)
     bool loadDateFromSPIFFS() {
-        File file = SPIFFS.open("/data/last_date.json", "r");
+        File file = storage().open("/data/last_date.json", "r");
         if (!file) {
             return false;
         }
         
-        DynamicJsonDocument doc(512);
+        JsonDocument doc;
         DeserializationError error = deserializeJson(doc, file);
         file.close();
         
@@ -98,35 +46,34 @@ public:
             return false;
         }
         
-        currentDateTime.year = doc["year"] | 0;
-        currentDateTime.month = doc["month"] | 0;
-        currentDateTime.day = doc["day"] | 0;
-        currentDateTime.hour = doc["hour"] | 0;
-        currentDateTime.minute = doc["minute"] | 0;
-        currentDateTime.second = doc["seconds"] | 0;
-        currentDateTime.timezone = doc["timezone"].as<String>();
-        currentDateTime.offset = doc["offset"] | 0;
-        currentDateTime.lastSync = doc["lastSync"] | 0;
+        // Stale by the time the device was off; runs on from here until the next sync
+        DateCore::Day day = DateCore::daysFromCivil(doc["year"] | 0, doc["month"] | 0, doc["day"] | 0);
+        setClock(DateCore::toSeconds(day, doc["hour"] | 0, doc["minute"] | 0, doc["seconds"] | 0));
+        timezone = doc["timezone"].as<String>();
+        offset = doc["offset"] | 0;
         
         isInitialized = true;
         return true;
     }
     
-    // Save date to SPIFFS
+    // Save date to flash; /data is created on backends with directories
     void saveDateToSPIFFS() {
-        DynamicJsonDocument doc(512);
-        
-        doc["year"] = currentDateTime.year;
-        doc["month"] = currentDateTime.month;
-        doc["day"] = currentDateTime.day;
-        doc["hour"] = currentDateTime.hour;
-        doc["minute"] = currentDateTime.minute;
-        doc["seconds"] = currentDateTime.second;
-        doc["timezone"] = currentDateTime.timezone;
-        doc["offset"] = currentDateTime.offset;
-        doc["lastSync"] = currentDateTime.lastSync;
-        
-        File file = SPIFFS.open("/data/last_date.json", "w");
+        JsonDocument doc;
+        
+        DateCore::Seconds seconds = now();
+        DateCore::Civil date = DateCore::civilFromDays(DateCore::dayOf(seconds));
+        int32_t secondOfDay = DateCore::secondOfDay(seconds);
+        
+        doc["year"] = date.year;
+        doc["month"] = date.month;
+        doc["day"] = date.day;
+        doc["hour"] = secondOfDay / 3600;
+        doc["minute"] = secondOfDay / 60 % 60;
+        doc["seconds"] = secondOfDay % 60;
+        doc["timezone"] = timezone;
+        doc["offset"] = offset;
+        
+        File file = storage().open("/data/last_date.json", "w");
         if (file) {
             serializeJson(doc, file);
             file.close();
@@ -135,47 +82,45 @@ public:
     
     // Check if date is valid (after 2024)
     bool isDateValid() {
-        return isInitialized && (currentDateTime.year > 2024);
+        return isInitialized && today() >= DateCore::daysFromCivil(2025, 1, 1);
+    }
+    
+    // Current local day (epoch day) - what notification windows compare against
+    DateCore::Day today() const {
+        return DateCore::dayOf(now());
     }
     
     // Get formatted date: "14.10.2025"
     String getFormattedDate() {
-        updateCurrentTime();  // Update time before formatting
-        
-        if (!isInitialized || currentDateTime.year == 0) {
+        if (!isInitialized) {
             return "--.--.----";
         }
         
+        DateCore::Civil date = DateCore::civilFromDays(today());
         char buffer[16];
-        sprintf(buffer, "%02d.%02d.%04d", 
-                currentDateTime.day, 
-                currentDateTime.month, 
-                currentDateTime.year);
+        sprintf(buffer, "%02d.%02d.%04d", date.day, date.month, date.year);
         return String(buffer);
     }
     
     // Get formatted time: "15:30"
     String getFormattedTime() {
-        updateCurrentTime();  // Update time before formatting
-        
-        if (!isInitialized || currentDateTime.year == 0) {
+        if (!isInitialized) {
             return "--:--";
         }
         
+        int32_t secondOfDay = DateCore::secondOfDay(now());
         char buffer[8];
-        sprintf(buffer, "%02d:%02d", 
-                currentDateTime.hour, 
-                currentDateTime.minute);
+        sprintf(buffer, "%02d:%02d", (int)(secondOfDay / 3600), (int)(secondOfDay / 60 % 60));
         return String(buffer);
     }
     
     // Get last sync time in human readable format
     String getLastSyncTime() {
-        if (currentDateTime.lastSync == 0) {
+        if (lastSyncMicros < 0) {
             return "Hic";
         }
         
-        unsigned long elapsed = millis() - currentDateTime.lastSync;
+        unsigned long elapsed = (unsigned long)((esp_timer_get_time() - lastSyncMicros) / 1000);
         unsigned long hours = elapsed / 3600000;
         unsigned long minutes = (elapsed % 3600000) / 60000;
         
@@ -193,15 +138,11 @@ public:
         Serial.printf("[Time] setManualDate called: %04d-%02d-%02d %02d:%02d\n",
                      year, month, day, hour, minute);
         
-        currentDateTime.year = year;
-        currentDateTime.month = month;
-        currentDateTime.day = day;
-        currentDateTime.hour = hour;
-        currentDateTime.minute = minute;
-        currentDateTime.second = 0;
-        currentDateTime.lastSync = millis();
+        setClock(DateCore::toSeconds(DateCore::daysFromCivil(year, month, day), hour, minute, 0));
+        lastSyncMicros = anchorMicros;
         
         isInitialized = true;
+        syncCount++;
         
         Serial.println("[Time] Saving date to SPIFFS...");
         saveDateToSPIFFS();
@@ -210,26 +151,16 @@ public:
         Serial.printf("[Time] Current date string: %s\n", getCurrentDateString().c_str());
     }
     
+    uint32_t getSyncCount() const {
+        return syncCount;
+    }
+    
     // Get date info for notifications (YYYY-MM-DD format)
     String getCurrentDateString() {
-        if (!isInitialized || currentDateTime.year == 0) {
+        if (!isInitialized) {
             return "";
         }
-        
-        char buffer[16];
-        sprintf(buffer, "%04d-%02d-%02d", 
-                currentDateTime.year, 
-                currentDateTime.month, 
-                currentDateTime.day);
-        return String(buffer);
-    }
-    
-    // Get date components
-    void getDateComponents(int &year, int &month, int &day) {
-        updateCurrentTime();  // Update time before getting components
-        year = currentDateTime.year;
-        month = currentDateTime.month;
-        day = currentDateTime.day;
+        return DateCore::formatDate(today());
     }
 };
 
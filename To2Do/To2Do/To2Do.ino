@@ -1,29 +1,30 @@
 /*
  * ESP32-C6 To2Do App - SmartKraft Edition
- * All data persists across firmware updates (stored in SPIFFS)
+ * All data persists across firmware updates (stored in SPIFFS or LittleFS)
  * Smart WiFi Manager with AP Mode fallback
  */
 
 #include <WiFi.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include <ESPmDNS.h>
-#include <SPIFFS.h>
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
 #include "Persistence_Manager.h"
+#include "Response_Stream.h"
+#include "Event_Stream.h"
+#include "Data_Lock.h"
 #include "WiFi_Manager.h"
-#include "Web_Interface.h"
-#include "Web_CSS.h"
-#include "Web_JavaScript.h"
-#include "Web_JavaScript_Lang.h"
-#include "Web_JavaScript_Lang_Handler.h"
+#include "Web_Assets.h" // generated from Web_*.h by tools/build_assets.py
 #include "Backup_Manager.h"
 #include "Time_Manager.h"
 #include "Notification_Manager.h"
 #include "Display_Manager.h"
 #include "Language_Manager.h"
+#include "Benchmark_Manager.h"
+#include "Task_Monitor.h"
+#include "Metrics.h"
 
-WebServer server(80);
+AsyncWebServer server(80);
 PersistenceManager persistence;
 WiFiManager* wifiManager;
 BackupManager* backupManager;
@@ -32,12 +33,70 @@ TimeManager* timeManager;
 DisplayManager* displayManager;
 LanguageManager* languageManager;
 
-const size_t JSON_BUFFER_SIZE = 16384;
+const size_t MAX_BODY_SIZE = 131072;        // Larger POST bodies get 413
+const UBaseType_t DEFERRED_QUEUE_LENGTH = 4; // Slow requests waiting for the net task
 
-// No more time sync tracking - browser provides all time data
-unsigned long lastDisplayUpdate = 0;
-const unsigned long DISPLAY_UPDATE_INTERVAL = 5000; // Update every 5 seconds
-bool firstDisplayUpdate = true; // Flag to force immediate first update
+// Backups never pass through RAM as a whole: exports are streamed shard by
+// shard, uploads are spooled to flash
+const char* BACKUP_IMPORT_FILE = "/import.spool";
+
+// Declared up here: the Arduino builder puts function prototypes above the first function
+typedef void (*RequestHandler)(AsyncWebServerRequest*);
+
+struct DeferredRequest {
+  AsyncWebServerRequestPtr request;
+  RequestHandler handler;
+  int metricsSlot;
+  uint32_t queuedMicros;  // latency includes the wait for the net task
+};
+
+QueueHandle_t deferredQueue = nullptr;
+unsigned long restartAt = 0;                // Set by factory reset, handled by the net task
+
+// Saved from a request, applied by the net task - reconnecting blocks for seconds
+NetworkSettings pendingNetworkSettings;
+bool networkSettingsPending = false;
+
+// Push channel for open browser tabs (GET /api/events)
+EventStream events;
+const unsigned long EVENT_CHECK_INTERVAL = 500; // counts/network/time compared this often
+unsigned long lastEventCheck = 0;
+String pushedCounts;                            // last state sent, owned by the net task
+String pushedNetwork;
+uint32_t pushedTimeSyncs = 0;
+
+// ==================== TASKS ====================
+// net     : WiFi state machine, network changes, deferred (slow) requests, push events
+// storage : sole caller of persistence.loop() - write-behind flush/compaction
+// ui      : button + OLED, the only task that talks to the display
+// time    : browser-synced clock, day rollover, periodic date save
+// HTTP requests run in AsyncTCP's own task. DataManager and the managers
+// around it are shared: everyone holds DataLock while touching them.
+
+enum UiEvent : uint8_t {
+  UI_DATA_CHANGED,      // task/project mutation - counts are stale
+  UI_SETTINGS_CHANGED,  // title/language
+  UI_DAY_CHANGED
+};
+
+enum StorageRequest : uint8_t {
+  STORAGE_SAVE_DATE
+};
+
+QueueHandle_t uiQueue = nullptr;
+QueueHandle_t storageQueue = nullptr;
+
+const UBaseType_t UI_PRIORITY = 3;       // above everything else: button-to-screen < 50 ms
+const UBaseType_t NET_PRIORITY = 2;
+const UBaseType_t STORAGE_PRIORITY = 1;
+const UBaseType_t TIME_PRIORITY = 1;
+
+const TickType_t UI_POLL_TICKS = pdMS_TO_TICKS(10);        // button poll while no event arrives
+const TickType_t NET_POLL_TICKS = pdMS_TO_TICKS(10);
+const TickType_t STORAGE_POLL_TICKS = pdMS_TO_TICKS(100);  // write-behind idle check
+const TickType_t TIME_TICKS = pdMS_TO_TICKS(1000);
+const unsigned long DISPLAY_UPDATE_INTERVAL = 5000;        // Periodic refresh (WiFi info)
+const unsigned long DATE_SAVE_INTERVAL = 3600000UL;        // Persist the running clock hourly
 
 
 
@@ -59,6 +118,8 @@ void setup() {
   WiFi.disconnect();
   delay(200);
   
+  DataLock::begin();
+  
   if (!persistence.begin()) {
     Serial.println("[ERROR] ✗ Persistence failed!");
     return;
@@ -70,11 +131,16 @@ void setup() {
   languageManager = new LanguageManager();
   
   // Load saved language from settings
-  String settingsData = persistence.getDataManager()->getSettings();
-  JsonDocument settingsDoc;
-  deserializeJson(settingsDoc, settingsData);
-  String savedLang = settingsDoc["language"] | "EN";
-  languageManager->begin(savedLang);
+  DataManager* dataManager = persistence.getDataManager();
+  languageManager->begin(dataManager->getCachedSettings().language);
+  
+  // Settings consumers are pushed changes instead of polling the JSON
+  // The display itself is only touched by the ui task
+  dataManager->onSettingsChanged([](const Settings& settings) {
+    languageManager->setLanguage(settings.language);
+    postUiEvent(UI_SETTINGS_CHANGED);
+  });
+  dataManager->onChange(queueChangeEvent);
   
   notificationManager->setTimeManager(timeManager);
   
@@ -82,38 +148,25 @@ void setup() {
     timeManager->setManualDate(2025, 10, 21, 12, 0);
   }
   
+  // Title/language are pushed once here and then by the settings listener,
+  // also when the OLED is only found later
+  if (displayManager) {
+    displayManager->setAppTitle(dataManager->getCachedSettings().appTitle.c_str());
+    displayManager->setLanguage(languageManager->getCurrentLanguage());
+  }
+  
   if (displayManager && displayManager->isDisplayFound()) {
-    String settingsData = persistence.getDataManager()->getSettings();
-    JsonDocument settingsDoc;
-    deserializeJson(settingsDoc, settingsData);
-    String appTitle = settingsDoc["appTitle"] | "To2Do-SmartKraft";
-    
-    displayManager->setAppTitle(appTitle.c_str());
-    
-    // Set language for OLED
-    if (languageManager) {
-      displayManager->setLanguage(languageManager->getCurrentLanguage());
-    }
-    
     // Get task counts immediately
-    String todayJson = notificationManager->getNotifications("today");
-    String tomorrowJson = notificationManager->getNotifications("tomorrow");
-    String weekJson = notificationManager->getNotifications("week");
-    
-    JsonDocument todayDoc, tomorrowDoc, weekDoc;
-    deserializeJson(todayDoc, todayJson);
-    deserializeJson(tomorrowDoc, tomorrowJson);
-    deserializeJson(weekDoc, weekJson);
-    
-    int todayCount = todayDoc["count"] | 0;
-    int tomorrowCount = tomorrowDoc["count"] | 0;
-    int weekCount = weekDoc["count"] | 0;
-    
-    displayManager->setTaskCounts(todayCount, tomorrowCount, weekCount);
+    TaskCounts counts = notificationManager->getTaskCounts();
+    displayManager->setTaskCounts(counts.today, counts.tomorrow, counts.week);
   }
   
   wifiManager = new WiFiManager(&persistence);
   wifiManager->begin();
+  dataManager->onNetworkSettingsChanged([](const NetworkSettings& network) {
+    pendingNetworkSettings = network;
+    networkSettingsPending = true;
+  });
   
   setupServerRoutes();
   server.begin();
@@ -124,82 +177,171 @@ void setup() {
     displayManager->setSystemReady();
   }
   
+  startTasks();
+  
   Serial.printf("[Setup] ✓ Ready (%lums)\n\n", millis() - setupStart);
 }
 
+void startTasks() {
+  uiQueue = xQueueCreate(8, sizeof(UiEvent));
+  storageQueue = xQueueCreate(4, sizeof(StorageRequest));
+  
+  TaskMonitor::start("ui", uiTask, 4096, UI_PRIORITY);
+  TaskMonitor::start("net", netTask, 8192, NET_PRIORITY); // benchmarks run here
+  TaskMonitor::start("storage", storageTask, 6144, STORAGE_PRIORITY);
+  TaskMonitor::start("time", timeTask, 3072, TIME_PRIORITY);
+  TaskMonitor::watch("async_tcp");
+}
+
+void postUiEvent(UiEvent event) {
+  if (uiQueue) {
+    xQueueSend(uiQueue, &event, 0); // full queue: a refresh is pending anyway
+  }
+}
+
+void postStorageRequest(StorageRequest request) {
+  if (storageQueue) {
+    xQueueSend(storageQueue, &request, 0);
+  }
+}
+
+// All work happens in the tasks started by setup()
 void loop() {
-  wifiManager->loop();
-  server.handleClient();
-  
-  // Display Manager loop - handles button and screen updates
-  // Safe to call even if display is not found or fails
-  if (displayManager) {
-    displayManager->loop(); // This is safe - internally checks displayFound
+  vTaskDelete(NULL);
+}
+
+void uiTask(void* parameter) {
+  int slot = (int)(intptr_t)parameter;
+  unsigned long lastDisplayUpdate = 0;
+  bool refresh = true; // first pass fills the screen
+  
+  for (;;) {
+    UiEvent event;
+    bool received = xQueueReceive(uiQueue, &event, UI_POLL_TICKS) == pdTRUE;
+    TaskMonitor::Cycle cycle(slot);
+    
+    if (!displayManager) continue;
+    
+    if (received && event == UI_SETTINGS_CHANGED) {
+      applyDisplaySettings();
+    }
+    refresh = refresh || received;
+    
+    // Button and OLED recovery - safe even if the display is missing
+    displayManager->loop();
     
-    // Only update display data if display is actually working
     if (displayManager->isDisplayFound()) {
-      // Update all display data periodically (every 5 seconds) or immediately on first run
-      unsigned long currentTime = millis();
-      if (firstDisplayUpdate || (currentTime - lastDisplayUpdate >= DISPLAY_UPDATE_INTERVAL)) {
-        lastDisplayUpdate = currentTime;
-        firstDisplayUpdate = false; // Clear the flag after first update
-        
-        // Update app title from settings
-        updateDisplayAppTitle();
-        
-        // Update task counts
+      unsigned long now = millis();
+      if (refresh || now - lastDisplayUpdate >= DISPLAY_UPDATE_INTERVAL) {
+        lastDisplayUpdate = now;
+        refresh = false;
         updateDisplayTaskCounts();
-        
-        // Refresh current page on screen
         displayManager->refreshCurrentPage();
       }
     }
   }
-  
-  // No more internet time sync - browser provides time via /api/time endpoint
-  
-  delay(2); // Small delay for stability
 }
 
-void updateDisplayAppTitle() {
-  if (!displayManager) return;
-  
-  String settingsData = persistence.getDataManager()->getSettings();
-  JsonDocument settingsDoc;
-  deserializeJson(settingsDoc, settingsData);
-  String appTitle = settingsDoc["appTitle"] | "To2Do-SmartKraft";
-  
-  displayManager->setAppTitle(appTitle.c_str());
-  
-  // Update language for OLED
-  if (languageManager) {
-    displayManager->setLanguage(languageManager->getCurrentLanguage());
+void netTask(void* parameter) {
+  int slot = (int)(intptr_t)parameter;
+  
+  for (;;) {
+    {
+      TaskMonitor::Cycle cycle(slot);
+      wifiManager->loop();
+      applyPendingNetworkSettings();
+      runDeferredRequests();
+      publishEvents();
+      
+      if (restartAt && (long)(millis() - restartAt) >= 0) {
+        ESP.restart();
+      }
+    }
+    vTaskDelay(NET_POLL_TICKS);
+  }
+}
+
+void storageTask(void* parameter) {
+  int slot = (int)(intptr_t)parameter;
+  
+  for (;;) {
+    StorageRequest request;
+    bool received = xQueueReceive(storageQueue, &request, STORAGE_POLL_TICKS) == pdTRUE;
+    TaskMonitor::Cycle cycle(slot);
+    DataLock lock;
+    
+    if (received && request == STORAGE_SAVE_DATE && timeManager->isDateValid()) {
+      timeManager->saveDateToSPIFFS();
+    }
+    persistence.loop();
+  }
+}
+
+// No internet time: the browser sets the clock, this task keeps it running
+void timeTask(void* parameter) {
+  int slot = (int)(intptr_t)parameter;
+  int32_t day = 0;
+  unsigned long lastDateSave = millis();
+  
+  for (;;) {
+    vTaskDelay(TIME_TICKS);
+    TaskMonitor::Cycle cycle(slot);
+    
+    int32_t today;
+    {
+      DataLock lock;
+      today = notificationManager->getCurrentDay();
+    }
+    if (today != day) {
+      if (day != 0) {
+        Serial.println("[Time] Day changed - refreshing counts");
+        postUiEvent(UI_DAY_CHANGED);
+      }
+      day = today;
+    }
+    
+    if (millis() - lastDateSave >= DATE_SAVE_INTERVAL) {
+      lastDateSave = millis();
+      postStorageRequest(STORAGE_SAVE_DATE);
+    }
+  }
+}
+
+void applyDisplaySettings() {
+  String title;
+  String language;
+  {
+    DataLock lock;
+    title = persistence.getDataManager()->getCachedSettings().appTitle;
+    language = languageManager->getCurrentLanguage();
+  }
+  displayManager->setAppTitle(title.c_str());
+  displayManager->setLanguage(language);
+}
+
+void applyPendingNetworkSettings() {
+  NetworkSettings network;
+  {
+    DataLock lock;
+    if (!networkSettingsPending) return;
+    network = pendingNetworkSettings;
+    networkSettingsPending = false;
   }
+  wifiManager->applyNewSettings(network);
 }
 
 void updateDisplayTaskCounts() {
   if (!displayManager || !notificationManager || !timeManager) return;
   
-  // Get task counts from notification manager using getNotifications
-  String todayJson = notificationManager->getNotifications("today");
-  String tomorrowJson = notificationManager->getNotifications("tomorrow");
-  String weekJson = notificationManager->getNotifications("week");
-  
-  // Parse JSON to get counts
-  JsonDocument todayDoc;
-  JsonDocument tomorrowDoc;
-  JsonDocument weekDoc;
-  
-  deserializeJson(todayDoc, todayJson);
-  deserializeJson(tomorrowDoc, tomorrowJson);
-  deserializeJson(weekDoc, weekJson);
-  
-  int todayCount = todayDoc["count"] | 0;
-  int tomorrowCount = tomorrowDoc["count"] | 0;
-  int weekCount = weekDoc["count"] | 0;
+  // Single pass over the task index, cached until the data revision changes
+  TaskCounts counts;
+  {
+    DataLock lock;
+    counts = notificationManager->getTaskCounts();
+  }
   
   // Update display
-  displayManager->setTaskCounts(todayCount, tomorrowCount, weekCount);
+  displayManager->setTaskCounts(counts.today, counts.tomorrow, counts.week);
   
   // Update network info
   updateDisplayNetworkInfo();
@@ -212,20 +354,20 @@ void updateDisplayNetworkInfo() {
   String ip = "";
   String local = "";
   
-  String networkData = persistence.getDataManager()->getNetworkSettings();
-  JsonDocument networkDoc;
-  deserializeJson(networkDoc, networkData);
+  NetworkSettings network;
+  {
+    DataLock lock;
+    network = persistence.getDataManager()->getCachedNetworkSettings();
+  }
   
   if (WiFi.getMode() == WIFI_AP) {
-    String apMDNS = networkDoc["apMDNS"] | "to2do";
     ssid = "AP: " + String(WiFi.softAPSSID());
     ip = WiFi.softAPIP().toString();
-    local = String(apMDNS) + ".local";
+    local = network.apMDNS + ".local";
   } else if (WiFi.status() == WL_CONNECTED) {
-    String priMDNS = networkDoc["primaryMDNS"] | "smartkraft-to2do";
     ssid = WiFi.SSID();
     ip = WiFi.localIP().toString();
-    local = String(priMDNS) + ".local";
+    local = network.primaryMDNS + ".local";
   } else {
     // Not connected
     ssid = "Not Connected";
@@ -236,190 +378,699 @@ void updateDisplayNetworkInfo() {
   displayManager->setNetworkInfo(ssid, ip, local);
 }
 
-void setupServerRoutes() {
-  server.on("/", HTTP_GET, handleRoot);
-  server.on("/app.js", HTTP_GET, []() {
-    server.send(200, "application/javascript", getJavaScriptCombined());
-  });
-  server.on("/app.css", HTTP_GET, []() {
-    server.send(200, "text/css", getCSS());
+// ==================== PUSH EVENTS ====================
+// Mutations queue "change" from inside DataManager; the rest is state the net
+// task compares every EVENT_CHECK_INTERVAL and pushes when it moved.
+
+void queueChangeEvent(const ChangeSet& changes) {
+  JsonDocument doc;
+  doc["revision"] = changes.revision;
+  doc["etag"] = persistence.getDataManager()->getETag(0);
+  if (changes.truncated) {
+    doc["truncated"] = true;
+  } else if (changes.records.length()) {
+    doc["records"] = serialized(changes.records);
+  }
+  if (changes.settings) doc["settings"] = true;
+  if (changes.network) doc["network"] = true;
+  
+  String json;
+  serializeJson(doc, json);
+  events.queue("change", json);
+}
+
+String countsJson() {
+  TaskCounts counts = notificationManager->getTaskCounts();
+  char json[96];
+  snprintf(json, sizeof(json), "{\"today\":%d,\"tomorrow\":%d,\"week\":%d,\"overdue\":%d}",
+           counts.today, counts.tomorrow, counts.week, counts.overdue);
+  return String(json);
+}
+
+String timeJson() {
+  JsonDocument doc;
+  doc["date"] = timeManager->getCurrentDateString();
+  doc["syncs"] = timeManager->getSyncCount();
+  String json;
+  serializeJson(doc, json);
+  return json;
+}
+
+// Everything a freshly connected tab needs to tell whether its copy is current
+String helloEvent() {
+  DataManager* dataManager = persistence.getDataManager();
+  JsonDocument doc;
+  doc["revision"] = dataManager->getRevision();
+  doc["etag"] = dataManager->getETag(0);
+  doc["counts"] = serialized(countsJson());
+  doc["network"] = serialized(wifiManager->getStatusJSON());
+  doc["time"] = serialized(timeJson());
+  String json;
+  serializeJson(doc, json);
+  return json;
+}
+
+void publishEvents() {
+  if (millis() - lastEventCheck >= EVENT_CHECK_INTERVAL) {
+    lastEventCheck = millis();
+    
+    // RSSI is left out: it would fire constantly
+    String network = String(wifiManager->isAP() ? "AP" : "STA") + "," +
+                     (wifiManager->isWiFiConnected() ? "1" : "0") + "," + wifiManager->getIP();
+    
+    DataLock lock;
+    String counts = countsJson();
+    if (counts != pushedCounts) {
+      pushedCounts = counts;
+      events.queue("counts", counts);
+    }
+    if (network != pushedNetwork) {
+      pushedNetwork = network;
+      events.queue("network", wifiManager->getStatusJSON());
+    }
+    if (timeManager->getSyncCount() != pushedTimeSyncs) {
+      pushedTimeSyncs = timeManager->getSyncCount();
+      events.queue("time", timeJson());
+    }
+  }
+  events.publish();
+}
+
+// ==================== HTTP SERVER ====================
+// AsyncWebServer: requests are parsed in the async_tcp task, several
+// connections at a time. Handlers that touch user data run under DataLock;
+// slow ones (benchmarks, WiFi scan) are paused and finished by the net task.
+
+// Body chunks land in request->_tempObject (freed by the request)
+void collectBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+  if (total > MAX_BODY_SIZE) {
+    return;
+  }
+  if (index == 0) {
+    request->_tempObject = malloc(total + 1);
+  }
+  if (!request->_tempObject) {
+    return;
+  }
+  memcpy((uint8_t*)request->_tempObject + index, data, len);
+  if (index + len == total) {
+    ((char*)request->_tempObject)[total] = '\0';
+  }
+}
+
+bool hasBody(AsyncWebServerRequest* request) {
+  return request->_tempObject != nullptr;
+}
+
+String requestBody(AsyncWebServerRequest* request) {
+  return hasBody(request) ? String((const char*)request->_tempObject) : String();
+}
+
+// Bodies built as a String: counted for /api/metrics, then sent
+void sendText(AsyncWebServerRequest* request, int code, const char* contentType, const String& body) {
+  Metrics::countBytes(request, body.length());
+  request->send(code, contentType, body);
+}
+
+bool rejectOversizedBody(AsyncWebServerRequest* request) {
+  if (request->contentLength() > MAX_BODY_SIZE) {
+    sendText(request, 413, "application/json", "{\"error\":\"Request body too large\"}");
+    return true;
+  }
+  return false;
+}
+
+const char* methodName(WebRequestMethodComposite method) {
+  if (method == HTTP_GET) return "GET";
+  if (method == HTTP_POST) return "POST";
+  if (method == HTTP_PATCH) return "PATCH";
+  if (method == HTTP_DELETE) return "DELETE";
+  return "ANY";
+}
+
+// Route whose handler reads or writes user data
+void route(const char* path, WebRequestMethodComposite method, RequestHandler handler) {
+  int slot = Metrics::add(path, methodName(method));
+  server.on(path, method, [handler, slot](AsyncWebServerRequest* request) {
+    uint32_t start = micros();
+    Metrics::bind(request, slot);
+    if (!rejectOversizedBody(request)) {
+      DataLock lock;
+      uint32_t revision = persistence.getDataManager()->getRevision();
+      handler(request);
+      if (persistence.getDataManager()->getRevision() != revision) {
+        postUiEvent(UI_DATA_CHANGED);
+      }
+    }
+    Metrics::record(slot, micros() - start, request);
+  }, nullptr, collectBody);
+}
+
+// Route whose handler blocks for seconds: runs in the net task, without the data lock
+void deferredRoute(const char* path, WebRequestMethodComposite method, RequestHandler handler) {
+  int slot = Metrics::add(path, methodName(method));
+  server.on(path, method, [handler, slot](AsyncWebServerRequest* request) {
+    Metrics::bind(request, slot);
+    if (rejectOversizedBody(request)) {
+      Metrics::record(slot, 0, request);
+      return;
+    }
+    deferRequest(request, handler, slot);
+  }, nullptr, collectBody);
+}
+
+void deferRequest(AsyncWebServerRequest* request, RequestHandler handler, int metricsSlot) {
+  uint32_t start = micros();
+  DeferredRequest* job = new DeferredRequest{request->pause(), handler, metricsSlot, start};
+  if (xQueueSend(deferredQueue, &job, 0) != pdTRUE) {
+    delete job;
+    sendText(request, 503, "application/json", "{\"error\":\"Busy\"}");
+    Metrics::record(metricsSlot, micros() - start, request);
+  }
+}
+
+// Half of the free flash: the other half is needed for what the upload turns into
+size_t uploadCapacity() {
+  return (storage().totalBytes() - storage().usedBytes()) / 2;
+}
+
+// Upload whose body is written to spoolPath chunk by chunk instead of RAM;
+// the handler runs in the net task like a deferred route
+void uploadRoute(const char* path, const char* spoolPath, RequestHandler handler) {
+  int slot = Metrics::add(path, "POST");
+  server.on(path, HTTP_POST, [handler, slot](AsyncWebServerRequest* request) {
+    Metrics::bind(request, slot);
+    if (!hasBody(request)) {
+      sendText(request, 400, "application/json", "{\"error\":\"No data\"}");
+    } else if (!*(bool*)request->_tempObject) {
+      sendText(request, 413, "application/json", "{\"error\":\"Not enough flash for the upload\"}");
+    } else {
+      deferRequest(request, handler, slot);
+      return;
+    }
+    Metrics::record(slot, 0, request);
+  }, nullptr, [spoolPath](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+    if (index == 0) {
+      request->_tempObject = malloc(sizeof(bool)); // "spooled so far" flag, freed by the request
+      if (!request->_tempObject) return;
+      *(bool*)request->_tempObject = total <= uploadCapacity();
+    }
+    bool* spooled = (bool*)request->_tempObject;
+    if (!spooled || !*spooled) return;
+    
+    File file = storage().open(spoolPath, index == 0 ? "w" : "a");
+    *spooled = file && file.write(data, len) == len;
+    file.close();
   });
-  server.on("/api/todos", HTTP_GET, handleGetTodos);
-  server.on("/api/todos", HTTP_POST, handleCreateTodo);
-  server.on("/api/todos", HTTP_PUT, handleUpdateTodo);
-  server.on("/api/todos", HTTP_DELETE, handleDeleteTodo);
+}
+
+void runDeferredRequests() {
+  DeferredRequest* job = nullptr;
+  while (xQueueReceive(deferredQueue, &job, 0) == pdTRUE) {
+    if (auto request = job->request.lock()) { // client may have gone away meanwhile
+      job->handler(request.get());
+      Metrics::record(job->metricsSlot, micros() - job->queuedMicros, request.get());
+    }
+    delete job;
+  }
+}
+
+void setupServerRoutes() {
+  deferredQueue = xQueueCreate(DEFERRED_QUEUE_LENGTH, sizeof(DeferredRequest*));
+  
+  // Static assets: page, CSS, JS (gzip'ed in flash) - no user data, no lock
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset* asset = &WEB_ASSETS[i];
+    int slot = Metrics::add(asset->path, "GET");
+    server.on(asset->path, HTTP_GET, [asset, slot](AsyncWebServerRequest* request) {
+      uint32_t start = micros();
+      Metrics::bind(request, slot);
+      handleAsset(request, *asset);
+      Metrics::record(slot, micros() - start, request);
+    });
+  }
+  
+  route("/api/todos", HTTP_GET, handleGetTodos);
+  route("/api/todos", HTTP_POST, handleCreateTodo);
+  
+  // Entity API endpoints - single task/project/checklist item per request
+  // A path also matches its subpaths and the first registered handler wins,
+  // so /api/tasks/... must come before /api/tasks (same for /api/time/sync)
+  route("/api/tasks/graph", HTTP_GET, handleTaskGraph);
+  route("/api/tasks/checklist", HTTP_POST, handleCreateChecklistItem);
+  route("/api/tasks/checklist", HTTP_PATCH, handlePatchChecklistItem);
+  route("/api/tasks/checklist", HTTP_DELETE, handleDeleteChecklistItem);
+  route("/api/tasks", HTTP_GET, handleGetTasks);
+  route("/api/tasks", HTTP_POST, handleCreateTask);
+  route("/api/tasks", HTTP_PATCH, handlePatchTask);
+  route("/api/tasks", HTTP_DELETE, handleDeleteTask);
+  route("/api/projects", HTTP_GET, handleGetProjects);
+  route("/api/projects", HTTP_POST, handleCreateProject);
+  route("/api/projects", HTTP_PATCH, handlePatchProject);
+  route("/api/projects", HTTP_DELETE, handleDeleteProject);
+  route("/api/search", HTTP_GET, handleSearch);
   
   // Settings API endpoints
-  server.on("/api/settings", HTTP_GET, handleGetSettings);
-  server.on("/api/settings", HTTP_POST, handleSaveSettings);
+  route("/api/settings", HTTP_GET, handleGetSettings);
+  route("/api/settings", HTTP_POST, handleSaveSettings);
   
   // Language API endpoints
-  server.on("/api/language", HTTP_GET, handleGetLanguage);
-  server.on("/api/language", HTTP_POST, handleSetLanguage);
-  server.on("/lang.js", HTTP_GET, []() {
-    server.send(200, "application/javascript", getLanguageJS());
-  });
-  server.on("/lang-handler.js", HTTP_GET, []() {
-    server.send(200, "application/javascript", getLanguageHandlerJS());
-  });
+  route("/api/language", HTTP_GET, handleGetLanguage);
+  route("/api/language", HTTP_POST, handleSetLanguage);
   
   // Network API endpoints
-  server.on("/api/network/status", HTTP_GET, handleNetworkStatus);
-  server.on("/api/network/settings", HTTP_GET, handleGetNetworkSettings);
-  server.on("/api/network/config", HTTP_POST, handleNetworkConfig);
-  server.on("/api/network/test", HTTP_POST, handleNetworkTest);
+  route("/api/network/status", HTTP_GET, handleNetworkStatus);
+  route("/api/network/settings", HTTP_GET, handleGetNetworkSettings);
+  route("/api/network/config", HTTP_POST, handleNetworkConfig);
+  deferredRoute("/api/network/test", HTTP_POST, handleNetworkTest);
   
   // System API endpoints
-  server.on("/api/factory-reset", HTTP_POST, handleFactoryReset);
-  server.on("/api/system/info", HTTP_GET, handleSystemInfo);
+  route("/api/factory-reset", HTTP_POST, handleFactoryReset);
+  route("/api/system/info", HTTP_GET, handleSystemInfo);
+  route("/api/system/tasks", HTTP_GET, handleSystemTasks);
+  route("/api/metrics", HTTP_GET, handleMetrics);
+  deferredRoute("/api/bench/index", HTTP_GET, handleBenchTaskIndex);
+  deferredRoute("/api/bench/projects", HTTP_GET, handleBenchProjectLookup);
+  deferredRoute("/api/bench/storage", HTTP_GET, handleBenchStorage);
+  deferredRoute("/api/bench/format", HTTP_GET, handleBenchFormat);
+  deferredRoute("/api/bench/managers", HTTP_GET, handleBenchManagers);
   
   // Backup API endpoints
-  server.on("/api/backup/export", HTTP_GET, handleBackupExport);
-  server.on("/api/backup/import", HTTP_POST, handleBackupImport);
+  route("/api/backup/export", HTTP_GET, handleBackupExport);
+  uploadRoute("/api/backup/import", BACKUP_IMPORT_FILE, handleBackupImport);
   
   // Notification API endpoints
-  server.on("/api/notifications/today", HTTP_GET, []() {
-    handleNotifications("today");
+  route("/api/notifications/today", HTTP_GET, [](AsyncWebServerRequest* request) {
+    handleNotifications(request, "today");
   });
-  server.on("/api/notifications/tomorrow", HTTP_GET, []() {
-    handleNotifications("tomorrow");
+  route("/api/notifications/tomorrow", HTTP_GET, [](AsyncWebServerRequest* request) {
+    handleNotifications(request, "tomorrow");
   });
-  server.on("/api/notifications/week", HTTP_GET, []() {
-    handleNotifications("week");
+  route("/api/notifications/week", HTTP_GET, [](AsyncWebServerRequest* request) {
+    handleNotifications(request, "week");
   });
-  server.on("/api/notifications/overdue", HTTP_GET, []() {
-    handleNotifications("overdue");
+  route("/api/notifications/overdue", HTTP_GET, [](AsyncWebServerRequest* request) {
+    handleNotifications(request, "overdue");
   });
-  server.on("/api/notifications/timezone", HTTP_POST, handleSetTimezone);
+  route("/api/notifications/timezone", HTTP_POST, handleSetTimezone);
   
   // Time API endpoints
-  server.on("/api/time", HTTP_GET, handleGetTime);
-  server.on("/api/time", HTTP_POST, handleSetManualTime);
-  server.on("/api/time/sync", HTTP_POST, handleTimeSyncNow);
+  route("/api/time/sync", HTTP_POST, handleTimeSyncNow);
+  route("/api/time", HTTP_GET, handleGetTime);
+  route("/api/time", HTTP_POST, handleSetManualTime);
+  
+  // Push channel: data changes, counts, network and time (Server-Sent Events)
+  events.begin(server, helloEvent);
+  
+  int healthSlot = Metrics::add("/api/health", "GET");
+  server.on("/api/health", HTTP_GET, [healthSlot](AsyncWebServerRequest* request) {
+    Metrics::bind(request, healthSlot);
+    sendText(request, 200, "application/json", "{\"status\":\"ok\"}");
+    Metrics::record(healthSlot, 0, request);
+  });
+  int notFoundSlot = Metrics::add("*", "ANY");
+  server.onNotFound([notFoundSlot](AsyncWebServerRequest* request) {
+    Metrics::bind(request, notFoundSlot);
+    sendText(request, 404, "text/plain", "404");
+    Metrics::record(notFoundSlot, 0, request);
+  });
+}
+
+// ==================== CONDITIONAL GET ====================
+// Answers 304 when the client already holds this version; otherwise the
+// caller sends the body and tags it with addCacheHeaders()
+
+bool sendNotModified(AsyncWebServerRequest* request, const String& etag, const char* cacheControl) {
+  if (!request->hasHeader("If-None-Match") || request->header("If-None-Match").indexOf(etag) < 0) {
+    return false;
+  }
   
-  server.on("/api/health", HTTP_GET, []() {
-    server.send(200, "application/json", "{\"status\":\"ok\"}");
+  AsyncWebServerResponse* response = request->beginResponse(304);
+  addCacheHeaders(response, etag, cacheControl);
+  request->send(response);
+  return true;
+}
+
+void addCacheHeaders(AsyncWebServerResponse* response, const String& etag, const char* cacheControl) {
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", cacheControl);
+}
+
+void addCacheHeaders(ResponseStream& out, const String& etag, const char* cacheControl) {
+  out.addHeader("ETag", etag);
+  out.addHeader("Cache-Control", cacheControl);
+}
+
+// Served straight from flash - no heap copy. Every browser in use accepts gzip.
+void handleAsset(AsyncWebServerRequest* request, const WebAsset& asset) {
+  if (sendNotModified(request, asset.etag, asset.cacheControl)) {
+    return;
+  }
+  
+  Serial.printf("[Web] %s (%u bytes gzip)\n", asset.path, (unsigned)asset.length);
+  AsyncWebServerResponse* response = request->beginResponse(200, asset.contentType, asset.data, asset.length);
+  response->addHeader("Content-Encoding", "gzip");
+  addCacheHeaders(response, asset.etag, asset.cacheControl);
+  Metrics::countBytes(request, asset.length);
+  request->send(response);
+}
+
+// Grows with the archive: sent in parts of at most one shard, each rendered
+// under the data lock when the connection can take it
+void handleGetTodos(AsyncWebServerRequest* request) {
+  DataManager* dm = persistence.getDataManager();
+  String etag = dm->getETag(0);
+  if (sendNotModified(request, etag, "no-cache")) {
+    Serial.println("[API] GET /api/todos - 304 Not Modified");
+    return;
+  }
+  
+  Serial.println("[API] GET /api/todos - Streaming todos...");
+  uint32_t revision = dm->getRevision();
+  AsyncWebServerResponse* response = beginPartResponse(request, "application/json",
+      [dm, revision, first = true](Print& out, size_t part) mutable {
+    DataLock lock;
+    // Parts of two revisions would not match: the body is cut short, the
+    // client fails to parse it and loads again
+    if (dm->getRevision() != revision) {
+      Serial.println("[API] /api/todos changed while streaming - response cut short");
+      return false;
+    }
+    return dm->writeTodosPart(out, part, first);
+  }, [](const PartResponseStats& stats) {
+    Serial.printf("[API] Sent %u bytes in %u parts, largest part %u bytes, peak heap use %u bytes\n",
+                  (unsigned)stats.bytes, (unsigned)stats.parts, (unsigned)stats.largestPart,
+                  (unsigned)stats.peakHeapUse);
   });
-  server.onNotFound([]() {
-    server.send(404, "text/plain", "404");
+  addCacheHeaders(response, etag, "no-cache");
+  request->send(response);
+}
+
+// ==================== PAGED QUERIES ====================
+// GET /api/projects[?category=Work]                         projects + task counts
+// GET /api/tasks?project=N[&cursor=ID][&limit=L]             limit 100, max 200
+// GET /api/tasks?from=YYYY-MM-DD&to=YYYY-MM-DD[&cursor=D:ID][&limit=L]
+//                                                            limit 50, max 100, at most 366 days
+
+// Streams one page with the data ETag; the URL (query string) tells pages apart
+void sendDataPage(AsyncWebServerRequest* request, std::function<void(Print&)> write) {
+  String etag = persistence.getDataManager()->getETag(0);
+  if (sendNotModified(request, etag, "no-cache")) {
+    return;
+  }
+  ResponseStream out(request);
+  out.begin(200, "application/json");
+  addCacheHeaders(out, etag, "no-cache");
+  write(out);
+  out.end();
+}
+
+int limitArg(AsyncWebServerRequest* request, int defaultLimit, int maxLimit) {
+  int limit = intArg(request, "limit");
+  return limit <= 0 ? defaultLimit : min(limit, maxLimit);
+}
+
+void handleGetProjects(AsyncWebServerRequest* request) {
+  String category = request->hasParam("category") ? request->getParam("category")->value() : String();
+  sendDataPage(request, [&](Print& out) {
+    persistence.getDataManager()->writeProjectPage(out, category.length() > 0 ? category.c_str() : nullptr);
   });
 }
 
-void handleRoot() {
-  Serial.println("[Root] Root page requested");
-  Serial.println("[Root] Serving main page");
-  server.send(200, "text/html", getHTML());
+void handleGetTasks(AsyncWebServerRequest* request) {
+  DataManager* dm = persistence.getDataManager();
+  
+  if (request->hasParam("project")) {
+    int projectId = intArg(request, "project");
+    int cursor = max(intArg(request, "cursor"), 0);
+    size_t limit = limitArg(request, 100, 200);
+    sendDataPage(request, [&](Print& out) {
+      dm->writeTaskPage(out, projectId, cursor, limit);
+    });
+    return;
+  }
+  
+  DateCore::Day fromDay = DateCore::parseDate(request->hasParam("from") ? request->getParam("from")->value().c_str() : nullptr);
+  DateCore::Day toDay = DateCore::parseDate(request->hasParam("to") ? request->getParam("to")->value().c_str() : nullptr);
+  if (fromDay == DateCore::NO_DATE || toDay == DateCore::NO_DATE || toDay < fromDay || toDay - fromDay > 365) {
+    sendText(request, 400, "application/json", "{\"error\":\"project or from/to (at most 366 days) required\"}");
+    return;
+  }
+  
+  DateCore::Day afterDay = DateCore::NO_DATE;
+  int afterId = 0;
+  if (request->hasParam("cursor")) {
+    String cursor = request->getParam("cursor")->value();
+    int colon = cursor.indexOf(':');
+    if (colon > 0) {
+      afterDay = cursor.substring(0, colon).toInt();
+      afterId = cursor.substring(colon + 1).toInt();
+    }
+  }
+  size_t limit = limitArg(request, 50, 100);
+  sendDataPage(request, [&](Print& out) {
+    dm->writeDuePage(out, fromDay, toDay, afterDay, afterId, limit);
+  });
 }
 
-void handleGetTodos() {
-  Serial.println("[API] GET /api/todos - Loading todos...");
-  String content = persistence.loadTodos();
-  Serial.printf("[API] Sending %d bytes\n", content.length());
-  server.send(200, "application/json", content);
+// GET /api/tasks/graph?project=N - dependency order, critical path, blocked tasks
+void handleTaskGraph(AsyncWebServerRequest* request) {
+  int projectId = intArg(request, "project");
+  DataManager* dm = persistence.getDataManager();
+  if (!dm->hasProject(projectId)) {
+    sendText(request, 404, "application/json", "{\"error\":\"Not found\"}");
+    return;
+  }
+  sendDataPage(request, [&](Print& out) {
+    dm->writeDependencyView(out, projectId);
+  });
 }
 
-void handleCreateTodo() {
-  if (!server.hasArg("plain")) {
-    server.send(400, "application/json", "{\"error\":\"No data\"}");
+void handleCreateTodo(AsyncWebServerRequest* request) {
+  if (!hasBody(request)) {
+    sendText(request, 400, "application/json", "{\"error\":\"No data\"}");
     return;
   }
   
-  String body = server.arg("plain");
+  String body = requestBody(request);
   
   Serial.println("[Todos] Received save request");
   Serial.printf("[Todos] Data size: %d bytes\n", body.length());
   
-  if (persistence.saveTodos(body)) {
+  // Invalid tasks (400) and dependency cycles (409) reject the whole body
+  MutationStatus status = persistence.saveTodos(body);
+  if (status == MUTATION_OK) {
     Serial.println("[Todos] ✓ Saved successfully to SPIFFS");
-    server.send(200, "application/json", "{\"success\":true}");
   } else {
     Serial.println("[Todos] ✗ Save failed!");
-    server.send(500, "application/json", "{\"error\":\"Write failed\"}");
   }
+  sendMutationResult(request, status, -1);
+}
+
+// ==================== ENTITY API ====================
+// POST creates, PATCH /?id=N merges fields, DELETE /?id=N removes.
+// Responses carry the new data revision.
+
+bool parseJsonBody(AsyncWebServerRequest* request, JsonDocument& doc) {
+  if (!hasBody(request)) {
+    sendText(request, 400, "application/json", "{\"error\":\"No data\"}");
+    return false;
+  }
+  
+  DeserializationError error = deserializeJson(doc, (const char*)request->_tempObject);
+  if (error || !doc.is<JsonObject>()) {
+    sendText(request, 400, "application/json", "{\"error\":\"Invalid JSON\"}");
+    return false;
+  }
+  return true;
+}
+
+int intArg(AsyncWebServerRequest* request, const char* name) {
+  return request->hasParam(name) ? request->getParam(name)->value().toInt() : -1;
+}
+
+void sendMutationResult(AsyncWebServerRequest* request, MutationStatus status, int id) {
+  switch (status) {
+    case MUTATION_OK: {
+      String response = "{\"success\":true";
+      if (id >= 0) {
+        response += ",\"id\":";
+        response += id;
+      }
+      response += ",\"revision\":";
+      response += persistence.getDataManager()->getRevision();
+      response += "}";
+      sendText(request, 200, "application/json", response);
+      break;
+    }
+    case MUTATION_NOT_FOUND:
+      sendText(request, 404, "application/json", "{\"error\":\"Not found\"}");
+      break;
+    case MUTATION_INVALID:
+      sendText(request, 400, "application/json", "{\"error\":\"Invalid data\"}");
+      break;
+    case MUTATION_CYCLE:
+      sendText(request, 409, "application/json", "{\"error\":\"Dependency cycle\"}");
+      break;
+    default:
+      sendText(request, 500, "application/json", "{\"error\":\"Write failed\"}");
+      break;
+  }
+}
+
+void handleCreateTask(AsyncWebServerRequest* request) {
+  JsonDocument doc;
+  if (!parseJsonBody(request, doc)) return;
+  
+  int id = -1;
+  MutationStatus status = persistence.getDataManager()->createTask(doc.as<JsonObject>(), id);
+  sendMutationResult(request, status, id);
+}
+
+void handlePatchTask(AsyncWebServerRequest* request) {
+  JsonDocument doc;
+  if (!parseJsonBody(request, doc)) return;
+  
+  sendMutationResult(request, persistence.getDataManager()->patchTask(intArg(request, "id"), doc.as<JsonObjectConst>()), -1);
+}
+
+void handleDeleteTask(AsyncWebServerRequest* request) {
+  sendMutationResult(request, persistence.getDataManager()->deleteTask(intArg(request, "id")), -1);
+}
+
+void handleCreateProject(AsyncWebServerRequest* request) {
+  JsonDocument doc;
+  if (!parseJsonBody(request, doc)) return;
+  
+  int id = -1;
+  MutationStatus status = persistence.getDataManager()->createProject(doc.as<JsonObject>(), id);
+  sendMutationResult(request, status, id);
 }
 
-void handleUpdateTodo() {
-  server.send(200, "application/json", "{\"success\":true}");
+void handlePatchProject(AsyncWebServerRequest* request) {
+  JsonDocument doc;
+  if (!parseJsonBody(request, doc)) return;
+  
+  sendMutationResult(request, persistence.getDataManager()->patchProject(intArg(request, "id"), doc.as<JsonObjectConst>()), -1);
 }
 
-void handleDeleteTodo() {
-  server.send(200, "application/json", "{\"success\":true}");
+void handleDeleteProject(AsyncWebServerRequest* request) {
+  sendMutationResult(request, persistence.getDataManager()->deleteProject(intArg(request, "id")), -1);
+}
+
+void handleCreateChecklistItem(AsyncWebServerRequest* request) {
+  JsonDocument doc;
+  if (!parseJsonBody(request, doc)) return;
+  
+  int id = -1;
+  MutationStatus status = persistence.getDataManager()->addChecklistItem(intArg(request, "task"), doc.as<JsonObjectConst>(), id);
+  sendMutationResult(request, status, id);
+}
+
+void handlePatchChecklistItem(AsyncWebServerRequest* request) {
+  JsonDocument doc;
+  if (!parseJsonBody(request, doc)) return;
+  
+  sendMutationResult(request, persistence.getDataManager()->patchChecklistItem(intArg(request, "task"), intArg(request, "id"), doc.as<JsonObjectConst>()), -1);
+}
+
+void handleDeleteChecklistItem(AsyncWebServerRequest* request) {
+  sendMutationResult(request, persistence.getDataManager()->deleteChecklistItem(intArg(request, "task"), intArg(request, "id")), -1);
+}
+
+// GET /api/search?q=...&limit=N (default 20, max 200 per list)
+void handleSearch(AsyncWebServerRequest* request) {
+  String query = request->hasParam("q") ? request->getParam("q")->value() : String();
+  int limit = intArg(request, "limit");
+  if (limit <= 0) {
+    limit = 20;
+  }
+  limit = min(limit, 200);
+  
+  DataManager* dm = persistence.getDataManager();
+  String etag = dm->getETag(limit);
+  if (sendNotModified(request, etag, "no-cache")) {
+    return;
+  }
+  
+  String results = dm->search(query.c_str(), limit);
+  AsyncWebServerResponse* response = request->beginResponse(200, "application/json", results);
+  addCacheHeaders(response, etag, "no-cache");
+  Metrics::countBytes(request, results.length());
+  request->send(response);
 }
 
 // ==================== NETWORK API ====================
 
-void handleNetworkStatus() {
+void handleNetworkStatus(AsyncWebServerRequest* request) {
   String json = wifiManager->getStatusJSON();
-  server.send(200, "application/json", json);
+  sendText(request, 200, "application/json", json);
 }
 
-void handleGetNetworkSettings() {
-  String networkSettings = persistence.loadNetworkSettings();
-  server.send(200, "application/json", networkSettings);
+void handleGetNetworkSettings(AsyncWebServerRequest* request) {
+  String etag = persistence.getDataManager()->getETag(0);
+  if (sendNotModified(request, etag, "no-cache")) return;
+  
+  ResponseStream out(request);
+  out.begin(200, "application/json");
+  addCacheHeaders(out, etag, "no-cache");
+  persistence.streamNetworkSettings(out);
+  out.end();
 }
 
-void handleNetworkConfig() {
-  if (!server.hasArg("plain")) {
-    server.send(400, "application/json", "{\"error\":\"No data\"}");
+void handleNetworkConfig(AsyncWebServerRequest* request) {
+  if (!hasBody(request)) {
+    sendText(request, 400, "application/json", "{\"error\":\"No data\"}");
     return;
   }
   
-  String body = server.arg("plain");
+  String body = requestBody(request);
   Serial.println("[Network] Received network config:");
   Serial.println(body);
   
-  // Parse JSON to extract WiFi settings
-  DynamicJsonDocument doc(2048);
+  // Validate before saving
+  JsonDocument doc;
   DeserializationError error = deserializeJson(doc, body);
   
   if (error) {
-    server.send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
+    sendText(request, 400, "application/json", "{\"error\":\"Invalid JSON\"}");
     return;
   }
   
-  // Extract settings
-  String apSSID = doc["apSSID"] | "SmartKraft-To2Do";
-  String apMDNS = doc["apMDNS"] | "to2do";
+  DataManager* dataManager = persistence.getDataManager();
+  NetworkSettings before = dataManager->getCachedNetworkSettings();
   
-  String priSSID = doc["primarySSID"] | "";
-  String priPass = doc["primaryPassword"] | "";
-  String priIP = doc["primaryIP"] | "";
-  String priMDNS = doc["primaryMDNS"] | "";
-  
-  String bkpSSID = doc["backupSSID"] | "";
-  String bkpPass = doc["backupPassword"] | "";
-  String bkpIP = doc["backupIP"] | "";
-  String bkpMDNS = doc["backupMDNS"] | "";
-  
-  Serial.printf("[Network] AP SSID: %s (mDNS: %s.local)\n", apSSID.c_str(), apMDNS.c_str());
-  Serial.printf("[Network] Primary SSID: %s\n", priSSID.c_str());
-  Serial.printf("[Network] Primary IP: %s\n", priIP.c_str());
-  Serial.printf("[Network] Primary mDNS: %s\n", priMDNS.c_str());
-  
-  // Save network settings to persistence
+  // Save network settings to persistence - WiFiManager is notified on change
   bool saved = persistence.saveNetworkSettings(body);
   Serial.printf("[Network] Data saved to SPIFFS: %s\n", saved ? "YES" : "NO");
   
-  // Apply new settings to WiFi Manager
-  wifiManager->applyNewSettings(apSSID, apMDNS,
-                                 priSSID, priPass, priIP, priMDNS,
-                                 bkpSSID, bkpPass, bkpIP, bkpMDNS);
+  const NetworkSettings& network = dataManager->getCachedNetworkSettings();
+  Serial.printf("[Network] AP SSID: %s (mDNS: %s.local)\n", network.apSSID.c_str(), network.apMDNS.c_str());
+  Serial.printf("[Network] Primary SSID: %s\n", network.primarySSID.c_str());
+  Serial.printf("[Network] Primary IP: %s\n", network.primaryIP.c_str());
+  Serial.printf("[Network] Primary mDNS: %s\n", network.primaryMDNS.c_str());
   
-  server.send(200, "application/json", "{\"success\":true,\"message\":\"Settings saved and connecting...\"}");
+  // Unchanged settings: reconnect anyway, the user asked for it
+  if (network == before) {
+    pendingNetworkSettings = network;
+    networkSettingsPending = true;
+  }
+  
+  sendText(request, 200, "application/json", "{\"success\":true,\"message\":\"Settings saved and connecting...\"}");
 }
 
-void handleNetworkTest() {
-  if (!server.hasArg("plain")) {
-    server.send(400, "application/json", "{\"error\":\"No data\"}");
+void handleNetworkTest(AsyncWebServerRequest* request) {
+  if (!hasBody(request)) {
+    sendText(request, 400, "application/json", "{\"error\":\"No data\"}");
     return;
   }
   
-  String body = server.arg("plain");
-  DynamicJsonDocument doc(512);
+  String body = requestBody(request);
+  JsonDocument doc;
   DeserializationError error = deserializeJson(doc, body);
   
   if (error) {
-    server.send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
+    sendText(request, 400, "application/json", "{\"error\":\"Invalid JSON\"}");
     return;
   }
   
@@ -427,7 +1078,7 @@ void handleNetworkTest() {
   String ssid = doc["ssid"] | "";
   
   if (ssid.isEmpty()) {
-    server.send(400, "application/json", "{\"success\":false,\"message\":\"SSID is required\"}");
+    sendText(request, 400, "application/json", "{\"success\":false,\"message\":\"SSID is required\"}");
     return;
   }
   
@@ -452,143 +1103,297 @@ void handleNetworkTest() {
     String response = "{\"success\":true,\"message\":\"Network found\",\"rssi\":";
     response += String(rssi);
     response += "}";
-    server.send(200, "application/json", response);
+    sendText(request, 200, "application/json", response);
   } else {
-    server.send(200, "application/json", "{\"success\":false,\"message\":\"Network not found\"}");
+    sendText(request, 200, "application/json", "{\"success\":false,\"message\":\"Network not found\"}");
   }
 }
 
 // ==================== SETTINGS API ====================
 
-void handleGetSettings() {
-  String settings = persistence.loadSettings();
-  server.send(200, "application/json", settings);
+void handleGetSettings(AsyncWebServerRequest* request) {
+  String etag = persistence.getDataManager()->getETag(0);
+  if (sendNotModified(request, etag, "no-cache")) return;
+  
+  ResponseStream out(request);
+  out.begin(200, "application/json");
+  addCacheHeaders(out, etag, "no-cache");
+  persistence.streamSettings(out);
+  out.end();
 }
 
-void handleSaveSettings() {
-  if (!server.hasArg("plain")) {
-    server.send(400, "application/json", "{\"error\":\"No data\"}");
+void handleSaveSettings(AsyncWebServerRequest* request) {
+  if (!hasBody(request)) {
+    sendText(request, 400, "application/json", "{\"error\":\"No data\"}");
     return;
   }
   
-  String body = server.arg("plain");
+  String body = requestBody(request);
   
   if (persistence.saveSettings(body)) {
-    server.send(200, "application/json", "{\"success\":true,\"message\":\"Settings saved\"}");
+    sendText(request, 200, "application/json", "{\"success\":true,\"message\":\"Settings saved\"}");
   } else {
-    server.send(500, "application/json", "{\"error\":\"Failed to save settings\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Failed to save settings\"}");
   }
 }
 
 // ==================== SYSTEM API ====================
 
-void handleFactoryReset() {
+void handleFactoryReset(AsyncWebServerRequest* request) {
   Serial.println("\n!!! FACTORY RESET REQUESTED !!!");
   
   // Reset all user data (projects, tasks, settings)
   if (persistence.factoryReset()) {
-    server.send(200, "application/json", "{\"success\":true,\"message\":\"Factory reset completed. Restarting...\"}");
-    delay(1000);
-    ESP.restart();
+    sendText(request, 200, "application/json", "{\"success\":true,\"message\":\"Factory reset completed. Restarting...\"}");
+    restartAt = millis() + 1000; // let the response go out first
   } else {
-    server.send(500, "application/json", "{\"error\":\"Factory reset failed\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Factory reset failed\"}");
   }
 }
 
-void handleSystemInfo() {
-  DynamicJsonDocument doc(1024);
+void handleSystemInfo(AsyncWebServerRequest* request) {
+  JsonDocument doc;
   
   doc["version"] = "SmartKraft-To2Do V1.1";
   doc["chipModel"] = ESP.getChipModel();
   doc["chipCores"] = ESP.getChipCores();
   doc["cpuFreq"] = ESP.getCpuFreqMHz();
   doc["freeHeap"] = ESP.getFreeHeap();
+  doc["minFreeHeap"] = ESP.getMinFreeHeap();
   doc["heapSize"] = ESP.getHeapSize();
   doc["flashSize"] = ESP.getFlashChipSize();
-  doc["spiffsTotal"] = SPIFFS.totalBytes();
-  doc["spiffsUsed"] = SPIFFS.usedBytes();
-  doc["spiffsFree"] = SPIFFS.totalBytes() - SPIFFS.usedBytes();
+  StorageBackend& fs = storage();
+  doc["storageBackend"] = fs.name();
+  doc["spiffsTotal"] = fs.totalBytes();
+  doc["spiffsUsed"] = fs.usedBytes();
+  doc["spiffsFree"] = fs.totalBytes() - fs.usedBytes();
   doc["uptime"] = millis() / 1000;
   
+  DataManager* dm = persistence.getDataManager();
+  if (dm) {
+    const StorageStats& st = dm->getStorageStats();
+    JsonObject storage = doc["storage"].to<JsonObject>();
+    storage["journalBytes"] = dm->getJournalSize();
+    storage["journalAppends"] = st.journalAppends;
+    storage["journalRecords"] = st.journalRecords;
+    storage["flushes"] = st.flushes;
+    storage["coalescedSaves"] = st.coalescedSaves;
+    storage["pendingSaves"] = dm->getPendingSaves();
+    storage["pendingBytes"] = dm->getPendingBytes();
+    storage["compactions"] = st.compactions;
+    storage["bytesWritten"] = st.bytesWritten;
+    storage["lastSaveBytes"] = st.lastSaveBytes;
+    storage["lastSaveUs"] = st.lastSaveMicros;
+    storage["maxSaveUs"] = st.maxSaveMicros;
+    storage["lastCompactionBytes"] = st.lastCompactionBytes;
+    storage["format"] = "msgpack";
+    storage["snapshotBytes"] = st.snapshotBytes;
+    storage["loadUs"] = st.loadMicros;
+    if (st.legacyJsonBytes > 0) {
+      storage["legacyJsonBytes"] = st.legacyJsonBytes;
+      storage["migratedBytes"] = st.migratedBytes;
+    }
+    storage["tasks"] = dm->getTaskCount();
+    storage["searchIndexBytes"] = dm->getSearchIndexMemory();
+    storage["dependencyGraphBytes"] = dm->getDependencyGraph().memoryUsage();
+    storage["blockedTasks"] = dm->getDependencyGraph().blockedCount();
+  }
+  
   String output;
   serializeJson(doc, output);
-  server.send(200, "application/json", output);
+  sendText(request, 200, "application/json", output);
 }
 
-void handleBackupExport() {
+// Per-task stack/CPU use and button-to-screen latency
+void handleSystemTasks(AsyncWebServerRequest* request) {
+  ResponseStream out(request);
+  out.begin(200, "application/json");
+  out.printf("{\"uptimeMs\":%lu,\"tasks\":", millis());
+  TaskMonitor::writeJson(out);
+  if (displayManager) {
+    const InputLatencyStats& input = displayManager->getInputLatency();
+    out.printf(",\"input\":{\"presses\":%u,\"lastUs\":%u,\"maxUs\":%u,\"overTarget\":%u,\"targetUs\":%u}",
+               (unsigned)input.inputs, (unsigned)input.lastMicros, (unsigned)input.maxMicros,
+               (unsigned)input.overTarget, (unsigned)INPUT_LATENCY_TARGET_US);
+  }
+  out.print("}");
+  out.end();
+}
+
+// JSON by default, ?format=prometheus for a scraper
+void handleMetrics(AsyncWebServerRequest* request) {
+  bool prometheus = request->arg("format") == "prometheus";
+  StorageStats storage = persistence.getDataManager()->getStorageStats();  // copied under the data lock
+  
+  const char* type = prometheus ? "text/plain; version=0.0.4" : "application/json";
+  AsyncWebServerResponse* response = beginPartResponse(request, type,
+      [prometheus, storage](Print& out, size_t part) {
+    return Metrics::writePart(out, prometheus, (int)part, storage);
+  });
+  request->send(response);
+}
+
+void handleBackupExport(AsyncWebServerRequest* request) {
   if (!backupManager) {
-    server.send(500, "application/json", "{\"error\":\"Backup manager not ready\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Backup manager not ready\"}");
     return;
   }
   
-  String backupData = backupManager->exportBackup();
-  server.sendHeader("Content-Disposition", "attachment; filename=backup.json");
-  server.send(200, "application/json", backupData);
+  // Same parts as /api/todos: at most one shard rendered per chunk, under the data lock
+  DataManager* dm = persistence.getDataManager();
+  uint32_t revision = dm->getRevision();
+  AsyncWebServerResponse* response = beginPartResponse(request, "application/json",
+      [dm, revision, first = true](Print& out, size_t part) mutable {
+    DataLock lock;
+    // A backup mixing two revisions would import as neither: cut it short so
+    // the client's JSON check rejects it
+    if (dm->getRevision() != revision) {
+      Serial.println("[Backup] Data changed while exporting - response cut short");
+      return false;
+    }
+    return backupManager->writeExportPart(out, part, first);
+  }, [](const PartResponseStats& stats) {
+    Serial.printf("[Backup] Exported %u bytes in %u parts\n", (unsigned)stats.bytes, (unsigned)stats.parts);
+  });
+  response->addHeader("Content-Disposition", "attachment; filename=backup.json");
+  request->send(response);
 }
 
-void handleBackupImport() {
+// Runs in the net task (uploadRoute): validation and shard writes take a while
+void handleBackupImport(AsyncWebServerRequest* request) {
   if (!backupManager) {
-    server.send(500, "application/json", "{\"error\":\"Backup manager not ready\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Backup manager not ready\"}");
     return;
   }
   
-  if (!server.hasArg("plain")) {
-    server.send(400, "application/json", "{\"error\":\"No data\"}");
+  File upload = storage().open(BACKUP_IMPORT_FILE, "r");
+  if (!upload || upload.size() != request->contentLength()) {
+    if (upload) upload.close();
+    storage().remove(BACKUP_IMPORT_FILE);
+    sendText(request, 400, "application/json", "{\"error\":\"Incomplete upload\"}");
     return;
   }
   
-  String backupData = server.arg("plain");
+  String error;
+  bool imported;
+  {
+    DataLock lock;
+    imported = backupManager->importBackup(upload, error);
+  }
+  upload.close();
+  storage().remove(BACKUP_IMPORT_FILE);
   
-  if (backupManager->importBackup(backupData)) {
-    server.send(200, "application/json", "{\"success\":true}");
+  if (imported) {
+    postUiEvent(UI_DATA_CHANGED);
+    sendText(request, 200, "application/json", "{\"success\":true}");
   } else {
-    server.send(500, "application/json", "{\"error\":\"Import failed\"}");
+    Serial.printf("[Backup] Import rejected: %s\n", error.c_str());
+    JsonDocument doc;
+    doc["error"] = "Import failed: " + error;
+    String json;
+    serializeJson(doc, json);
+    sendText(request, 400, "application/json", json);
   }
 }
 
-void handleNotifications(String filterType) {
+// Synthetic on-device benchmark - takes a few seconds, user data is untouched
+void handleBenchTaskIndex(AsyncWebServerRequest* request) {
+  Serial.println("[Bench] Task index benchmark...");
+  ResponseStream out(request);
+  out.begin(200, "application/json");
+  BenchmarkManager::runTaskIndex(out);
+  out.end();
+}
+
+void handleBenchProjectLookup(AsyncWebServerRequest* request) {
+  Serial.println("[Bench] Project lookup benchmark...");
+  ResponseStream out(request);
+  out.begin(200, "application/json");
+  BenchmarkManager::runProjectLookup(out);
+  out.end();
+}
+
+// Writes scratch files under /bench and removes them afterwards
+void handleBenchStorage(AsyncWebServerRequest* request) {
+  Serial.printf("[Bench] Storage benchmark on %s...\n", storage().name());
+  ResponseStream out(request);
+  out.begin(200, "application/json");
+  BenchmarkManager::runStorage(out, storage());
+  out.end();
+}
+
+void handleBenchFormat(AsyncWebServerRequest* request) {
+  Serial.println("[Bench] JSON vs MessagePack benchmark...");
+  ResponseStream out(request);
+  out.begin(200, "application/json");
+  BenchmarkManager::runFormat(out);
+  out.end();
+}
+
+// Separate data set under /bench - minutes at the largest size, user data is untouched
+void handleBenchManagers(AsyncWebServerRequest* request) {
+  Serial.printf("[Bench] Managers benchmark on %s...\n", storage().name());
+  ResponseStream out(request);
+  out.begin(200, "application/json");
+  BenchmarkManager::runManagers(out, storage(), timeManager);
+  out.end();
+}
+
+void handleNotifications(AsyncWebServerRequest* request, String filterType) {
   if (!notificationManager) {
-    server.send(500, "application/json", "{\"error\":\"Notification manager not ready\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Notification manager not ready\"}");
     return;
   }
   
   Serial.printf("[API] GET /api/notifications/%s\n", filterType.c_str());
   
-  String notifications = notificationManager->getNotifications(filterType);
+  // The lists depend on the data, the day and the timezone offset that picks the day
+  int32_t version = notificationManager->getCurrentDay() * 100 + notificationManager->getTimezoneOffset() + 50;
+  String etag = persistence.getDataManager()->getETag(version);
+  if (sendNotModified(request, etag, "no-cache")) {
+    Serial.println("[API] Notifications not modified");
+    return;
+  }
+  
+  // ?excludeBlocked=1 hides tasks still waiting on an open dependency
+  String notifications = notificationManager->getNotifications(filterType, intArg(request, "excludeBlocked") == 1);
   
   Serial.printf("[API] Notification response length: %d bytes\n", notifications.length());
   
-  server.send(200, "application/json", notifications);
+  AsyncWebServerResponse* response = request->beginResponse(200, "application/json", notifications);
+  addCacheHeaders(response, etag, "no-cache");
+  Metrics::countBytes(request, notifications.length());
+  request->send(response);
 }
 
-void handleSetTimezone() {
+void handleSetTimezone(AsyncWebServerRequest* request) {
   if (!notificationManager) {
-    server.send(500, "application/json", "{\"error\":\"Notification manager not ready\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Notification manager not ready\"}");
     return;
   }
   
-  if (!server.hasArg("plain")) {
-    server.send(400, "application/json", "{\"error\":\"No data\"}");
+  if (!hasBody(request)) {
+    sendText(request, 400, "application/json", "{\"error\":\"No data\"}");
     return;
   }
   
-  DynamicJsonDocument doc(256);
-  deserializeJson(doc, server.arg("plain"));
+  JsonDocument doc;
+  deserializeJson(doc, requestBody(request));
   
   int offset = doc["offset"] | 0;
   notificationManager->setTimezoneOffset(offset);
   
-  server.send(200, "application/json", "{\"success\":true}");
+  sendText(request, 200, "application/json", "{\"success\":true}");
 }
 
 // Time API handlers
-void handleGetTime() {
+void handleGetTime(AsyncWebServerRequest* request) {
   if (!timeManager) {
-    server.send(500, "application/json", "{\"error\":\"Time manager not ready\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Time manager not ready\"}");
     return;
   }
   
-  DynamicJsonDocument doc(512);
+  JsonDocument doc;
   doc["date"] = timeManager->getFormattedDate();
   doc["time"] = timeManager->getFormattedTime();
   doc["lastSync"] = timeManager->getLastSyncTime();
@@ -603,24 +1408,24 @@ void handleGetTime() {
                 doc["time"].as<String>().c_str(),
                 doc["isValid"].as<bool>() ? "true" : "false");
   
-  server.send(200, "application/json", response);
+  sendText(request, 200, "application/json", response);
 }
 
-void handleSetManualTime() {
+void handleSetManualTime(AsyncWebServerRequest* request) {
   if (!timeManager) {
-    server.send(500, "application/json", "{\"error\":\"Time manager not ready\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Time manager not ready\"}");
     return;
   }
   
-  if (!server.hasArg("plain")) {
-    server.send(400, "application/json", "{\"error\":\"No data\"}");
+  if (!hasBody(request)) {
+    sendText(request, 400, "application/json", "{\"error\":\"No data\"}");
     return;
   }
   
-  String requestBody = server.arg("plain");
+  String requestBody = requestBody(request);
   Serial.printf("[API] POST /api/time - Request body: %s\n", requestBody.c_str());
   
-  DynamicJsonDocument doc(256);
+  JsonDocument doc;
   deserializeJson(doc, requestBody);
   
   int year = doc["year"] | 0;
@@ -635,7 +1440,7 @@ void handleSetManualTime() {
   if (year < 2024 || year > 2100 || month < 1 || month > 12 || day < 1 || day > 31) {
     Serial.printf("[API] INVALID date/time values: %04d-%02d-%02d %02d:%02d\n",
                  year, month, day, hour, minute);
-    server.send(400, "application/json", "{\"error\":\"Invalid date\"}");
+    sendText(request, 400, "application/json", "{\"error\":\"Invalid date\"}");
     return;
   }
   
@@ -643,7 +1448,7 @@ void handleSetManualTime() {
   timeManager->setManualDate(year, month, day, hour, minute);
   Serial.println("[API] Date set and saved to SPIFFS successfully");
   
-  DynamicJsonDocument response(256);
+  JsonDocument response;
   response["success"] = true;
   response["date"] = timeManager->getFormattedDate();
   response["time"] = timeManager->getFormattedTime();
@@ -652,17 +1457,17 @@ void handleSetManualTime() {
   String responseStr;
   serializeJson(response, responseStr);
   Serial.printf("[API] Response: %s\n", responseStr.c_str());
-  server.send(200, "application/json", responseStr);
+  sendText(request, 200, "application/json", responseStr);
 }
 
-void handleTimeSyncNow() {
+void handleTimeSyncNow(AsyncWebServerRequest* request) {
   if (!timeManager) {
-    server.send(500, "application/json", "{\"error\":\"Time manager not ready\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Time manager not ready\"}");
     return;
   }
   
   // No more internet sync - just return current time from browser-synced data
-  DynamicJsonDocument doc(256);
+  JsonDocument doc;
   doc["success"] = true;
   doc["date"] = timeManager->getFormattedDate();
   doc["time"] = timeManager->getFormattedTime();
@@ -671,53 +1476,47 @@ void handleTimeSyncNow() {
   
   String response;
   serializeJson(doc, response);
-  server.send(200, "application/json", response);
+  sendText(request, 200, "application/json", response);
 }
 
-void handleGetLanguage() {
+void handleGetLanguage(AsyncWebServerRequest* request) {
   if (!languageManager) {
-    server.send(500, "application/json", "{\"error\":\"Language manager not ready\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Language manager not ready\"}");
     return;
   }
   
   String response = languageManager->getLanguageInfo();
-  server.send(200, "application/json", response);
+  sendText(request, 200, "application/json", response);
 }
 
-void handleSetLanguage() {
+void handleSetLanguage(AsyncWebServerRequest* request) {
   if (!languageManager) {
-    server.send(500, "application/json", "{\"error\":\"Language manager not ready\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Language manager not ready\"}");
     return;
   }
   
-  String body = server.arg("plain");
+  String body = requestBody(request);
   JsonDocument doc;
   DeserializationError error = deserializeJson(doc, body);
   
   if (error) {
-    server.send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
+    sendText(request, 400, "application/json", "{\"error\":\"Invalid JSON\"}");
     return;
   }
   
   String newLang = doc["language"] | "";
   if (newLang.length() == 0) {
-    server.send(400, "application/json", "{\"error\":\"Language code required\"}");
+    sendText(request, 400, "application/json", "{\"error\":\"Language code required\"}");
     return;
   }
   
   if (!languageManager->setLanguage(newLang)) {
-    server.send(400, "application/json", "{\"error\":\"Invalid language code\"}");
+    sendText(request, 400, "application/json", "{\"error\":\"Invalid language code\"}");
     return;
   }
   
-  // Save to settings.json
-  String settingsData = persistence.getDataManager()->getSettings();
-  JsonDocument settingsDoc;
-  deserializeJson(settingsDoc, settingsData);
-  settingsDoc["language"] = languageManager->getCurrentLanguage();
-  
-  String updatedSettings;
-  serializeJson(settingsDoc, updatedSettings);
+  // Save to settings.json (merged into the stored settings)
+  String updatedSettings = "{\"language\":\"" + languageManager->getCurrentLanguage() + "\"}";
   
   if (persistence.getDataManager()->setSettings(updatedSettings)) {
     JsonDocument response;
@@ -726,11 +1525,11 @@ void handleSetLanguage() {
     
     String responseStr;
     serializeJson(response, responseStr);
-    server.send(200, "application/json", responseStr);
+    sendText(request, 200, "application/json", responseStr);
     
     Serial.printf("[Language] Saved: %s\n", languageManager->getCurrentLanguage().c_str());
   } else {
-    server.send(500, "application/json", "{\"error\":\"Failed to save language\"}");
+    sendText(request, 500, "application/json", "{\"error\":\"Failed to save language\"}");
   }
 }
 
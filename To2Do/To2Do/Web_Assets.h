@@ -0,0 +1,2453 @@
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+// AUTO-GENERATED by tools/build_assets.py - do not edit.
+// Minified + gzip'ed web assets, served as-is with Content-Encoding: gzip.
+
+#include <Arduino.h>
+
+struct WebAsset {
+  const char* path;
+  const char* contentType;
+  const uint8_t* data;
+  size_t length;
+  const char* etag;
+  const char* cacheControl;
+};
+
+// /app.css <- Web_CSS.h
+static const uint8_t ASSET_APP_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5c, 0xdb, 0x6e, 0xe3, 0xba,
+  0x15, 0xfd, 0x15, 0xe3, 0x14, 0x83, 0x49, 0xda, 0xb1, 0x21, 0x5f, 0x8f, 0xc7, 0x42, 0x81, 0x03,
+  0xf4, 0xbd, 0x6f, 0x05, 0x5a, 0x14, 0x7d, 0xa0, 0x2d, 0xda, 0xd6, 0x89, 0x2c, 0x19, 0x12, 0x3d,
+  0x49, 0x6a, 0xf8, 0xb5, 0x1f, 0xd0, 0x4f, 0xec, 0x97, 0x94, 0x17, 0x89, 0xd7, 0x4d, 0x8a, 0x72,
+  0x9c, 0x9e, 0x22, 0x98, 0x4c, 0x12, 0x8b, 0x9b, 0x9b, 0xe4, 0xbe, 0xef, 0x45, 0xfd, 0xfe, 0x7a,
+  0x42, 0xf5, 0x21, 0x2f, 0x37, 0xa3, 0x24, 0x3d, 0xa3, 0x2c, 0xcb, 0xcb, 0x03, 0xfb, 0x71, 0x5b,
+  0xbd, 0x8d, 0x9b, 0xfc, 0x9f, 0xfc, 0xb7, 0x6d, 0x55, 0x67, 0xb8, 0x1e, 0xd3, 0x3f, 0xdd, 0xb6,
+  0x55, 0xf6, 0x7e, 0xdd, 0x57, 0x25, 0x19, 0xef, 0xd1, 0x29, 0x2f, 0xde, 0x37, 0xa3, 0xaf, 0x7f,
+  0xaa, 0x2e, 0x75, 0x8e, 0xeb, 0xd1, 0x9f, 0xf1, 0xeb, 0xd7, 0x6f, 0xa7, 0xaa, 0xac, 0x9a, 0x33,
+  0xda, 0xe1, 0x74, 0x8b, 0x76, 0x2f, 0x87, 0xba, 0xba, 0x94, 0xd9, 0x66, 0xf4, 0xbb, 0x24, 0x49,
+  0xd2, 0x5d, 0x55, 0x54, 0x35, 0xfd, 0x79, 0xbf, 0xdf, 0xa7, 0xd5, 0x0f, 0x5c, 0xef, 0x8b, 0xea,
+  0x75, 0x33, 0x3a, 0xe6, 0x59, 0x86, 0xcb, 0x94, 0x93, 0xa4, 0xf3, 0xe1, 0xcd, 0x68, 0xba, 0x38,
+  0xbf, 0xa5, 0xe3, 0x71, 0x86, 0x08, 0x26, 0xf9, 0x09, 0x8f, 0xb7, 0x07, 0x46, 0x00, 0xb1, 0x2f,
+  0xe3, 0xcf, 0x9c, 0x29, 0xfa, 0xd1, 0x7c, 0x3e, 0xd7, 0xff, 0x4e, 0xf0, 0x1b, 0x69, 0x67, 0xd1,
+  0xfe, 0x5a, 0xa0, 0x2d, 0x2e, 0xe8, 0x9f, 0x57, 0xab, 0x15, 0x5f, 0xc3, 0xdf, 0xe9, 0x27, 0x68,
+  0x4c, 0x8e, 0xf8, 0x84, 0xff, 0xf8, 0x53, 0x91, 0x1f, 0x8e, 0xe4, 0xa7, 0x7f, 0x5c, 0x0d, 0x96,
+  0xf7, 0x4b, 0xf6, 0x25, 0xb9, 0x66, 0x2b, 0xb0, 0x99, 0xb2, 0xe6, 0x90, 0x1c, 0x65, 0x59, 0x06,
+  0x70, 0x64, 0x51, 0xe8, 0x38, 0x5a, 0xaf, 0xd7, 0x5e, 0x8e, 0x46, 0x93, 0xd7, 0xaa, 0x7e, 0xe1,
+  0xfb, 0x09, 0x31, 0x17, 0x18, 0xd7, 0xe4, 0x19, 0xde, 0xa2, 0xda, 0x1a, 0x45, 0xf9, 0x6d, 0xcf,
+  0xb2, 0x66, 0x0f, 0xd2, 0xbd, 0x3e, 0xbf, 0x8d, 0x9a, 0xaa, 0xc8, 0x33, 0xce, 0x74, 0x3f, 0xbd,
+  0xf1, 0x11, 0x23, 0x3a, 0xfc, 0x2a, 0x25, 0x82, 0x90, 0xea, 0x34, 0x84, 0x0c, 0x41, 0x44, 0xac,
+  0xfc, 0xda, 0x6d, 0xec, 0xf7, 0xef, 0xdf, 0x23, 0xe6, 0x25, 0x68, 0x3b, 0x6c, 0x2d, 0xe9, 0x60,
+  0xfa, 0x13, 0xb4, 0x23, 0xf9, 0x0f, 0xdc, 0x2b, 0x05, 0xd6, 0xda, 0x67, 0x6a, 0x5a, 0xfa, 0x69,
+  0x60, 0xaa, 0x73, 0x5d, 0xfd, 0x8a, 0x77, 0x54, 0xca, 0x31, 0xaa, 0x77, 0x47, 0x70, 0x9a, 0x4e,
+  0x82, 0x3c, 0x4b, 0x09, 0xd3, 0xef, 0x96, 0xd2, 0xce, 0xe3, 0xdb, 0xae, 0x3b, 0x0e, 0xbd, 0xa5,
+  0xb8, 0x39, 0x32, 0xb5, 0xb5, 0xe8, 0x7e, 0x67, 0x5f, 0xdd, 0x9e, 0x74, 0x8c, 0xee, 0x76, 0xbb,
+  0x78, 0xb2, 0xf0, 0xbe, 0x27, 0xec, 0xcb, 0xa6, 0x1b, 0xb7, 0xc1, 0x19, 0x6e, 0x76, 0x52, 0xbc,
+  0x42, 0x0a, 0xaf, 0x86, 0xec, 0xe8, 0xb4, 0x64, 0xa0, 0x48, 0x6e, 0x49, 0xf9, 0x79, 0x87, 0x48,
+  0x89, 0x43, 0xdb, 0x8d, 0x97, 0xec, 0x6b, 0xe0, 0xb6, 0xa0, 0x92, 0xaa, 0xdb, 0x30, 0xf3, 0xc1,
+  0xc7, 0x7c, 0x54, 0xd9, 0x05, 0x91, 0xe6, 0xb2, 0x25, 0x39, 0x29, 0x70, 0xec, 0x89, 0xf0, 0x41,
+  0xfb, 0xbc, 0x20, 0x18, 0xda, 0x62, 0xaf, 0x18, 0x47, 0xea, 0xbb, 0x4d, 0x1e, 0x14, 0x3e, 0xdb,
+  0x5b, 0x0d, 0xdf, 0x6e, 0x6d, 0x06, 0x71, 0x8c, 0x9b, 0xb2, 0x22, 0x4f, 0xed, 0x64, 0xcf, 0x90,
+  0x0a, 0x05, 0x28, 0x12, 0xd4, 0xbc, 0x8c, 0x73, 0x82, 0x4f, 0x0f, 0x50, 0x69, 0x49, 0xeb, 0x51,
+  0xca, 0xcc, 0x09, 0xee, 0x8e, 0x78, 0xf7, 0x42, 0xc3, 0x83, 0x6b, 0xc7, 0x8f, 0x66, 0x14, 0xc3,
+  0xe7, 0x61, 0x0c, 0x9f, 0xf0, 0x1f, 0x70, 0xe6, 0x9c, 0xc6, 0x50, 0x02, 0x9b, 0x0d, 0xda, 0x13,
+  0x25, 0xb9, 0xda, 0x59, 0xf6, 0x51, 0x22, 0xef, 0x67, 0xea, 0xc8, 0x51, 0x76, 0xc0, 0xf7, 0xe8,
+  0x76, 0x58, 0xb4, 0xf9, 0x04, 0xcc, 0x38, 0xd5, 0xf9, 0x99, 0xe4, 0x55, 0x29, 0x35, 0x62, 0xb9,
+  0x5c, 0xf6, 0x0f, 0x3b, 0xe3, 0x92, 0x06, 0x4a, 0xbb, 0x1c, 0x37, 0x81, 0x43, 0x1b, 0x20, 0x09,
+  0x92, 0xe2, 0xfb, 0x20, 0x87, 0xac, 0x0d, 0xe3, 0x22, 0xa9, 0x2d, 0x3d, 0xf5, 0x1b, 0x0a, 0x8c,
+  0x71, 0x1c, 0xcd, 0x1a, 0x9f, 0xaa, 0x1f, 0x9f, 0xb0, 0xf7, 0xce, 0x14, 0xa0, 0xfc, 0x27, 0x8e,
+  0xc7, 0xd9, 0x9b, 0xa6, 0x20, 0x30, 0x03, 0x17, 0xbd, 0x22, 0x6f, 0x88, 0xab, 0x0d, 0xd3, 0x58,
+  0x6d, 0x70, 0x69, 0xc0, 0x2a, 0x11, 0x4b, 0x85, 0x45, 0x9e, 0x91, 0x52, 0x66, 0x0e, 0x9a, 0xec,
+  0xaa, 0xd3, 0xb9, 0xc0, 0x84, 0x4e, 0xdc, 0x0d, 0x47, 0x08, 0x45, 0x0d, 0xbf, 0xff, 0x04, 0x63,
+  0x57, 0xf5, 0xe9, 0x07, 0x98, 0x97, 0xe7, 0x0b, 0x79, 0xbc, 0x6f, 0xe7, 0x8a, 0x7c, 0xc2, 0x04,
+  0x45, 0xaa, 0x1a, 0x7f, 0x9e, 0xb9, 0x8c, 0xaa, 0xbc, 0xcb, 0x13, 0x46, 0x58, 0x23, 0x45, 0x3d,
+  0xde, 0x1f, 0xe8, 0xde, 0x31, 0x62, 0xc1, 0x6a, 0x0a, 0xaa, 0x84, 0x4c, 0xa4, 0x1e, 0x7e, 0x70,
+  0xf8, 0x74, 0x26, 0xef, 0x63, 0x96, 0x5a, 0xa8, 0x20, 0x63, 0xbb, 0xdd, 0x06, 0x46, 0xec, 0xed,
+  0x6c, 0xc2, 0xf5, 0xf8, 0x34, 0xfb, 0x3d, 0xa2, 0x8c, 0x65, 0xa8, 0xc9, 0x88, 0x26, 0xa4, 0xa3,
+  0x29, 0x73, 0x69, 0xf5, 0x61, 0x8b, 0x9e, 0x92, 0x6f, 0xec, 0x6b, 0x32, 0x7f, 0x0e, 0x4f, 0xd0,
+  0x2d, 0xd3, 0xa0, 0xb4, 0x62, 0x94, 0x56, 0x16, 0xa5, 0x65, 0x88, 0xd2, 0xa9, 0xca, 0x90, 0x19,
+  0xbd, 0xe9, 0x43, 0x7f, 0xee, 0x1d, 0x4a, 0xf7, 0xb3, 0x24, 0xb8, 0x0c, 0xa4, 0x03, 0xb3, 0x58,
+  0x8f, 0x21, 0xe8, 0x71, 0xe5, 0xf8, 0xd6, 0xf7, 0x14, 0x33, 0x22, 0xa8, 0xc6, 0xa8, 0xf7, 0xc1,
+  0x86, 0xca, 0xc4, 0xae, 0x9f, 0x1e, 0x4b, 0x9b, 0x1f, 0xaf, 0x91, 0xda, 0x8a, 0x36, 0xfb, 0x6a,
+  0x77, 0x69, 0xa2, 0xd7, 0x15, 0xf9, 0xb8, 0x58, 0x5d, 0xe4, 0xc3, 0x6c, 0x8d, 0xe2, 0xd1, 0xeb,
+  0xa0, 0x88, 0x53, 0x1b, 0xbd, 0x19, 0xbf, 0xe2, 0xed, 0x4b, 0x4e, 0xfd, 0x07, 0x2a, 0xa8, 0xbf,
+  0x63, 0x49, 0x56, 0x4e, 0xdd, 0x47, 0x4d, 0xd7, 0x98, 0xe5, 0x3b, 0x44, 0xaa, 0xfa, 0x2a, 0x22,
+  0xd3, 0xcd, 0x28, 0x2f, 0xa9, 0x78, 0x92, 0xa7, 0xa4, 0x5f, 0x82, 0x3e, 0x25, 0xd1, 0x91, 0xa4,
+  0x69, 0x0e, 0x96, 0x9f, 0x50, 0xfd, 0x1e, 0x54, 0xc8, 0x18, 0x42, 0x8f, 0xca, 0x97, 0x1c, 0xce,
+  0x20, 0xc2, 0xf3, 0xf9, 0x3c, 0x94, 0xc5, 0x61, 0x42, 0xf2, 0xf2, 0xd0, 0xc0, 0x65, 0x8b, 0xc8,
+  0x34, 0x53, 0xa3, 0xd1, 0x65, 0x29, 0xde, 0x32, 0x44, 0xe4, 0xd2, 0x74, 0x9a, 0x1f, 0xcf, 0x4b,
+  0x24, 0x35, 0x33, 0x7e, 0x0c, 0xbb, 0x1d, 0x39, 0xe8, 0x93, 0x9c, 0xac, 0x49, 0xff, 0x1e, 0x75,
+  0xe2, 0xbf, 0x0f, 0x5a, 0x13, 0xa9, 0x0e, 0x87, 0x02, 0x8f, 0x1b, 0xca, 0xaa, 0x2d, 0x27, 0x3d,
+  0xd9, 0x98, 0x3e, 0x70, 0xb3, 0xc5, 0xfb, 0xaa, 0xc6, 0x83, 0x92, 0x9f, 0x76, 0xfc, 0x6b, 0x4e,
+  0x76, 0xc7, 0x91, 0x58, 0x71, 0x1b, 0x30, 0xfe, 0x21, 0xc4, 0xd5, 0xa3, 0xa8, 0x82, 0x2c, 0xf7,
+  0x44, 0x59, 0xcc, 0x1d, 0xbd, 0x11, 0x1a, 0x07, 0x95, 0x97, 0x07, 0xe4, 0xb3, 0x3a, 0xb9, 0x36,
+  0x47, 0xbe, 0x33, 0x09, 0x71, 0x28, 0xf9, 0x23, 0xa2, 0x21, 0x54, 0x26, 0x19, 0x2a, 0x0f, 0x74,
+  0x49, 0x9e, 0xa0, 0x27, 0x32, 0x35, 0xad, 0x50, 0x43, 0x62, 0x6a, 0x14, 0x03, 0xca, 0x91, 0x9c,
+  0xe6, 0x04, 0xd7, 0x75, 0x75, 0x2f, 0x5b, 0xca, 0xdb, 0xd0, 0x94, 0xb6, 0x2a, 0x0a, 0x5e, 0x47,
+  0xad, 0x29, 0xa9, 0x61, 0xc5, 0x26, 0x90, 0xcc, 0xf1, 0x72, 0xda, 0x0e, 0xd0, 0x24, 0x2f, 0x0d,
+  0x68, 0xdf, 0x59, 0x41, 0x43, 0x2b, 0xac, 0x67, 0x79, 0x73, 0x2e, 0xd0, 0xfb, 0x66, 0xb4, 0x2f,
+  0xf0, 0x5b, 0x7a, 0xc4, 0x6d, 0x35, 0x39, 0x49, 0x7e, 0x1c, 0x6f, 0xb2, 0x8e, 0xfe, 0x9a, 0x67,
+  0xe4, 0xb8, 0x19, 0x2d, 0x96, 0xc9, 0xf9, 0xcd, 0x6a, 0x6d, 0x88, 0xce, 0x84, 0xb7, 0x16, 0x3d,
+  0x9b, 0xcd, 0x52, 0x73, 0x0a, 0xf6, 0x6d, 0x9c, 0xe5, 0x35, 0xe6, 0x91, 0xf1, 0x66, 0x44, 0x37,
+  0xfb, 0x72, 0x2a, 0x6f, 0x76, 0x8d, 0x5d, 0x36, 0x63, 0x66, 0x7c, 0x4e, 0xaf, 0x58, 0xd3, 0x09,
+  0xd4, 0x58, 0x51, 0x6a, 0xd3, 0xba, 0x29, 0x7c, 0x30, 0x0d, 0xbb, 0x59, 0x35, 0x8a, 0xad, 0x97,
+  0x53, 0x9c, 0xd3, 0xbf, 0x89, 0xae, 0x8f, 0x22, 0xb8, 0x3c, 0xbf, 0x29, 0x32, 0x2c, 0x98, 0x6e,
+  0xac, 0x9d, 0xf9, 0xf5, 0xd2, 0x90, 0x7c, 0xff, 0xde, 0x05, 0x94, 0x9b, 0x11, 0xdf, 0xbe, 0xf1,
+  0x16, 0x93, 0x57, 0x8c, 0x19, 0xfb, 0x74, 0xcc, 0x95, 0x0b, 0x3f, 0xa2, 0xc7, 0xc2, 0xd6, 0x45,
+  0x9f, 0xc2, 0xb5, 0xf8, 0x60, 0xfc, 0x03, 0x15, 0x17, 0x93, 0xb1, 0x35, 0x65, 0x82, 0xff, 0xfe,
+  0xda, 0x6e, 0xf9, 0xb6, 0x2a, 0xb2, 0x9b, 0xde, 0x22, 0xd0, 0x9b, 0x42, 0x54, 0xae, 0xf5, 0xc4,
+  0xa6, 0x63, 0x9f, 0x54, 0xe7, 0xcd, 0xc8, 0x60, 0x9d, 0xba, 0x36, 0x9b, 0xf3, 0xd8, 0xbd, 0xa3,
+  0xce, 0x9a, 0x3d, 0x4f, 0x9f, 0x50, 0x9d, 0x30, 0x3e, 0xb1, 0xbb, 0xaa, 0x80, 0x0c, 0x6c, 0x46,
+  0x65, 0x55, 0xe2, 0xb0, 0x40, 0xe8, 0x2b, 0xd9, 0x5d, 0xea, 0x86, 0xfd, 0x72, 0xae, 0x72, 0x4e,
+  0x99, 0xaa, 0x50, 0xd9, 0xe4, 0x42, 0x34, 0x50, 0x51, 0x8c, 0x26, 0xb3, 0x26, 0x8d, 0xea, 0xb8,
+  0xd9, 0x3d, 0x34, 0x68, 0x73, 0xd5, 0x52, 0x37, 0x05, 0xe2, 0x75, 0x86, 0xbc, 0xc8, 0xae, 0x26,
+  0xaf, 0x8c, 0xfd, 0x5b, 0x6f, 0x67, 0xc4, 0x53, 0x24, 0x05, 0xda, 0x22, 0xcc, 0x88, 0x28, 0xc9,
+  0x12, 0xdd, 0x0f, 0xb5, 0xbf, 0xcb, 0x7e, 0xe1, 0xb6, 0x3a, 0x27, 0xad, 0x2e, 0x52, 0x0d, 0xfd,
+  0xa2, 0x9d, 0x93, 0xa3, 0x98, 0xd3, 0xe9, 0x14, 0xf2, 0x27, 0xac, 0x5d, 0xa8, 0xf3, 0x7d, 0xcf,
+  0xd6, 0xaa, 0xe5, 0x88, 0x7e, 0x68, 0x2b, 0x34, 0x5d, 0x57, 0x73, 0x4c, 0x29, 0xa1, 0x0b, 0xa9,
+  0x24, 0xe7, 0x34, 0x44, 0xca, 0xa9, 0x01, 0x37, 0x17, 0xdd, 0xfe, 0xa6, 0x56, 0x9d, 0x24, 0x8c,
+  0x72, 0xb7, 0x58, 0xb6, 0x8e, 0x33, 0xa0, 0x08, 0x53, 0x4d, 0x11, 0x16, 0x8b, 0x85, 0xa3, 0xc7,
+  0x90, 0xbe, 0xcf, 0x74, 0x96, 0xbb, 0xfe, 0xd0, 0x10, 0xed, 0x4e, 0xb9, 0xf0, 0x73, 0x87, 0xd6,
+  0x48, 0x15, 0x30, 0x75, 0xc4, 0xe2, 0x63, 0x1d, 0xb4, 0x93, 0xae, 0x42, 0xf4, 0x2b, 0xc1, 0x2d,
+  0xa6, 0x1f, 0xa5, 0x0e, 0x5d, 0x46, 0x7b, 0x2c, 0x54, 0x8f, 0xea, 0x39, 0x01, 0x63, 0xb9, 0xe8,
+  0x76, 0x27, 0x92, 0x97, 0xfb, 0xaa, 0x3b, 0x6b, 0xf5, 0xd7, 0x12, 0x9d, 0x0c, 0xbb, 0xc6, 0xcf,
+  0xd6, 0x51, 0x3d, 0x7b, 0x7b, 0x16, 0xfa, 0x51, 0xf3, 0x86, 0x55, 0xc0, 0xd8, 0xa9, 0x27, 0x79,
+  0xf5, 0xc8, 0x3c, 0x38, 0xe8, 0x64, 0x0e, 0xe8, 0x2c, 0x24, 0x41, 0x8d, 0xa4, 0xb9, 0x4c, 0x55,
+  0xe7, 0xe4, 0xbd, 0xd3, 0x1e, 0x76, 0x3e, 0x9d, 0xaf, 0x5b, 0x2b, 0x15, 0xac, 0x51, 0x96, 0x5f,
+  0x28, 0xa1, 0x65, 0xf2, 0x85, 0x8d, 0x15, 0x63, 0xc6, 0x47, 0xfa, 0x9c, 0x13, 0x24, 0x68, 0x9f,
+  0x9f, 0x30, 0x1d, 0xe5, 0xb4, 0x27, 0xf4, 0x27, 0xa8, 0x56, 0x58, 0xe6, 0x43, 0x7c, 0xac, 0xb7,
+  0xdf, 0x82, 0x3b, 0xd0, 0x1d, 0xe0, 0xbe, 0xaa, 0x88, 0xee, 0x1c, 0x75, 0xfb, 0xc1, 0x9d, 0x41,
+  0xd0, 0xf5, 0x6a, 0x1b, 0xa3, 0xb7, 0xf1, 0x60, 0xab, 0x7f, 0x8f, 0x35, 0xf9, 0x14, 0x63, 0x3e,
+  0xb7, 0xf8, 0x85, 0x04, 0x9f, 0xad, 0x15, 0x14, 0x5e, 0xde, 0xfd, 0xeb, 0x16, 0x18, 0x13, 0x88,
+  0x38, 0xe0, 0x8c, 0x9b, 0xd9, 0x0e, 0x1c, 0x14, 0x97, 0x88, 0x91, 0x3c, 0x2a, 0x19, 0xd7, 0x54,
+  0x06, 0xee, 0x37, 0x3a, 0x9c, 0x59, 0x1a, 0x1c, 0xd4, 0xc4, 0xd6, 0x25, 0xee, 0xfe, 0xb5, 0x89,
+  0x8c, 0x28, 0x63, 0xa6, 0x3e, 0x14, 0x95, 0x48, 0x3b, 0x38, 0xe0, 0x22, 0xb1, 0x56, 0x4f, 0x31,
+  0x79, 0x90, 0x4b, 0x5c, 0xb7, 0x95, 0xbf, 0x87, 0xc8, 0xc2, 0xe0, 0x73, 0xe7, 0xa1, 0x07, 0x64,
+  0x08, 0x25, 0xa7, 0x83, 0x25, 0x41, 0xb5, 0x63, 0x2d, 0x01, 0x93, 0x9c, 0xaf, 0xd7, 0xeb, 0x96,
+  0x09, 0xf2, 0x5e, 0xd0, 0x0f, 0x73, 0x42, 0x8f, 0x61, 0x07, 0x87, 0x8b, 0x7a, 0xaf, 0x13, 0xdc,
+  0xd7, 0xd5, 0xb9, 0x95, 0xb2, 0xd7, 0x9a, 0xfd, 0xca, 0xbe, 0xdf, 0xdc, 0x16, 0xaf, 0xdc, 0x6e,
+  0x5e, 0x1e, 0x4d, 0xe2, 0x3d, 0x87, 0xbe, 0xe3, 0x9f, 0x16, 0x4a, 0xcd, 0xec, 0x95, 0x7a, 0xfb,
+  0xc6, 0x7a, 0x71, 0x27, 0x01, 0x2a, 0xda, 0xea, 0x14, 0x06, 0xb4, 0x87, 0xa9, 0xb0, 0xc9, 0x03,
+  0x0f, 0x05, 0x1b, 0xa9, 0xa1, 0x97, 0x37, 0x5e, 0x7c, 0x6f, 0xb8, 0x66, 0xa1, 0xbc, 0xa4, 0x32,
+  0x72, 0x42, 0xf4, 0x14, 0xda, 0xc8, 0x69, 0xc1, 0x42, 0x0d, 0x5f, 0x00, 0xa2, 0xda, 0xcd, 0xc0,
+  0x99, 0xa7, 0x96, 0xe1, 0x8d, 0xf7, 0xf0, 0xed, 0x66, 0x14, 0x78, 0x4f, 0x78, 0x02, 0xd2, 0x7d,
+  0xc6, 0x62, 0x18, 0x50, 0xc8, 0x83, 0xad, 0x6a, 0x9f, 0x9f, 0x97, 0x83, 0xb4, 0x0e, 0x56, 0xc5,
+  0xc2, 0x20, 0x42, 0xb7, 0x69, 0xb2, 0xd2, 0x1f, 0xb0, 0xbc, 0x9b, 0x62, 0x4f, 0x6f, 0x41, 0x80,
+  0x03, 0x3a, 0x77, 0x07, 0x0d, 0xd9, 0xc3, 0x43, 0xb8, 0xff, 0x03, 0x9e, 0x4f, 0xe4, 0xf3, 0xad,
+  0x75, 0x85, 0xfc, 0xd5, 0x52, 0x1e, 0x8b, 0x6c, 0x2d, 0xb6, 0x27, 0xc9, 0x4d, 0x70, 0xe7, 0xc6,
+  0x35, 0x7b, 0x6c, 0xc4, 0xdf, 0x90, 0x66, 0x08, 0x6b, 0x7a, 0xac, 0xf3, 0xf2, 0x85, 0xa1, 0xfd,
+  0xf4, 0x6c, 0x6a, 0xe6, 0xcc, 0x06, 0x37, 0x21, 0x99, 0xb4, 0x9f, 0xab, 0xee, 0xd8, 0x6a, 0x5c,
+  0x20, 0x26, 0xbd, 0xb7, 0x70, 0x47, 0x5e, 0x5a, 0xfa, 0xaf, 0x5f, 0xb5, 0xc1, 0x34, 0x65, 0xa3,
+  0xae, 0x87, 0xe0, 0x54, 0x48, 0x07, 0x93, 0xac, 0x8e, 0x95, 0xb4, 0x5d, 0xe9, 0xf2, 0xac, 0xe7,
+  0xe6, 0xda, 0x42, 0x55, 0xb1, 0xa3, 0x13, 0x88, 0x76, 0x44, 0xc2, 0xf7, 0x80, 0xfd, 0x4b, 0x84,
+  0x80, 0xed, 0xab, 0x9a, 0x4a, 0x71, 0x5d, 0xb1, 0x46, 0xd1, 0xd3, 0x62, 0x99, 0xe1, 0xc3, 0x73,
+  0xc7, 0x6d, 0xdb, 0x23, 0x91, 0xc1, 0x9d, 0xc0, 0x02, 0x7c, 0xaa, 0xd7, 0x5a, 0xcb, 0x6d, 0x76,
+  0xed, 0x31, 0x1c, 0x42, 0x5a, 0xdc, 0x29, 0xa4, 0x82, 0xd4, 0xc9, 0x25, 0x68, 0x3f, 0x03, 0xee,
+  0xca, 0x97, 0x58, 0x30, 0x50, 0xa2, 0x8b, 0x57, 0xf0, 0xb9, 0x0c, 0x84, 0x10, 0x94, 0x86, 0xdc,
+  0x00, 0xe8, 0x42, 0x87, 0x35, 0x65, 0x9f, 0xeb, 0x80, 0x53, 0xc0, 0xea, 0x2f, 0xd9, 0x97, 0xcf,
+  0x9a, 0x38, 0x06, 0xda, 0x0b, 0x67, 0xd0, 0x8a, 0x05, 0x7a, 0x6e, 0x62, 0xaf, 0xdc, 0x4e, 0x99,
+  0xa6, 0x16, 0x51, 0x6e, 0x10, 0x1f, 0x97, 0x32, 0xad, 0xf8, 0xf2, 0x75, 0x9f, 0xeb, 0x0f, 0xa4,
+  0xb8, 0x07, 0xb0, 0x58, 0x01, 0xb2, 0xf7, 0x6e, 0xa4, 0x48, 0xdf, 0xb5, 0xe7, 0x39, 0x0a, 0x40,
+  0x0a, 0x8f, 0xf5, 0xc1, 0xa6, 0xab, 0xe1, 0x2a, 0xcd, 0xfc, 0xcf, 0xbf, 0xfe, 0x3d, 0xfa, 0x9a,
+  0xea, 0x7d, 0x58, 0xa0, 0x92, 0xe0, 0x62, 0x36, 0xe4, 0xda, 0x58, 0xbb, 0x74, 0x7d, 0x47, 0xcc,
+  0xc4, 0x76, 0x01, 0x8c, 0x99, 0xda, 0x63, 0x4a, 0x7c, 0xe1, 0xd0, 0x23, 0xc0, 0x1d, 0x89, 0xb4,
+  0xf5, 0x12, 0x07, 0xe0, 0x11, 0xd6, 0xd6, 0x85, 0x09, 0x09, 0xd7, 0x40, 0x03, 0xae, 0x80, 0xf8,
+  0x2c, 0x41, 0x17, 0x72, 0xda, 0x72, 0xb9, 0xb2, 0xe4, 0x72, 0x6e, 0xce, 0x60, 0x1b, 0x7f, 0x5e,
+  0xe4, 0x91, 0x36, 0x71, 0xa1, 0xd9, 0xc4, 0xe9, 0xc7, 0x8c, 0x7f, 0x2c, 0x0c, 0x85, 0x27, 0x66,
+  0x16, 0xda, 0xa4, 0x0b, 0x4f, 0x74, 0xd8, 0x88, 0x1f, 0x5c, 0xc2, 0x0b, 0x6b, 0x19, 0xde, 0x55,
+  0x35, 0x12, 0x67, 0x5a, 0xd0, 0x58, 0x65, 0x4c, 0x8e, 0x74, 0x86, 0xc3, 0x31, 0xd5, 0x91, 0x2b,
+  0x2e, 0xc2, 0x44, 0xc5, 0x3b, 0x74, 0xb5, 0xab, 0x3b, 0xe4, 0x0d, 0xdc, 0x1a, 0x4b, 0xde, 0xda,
+  0xbd, 0x11, 0x47, 0xbe, 0xf6, 0x09, 0xe0, 0x03, 0xb0, 0x29, 0x5c, 0xfe, 0x6c, 0x08, 0x0a, 0x58,
+  0xe9, 0x5a, 0xfd, 0xaf, 0x0a, 0x5d, 0x2a, 0x10, 0x68, 0x93, 0xee, 0x0f, 0x9b, 0x3f, 0x5d, 0xd2,
+  0x34, 0x0f, 0x01, 0x54, 0x35, 0x64, 0xa2, 0x9e, 0x06, 0xab, 0x02, 0x1a, 0xc2, 0xc4, 0x9f, 0xd7,
+  0xd9, 0x38, 0x9a, 0x87, 0xa4, 0x1b, 0x90, 0xb1, 0x7a, 0x5c, 0xba, 0x11, 0x01, 0xce, 0x81, 0xab,
+  0x55, 0x46, 0xe7, 0xe6, 0x71, 0x00, 0x1c, 0x2e, 0x9d, 0x3a, 0xce, 0x06, 0xa8, 0x88, 0xab, 0x6d,
+  0x65, 0xe6, 0x92, 0x07, 0xa3, 0x5a, 0x9d, 0xf2, 0xc6, 0x41, 0x37, 0x2a, 0xe4, 0xdb, 0xe7, 0x6f,
+  0x38, 0x4b, 0x3b, 0xcb, 0x37, 0x67, 0x4f, 0xb7, 0xe5, 0x67, 0xfe, 0x73, 0x2b, 0xf9, 0x2b, 0x3d,
+  0xbe, 0x5d, 0x39, 0x47, 0xa5, 0x37, 0xbe, 0x8c, 0xa2, 0xbb, 0xaa, 0x62, 0x19, 0x09, 0x99, 0xdd,
+  0x7e, 0xb0, 0x0f, 0x30, 0x04, 0xfb, 0x99, 0x2d, 0x97, 0xdf, 0xba, 0x7f, 0x93, 0xf9, 0x33, 0x78,
+  0xd8, 0xff, 0x64, 0x38, 0x0b, 0x6e, 0xff, 0xd8, 0x7e, 0x29, 0x10, 0x90, 0x16, 0x7e, 0x36, 0x0c,
+  0x99, 0xf1, 0x34, 0x9d, 0x4c, 0x9f, 0xd3, 0x10, 0x34, 0xc8, 0x98, 0x6d, 0xf9, 0x2c, 0x88, 0xb5,
+  0x39, 0xa7, 0x43, 0x6d, 0xf2, 0x9d, 0x3d, 0x41, 0x53, 0xc8, 0x7c, 0xcf, 0x40, 0x1e, 0xec, 0xb4,
+  0xd9, 0x66, 0x03, 0x11, 0xa4, 0x5a, 0xff, 0x9c, 0xcb, 0x99, 0x31, 0xa6, 0x0d, 0x26, 0xdd, 0xa8,
+  0x9c, 0xeb, 0xeb, 0x78, 0xa9, 0x8e, 0x68, 0xec, 0xe6, 0x7e, 0x70, 0x37, 0x40, 0x3f, 0x08, 0x6f,
+  0xca, 0x62, 0x87, 0x62, 0x2e, 0xdf, 0x52, 0xb3, 0xf9, 0x21, 0x43, 0x96, 0xc5, 0x31, 0x46, 0x6d,
+  0xf3, 0xc9, 0xdf, 0xff, 0x04, 0x96, 0x1e, 0x91, 0xcc, 0x3b, 0x0d, 0xd6, 0x16, 0xa0, 0x65, 0x72,
+  0x68, 0x8b, 0x39, 0xdf, 0xc0, 0xa4, 0xcd, 0x6e, 0x92, 0x54, 0x37, 0xeb, 0x5a, 0xbf, 0xf1, 0x4b,
+  0xea, 0x83, 0x79, 0xad, 0x97, 0xcf, 0x43, 0x56, 0x6d, 0xc8, 0x61, 0xc7, 0x62, 0x57, 0xb1, 0x30,
+  0xac, 0xe4, 0x2d, 0x04, 0x12, 0xb3, 0x0c, 0xe1, 0xcc, 0x34, 0x84, 0x52, 0x43, 0x85, 0x9b, 0x94,
+  0xc5, 0x85, 0xef, 0x74, 0x1d, 0xec, 0xd7, 0x6e, 0x61, 0xdf, 0x93, 0x1f, 0xc7, 0xc8, 0x06, 0x68,
+  0x0b, 0xb1, 0x02, 0x5b, 0x98, 0x56, 0xa8, 0x34, 0xf3, 0xb4, 0x39, 0x94, 0x15, 0x62, 0x66, 0x44,
+  0x7c, 0x4b, 0xf8, 0x7f, 0x1d, 0x79, 0xa6, 0x38, 0x66, 0x52, 0x77, 0xa8, 0xf3, 0x2c, 0x65, 0xdf,
+  0x68, 0x74, 0x42, 0x03, 0x13, 0x6a, 0xde, 0xc6, 0x82, 0x23, 0xba, 0xd1, 0xb3, 0x7d, 0x3d, 0x9a,
+  0x8a, 0x7f, 0x9a, 0x4f, 0x0a, 0x16, 0x46, 0xcc, 0xe9, 0x04, 0x5c, 0xce, 0x46, 0xc5, 0x99, 0xe0,
+  0x37, 0x1d, 0xe3, 0xf6, 0xff, 0xd0, 0xdc, 0x72, 0x61, 0x71, 0x30, 0xfa, 0x0d, 0x02, 0xb9, 0xb9,
+  0x58, 0xb6, 0xea, 0x42, 0x58, 0x54, 0x67, 0x5a, 0x68, 0xc3, 0x4d, 0x99, 0xc4, 0xaf, 0x27, 0xba,
+  0xb5, 0xb2, 0x35, 0xc1, 0x1d, 0x03, 0x16, 0xdc, 0x31, 0xc0, 0x1a, 0xd5, 0xd8, 0x02, 0x2e, 0x46,
+  0x7e, 0x08, 0x06, 0x37, 0x7d, 0xee, 0x08, 0x04, 0xa2, 0x89, 0x69, 0xa2, 0x9f, 0xf3, 0xac, 0x13,
+  0x30, 0x5f, 0xfb, 0x81, 0x1d, 0x86, 0x1e, 0xf1, 0x88, 0x96, 0xa0, 0xc2, 0xd4, 0x7d, 0x5e, 0xd7,
+  0xe1, 0xae, 0x76, 0x31, 0x18, 0xd9, 0xf6, 0xc0, 0xf4, 0x2c, 0x23, 0x79, 0x0b, 0xa3, 0xf1, 0x7c,
+  0x95, 0xe9, 0x28, 0xc4, 0x1d, 0xc3, 0x7f, 0x18, 0x00, 0x36, 0xf0, 0x88, 0x96, 0x1e, 0x53, 0xe1,
+  0xcf, 0xae, 0xd9, 0x5e, 0x06, 0x8c, 0x86, 0x01, 0xe5, 0x8b, 0x38, 0xb1, 0x00, 0x14, 0xc0, 0x6d,
+  0x8d, 0xf3, 0x2d, 0x3f, 0x53, 0xa1, 0x2f, 0xc9, 0xe7, 0xd7, 0xb1, 0xe7, 0x1e, 0x48, 0x40, 0x00,
+  0x67, 0xe8, 0xf4, 0xf5, 0xcd, 0x73, 0x1b, 0x04, 0x27, 0xe4, 0x55, 0x0c, 0x39, 0xc2, 0xaa, 0xb8,
+  0xf5, 0x54, 0xb3, 0x81, 0xb3, 0x90, 0x14, 0x0c, 0xcf, 0x0b, 0x3f, 0xe3, 0xb8, 0xbe, 0x6d, 0x51,
+  0xed, 0x5e, 0xe0, 0x67, 0x47, 0xe7, 0x2b, 0xd8, 0x51, 0x67, 0x79, 0xa9, 0xf4, 0xd5, 0x93, 0x95,
+  0x99, 0xdf, 0x4a, 0x42, 0x8d, 0x70, 0x69, 0x36, 0x89, 0xd9, 0xd2, 0x60, 0x5f, 0x14, 0xa8, 0x4c,
+  0x6e, 0xbc, 0x79, 0x0e, 0x4b, 0x34, 0x80, 0xfa, 0x15, 0x58, 0xaf, 0xb2, 0xc0, 0x95, 0xbf, 0xbd,
+  0x2f, 0x01, 0x8b, 0x9e, 0x20, 0x44, 0xb3, 0xdf, 0x4b, 0x08, 0x5c, 0xa6, 0xc0, 0x1f, 0x46, 0xf7,
+  0xc0, 0xcd, 0x96, 0x05, 0x57, 0xec, 0x9b, 0x81, 0xf0, 0x0c, 0xb5, 0xc1, 0x98, 0x23, 0xea, 0xca,
+  0xcf, 0x22, 0x5b, 0xd5, 0x91, 0x91, 0x57, 0xb7, 0xf8, 0x9d, 0x6a, 0x4f, 0xab, 0x18, 0x97, 0xed,
+  0x83, 0xe4, 0x37, 0x2f, 0xb9, 0x28, 0xb5, 0x12, 0x08, 0x40, 0x2d, 0x55, 0xbb, 0x42, 0x06, 0x8a,
+  0x89, 0xa4, 0x95, 0xdc, 0x2c, 0x58, 0x27, 0x10, 0xad, 0x3b, 0xc6, 0xc3, 0x0c, 0x3e, 0xdb, 0x10,
+  0x3e, 0x91, 0xb9, 0x57, 0x92, 0xda, 0xc8, 0x66, 0xc3, 0xde, 0x4c, 0xe6, 0x8d, 0x1d, 0xcd, 0xcf,
+  0x16, 0xfa, 0x66, 0x18, 0x48, 0x50, 0x88, 0x9f, 0x2e, 0x38, 0xfd, 0xe9, 0x27, 0x15, 0xed, 0xae,
+  0x55, 0x8e, 0x37, 0x15, 0xe2, 0xdc, 0xb6, 0x85, 0x54, 0x4a, 0x08, 0x25, 0x7b, 0x3d, 0x8c, 0x71,
+  0xd4, 0xc2, 0xbd, 0xa0, 0x58, 0x21, 0x64, 0x83, 0xb1, 0xaf, 0x5a, 0x36, 0xc6, 0x7f, 0x64, 0xf1,
+  0xe3, 0x5f, 0x9f, 0x66, 0x34, 0x93, 0x7b, 0x76, 0x52, 0xa4, 0xdb, 0xa4, 0x40, 0xe5, 0xe1, 0x82,
+  0x0e, 0xb8, 0x0d, 0x9a, 0xaa, 0xda, 0x53, 0xb5, 0x80, 0x44, 0x5a, 0x8c, 0xe6, 0xa1, 0x43, 0x07,
+  0x47, 0xd4, 0xe5, 0x6c, 0xe1, 0x69, 0xff, 0x70, 0x23, 0x1e, 0xca, 0xd5, 0xee, 0xea, 0x4b, 0xbb,
+  0x49, 0x9a, 0x9b, 0x4c, 0x1b, 0x67, 0x03, 0x85, 0x18, 0x09, 0x75, 0x64, 0x23, 0x8c, 0x1a, 0x9c,
+  0xf6, 0xeb, 0xb3, 0x2f, 0xc3, 0x93, 0x9b, 0xd2, 0x06, 0x0d, 0x4a, 0x7d, 0x26, 0xeb, 0x14, 0x48,
+  0xbc, 0x13, 0x96, 0x2b, 0x77, 0x63, 0xee, 0x6d, 0xe3, 0xfa, 0xd3, 0x4a, 0x79, 0x44, 0x70, 0xbe,
+  0x98, 0x06, 0xc3, 0xa7, 0x7e, 0xb2, 0x8f, 0xbf, 0xaf, 0x1c, 0xd8, 0xbe, 0x1b, 0x9d, 0x6d, 0x47,
+  0x69, 0x41, 0x1e, 0x8d, 0xdb, 0x43, 0xf9, 0x31, 0xdc, 0x2f, 0x4e, 0xe0, 0x92, 0x34, 0xb3, 0x30,
+  0x40, 0xcc, 0xa4, 0x93, 0x03, 0x9b, 0xa1, 0x1f, 0x82, 0xa8, 0x2d, 0x81, 0x72, 0x0f, 0x14, 0x56,
+  0x79, 0x03, 0x45, 0x2d, 0x56, 0x73, 0x39, 0xf5, 0x14, 0xe8, 0xdc, 0x07, 0xfb, 0x80, 0x67, 0x56,
+  0x98, 0xc5, 0x7b, 0xda, 0x8a, 0x86, 0xdb, 0x29, 0x5c, 0xc0, 0xaa, 0xa8, 0x09, 0x03, 0x18, 0x28,
+  0x28, 0x92, 0xac, 0x9c, 0x47, 0xdd, 0xaf, 0x5d, 0x83, 0x09, 0x37, 0x73, 0x54, 0x20, 0xef, 0x1e,
+  0xac, 0xa9, 0xf5, 0x73, 0xbb, 0xa9, 0x68, 0xcf, 0x0c, 0x0b, 0x34, 0xf0, 0xea, 0x87, 0xbd, 0x55,
+  0x8d, 0x74, 0x08, 0x51, 0xb1, 0x28, 0xa9, 0x49, 0x75, 0xae, 0x8f, 0x03, 0x0a, 0x61, 0x67, 0x2d,
+  0x0e, 0x2d, 0x0f, 0x2c, 0xbe, 0xe7, 0x8a, 0xa2, 0x46, 0x07, 0x8c, 0x4e, 0x53, 0x10, 0x3a, 0x05,
+  0xa4, 0x8d, 0x00, 0xa5, 0xde, 0x18, 0xf6, 0x98, 0x5b, 0x10, 0xba, 0x69, 0x18, 0x31, 0x0d, 0x80,
+  0x7c, 0x2c, 0x6a, 0x4c, 0xbf, 0xca, 0xab, 0xe3, 0x29, 0x3c, 0xe9, 0x83, 0xec, 0x4e, 0x45, 0x86,
+  0x66, 0x5a, 0xff, 0x8b, 0xb3, 0x04, 0xd5, 0x63, 0x03, 0xc1, 0x19, 0x30, 0x73, 0x1b, 0x3f, 0x59,
+  0x44, 0xb4, 0x07, 0x35, 0xcf, 0x69, 0xc5, 0xc4, 0xbf, 0x59, 0xe2, 0x0d, 0x26, 0x65, 0xa0, 0x61,
+  0x72, 0x7b, 0x27, 0xfa, 0xba, 0x86, 0xa4, 0xdb, 0xad, 0xa2, 0x70, 0xb3, 0xcd, 0x20, 0xad, 0x46,
+  0xff, 0x6f, 0x69, 0x97, 0x38, 0xd2, 0xf8, 0x9a, 0xa0, 0x43, 0x7a, 0x0c, 0x43, 0xcd, 0xc2, 0x06,
+  0x0b, 0x2a, 0xae, 0x81, 0x46, 0x4c, 0x9b, 0x4c, 0xa8, 0xed, 0x98, 0x15, 0xf1, 0xe2, 0xea, 0x7a,
+  0x35, 0x3e, 0x63, 0x44, 0x9e, 0x66, 0xdf, 0xa6, 0xfb, 0xfa, 0x59, 0x87, 0xd9, 0xb8, 0x44, 0x81,
+  0xc6, 0xae, 0x07, 0x38, 0xd9, 0x55, 0x20, 0xc4, 0x25, 0x86, 0x4b, 0xd3, 0x83, 0xde, 0x16, 0xb8,
+  0x56, 0xf1, 0xa4, 0x73, 0x3d, 0xc2, 0x90, 0x77, 0x58, 0xf7, 0xfc, 0x3e, 0xdd, 0xf2, 0xcb, 0x1f,
+  0xbf, 0x66, 0x15, 0xe3, 0xef, 0x7a, 0xef, 0x46, 0x45, 0xf9, 0x42, 0xf3, 0xce, 0xb9, 0xe5, 0x0e,
+  0x63, 0x99, 0x34, 0x5f, 0x38, 0x13, 0x8e, 0x7f, 0x1c, 0x57, 0xe8, 0xbf, 0x92, 0xa8, 0xf3, 0x11,
+  0x79, 0xcb, 0xfe, 0x51, 0xee, 0x6e, 0xc0, 0x0c, 0xf7, 0xfb, 0xc1, 0x01, 0x93, 0xdc, 0xe7, 0x20,
+  0x63, 0x26, 0x90, 0xad, 0x08, 0xd8, 0x3b, 0xf6, 0xbc, 0xb1, 0xca, 0xf0, 0x86, 0x03, 0x2f, 0xda,
+  0xba, 0x3e, 0x2f, 0xf2, 0xaa, 0xa9, 0x74, 0x7d, 0x03, 0xaf, 0xc0, 0x86, 0x2f, 0x56, 0x83, 0xd2,
+  0x16, 0xc9, 0xd1, 0x03, 0xaf, 0x43, 0xdb, 0xde, 0x22, 0xe2, 0x0d, 0x11, 0xbd, 0x57, 0x36, 0x01,
+  0x1f, 0x11, 0xb9, 0x40, 0xdd, 0xae, 0x46, 0x1e, 0xaf, 0x6e, 0x60, 0x8d, 0xa8, 0x8f, 0xcf, 0xde,
+  0x7e, 0xcc, 0xee, 0xf8, 0x0d, 0x71, 0x1c, 0x0b, 0xdd, 0x71, 0xf8, 0xfa, 0x53, 0x77, 0x61, 0x65,
+  0xb9, 0x1f, 0xd5, 0x59, 0xe3, 0x26, 0x3c, 0xd4, 0x6f, 0x8f, 0xc5, 0x5a, 0x71, 0x40, 0xbe, 0x4e,
+  0xb9, 0xb7, 0x0e, 0x99, 0xc0, 0x21, 0xa4, 0x76, 0x89, 0x05, 0xf6, 0xcc, 0xfa, 0x24, 0x62, 0xe3,
+  0x23, 0x8b, 0x9d, 0x9e, 0x20, 0x53, 0xd0, 0xf3, 0xd4, 0x56, 0x93, 0x4f, 0x42, 0x25, 0x9b, 0xd3,
+  0x46, 0x05, 0xc3, 0x9e, 0x98, 0x67, 0x31, 0x38, 0xe6, 0x49, 0x82, 0x3b, 0x2b, 0x80, 0x56, 0x56,
+  0xac, 0x60, 0x55, 0xa8, 0xd7, 0x21, 0x74, 0xe6, 0x4a, 0x43, 0x7f, 0xeb, 0x68, 0x36, 0x49, 0x7d,
+  0xd4, 0x90, 0xba, 0x2a, 0x0f, 0x57, 0x23, 0x6e, 0xe4, 0x9f, 0xb6, 0x50, 0x20, 0x23, 0x66, 0x74,
+  0x4f, 0x60, 0xe0, 0x85, 0x49, 0x50, 0xfc, 0xc5, 0x4c, 0xee, 0x62, 0xfb, 0x8b, 0xe3, 0x26, 0x01,
+  0xba, 0x31, 0x2f, 0x57, 0xb0, 0xfe, 0x9a, 0x9a, 0xf7, 0x3c, 0xee, 0x05, 0x56, 0x39, 0x20, 0x36,
+  0x9e, 0xeb, 0x45, 0x5d, 0xe4, 0xb0, 0xf9, 0x8c, 0x0f, 0xe3, 0x53, 0xb8, 0xee, 0x48, 0x25, 0x21,
+  0xf4, 0x42, 0x0f, 0xdb, 0xe4, 0x7d, 0x3c, 0x32, 0x74, 0x2c, 0xd5, 0x43, 0x5e, 0x4e, 0xe6, 0x5a,
+  0xa9, 0x38, 0x63, 0xef, 0x1a, 0x9e, 0x38, 0xbf, 0x62, 0x18, 0x98, 0xd8, 0xf7, 0x2c, 0xf9, 0x6c,
+  0x47, 0x0c, 0x8b, 0x90, 0x51, 0x89, 0x60, 0x71, 0x88, 0xaf, 0x54, 0xa6, 0x22, 0xee, 0x0d, 0x60,
+  0x5e, 0xe5, 0x8f, 0x98, 0xa6, 0xb5, 0x0a, 0x8f, 0x3b, 0x7b, 0x5d, 0xf9, 0xe3, 0xa2, 0x2a, 0x47,
+  0xe5, 0x1f, 0xfe, 0x6a, 0x91, 0x18, 0x65, 0xf5, 0x47, 0x58, 0xe6, 0x9b, 0x2f, 0xc2, 0x78, 0xa1,
+  0x01, 0x78, 0x44, 0xad, 0x47, 0x35, 0xe3, 0x50, 0x1c, 0x89, 0xfd, 0x99, 0x39, 0xb3, 0xfa, 0x6a,
+  0x48, 0xee, 0x4b, 0x34, 0x8c, 0xca, 0x08, 0x5c, 0x3c, 0x0d, 0x5e, 0xfc, 0x03, 0x60, 0xcc, 0x31,
+  0xaf, 0xd7, 0xe0, 0x25, 0xd3, 0x7b, 0x5f, 0xa1, 0x21, 0x10, 0xdc, 0xfc, 0x4d, 0x19, 0x41, 0x98,
+  0x61, 0x7b, 0xc7, 0x24, 0xf9, 0xe2, 0x31, 0xa1, 0x63, 0xfa, 0xd1, 0xb3, 0xe9, 0xcf, 0x44, 0x59,
+  0x24, 0xd8, 0x24, 0xb0, 0xdd, 0xb1, 0xa7, 0x11, 0x23, 0x4f, 0x67, 0xce, 0x06, 0xa1, 0x32, 0x3f,
+  0xb5, 0x3e, 0x83, 0x37, 0x95, 0xfe, 0x72, 0x66, 0x5d, 0x2d, 0xde, 0x11, 0xb9, 0xc5, 0xbf, 0xa0,
+  0xe3, 0x97, 0x17, 0xfc, 0xbe, 0xaf, 0xd1, 0x09, 0x37, 0x1d, 0x95, 0xeb, 0xbe, 0xae, 0x4e, 0xd7,
+  0xc0, 0xf2, 0xd4, 0x1f, 0xfe, 0xf6, 0xc4, 0xaf, 0x7d, 0x3d, 0xa7, 0xaa, 0xf0, 0x7f, 0x23, 0x55,
+  0xec, 0xd8, 0x44, 0x1b, 0x37, 0xbd, 0xdd, 0x80, 0xd7, 0x70, 0x68, 0xf7, 0x8d, 0x6f, 0x91, 0x2f,
+  0x0c, 0x69, 0xdb, 0x01, 0x91, 0xef, 0x05, 0x61, 0x01, 0xc3, 0xa0, 0xd7, 0x7f, 0x30, 0x2b, 0xf8,
+  0x0b, 0xbb, 0xc2, 0x85, 0x9e, 0x14, 0x6c, 0xed, 0xe7, 0x15, 0x65, 0xf0, 0xf9, 0xca, 0x6f, 0xd8,
+  0xa9, 0xfb, 0xaf, 0x02, 0xb1, 0xa3, 0x5e, 0x15, 0xe2, 0xa9, 0xfb, 0x74, 0x51, 0x97, 0x78, 0xdc,
+  0x7a, 0x65, 0x88, 0x00, 0xf6, 0x39, 0x2f, 0x58, 0x88, 0x7d, 0x29, 0x85, 0x7d, 0xe9, 0xd6, 0x7c,
+  0x4f, 0x87, 0x1b, 0x6b, 0xae, 0xdd, 0xd7, 0x78, 0xe8, 0x97, 0x9e, 0xe1, 0x57, 0x71, 0x24, 0xce,
+  0x0b, 0x34, 0xb4, 0x4b, 0x9b, 0x65, 0xc5, 0xfe, 0x57, 0x08, 0x8d, 0x37, 0x6b, 0xa1, 0x02, 0x19,
+  0x63, 0x45, 0x3b, 0x46, 0xcf, 0xdd, 0x7a, 0x5d, 0x82, 0x8e, 0x0e, 0x5c, 0xf0, 0xb7, 0xac, 0x88,
+  0x4b, 0xca, 0xda, 0x86, 0xf9, 0xae, 0x1c, 0x4f, 0x43, 0x77, 0x7d, 0xa7, 0x6b, 0xf7, 0x4e, 0xaa,
+  0xcd, 0x75, 0xea, 0x2c, 0xcc, 0xb8, 0x5c, 0x69, 0xb1, 0xad, 0xae, 0x42, 0x42, 0x1f, 0x80, 0x81,
+  0xbe, 0x8d, 0xa8, 0x34, 0x6b, 0xa9, 0x1d, 0x46, 0x72, 0xf9, 0xc5, 0x81, 0x23, 0x7a, 0xf2, 0x4d,
+  0x09, 0x3c, 0xe4, 0x8b, 0xe3, 0x2f, 0x2e, 0xd4, 0x13, 0x9f, 0x5a, 0xc3, 0xd1, 0x42, 0xe0, 0x83,
+  0xa5, 0x05, 0xb0, 0x15, 0xad, 0x7b, 0x3b, 0x0c, 0x8c, 0x29, 0x92, 0x02, 0x49, 0xa9, 0x55, 0xd8,
+  0xbc, 0xdd, 0xfe, 0x0b, 0xca, 0xc2, 0xac, 0x2d, 0x4c, 0x60, 0x00, 0x00,
+};
+
+// /lang.js <- Web_JavaScript_Lang.h
+static const uint8_t ASSET_LANG_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x5c, 0x5b, 0x73, 0xeb, 0xb8,
+  0x91, 0x7e, 0x9f, 0x5f, 0x81, 0xcc, 0x43, 0xec, 0x53, 0x63, 0x1f, 0x57, 0x66, 0xe6, 0xc9, 0xa9,
+  0x64, 0x8a, 0x96, 0x68, 0x9b, 0xab, 0x9b, 0x57, 0xa4, 0x8e, 0xd7, 0x27, 0x95, 0x3a, 0x05, 0x49,
+  0x90, 0x84, 0x90, 0x22, 0xb5, 0xbc, 0xd8, 0x23, 0x27, 0xf9, 0x1d, 0xfb, 0xb2, 0x55, 0xfb, 0x67,
+  0xf6, 0x97, 0xec, 0x2f, 0xd9, 0xee, 0x06, 0x40, 0x82, 0x37, 0xe9, 0xcc, 0x24, 0x79, 0xb1, 0x25,
+  0xa0, 0x89, 0x4b, 0x77, 0xa3, 0x2f, 0xf8, 0x9a, 0x5a, 0x25, 0x71, 0x96, 0xb3, 0xb1, 0x33, 0x7d,
+  0x60, 0x7f, 0x60, 0x7f, 0xfd, 0xc6, 0x9d, 0xde, 0xc2, 0xdf, 0x2c, 0xe7, 0xf9, 0x97, 0x3c, 0xc9,
+  0x79, 0x74, 0xcb, 0xbe, 0x0d, 0x66, 0x81, 0x33, 0xfe, 0xf6, 0x4a, 0x35, 0xf2, 0x55, 0x2e, 0x5f,
+  0x05, 0xb4, 0x3a, 0x83, 0xc0, 0xfb, 0xe4, 0x9a, 0xe6, 0x43, 0x9a, 0xfc, 0x45, 0xac, 0xf2, 0x0c,
+  0x3a, 0x9e, 0xe6, 0xb3, 0x7f, 0x73, 0x07, 0x81, 0x8f, 0x5d, 0x82, 0xa7, 0xab, 0x9d, 0xdd, 0xe9,
+  0x53, 0x0b, 0x33, 0x2d, 0x1f, 0x3f, 0x7e, 0x04, 0xb2, 0x58, 0xbc, 0x19, 0x9a, 0x2f, 0xcb, 0x3c,
+  0x06, 0xb2, 0xef, 0xd8, 0xd4, 0x7d, 0x66, 0x7a, 0x24, 0x1a, 0x28, 0xcf, 0x65, 0xbc, 0xcd, 0x74,
+  0xb7, 0xef, 0x06, 0x81, 0x37, 0x7d, 0xc0, 0x29, 0x36, 0x32, 0xca, 0x45, 0xfa, 0x85, 0x47, 0xb8,
+  0x52, 0x67, 0x3c, 0xb6, 0x9a, 0x5a, 0x2b, 0xd5, 0x1d, 0xab, 0x64, 0x7f, 0x88, 0x44, 0x2e, 0xd6,
+  0xd0, 0x37, 0x98, 0x4d, 0x9e, 0xc6, 0x6e, 0xe0, 0x0e, 0xab, 0xee, 0x9c, 0x67, 0x21, 0xee, 0xda,
+  0xf1, 0x47, 0x55, 0xe3, 0x21, 0xe2, 0x38, 0xf1, 0x13, 0xf0, 0xa9, 0x6a, 0x8c, 0x93, 0x1c, 0xc7,
+  0x9f, 0xce, 0x02, 0x6b, 0xf4, 0x54, 0xec, 0x65, 0xbc, 0x16, 0x29, 0x74, 0xcc, 0xdd, 0x89, 0x37,
+  0x1d, 0xba, 0x73, 0xe8, 0x34, 0x1b, 0xfe, 0xb2, 0x13, 0x5c, 0x75, 0x5a, 0x6c, 0x42, 0x96, 0xc0,
+  0x52, 0xab, 0x3e, 0x67, 0x3e, 0x78, 0x54, 0x4b, 0x16, 0xfb, 0x43, 0x7e, 0x84, 0x89, 0x0c, 0x7f,
+  0x68, 0x3a, 0xc3, 0x18, 0xe6, 0xbb, 0x63, 0xf8, 0x47, 0x8b, 0x57, 0x84, 0x99, 0x88, 0x90, 0x89,
+  0x15, 0xb1, 0x4f, 0x0d, 0x8c, 0x1b, 0x8e, 0xb3, 0x4d, 0x9a, 0xec, 0x59, 0xbe, 0x13, 0x2c, 0x12,
+  0x9b, 0xdc, 0x9e, 0x00, 0xb7, 0x8d, 0x12, 0x9a, 0x26, 0x8c, 0x3e, 0xb2, 0xa3, 0xa8, 0xfa, 0x57,
+  0xa9, 0xe0, 0xb9, 0x30, 0xac, 0x19, 0x44, 0x72, 0x15, 0xb2, 0xef, 0x58, 0x9e, 0x30, 0xd5, 0xc1,
+  0x8e, 0x49, 0x91, 0xb2, 0x8d, 0x4c, 0x41, 0x93, 0x90, 0x06, 0x9e, 0xdb, 0x27, 0x6b, 0x1e, 0x7d,
+  0x41, 0xc9, 0xea, 0x87, 0x50, 0xa0, 0x9a, 0xa7, 0xaa, 0x4f, 0xac, 0x65, 0x6e, 0x3a, 0xdd, 0xa1,
+  0x17, 0x98, 0x5e, 0x6c, 0xfa, 0x92, 0xcb, 0x3c, 0x12, 0xc8, 0xf5, 0x95, 0xd8, 0x25, 0x91, 0xe2,
+  0x4a, 0x80, 0x6d, 0x4a, 0x63, 0x88, 0x66, 0x2d, 0xb2, 0x55, 0x83, 0x64, 0x08, 0x4d, 0xa9, 0x3c,
+  0xe4, 0x32, 0x89, 0xaf, 0xd8, 0x5a, 0xe4, 0x5c, 0x46, 0xd9, 0x15, 0x43, 0x39, 0x65, 0xd6, 0x83,
+  0xf9, 0xf1, 0x50, 0xee, 0x25, 0x50, 0xcb, 0xad, 0xda, 0x8d, 0xa4, 0xe1, 0x5f, 0xad, 0xdd, 0x08,
+  0x1b, 0xfe, 0xd5, 0xda, 0x6d, 0x79, 0xeb, 0x8f, 0x24, 0x6f, 0x99, 0xa4, 0x12, 0x38, 0x17, 0x25,
+  0x6f, 0xd0, 0x33, 0x4e, 0xde, 0xec, 0xc6, 0x3d, 0xec, 0xbd, 0xd8, 0x43, 0xfb, 0x84, 0x3e, 0xd8,
+  0x5d, 0x3b, 0xb9, 0xdd, 0x41, 0xc7, 0x23, 0xfc, 0x83, 0xe6, 0x54, 0x1c, 0x80, 0xbf, 0x30, 0x77,
+  0xac, 0xe6, 0x8e, 0x45, 0xd5, 0xb8, 0x86, 0xcd, 0x1d, 0x71, 0xcf, 0xf8, 0xbf, 0x6a, 0x7e, 0x13,
+  0x22, 0x5c, 0xf3, 0x23, 0x8a, 0xf2, 0x59, 0x7f, 0xac, 0x77, 0xd2, 0x43, 0xcf, 0xf4, 0xa1, 0xea,
+  0xd8, 0x27, 0x71, 0xbe, 0xa3, 0x9e, 0x89, 0xfa, 0x54, 0x75, 0x89, 0x57, 0x91, 0x62, 0x87, 0x8b,
+  0xff, 0xd9, 0x25, 0x0e, 0x78, 0x83, 0xe3, 0x64, 0x37, 0xf4, 0x50, 0xf6, 0xa1, 0x26, 0x6d, 0x4b,
+  0x4f, 0x6b, 0x27, 0xd8, 0x92, 0x79, 0x45, 0x42, 0x62, 0xaf, 0x68, 0x8c, 0x0d, 0x88, 0xf9, 0xbe,
+  0x29, 0xfb, 0x27, 0xad, 0xbe, 0xd8, 0xa5, 0x24, 0x69, 0x88, 0x3b, 0xb4, 0xc0, 0x10, 0xaf, 0x2b,
+  0x6d, 0x30, 0xcf, 0x54, 0x52, 0xf9, 0x12, 0xf1, 0xa5, 0x88, 0x94, 0x6c, 0xd8, 0x93, 0xee, 0x68,
+  0x0b, 0xa9, 0x24, 0x53, 0xa2, 0xea, 0xa4, 0x44, 0x99, 0x95, 0x74, 0x28, 0x39, 0x9b, 0x0a, 0x2c,
+  0xd6, 0x97, 0x15, 0x8f, 0x57, 0xd4, 0x39, 0x70, 0xa6, 0x03, 0x77, 0x6c, 0x5a, 0xe9, 0xec, 0x60,
+  0xeb, 0xdc, 0x75, 0xc8, 0x84, 0x60, 0x6b, 0xc6, 0xc9, 0x68, 0xf9, 0xce, 0x27, 0xd3, 0x52, 0x1c,
+  0xd6, 0x8a, 0x6e, 0xf1, 0x34, 0xac, 0xe8, 0xd6, 0x02, 0x6d, 0x18, 0xca, 0xdf, 0x45, 0x03, 0x66,
+  0xc6, 0x8c, 0x92, 0x8c, 0x86, 0x1c, 0xcf, 0x7c, 0xd3, 0xc6, 0xd7, 0x6b, 0xa0, 0x3e, 0x08, 0x50,
+  0xcd, 0x78, 0x75, 0x24, 0xeb, 0x3a, 0x74, 0x9f, 0x5c, 0xb0, 0x4c, 0xd3, 0xc1, 0x8b, 0xa6, 0x11,
+  0x3f, 0x1f, 0x92, 0x94, 0x44, 0xf2, 0x1f, 0x4f, 0xb3, 0x79, 0xa0, 0x5b, 0xe5, 0x5e, 0xb7, 0x7a,
+  0x13, 0xab, 0x15, 0x0e, 0x13, 0xb6, 0x05, 0xae, 0x1f, 0xb0, 0xc1, 0x6c, 0x3a, 0x05, 0xe1, 0x79,
+  0xb3, 0x69, 0x69, 0x2b, 0xe8, 0xe8, 0xe2, 0x48, 0x93, 0xa7, 0xe0, 0xa5, 0x6c, 0x45, 0x59, 0x94,
+  0xa6, 0x03, 0xed, 0xcf, 0x77, 0x6c, 0x59, 0xe4, 0x79, 0x12, 0x33, 0x9e, 0xd3, 0xf7, 0x65, 0x02,
+  0xdf, 0xf6, 0x2c, 0x05, 0xf6, 0xa1, 0xdd, 0x81, 0xe3, 0x26, 0x37, 0xe5, 0x58, 0x60, 0x62, 0xbd,
+  0x7b, 0x6f, 0xe0, 0xe0, 0x44, 0x7e, 0xd5, 0x0b, 0x3a, 0x75, 0x24, 0x07, 0x35, 0x74, 0x5e, 0xac,
+  0xd6, 0x7d, 0x92, 0xa6, 0x74, 0xec, 0x82, 0xd9, 0x64, 0x36, 0x9f, 0xcf, 0x9e, 0xcb, 0x3e, 0xd4,
+  0x5b, 0x6c, 0x7f, 0xf4, 0x7c, 0xf6, 0xec, 0xba, 0xa3, 0xb2, 0x23, 0x01, 0xe5, 0x5e, 0x17, 0x38,
+  0xd5, 0xec, 0x93, 0x3b, 0x1f, 0x2e, 0xdc, 0xb2, 0x27, 0x4a, 0xf8, 0x1a, 0x5c, 0x0f, 0x29, 0x0a,
+  0x7d, 0xaa, 0x0c, 0x49, 0xd6, 0xee, 0x54, 0xb6, 0x53, 0xbb, 0x35, 0x7a, 0xbe, 0xd2, 0x76, 0xfd,
+  0xa9, 0xd9, 0x93, 0x55, 0x5d, 0x59, 0xb5, 0x09, 0x65, 0x9d, 0xb4, 0x31, 0xad, 0xda, 0x32, 0xdd,
+  0x98, 0xd9, 0x4e, 0xd1, 0x70, 0xc9, 0x72, 0x8b, 0x55, 0x1f, 0x5f, 0x7e, 0xd9, 0x16, 0x12, 0x7a,
+  0x1f, 0x16, 0x5e, 0xb3, 0x63, 0x95, 0xc4, 0x31, 0x4c, 0x0b, 0xe7, 0x83, 0x5c, 0xa1, 0x25, 0xca,
+  0x1a, 0x99, 0x8c, 0x37, 0x09, 0x2a, 0xc1, 0xf4, 0x7e, 0x06, 0x5d, 0x30, 0xda, 0x17, 0x10, 0x18,
+  0x1c, 0x51, 0x30, 0x91, 0xdb, 0x82, 0x6f, 0x05, 0x71, 0xd4, 0x9d, 0xb8, 0xec, 0xb7, 0x14, 0x47,
+  0x2c, 0x9c, 0x07, 0xb7, 0x4e, 0x87, 0x32, 0x45, 0x1e, 0x79, 0x0f, 0x8f, 0x41, 0xad, 0x67, 0xcd,
+  0x53, 0xdc, 0xe6, 0xd0, 0x99, 0x8f, 0x74, 0x3b, 0x3f, 0x1c, 0xb4, 0xf1, 0x37, 0x07, 0xca, 0x79,
+  0x7a, 0x62, 0x81, 0x17, 0x8c, 0xdd, 0x16, 0x45, 0xc3, 0x3d, 0x24, 0xdf, 0x0f, 0x13, 0x76, 0xcd,
+  0xfc, 0x3d, 0x4f, 0xf3, 0x51, 0xca, 0xc9, 0xbd, 0xe1, 0x03, 0x2b, 0x38, 0x3d, 0x5b, 0x38, 0x8e,
+  0x22, 0x2b, 0xc7, 0x04, 0x4d, 0x72, 0x1f, 0x66, 0xf3, 0x17, 0x36, 0x75, 0x26, 0xae, 0x5f, 0xa7,
+  0x3b, 0x36, 0xc6, 0x1d, 0xe8, 0x66, 0x4d, 0x85, 0x67, 0x31, 0x97, 0xfb, 0x6a, 0x7d, 0x78, 0x26,
+  0xd9, 0x0d, 0x2c, 0x71, 0xe2, 0x5a, 0x24, 0xb5, 0x6e, 0xb3, 0x67, 0xfb, 0x31, 0x4d, 0x8f, 0x22,
+  0x00, 0x4d, 0x90, 0xb0, 0xe8, 0xe3, 0x97, 0x37, 0xb9, 0x91, 0x14, 0x1a, 0x78, 0x13, 0x07, 0x16,
+  0xf7, 0x0c, 0x3a, 0x6f, 0x48, 0x96, 0x7c, 0x15, 0x16, 0x07, 0x43, 0x71, 0xe7, 0x0c, 0x46, 0x8b,
+  0xa7, 0x1a, 0x01, 0x3f, 0x80, 0x11, 0x5f, 0x53, 0xbc, 0xf3, 0xc4, 0x26, 0xb3, 0xa1, 0xcb, 0x2c,
+  0x75, 0x20, 0x0a, 0x0c, 0xd4, 0x8a, 0xcc, 0x08, 0x5d, 0x85, 0x3f, 0xe6, 0x73, 0x83, 0x06, 0x14,
+  0xae, 0x46, 0x07, 0x5e, 0x8f, 0x9d, 0xa1, 0xdd, 0xc8, 0x6d, 0x91, 0xda, 0xc4, 0xba, 0xa1, 0xa4,
+  0xce, 0xe4, 0xba, 0xdc, 0xfc, 0xb3, 0xbc, 0x97, 0xcc, 0xf7, 0xbd, 0x21, 0xbb, 0x9c, 0x8a, 0xfc,
+  0x2d, 0x49, 0x43, 0x36, 0x05, 0xcb, 0xfe, 0xa1, 0x64, 0x08, 0xcf, 0x32, 0x68, 0x6d, 0x3c, 0xf0,
+  0xe4, 0xf8, 0xfe, 0xf3, 0x6c, 0x3e, 0x2c, 0x87, 0xdc, 0x81, 0x19, 0x37, 0xa4, 0xa8, 0xff, 0x3b,
+  0x34, 0xe5, 0xfa, 0xbb, 0xbd, 0x4a, 0xb9, 0xfa, 0x22, 0x0f, 0xe5, 0x58, 0x7e, 0x00, 0x76, 0x64,
+  0xc0, 0xbc, 0x27, 0xe6, 0x0c, 0x87, 0x73, 0xd7, 0xf7, 0xdb, 0xa4, 0x3b, 0x19, 0x93, 0xc2, 0x0a,
+  0x30, 0xc6, 0x8c, 0x0c, 0x18, 0xdb, 0x24, 0x29, 0x1b, 0x3e, 0x0e, 0x9e, 0xd8, 0x25, 0x2f, 0xc0,
+  0xc4, 0x20, 0x65, 0xb9, 0xdc, 0xfd, 0x3a, 0xae, 0x74, 0x6b, 0x3f, 0x9c, 0xfa, 0xec, 0x71, 0xe6,
+  0x07, 0xa8, 0x5b, 0x35, 0x0a, 0x3d, 0xaa, 0xb3, 0x5a, 0x89, 0x2c, 0x63, 0xaf, 0x92, 0xdf, 0xb2,
+  0x5d, 0x9e, 0x1f, 0x6e, 0x6f, 0x6e, 0x6a, 0x64, 0xfc, 0xf0, 0x15, 0x94, 0x40, 0x54, 0xe3, 0x28,
+  0x08, 0x5d, 0xf1, 0x53, 0x3f, 0xf3, 0x94, 0xc0, 0x10, 0x75, 0xa6, 0xa2, 0x86, 0xf4, 0x2e, 0x14,
+  0x1e, 0x04, 0xb5, 0x01, 0x05, 0xb2, 0xc9, 0x31, 0xee, 0xac, 0xd8, 0x0b, 0x91, 0xa1, 0xf9, 0xc6,
+  0x52, 0xf1, 0x9f, 0x85, 0x04, 0xe9, 0x7e, 0x64, 0x33, 0x70, 0x2c, 0x2c, 0xd6, 0x42, 0x44, 0x26,
+  0x09, 0x9e, 0x1d, 0x55, 0x2c, 0x78, 0x8d, 0x0a, 0xcf, 0xc0, 0x94, 0x14, 0x87, 0x8f, 0x66, 0xd4,
+  0x55, 0x91, 0xa6, 0x22, 0xce, 0xb5, 0xf2, 0xa0, 0x0a, 0x2e, 0xe6, 0x73, 0x77, 0x6a, 0x7b, 0x12,
+  0x86, 0x02, 0x5a, 0x94, 0x52, 0x41, 0xad, 0xae, 0xbc, 0x30, 0xaa, 0x78, 0x39, 0x96, 0xd1, 0x48,
+  0xb0, 0xf9, 0xb6, 0x32, 0xb3, 0x20, 0x29, 0x69, 0x40, 0x98, 0xe0, 0xff, 0x52, 0x60, 0x09, 0x5a,
+  0x30, 0x10, 0xb9, 0xfe, 0x52, 0xca, 0x5c, 0x6e, 0x63, 0x08, 0x4c, 0xb2, 0x1c, 0x56, 0xb5, 0xcd,
+  0x31, 0xf4, 0xf2, 0xa9, 0x85, 0xf9, 0xa6, 0x05, 0x28, 0xd1, 0x00, 0x7e, 0x01, 0x0f, 0x91, 0x29,
+  0x4b, 0xf9, 0x49, 0x7f, 0x32, 0x3d, 0xfa, 0x50, 0xa2, 0x8e, 0x96, 0x6d, 0xf2, 0x40, 0xf3, 0x95,
+  0xdf, 0x91, 0xf3, 0x9a, 0xe7, 0x65, 0x1b, 0xb0, 0x70, 0x15, 0x22, 0x27, 0xc8, 0xc7, 0xfe, 0xfb,
+  0xc2, 0x1b, 0x8c, 0x70, 0xef, 0xe4, 0x68, 0x2d, 0x82, 0xdf, 0x41, 0xe7, 0xef, 0x3e, 0xb2, 0x32,
+  0x94, 0x37, 0x76, 0xaa, 0x15, 0xcb, 0x5b, 0xcf, 0x7c, 0x0f, 0xcf, 0x7c, 0xff, 0x91, 0x0d, 0x54,
+  0x78, 0x5e, 0x85, 0xff, 0x6f, 0x32, 0xdf, 0xb1, 0x8b, 0x5a, 0x7a, 0x75, 0xa1, 0x1d, 0x71, 0x7d,
+  0x80, 0x1f, 0x60, 0x80, 0x1f, 0x60, 0x00, 0xf2, 0xd7, 0xe0, 0xa5, 0xcd, 0x00, 0x10, 0xf3, 0xab,
+  0x24, 0x83, 0xc9, 0xc6, 0x94, 0x3f, 0xc2, 0x13, 0x3f, 0x7e, 0x44, 0x06, 0xeb, 0x04, 0x82, 0xe6,
+  0xc2, 0xe5, 0x5d, 0x7c, 0x67, 0xe6, 0xc0, 0x91, 0x1a, 0x8e, 0x9e, 0x46, 0x30, 0xc1, 0xdc, 0x9e,
+  0xc7, 0xe0, 0x4f, 0xf6, 0x82, 0xb4, 0xdf, 0x64, 0x39, 0x13, 0x67, 0x0a, 0x1e, 0x65, 0x02, 0x4a,
+  0xd2, 0x24, 0xaf, 0x22, 0x28, 0xb5, 0x4f, 0x1d, 0xf8, 0xdd, 0x76, 0xd3, 0x99, 0x18, 0x64, 0x91,
+  0x89, 0x1e, 0x16, 0x34, 0x62, 0x11, 0x9b, 0xad, 0x66, 0x28, 0x8c, 0x60, 0x31, 0xb8, 0x81, 0x7f,
+  0xbd, 0xd3, 0x51, 0x94, 0xab, 0x27, 0x9b, 0xe3, 0x36, 0xaf, 0x57, 0x4d, 0x36, 0xf2, 0x78, 0x6d,
+  0xf8, 0x78, 0x81, 0x51, 0xf0, 0x45, 0x6b, 0xc9, 0xc9, 0xe1, 0x48, 0x3a, 0x7d, 0x38, 0xf6, 0x6f,
+  0x0b, 0x3a, 0xbb, 0xe6, 0xf9, 0x23, 0xbb, 0x18, 0xcc, 0x9e, 0x5e, 0x2e, 0x50, 0x58, 0xeb, 0xe2,
+  0x00, 0x6d, 0xc8, 0x9c, 0x2a, 0xfc, 0xa8, 0x0d, 0xa2, 0x93, 0x4f, 0x34, 0x21, 0xea, 0x53, 0xef,
+  0x74, 0x26, 0x4d, 0xed, 0x9e, 0x51, 0xe7, 0xac, 0x34, 0xe9, 0x1e, 0xc2, 0x29, 0xfc, 0xaf, 0x9f,
+  0x68, 0x0e, 0x54, 0x85, 0xae, 0xf4, 0xa1, 0x77, 0x42, 0x45, 0xd7, 0x33, 0x9f, 0x0a, 0x7b, 0x69,
+  0xba, 0x83, 0x48, 0x41, 0x71, 0x40, 0x69, 0xa2, 0x23, 0x18, 0x26, 0x9c, 0xdc, 0x8c, 0x44, 0x69,
+  0x5a, 0x4d, 0xa9, 0x30, 0xc9, 0xec, 0xd0, 0x28, 0x22, 0x04, 0x43, 0x81, 0x6c, 0x00, 0x05, 0xc6,
+  0xac, 0xf0, 0xb6, 0xd9, 0xd7, 0x8e, 0x61, 0xdf, 0x76, 0x32, 0xff, 0x1a, 0xf5, 0xa6, 0x11, 0xcc,
+  0xb5, 0x03, 0x49, 0x55, 0x7d, 0xec, 0x98, 0xc7, 0x50, 0xb5, 0x27, 0x5b, 0xed, 0xc4, 0x2a, 0x5c,
+  0x26, 0x3f, 0xe3, 0x24, 0xe6, 0xd0, 0xb3, 0x64, 0x43, 0x9f, 0x75, 0x9c, 0x58, 0x0d, 0x83, 0xa9,
+  0x69, 0xa6, 0xd3, 0x5b, 0x16, 0xd0, 0x97, 0x76, 0xbf, 0x99, 0x03, 0x89, 0xae, 0x18, 0x66, 0xbc,
+  0x57, 0x0c, 0xf3, 0xdb, 0x2b, 0x66, 0x32, 0x59, 0x08, 0xa7, 0x7e, 0x64, 0x44, 0xcb, 0xf8, 0x2b,
+  0xe4, 0x99, 0x7c, 0x19, 0x59, 0xd2, 0x34, 0xc9, 0x14, 0x64, 0x88, 0x11, 0xdd, 0xfc, 0xe8, 0x16,
+  0x36, 0x56, 0x2d, 0x3d, 0x94, 0x66, 0x5a, 0x4c, 0xbc, 0x2e, 0x1f, 0x52, 0x21, 0xe2, 0x0f, 0x57,
+  0x4c, 0xa7, 0x57, 0x97, 0x2f, 0x22, 0x82, 0xe4, 0x0c, 0x1a, 0x28, 0x8f, 0xba, 0x9c, 0x8b, 0xf5,
+  0x07, 0x33, 0x4c, 0x56, 0x2c, 0x4d, 0x08, 0xec, 0x9b, 0x8f, 0xcd, 0x3e, 0x33, 0x36, 0x0a, 0x91,
+  0x18, 0x16, 0xc9, 0x2c, 0xcf, 0x98, 0x8c, 0xc1, 0x57, 0x82, 0x27, 0xe7, 0xab, 0x9d, 0xe1, 0x15,
+  0x0a, 0x54, 0x3f, 0x45, 0x29, 0x11, 0x3e, 0xa1, 0xbf, 0xab, 0xf0, 0x9d, 0xa2, 0x38, 0xf0, 0x80,
+  0x3a, 0xf9, 0x9a, 0xce, 0x98, 0x0e, 0xe5, 0x68, 0xc2, 0x32, 0xa1, 0x92, 0xc4, 0xe7, 0xa1, 0xfd,
+  0xb5, 0x8b, 0xa6, 0xdc, 0xb4, 0x8c, 0x43, 0x6d, 0x1f, 0xf1, 0xa0, 0x90, 0x6a, 0x32, 0xf4, 0x9d,
+  0x9b, 0x88, 0xee, 0x08, 0xe8, 0x41, 0x75, 0x95, 0xa4, 0x12, 0x8b, 0x7b, 0x6f, 0x1c, 0xb8, 0x73,
+  0x88, 0xe3, 0xea, 0x9d, 0xd5, 0x8d, 0xd7, 0x6d, 0xbb, 0xc3, 0x4c, 0x46, 0x01, 0x11, 0x7c, 0x67,
+  0x26, 0x65, 0xa8, 0xd1, 0xd5, 0xef, 0xc7, 0x6e, 0x3b, 0xbb, 0x6b, 0x23, 0x25, 0x31, 0x1c, 0x30,
+  0x19, 0x1b, 0x15, 0xed, 0x1c, 0xb5, 0xf3, 0x72, 0xed, 0xb6, 0x8f, 0xa8, 0x3d, 0x7c, 0xd9, 0xd5,
+  0x39, 0x7a, 0xa9, 0xd6, 0x70, 0x8a, 0x6f, 0xf0, 0x32, 0xee, 0x06, 0x2f, 0xdf, 0x6e, 0xcc, 0x45,
+  0xdb, 0x6d, 0x17, 0xb9, 0x99, 0xe3, 0x9e, 0xda, 0xd8, 0xf2, 0x48, 0x0a, 0x5d, 0x2a, 0x8e, 0xba,
+  0xa2, 0x8c, 0xf9, 0x2b, 0x25, 0x50, 0x68, 0xc5, 0x20, 0x8d, 0x99, 0x3a, 0x9f, 0xbc, 0x07, 0x47,
+  0xe7, 0x42, 0x16, 0x9d, 0x75, 0xb9, 0xa0, 0x6e, 0x32, 0x6f, 0x1b, 0xe3, 0x58, 0x2e, 0x06, 0xcf,
+  0xa5, 0x6a, 0x65, 0x78, 0x6a, 0xb5, 0x6b, 0xc9, 0x93, 0x43, 0xcd, 0xaf, 0x94, 0x49, 0x47, 0x06,
+  0xee, 0x92, 0x26, 0xf0, 0xe9, 0x03, 0x33, 0x69, 0xc7, 0x6d, 0x0f, 0x65, 0xc9, 0x3a, 0xe5, 0x45,
+  0xca, 0x58, 0x00, 0x27, 0x80, 0xa4, 0xad, 0xe4, 0x1c, 0x04, 0xc9, 0x69, 0xbe, 0x2a, 0xd4, 0xed,
+  0xeb, 0x23, 0x64, 0xf1, 0x83, 0x05, 0x5d, 0x3a, 0x52, 0x27, 0x59, 0xa9, 0x2f, 0x64, 0x53, 0x8d,
+  0x85, 0x55, 0x2e, 0xff, 0xb6, 0x83, 0xa2, 0x34, 0x49, 0x49, 0x9c, 0x8b, 0x9f, 0x73, 0x06, 0x16,
+  0xb5, 0xb0, 0x7c, 0x5a, 0x39, 0xe3, 0x3a, 0x29, 0xc0, 0x4c, 0x94, 0xa3, 0x0e, 0xe9, 0x6b, 0x63,
+  0x58, 0x9b, 0xc6, 0x8c, 0x4b, 0x3e, 0x15, 0xa5, 0xce, 0x28, 0xbd, 0x63, 0x10, 0x4b, 0x5a, 0x37,
+  0x38, 0xa5, 0x68, 0x21, 0x21, 0x55, 0xd6, 0x16, 0x65, 0xea, 0xdc, 0xb1, 0x3b, 0xf5, 0xa5, 0xdd,
+  0x5f, 0xda, 0x82, 0xe8, 0x8d, 0x1f, 0x31, 0x8a, 0xce, 0x24, 0x2e, 0xc4, 0x32, 0xd7, 0x18, 0xae,
+  0x52, 0xf0, 0xa2, 0xa6, 0xa5, 0x30, 0xc1, 0x9a, 0x6a, 0x55, 0x64, 0x60, 0xca, 0xe5, 0x3b, 0x37,
+  0x19, 0xf2, 0xc2, 0x0f, 0x66, 0x13, 0xef, 0x73, 0x4d, 0x31, 0x28, 0xb1, 0xe3, 0x4b, 0x95, 0x60,
+  0x83, 0x41, 0x5f, 0xde, 0x36, 0x7a, 0x4a, 0xb6, 0xed, 0x20, 0x5d, 0x86, 0x58, 0xec, 0x70, 0x50,
+  0xfb, 0xbb, 0xaa, 0x02, 0x39, 0xbc, 0xd5, 0xca, 0xae, 0x28, 0x28, 0xa0, 0xbc, 0xb8, 0x34, 0xd5,
+  0xf8, 0x05, 0xd5, 0x9d, 0xfe, 0xd7, 0x5a, 0x4b, 0xf1, 0x2b, 0x6d, 0x59, 0x42, 0x00, 0x0e, 0x86,
+  0x94, 0x8d, 0x51, 0x5c, 0x37, 0x43, 0x48, 0xab, 0xeb, 0x23, 0xc1, 0x46, 0x52, 0x95, 0xa9, 0xfb,
+  0xfa, 0x53, 0xa3, 0xa7, 0x62, 0x56, 0xc4, 0x4c, 0xf2, 0x0f, 0xfe, 0x1b, 0x54, 0x18, 0x52, 0xa0,
+  0x35, 0x2b, 0x73, 0x1e, 0xb0, 0x26, 0x68, 0x03, 0xd8, 0x32, 0x4d, 0xde, 0x32, 0xba, 0xea, 0x54,
+  0xf2, 0xe4, 0x39, 0xb7, 0x26, 0x01, 0x4b, 0xe9, 0x40, 0x28, 0x3b, 0x9b, 0xab, 0xab, 0x80, 0x16,
+  0x89, 0x3d, 0x9b, 0x51, 0x9f, 0x2b, 0x6d, 0x16, 0x55, 0x68, 0x64, 0xaf, 0x00, 0x9e, 0x81, 0x25,
+  0xc0, 0xa4, 0xae, 0xff, 0xf4, 0xc3, 0xf7, 0xcc, 0x7f, 0xf2, 0xee, 0xef, 0x7d, 0x50, 0xbf, 0x3d,
+  0xf0, 0xee, 0x63, 0x6d, 0xf8, 0x03, 0x46, 0xe6, 0x59, 0xae, 0x5c, 0xfd, 0x10, 0x5a, 0x98, 0x6e,
+  0xc9, 0x18, 0xb8, 0x1e, 0x88, 0xef, 0x36, 0x68, 0x02, 0x0e, 0xc9, 0x1b, 0xfc, 0x8d, 0x12, 0x48,
+  0x93, 0x12, 0xba, 0xb6, 0xde, 0xbf, 0xe1, 0x3c, 0xea, 0x9e, 0x2d, 0x2b, 0x47, 0x2c, 0xc3, 0x0a,
+  0x6b, 0x63, 0x4f, 0xa6, 0x8d, 0x35, 0xf9, 0xd8, 0xa2, 0x36, 0x7b, 0xa4, 0xd4, 0xd5, 0x6c, 0xe8,
+  0x4a, 0x89, 0xa5, 0x94, 0xbd, 0x14, 0x6a, 0x8f, 0x5c, 0xe9, 0x28, 0xf0, 0x22, 0xa7, 0x14, 0xa6,
+  0x5c, 0x84, 0xce, 0xfb, 0x21, 0x67, 0x41, 0x2e, 0x54, 0xa9, 0xff, 0x0d, 0x83, 0xcc, 0x15, 0x18,
+  0xec, 0x36, 0x08, 0x33, 0xbe, 0x21, 0x29, 0xc3, 0xbf, 0x46, 0x8f, 0x5e, 0xce, 0x1d, 0x7d, 0x53,
+  0x37, 0xf6, 0xc8, 0x33, 0x76, 0x59, 0x5b, 0x20, 0x13, 0x3f, 0xaf, 0xa2, 0x62, 0x6d, 0xb9, 0x5d,
+  0xfd, 0x38, 0xd8, 0x7d, 0x6a, 0xc7, 0xb4, 0xa6, 0xfc, 0xf8, 0x54, 0xca, 0x0e, 0x63, 0x08, 0xf8,
+  0x87, 0x67, 0xc0, 0xd7, 0x43, 0x35, 0x06, 0x30, 0x03, 0xe3, 0x49, 0x2f, 0x3f, 0xd2, 0xdc, 0x70,
+  0xee, 0xc0, 0x4b, 0xe6, 0x92, 0x47, 0x19, 0xbb, 0xc4, 0x33, 0x99, 0x09, 0x48, 0x13, 0x21, 0x60,
+  0xf8, 0x50, 0x1d, 0xea, 0x55, 0x8e, 0xa6, 0x0f, 0xd8, 0x20, 0x72, 0x3a, 0xf7, 0x83, 0x00, 0xaf,
+  0x6f, 0x80, 0x07, 0x6e, 0xd0, 0x24, 0x5a, 0xe3, 0x39, 0x4b, 0x13, 0xca, 0x2e, 0x87, 0xe6, 0x73,
+  0x93, 0x08, 0x24, 0x1e, 0x2b, 0x07, 0x1b, 0xec, 0x24, 0xe6, 0x2a, 0xa8, 0x89, 0x56, 0x1c, 0xa9,
+  0x62, 0x4f, 0x06, 0xfe, 0x95, 0xb8, 0x74, 0xdb, 0x7c, 0xde, 0xba, 0xbc, 0xfb, 0xbf, 0xff, 0xfe,
+  0x2f, 0x66, 0x2b, 0xb2, 0x3a, 0xc7, 0x35, 0xef, 0xa5, 0x1f, 0x52, 0x17, 0x71, 0x48, 0x8f, 0x7c,
+  0x2a, 0x59, 0x7e, 0xd9, 0xd2, 0x89, 0xd6, 0xc6, 0x75, 0x8a, 0x89, 0x8f, 0x12, 0xcb, 0x4c, 0xc2,
+  0x9d, 0x35, 0x78, 0x6d, 0xe8, 0x25, 0x64, 0xd9, 0x94, 0xb0, 0x2e, 0x23, 0x61, 0xf6, 0xc8, 0xe9,
+  0xa6, 0x0f, 0x66, 0x89, 0xe3, 0x24, 0x07, 0x8b, 0xc1, 0x8a, 0x78, 0x9d, 0xc4, 0xe2, 0x37, 0xcd,
+  0x67, 0x2d, 0xeb, 0xda, 0xc1, 0x65, 0x38, 0x74, 0xc2, 0xdc, 0x08, 0xde, 0x83, 0xac, 0xf0, 0x3b,
+  0xc3, 0xef, 0xe9, 0x5e, 0xd9, 0x49, 0xcc, 0xac, 0xf3, 0x9f, 0xcb, 0x44, 0x09, 0x92, 0x1b, 0xdd,
+  0x62, 0x52, 0x1a, 0x48, 0x4d, 0x74, 0x8b, 0x95, 0x7b, 0x94, 0x88, 0x17, 0xb6, 0xb7, 0xef, 0xb6,
+  0x79, 0x24, 0x52, 0x7d, 0xcd, 0x94, 0xee, 0xab, 0x7e, 0x27, 0x25, 0xec, 0x09, 0x02, 0x37, 0xfd,
+  0xe1, 0x8d, 0xc7, 0x94, 0xa3, 0x2a, 0x8a, 0x9f, 0x5a, 0x4f, 0xea, 0x3d, 0x36, 0x37, 0x07, 0x71,
+  0xae, 0x19, 0x0a, 0x5c, 0x67, 0x12, 0x15, 0xb9, 0x00, 0x1d, 0xc0, 0x51, 0x7f, 0x22, 0xd1, 0xd2,
+  0x41, 0x21, 0x1d, 0x01, 0xb6, 0x81, 0xe1, 0xc8, 0x7f, 0x53, 0x8e, 0x9c, 0x15, 0x74, 0xe1, 0x42,
+  0x41, 0x29, 0x7d, 0xaa, 0xba, 0x44, 0x9a, 0x26, 0x78, 0x83, 0xe8, 0xe2, 0x7f, 0xeb, 0x09, 0xb4,
+  0xa8, 0x74, 0x46, 0xd1, 0xb2, 0xea, 0xe7, 0x37, 0x45, 0x44, 0xa0, 0x8b, 0x22, 0x51, 0xcb, 0x5f,
+  0x97, 0x29, 0x52, 0x0f, 0x59, 0xdd, 0x38, 0xac, 0xab, 0xd3, 0x6d, 0x5a, 0x7e, 0xd3, 0x24, 0xdd,
+  0x40, 0x10, 0x4f, 0x84, 0xf7, 0xea, 0x43, 0xd9, 0xaf, 0x9f, 0x30, 0x8c, 0x22, 0x34, 0x8b, 0x5a,
+  0x98, 0x7a, 0xf2, 0x27, 0x36, 0x50, 0x37, 0x37, 0x75, 0x5e, 0xe0, 0xbd, 0xf9, 0x1b, 0x1c, 0x55,
+  0x30, 0xb9, 0x68, 0xb2, 0x92, 0x88, 0x2e, 0x63, 0xd4, 0xb5, 0xfc, 0x5d, 0xb1, 0x2d, 0xe2, 0xaa,
+  0xb1, 0xbc, 0x95, 0x7f, 0xe1, 0x10, 0xda, 0x9a, 0x76, 0x7d, 0x23, 0x7f, 0x57, 0xb0, 0x47, 0x30,
+  0xce, 0xfc, 0xdb, 0x6f, 0xfe, 0x7e, 0xf5, 0xcd, 0xd0, 0x6d, 0x61, 0xd0, 0x0f, 0xae, 0xef, 0x4c,
+  0x82, 0x36, 0x08, 0x3d, 0x82, 0xd0, 0xb5, 0x0f, 0x83, 0x1e, 0x91, 0xe6, 0xb4, 0x31, 0x68, 0x32,
+  0x5a, 0x21, 0x1c, 0x6e, 0xe0, 0xe9, 0x4e, 0xc4, 0xa7, 0x30, 0xe8, 0x85, 0xeb, 0x33, 0x3d, 0x56,
+  0x1b, 0x85, 0x76, 0xbd, 0xa9, 0x1f, 0xb8, 0xe3, 0xf1, 0x62, 0xfa, 0xe0, 0x4e, 0x3b, 0xa0, 0x68,
+  0xb7, 0x0b, 0x8b, 0xd6, 0x0b, 0xee, 0x88, 0x96, 0x9d, 0x3b, 0xd8, 0xe4, 0xe0, 0x71, 0x3c, 0xf3,
+  0x7d, 0x7b, 0x38, 0x9d, 0xa0, 0x38, 0x8b, 0xfb, 0x07, 0xe7, 0xce, 0xfd, 0x6a, 0x44, 0xda, 0xfb,
+  0xdc, 0x09, 0x49, 0x63, 0x26, 0x31, 0x75, 0xe7, 0x0b, 0x4a, 0x27, 0x7a, 0x40, 0x69, 0xc5, 0xb7,
+  0x1e, 0x50, 0xba, 0x1b, 0x93, 0x1e, 0x01, 0x2f, 0x0c, 0xa3, 0x98, 0xb3, 0xf0, 0x1f, 0xdc, 0x67,
+  0xe7, 0x71, 0x1c, 0xf4, 0xe3, 0xd2, 0xcf, 0x7c, 0x17, 0x81, 0x3f, 0xf6, 0x25, 0x24, 0x65, 0xe0,
+  0xd8, 0xb5, 0x48, 0xd8, 0x2b, 0xd8, 0xa7, 0x08, 0x32, 0xa4, 0xac, 0x1b, 0x99, 0x86, 0x40, 0x27,
+  0x04, 0x72, 0x30, 0xcb, 0xc5, 0x66, 0xcb, 0x97, 0x22, 0xee, 0x01, 0xa8, 0x47, 0x18, 0x56, 0xea,
+  0xe1, 0x79, 0xb1, 0x61, 0xdf, 0x5d, 0x31, 0xc8, 0x2d, 0xbd, 0x1d, 0x68, 0x33, 0xd8, 0xc4, 0xbc,
+  0x7c, 0x9e, 0xbd, 0x17, 0xaa, 0x21, 0x8a, 0x68, 0xac, 0x0e, 0xd0, 0x7a, 0xe1, 0xb2, 0x8a, 0xf5,
+  0x6d, 0xe0, 0x5a, 0xf7, 0xb1, 0x3b, 0xc8, 0x1c, 0xee, 0x5c, 0x2f, 0x20, 0xc9, 0x9d, 0x42, 0xb0,
+  0x45, 0x74, 0x1a, 0xc1, 0xbe, 0x83, 0x26, 0x58, 0xa7, 0x5c, 0x16, 0xf1, 0xf6, 0x8a, 0x0d, 0x0d,
+  0x84, 0x0d, 0x69, 0xb9, 0x7c, 0x37, 0xba, 0xda, 0x02, 0xb1, 0xf5, 0x76, 0x7e, 0x21, 0x8e, 0x2d,
+  0xdf, 0xfb, 0x80, 0x6c, 0x17, 0x0e, 0x68, 0x2c, 0x52, 0x58, 0x42, 0x1b, 0xca, 0x9e, 0x4a, 0xb1,
+  0x86, 0xa4, 0xa0, 0x1b, 0xce, 0x46, 0x43, 0x10, 0x75, 0xc1, 0xd9, 0x20, 0xba, 0x16, 0x9c, 0x3d,
+  0x42, 0x51, 0xb6, 0xf1, 0xec, 0x80, 0x6f, 0x41, 0x7c, 0xbb, 0x1e, 0x44, 0x3b, 0x0d, 0x73, 0xbe,
+  0xed, 0x44, 0xb4, 0x13, 0x3c, 0xcc, 0x79, 0xfd, 0xd1, 0x1a, 0xac, 0xcd, 0x1b, 0x9d, 0x06, 0xd8,
+  0x06, 0x03, 0x2f, 0xd8, 0x25, 0x4c, 0x2b, 0x6e, 0xd4, 0x20, 0x37, 0x44, 0x2c, 0xfa, 0x81, 0xed,
+  0xba, 0x59, 0xe8, 0x84, 0xb6, 0xcd, 0x61, 0xa8, 0x29, 0xc6, 0x39, 0x80, 0x3b, 0xcc, 0xbf, 0x1e,
+  0xdf, 0x0e, 0xf3, 0xa5, 0xa5, 0x2a, 0x27, 0xf0, 0x6d, 0x2d, 0x30, 0x61, 0x40, 0x69, 0x9e, 0x9f,
+  0x42, 0xb9, 0x41, 0x82, 0xe0, 0x0f, 0x7a, 0x88, 0xeb, 0x40, 0x77, 0xb2, 0xab, 0x93, 0xd5, 0x90,
+  0x6e, 0xe7, 0xee, 0x6e, 0xee, 0x0e, 0x1e, 0x69, 0xdb, 0x35, 0xb0, 0xdb, 0x9d, 0x93, 0xd1, 0x2c,
+  0x3b, 0x0c, 0xde, 0xfd, 0xe4, 0x7a, 0x40, 0x3e, 0x9f, 0x36, 0x41, 0x6f, 0xb0, 0x98, 0x0b, 0x67,
+  0xec, 0xf9, 0x9e, 0x3b, 0x2f, 0x9f, 0x29, 0xfd, 0x3f, 0x18, 0x4b, 0x7b, 0x0e, 0x0d, 0x7e, 0xa3,
+  0x15, 0xf5, 0x5c, 0x6d, 0x46, 0x7b, 0x10, 0x70, 0xe7, 0xee, 0xd1, 0x99, 0x3e, 0x78, 0x0f, 0x60,
+  0xb9, 0x82, 0x6e, 0x0c, 0xdc, 0x9e, 0xb0, 0x01, 0x84, 0xdb, 0x5d, 0x1a, 0x0d, 0xff, 0xe4, 0xce,
+  0xef, 0xbc, 0xe9, 0x10, 0x0c, 0x2b, 0x43, 0x60, 0xdc, 0x6d, 0xe3, 0xe1, 0x63, 0x97, 0x2a, 0x81,
+  0x6a, 0x70, 0x78, 0xd3, 0x50, 0xad, 0x25, 0x02, 0xe3, 0xfe, 0x6a, 0xc7, 0xa3, 0x7c, 0x03, 0x32,
+  0xdf, 0x61, 0x90, 0x06, 0xbe, 0x15, 0x1c, 0xfa, 0x6a, 0x67, 0xc3, 0xc3, 0x7a, 0xcc, 0x3b, 0x77,
+  0xea, 0x0c, 0x1e, 0xe7, 0xc0, 0xb9, 0xc0, 0x7b, 0x30, 0x7e, 0xa8, 0x0e, 0x8e, 0x3f, 0xba, 0x8b,
+  0xc0, 0xed, 0x02, 0xc7, 0x27, 0xb3, 0xb9, 0x4d, 0xaf, 0x1d, 0xf1, 0x10, 0x18, 0xe7, 0xb2, 0xe7,
+  0x19, 0xb0, 0xb5, 0x03, 0x1c, 0x5f, 0xdc, 0xb9, 0xf3, 0x7b, 0x70, 0x6d, 0xde, 0x43, 0x07, 0x3e,
+  0xfe, 0x2c, 0xd3, 0x35, 0xdb, 0x8a, 0x08, 0xfc, 0x45, 0xdc, 0x0d, 0x92, 0x1b, 0xb3, 0xcd, 0x20,
+  0xff, 0x02, 0xa2, 0x3a, 0x71, 0x13, 0x2e, 0xd7, 0x5a, 0xde, 0x05, 0x97, 0x1b, 0x0f, 0xde, 0x84,
+  0xcb, 0x2b, 0x3b, 0x58, 0x47, 0xcc, 0x2d, 0x77, 0xd1, 0x02, 0xcd, 0x9b, 0x5e, 0xfc, 0x57, 0x20,
+  0xe7, 0x95, 0xec, 0xff, 0x01, 0xe4, 0xdc, 0x7f, 0x9a, 0x3b, 0x8a, 0xe9, 0x6d, 0xe0, 0xfc, 0xd1,
+  0xa5, 0xc2, 0xb6, 0x36, 0x6e, 0xbe, 0x98, 0x8e, 0xdc, 0xf1, 0x29, 0xe4, 0xfc, 0x3a, 0x00, 0xd3,
+  0x33, 0xfe, 0x27, 0x22, 0xe7, 0x23, 0x85, 0x9c, 0x7b, 0x2e, 0x82, 0x86, 0xd3, 0xd3, 0xc8, 0xf9,
+  0xc8, 0x3c, 0x7e, 0x02, 0x3a, 0x5f, 0x4c, 0x20, 0x95, 0xfd, 0xac, 0x0e, 0x61, 0x17, 0x76, 0xbe,
+  0x98, 0x74, 0x81, 0xe7, 0xfa, 0x81, 0x7e, 0xf0, 0x1c, 0x0c, 0xf4, 0xb3, 0x8a, 0x8c, 0x7a, 0xd1,
+  0xf3, 0x6b, 0x9b, 0xc0, 0x46, 0xcf, 0xaf, 0x27, 0xb3, 0xe1, 0xc2, 0x67, 0x4d, 0xc5, 0xe8, 0xc3,
+  0xd0, 0x3f, 0x89, 0x14, 0x2c, 0xf0, 0x9a, 0xb4, 0xeb, 0x24, 0x86, 0x0e, 0xce, 0x07, 0x22, 0x9c,
+  0xd3, 0xd4, 0x16, 0x8a, 0x4e, 0xe4, 0xa1, 0x6e, 0x92, 0x10, 0xa3, 0x77, 0x23, 0xe9, 0xb0, 0x89,
+  0x0a, 0x49, 0x7f, 0x87, 0x83, 0x15, 0xc6, 0xa7, 0x91, 0x74, 0x7c, 0x40, 0x23, 0xe9, 0x41, 0x1f,
+  0x92, 0xae, 0x41, 0x74, 0xc4, 0xa9, 0xde, 0x05, 0xf8, 0x8e, 0xf8, 0x0c, 0x9a, 0x8e, 0x56, 0x98,
+  0x79, 0x4f, 0xd7, 0x0e, 0xe1, 0xe9, 0xee, 0x09, 0x40, 0x1d, 0x2f, 0x5e, 0x60, 0x70, 0x38, 0xfc,
+  0x9b, 0xa2, 0x09, 0xa8, 0x83, 0x3b, 0xfb, 0x95, 0x90, 0xfa, 0xe7, 0x62, 0x9b, 0xca, 0xcd, 0x86,
+  0x15, 0x4b, 0x54, 0xbc, 0xd3, 0xa0, 0xfa, 0x49, 0xda, 0x7f, 0x05, 0xac, 0x7e, 0x3d, 0x49, 0xd6,
+  0x45, 0xd6, 0x8f, 0xab, 0x8f, 0x28, 0x02, 0x36, 0x1c, 0x17, 0x29, 0xa4, 0xd2, 0x70, 0x7e, 0x30,
+  0x56, 0xf9, 0xc8, 0x66, 0x9b, 0x8d, 0x88, 0x45, 0xc6, 0x8c, 0x6c, 0x89, 0x6b, 0x40, 0xbf, 0x21,
+  0xdf, 0xe0, 0x62, 0xec, 0x2a, 0xe3, 0x14, 0x55, 0x05, 0x83, 0x80, 0x5e, 0x90, 0x1d, 0x9d, 0x28,
+  0x3a, 0xdd, 0x39, 0xab, 0x6c, 0x95, 0x7f, 0x1a, 0x66, 0x2f, 0xb2, 0x3e, 0x9c, 0xbd, 0x54, 0x78,
+  0xb6, 0x97, 0x79, 0x1f, 0xd0, 0x7e, 0xed, 0xd0, 0x67, 0x71, 0x16, 0x68, 0x47, 0xf8, 0x3b, 0x14,
+  0xbf, 0x00, 0x65, 0x07, 0xfd, 0xfd, 0x07, 0x50, 0x76, 0xd0, 0xd4, 0x29, 0x70, 0xa2, 0x1f, 0x66,
+  0xaf, 0x67, 0x26, 0x82, 0x95, 0x46, 0xac, 0x96, 0x9c, 0xb4, 0xa1, 0x76, 0xd7, 0xe4, 0x11, 0xad,
+  0xa4, 0x06, 0xb8, 0xa4, 0xf0, 0x66, 0x2b, 0x6c, 0xbc, 0xe8, 0x44, 0xdb, 0x5b, 0xe1, 0x00, 0xcf,
+  0xcc, 0x28, 0x94, 0xc1, 0xe0, 0x65, 0x61, 0x91, 0xbd, 0x17, 0x6f, 0xb4, 0xc6, 0x4e, 0xf8, 0xfd,
+  0xbe, 0xd8, 0xea, 0x01, 0x4a, 0x67, 0x8b, 0xf3, 0xaf, 0xc5, 0x9e, 0x2e, 0xbe, 0xd5, 0x65, 0x79,
+  0x2d, 0xa8, 0x60, 0x70, 0x2e, 0xde, 0x8b, 0xf3, 0x48, 0xfc, 0x28, 0x00, 0xdd, 0x79, 0x76, 0xc6,
+  0xc1, 0xa2, 0xc2, 0xa2, 0x5a, 0x40, 0xbc, 0xd9, 0x73, 0x99, 0x55, 0x9d, 0xc1, 0xe2, 0x41, 0xc8,
+  0x6f, 0x14, 0x96, 0xd1, 0x92, 0x5b, 0x5c, 0xd2, 0x0b, 0xad, 0x71, 0xbd, 0x81, 0xc4, 0x9b, 0x19,
+  0x97, 0x90, 0xe7, 0x2f, 0x05, 0x24, 0x58, 0xf1, 0x69, 0x3c, 0x9e, 0xf6, 0x1c, 0x12, 0xaa, 0x8a,
+  0x2c, 0x36, 0x8f, 0x83, 0x42, 0xb3, 0x8b, 0x2a, 0x58, 0xbf, 0x60, 0x75, 0x1e, 0x37, 0x60, 0x79,
+  0xf3, 0x54, 0x98, 0x1c, 0xc0, 0x32, 0x77, 0xed, 0xd2, 0x86, 0xe6, 0xad, 0x29, 0xff, 0xc8, 0x2e,
+  0x46, 0xb3, 0x27, 0x8a, 0x1f, 0x2f, 0x20, 0xfb, 0xdc, 0xb3, 0x21, 0xe2, 0xf3, 0xef, 0x34, 0x48,
+  0x3f, 0x32, 0x6f, 0xa6, 0x53, 0x2d, 0xdd, 0x33, 0x36, 0xd1, 0xf9, 0xfa, 0xa4, 0x2a, 0x79, 0xb7,
+  0xe6, 0xc5, 0xd3, 0x05, 0x0f, 0x88, 0x65, 0x7b, 0xde, 0x32, 0xba, 0x36, 0xd3, 0x42, 0x58, 0x8d,
+  0x69, 0xd1, 0x39, 0x7c, 0xbe, 0x3e, 0xa3, 0x0e, 0xcd, 0xd5, 0x6c, 0x6b, 0x5e, 0x88, 0x74, 0x87,
+  0xb7, 0xef, 0x31, 0x73, 0xe3, 0x7c, 0x23, 0xd2, 0xb8, 0x9a, 0xb7, 0x0d, 0xd2, 0xeb, 0xac, 0x7a,
+  0xda, 0x56, 0x38, 0x1b, 0xa7, 0xd7, 0x39, 0x3c, 0xa9, 0xef, 0x06, 0xd5, 0xbe, 0x17, 0xb1, 0x6f,
+  0x9d, 0x2b, 0x0a, 0x41, 0x25, 0xb9, 0xa1, 0x9e, 0x53, 0xd1, 0x07, 0xdd, 0x9b, 0x59, 0xf9, 0x12,
+  0x78, 0x12, 0x49, 0x34, 0x71, 0xf1, 0x69, 0x04, 0xbf, 0xeb, 0x50, 0x8f, 0x20, 0x2f, 0x4d, 0x93,
+  0x28, 0x0a, 0x79, 0x96, 0x23, 0x6b, 0x95, 0x86, 0xb3, 0x18, 0xc5, 0xc1, 0x10, 0x77, 0xaf, 0x22,
+  0xd9, 0x36, 0xa6, 0x6f, 0x0e, 0x36, 0x7e, 0x8f, 0x4f, 0xc0, 0xfa, 0x9a, 0xce, 0x42, 0xf6, 0xe5,
+  0xfb, 0x15, 0xab, 0x72, 0x7b, 0x02, 0xf7, 0xb1, 0x36, 0x20, 0xc6, 0xa8, 0x04, 0x38, 0xb8, 0xe4,
+  0xe9, 0x59, 0x70, 0x9f, 0xe7, 0x59, 0x96, 0x17, 0x9b, 0x9a, 0x36, 0x74, 0xa2, 0xfb, 0x3a, 0xed,
+  0x44, 0x84, 0xbf, 0x20, 0x80, 0x9f, 0xee, 0x06, 0xe0, 0xab, 0x88, 0x96, 0x08, 0xef, 0xe3, 0x65,
+  0xce, 0xe5, 0x3c, 0xc9, 0xbb, 0xe0, 0xfd, 0x05, 0x08, 0x22, 0xe5, 0x7a, 0x9b, 0xbd, 0x18, 0xff,
+  0xc0, 0xe0, 0xfb, 0xb0, 0x01, 0x30, 0xb7, 0x7f, 0x11, 0x16, 0xe3, 0x2c, 0xad, 0xe8, 0xc0, 0xfa,
+  0xed, 0xf1, 0x2d, 0xca, 0x4e, 0xdc, 0x9f, 0xae, 0xb6, 0x4c, 0x20, 0xda, 0x05, 0xfd, 0x3b, 0x4b,
+  0x04, 0xf6, 0xe4, 0x36, 0xac, 0x1b, 0x9f, 0x2e, 0xf0, 0xbf, 0x34, 0xc9, 0xaf, 0x18, 0xa6, 0x15,
+  0x07, 0x60, 0x23, 0xd9, 0x75, 0xd4, 0xc7, 0x67, 0x5d, 0x03, 0x80, 0x77, 0x52, 0x78, 0xa9, 0x0a,
+  0x19, 0x60, 0x75, 0x44, 0xda, 0x05, 0x01, 0x8b, 0xfe, 0x82, 0x00, 0xf7, 0x44, 0x45, 0x00, 0xdd,
+  0x75, 0x94, 0xcb, 0xb0, 0xa2, 0xbb, 0xee, 0xca, 0x00, 0xbc, 0xad, 0x3c, 0x5d, 0x18, 0x30, 0x85,
+  0x78, 0xa4, 0x88, 0x5f, 0x41, 0x97, 0xc1, 0xc3, 0xc6, 0x6b, 0xbc, 0x67, 0x38, 0x37, 0x7c, 0xef,
+  0xa5, 0xe7, 0xd9, 0x32, 0x01, 0x9c, 0x8c, 0x2f, 0xb7, 0x78, 0xef, 0x81, 0xe8, 0x9d, 0x88, 0xcf,
+  0x4f, 0x56, 0x1e, 0x1a, 0x65, 0x52, 0xca, 0xa2, 0x01, 0xef, 0xf3, 0x4d, 0x75, 0x17, 0x7a, 0xb2,
+  0x6e, 0x60, 0x8a, 0x45, 0x23, 0x70, 0x4c, 0x98, 0xea, 0x8c, 0xbb, 0x2b, 0x07, 0x16, 0x18, 0x01,
+  0x9f, 0x2f, 0x1c, 0x08, 0x73, 0xba, 0x74, 0xee, 0x29, 0x1b, 0xa8, 0x7b, 0x43, 0x34, 0x14, 0x3e,
+  0x50, 0x6f, 0x44, 0xb4, 0x66, 0xc9, 0xb2, 0xe9, 0x07, 0xdb, 0x95, 0x03, 0x55, 0xa8, 0xf2, 0x06,
+  0x36, 0x2c, 0x13, 0x51, 0x7c, 0xae, 0x78, 0xc0, 0x29, 0x32, 0x52, 0x3e, 0x18, 0x1d, 0x7c, 0x0a,
+  0xa2, 0xd7, 0x14, 0x61, 0xd4, 0x7d, 0x9f, 0x5d, 0x41, 0x10, 0x38, 0x78, 0xb7, 0x31, 0x5a, 0xcc,
+  0x3f, 0x53, 0x56, 0xd9, 0x55, 0x44, 0x50, 0xb9, 0x81, 0x53, 0x45, 0x04, 0x23, 0x55, 0x44, 0x40,
+  0x35, 0x04, 0xe0, 0xb6, 0x8d, 0x1f, 0xae, 0x66, 0x6d, 0x55, 0x11, 0x1c, 0x0e, 0x22, 0x0a, 0xcf,
+  0x16, 0x11, 0x94, 0xc6, 0x11, 0xaf, 0x5a, 0x59, 0x82, 0x26, 0xc1, 0xbe, 0x52, 0xb5, 0xc2, 0x84,
+  0x5f, 0x5f, 0x50, 0xe0, 0xed, 0xf7, 0x30, 0x6c, 0x86, 0x51, 0x37, 0x98, 0x4c, 0xf8, 0x68, 0xf9,
+  0x10, 0x8c, 0xcf, 0x61, 0xba, 0x58, 0xd8, 0x07, 0x4d, 0x47, 0x43, 0xea, 0x3e, 0xb5, 0xb3, 0xb4,
+  0xc0, 0x99, 0x62, 0x4a, 0x66, 0x1d, 0xea, 0xaf, 0x2e, 0x2b, 0x70, 0x0e, 0x87, 0x6b, 0xba, 0x57,
+  0xbe, 0xaa, 0x42, 0x55, 0xcc, 0x00, 0x63, 0x0a, 0x69, 0xa8, 0x72, 0x00, 0x01, 0x49, 0x4b, 0x71,
+  0xbf, 0xa2, 0xaa, 0xe0, 0xf3, 0x9b, 0x24, 0x97, 0xcf, 0x1e, 0x61, 0xd9, 0x37, 0xc3, 0x22, 0x0e,
+  0x81, 0x99, 0x6a, 0x2c, 0xa3, 0x5a, 0x1d, 0x95, 0x05, 0x07, 0x01, 0x2c, 0x21, 0xd7, 0x72, 0xa2,
+  0xba, 0x00, 0xb2, 0x16, 0x19, 0x1b, 0x76, 0x54, 0x57, 0x41, 0x56, 0x0e, 0xc8, 0xe4, 0x9e, 0xdd,
+  0xa9, 0xf2, 0x02, 0x06, 0x67, 0x5d, 0x8f, 0x9a, 0xf7, 0x97, 0x1a, 0xb8, 0x53, 0x73, 0x7b, 0x68,
+  0x31, 0xb0, 0xa7, 0xdc, 0x40, 0x94, 0x9a, 0x76, 0x55, 0xd9, 0x0e, 0xe4, 0x54, 0xe7, 0xaa, 0x60,
+  0x25, 0x76, 0xcd, 0xc1, 0xb5, 0xd9, 0xa2, 0xbd, 0xae, 0xd3, 0x15, 0x08, 0x30, 0x08, 0xe8, 0xa8,
+  0x24, 0x0b, 0x05, 0x67, 0x99, 0xc5, 0x68, 0x4d, 0x7c, 0x70, 0xfe, 0x7b, 0x38, 0x67, 0x1b, 0xac,
+  0xcd, 0x22, 0x1d, 0xbd, 0xd7, 0x45, 0x08, 0xd7, 0x0b, 0x55, 0x84, 0xc0, 0x30, 0x5c, 0x8a, 0x34,
+  0xaa, 0x76, 0xbe, 0x1a, 0x41, 0xb0, 0x2e, 0xe6, 0xf7, 0x97, 0x24, 0x80, 0x11, 0xbc, 0xae, 0x6d,
+  0xf8, 0x4a, 0x49, 0xd7, 0xd6, 0x21, 0x50, 0x70, 0x60, 0x8b, 0x24, 0x5d, 0x27, 0x93, 0x5b, 0xe4,
+  0xef, 0xf9, 0x57, 0xd4, 0x25, 0x3c, 0x7b, 0xee, 0xd0, 0x9d, 0x3f, 0xea, 0x7b, 0x5e, 0x4b, 0x22,
+  0x8d, 0x0a, 0x05, 0x5a, 0x6e, 0x77, 0x8d, 0x82, 0xea, 0x53, 0x56, 0x90, 0x50, 0x1b, 0xc5, 0xc8,
+  0xcb, 0xf6, 0xba, 0xd1, 0x5a, 0x59, 0xfe, 0xe0, 0x44, 0xd1, 0x02, 0x84, 0x9d, 0x8a, 0xa3, 0xb7,
+  0x1d, 0x1a, 0x40, 0x85, 0x0b, 0xf5, 0x91, 0xfb, 0xab, 0x17, 0x9c, 0xda, 0x94, 0xb7, 0x74, 0xd1,
+  0x74, 0xfd, 0xb9, 0xd8, 0x42, 0x14, 0x90, 0xad, 0xd5, 0x42, 0x61, 0x55, 0x4c, 0x6d, 0x62, 0x07,
+  0xb6, 0x26, 0xdb, 0xa6, 0x94, 0x2f, 0xf7, 0x96, 0x33, 0x3c, 0xbb, 0xf3, 0x91, 0xdf, 0xbc, 0x6f,
+  0xea, 0xad, 0x69, 0x78, 0x10, 0x1b, 0xbe, 0x4b, 0x35, 0x96, 0xd1, 0x53, 0xd4, 0x30, 0xc4, 0xc2,
+  0x92, 0x37, 0xbc, 0x90, 0xc5, 0x80, 0x40, 0xf3, 0xaf, 0x8c, 0xc2, 0x5b, 0x11, 0x7d, 0x7f, 0x55,
+  0x43, 0x75, 0x5e, 0xe8, 0x94, 0x58, 0x37, 0xa9, 0xfd, 0x95, 0x0d, 0x0d, 0x11, 0x5d, 0xb6, 0x54,
+  0xeb, 0x64, 0x79, 0x03, 0x72, 0xd3, 0x5c, 0x77, 0x88, 0x2e, 0x89, 0xf4, 0xd4, 0x38, 0xe0, 0x96,
+  0xc1, 0xe4, 0x86, 0x54, 0xe4, 0x10, 0xf2, 0x38, 0x66, 0x31, 0x5d, 0xa1, 0xa5, 0xc5, 0x2a, 0xdc,
+  0x52, 0x84, 0x06, 0x6a, 0xbc, 0xe7, 0xd8, 0xa4, 0x4e, 0x77, 0x7f, 0xe1, 0x43, 0xbf, 0x3c, 0xec,
+  0xea, 0x87, 0x67, 0x74, 0x23, 0xa0, 0x9c, 0x5e, 0x55, 0xfc, 0x20, 0x9a, 0xe5, 0x0f, 0x35, 0xf8,
+  0xc7, 0x2a, 0x82, 0x30, 0x49, 0x60, 0x4f, 0x21, 0x84, 0xdd, 0xd7, 0x01, 0x76, 0xf4, 0x54, 0x43,
+  0x4c, 0x20, 0xa6, 0xce, 0x75, 0xf0, 0x00, 0xb2, 0x47, 0x67, 0xb9, 0x33, 0xa2, 0x3e, 0x55, 0x0a,
+  0xd1, 0xde, 0x2e, 0x5e, 0x06, 0xe3, 0xe9, 0xa7, 0x9c, 0x45, 0x15, 0x44, 0x90, 0xbf, 0x13, 0xe9,
+  0x4f, 0x4a, 0x29, 0x94, 0x42, 0x6d, 0xc5, 0x4e, 0x05, 0xb3, 0x11, 0xb0, 0x25, 0xee, 0xaa, 0x89,
+  0x70, 0xd3, 0x4d, 0x12, 0x6d, 0xdb, 0x25, 0x11, 0xf7, 0x02, 0x22, 0x8c, 0x8e, 0x9a, 0x08, 0x45,
+  0x9f, 0xa2, 0x2d, 0x6b, 0xd8, 0xfe, 0x66, 0x61, 0x44, 0x9d, 0x92, 0x76, 0x99, 0x9f, 0x2f, 0x8c,
+  0x78, 0x93, 0x98, 0x25, 0xc0, 0x90, 0x30, 0x38, 0x2a, 0x56, 0x7e, 0xa2, 0x42, 0x02, 0x96, 0xa8,
+  0xce, 0x39, 0xd7, 0xb9, 0x65, 0x5f, 0xa5, 0x44, 0x73, 0x6c, 0x7d, 0xf5, 0xf1, 0x13, 0x2a, 0x63,
+  0x21, 0x2a, 0x76, 0x69, 0xa7, 0x82, 0x17, 0x8f, 0x18, 0x91, 0x50, 0xf2, 0xdd, 0xaa, 0x9a, 0x78,
+  0x14, 0x05, 0x01, 0x1b, 0xcd, 0xaa, 0x89, 0x49, 0x92, 0xaa, 0x33, 0x60, 0x97, 0x4d, 0x28, 0x9d,
+  0x27, 0xd4, 0x92, 0x2a, 0x27, 0x82, 0x79, 0xc7, 0xdb, 0xfb, 0x10, 0xf2, 0x4e, 0x3a, 0x2b, 0x27,
+  0xee, 0xfb, 0x2a, 0x27, 0xfa, 0xcb, 0x26, 0x18, 0x4f, 0x79, 0x7f, 0xc1, 0xc4, 0x8b, 0x3b, 0xf5,
+  0x58, 0x35, 0x42, 0xad, 0x5a, 0xc2, 0x79, 0x71, 0xe6, 0x63, 0x67, 0xde, 0xac, 0x93, 0x80, 0xbc,
+  0x6a, 0xd1, 0x53, 0x27, 0x71, 0xdf, 0x5d, 0x27, 0x11, 0x38, 0x13, 0x67, 0x02, 0x46, 0xc2, 0x69,
+  0x17, 0x49, 0x3c, 0xcc, 0xe6, 0xee, 0xa7, 0xaf, 0x2e, 0x91, 0xe8, 0x2c, 0x90, 0x78, 0x84, 0xe0,
+  0x1d, 0xd6, 0x19, 0x4c, 0x9c, 0xfe, 0x02, 0x89, 0x31, 0x01, 0x79, 0x1d, 0x05, 0x12, 0x7e, 0x5f,
+  0x7d, 0x04, 0x3d, 0xc6, 0x7c, 0x77, 0xe0, 0x8d, 0x27, 0xee, 0xd0, 0x3b, 0xf1, 0xbe, 0x7e, 0x82,
+  0xc5, 0xda, 0x08, 0xc1, 0x70, 0x08, 0x1c, 0x64, 0xaa, 0x8a, 0xca, 0xb0, 0x20, 0x4e, 0xc6, 0x5d,
+  0x35, 0x11, 0x8f, 0x10, 0x3f, 0xbf, 0x33, 0xb0, 0xaa, 0xe2, 0x95, 0x1d, 0x93, 0xb0, 0xa7, 0x1e,
+  0xc2, 0x8b, 0x42, 0x45, 0x23, 0x63, 0xf9, 0x2e, 0x19, 0x1c, 0x67, 0xc8, 0xe1, 0xc1, 0x64, 0x85,
+  0x4c, 0xc2, 0xb8, 0xf8, 0x26, 0xbf, 0x0c, 0x23, 0x7e, 0x94, 0x9d, 0x35, 0x10, 0x24, 0x54, 0xc3,
+  0xd9, 0x76, 0x05, 0x04, 0xf5, 0x78, 0x6c, 0xb8, 0xf8, 0xec, 0x4e, 0xa9, 0xe4, 0xa5, 0xb7, 0xfa,
+  0xe1, 0x8e, 0x67, 0x91, 0x0c, 0x4f, 0x97, 0x3f, 0x38, 0x2b, 0x5c, 0xc9, 0x9e, 0xab, 0xb7, 0xf7,
+  0x8f, 0x11, 0x4f, 0xe9, 0xf5, 0x7d, 0xf8, 0xdf, 0x53, 0xfa, 0xf0, 0x80, 0xdb, 0xfa, 0x85, 0x85,
+  0x0f, 0x7d, 0x65, 0x0f, 0x8f, 0x60, 0xc3, 0xd3, 0x88, 0xe7, 0x7b, 0xde, 0x2e, 0x7b, 0x18, 0x16,
+  0x59, 0x11, 0x76, 0x16, 0x3d, 0xcc, 0xd2, 0x9c, 0x77, 0x94, 0x3c, 0xbc, 0x14, 0x61, 0x26, 0xc2,
+  0x56, 0xd1, 0x43, 0x20, 0xc2, 0x94, 0xa7, 0x5a, 0x56, 0x8d, 0xca, 0x87, 0x47, 0x8c, 0xb4, 0xa8,
+  0x64, 0xaa, 0x5d, 0xf9, 0x40, 0xd5, 0x51, 0x28, 0xae, 0x8e, 0xd2, 0x07, 0xea, 0x03, 0xd6, 0x76,
+  0xd5, 0x3d, 0x38, 0xc7, 0x5a, 0x87, 0xa9, 0x79, 0xc0, 0xa9, 0x2e, 0x61, 0xae, 0x1b, 0x0c, 0x07,
+  0xf8, 0x0d, 0x3f, 0xf6, 0x15, 0x3b, 0xd4, 0x8e, 0x74, 0x7f, 0xa5, 0xc3, 0x8b, 0xad, 0x01, 0xe7,
+  0xca, 0x1c, 0x18, 0x5f, 0xcb, 0xaf, 0x2b, 0x72, 0x60, 0x5c, 0xeb, 0x43, 0x26, 0x4f, 0x54, 0x38,
+  0x90, 0x6c, 0xd8, 0x0c, 0x2b, 0x0f, 0x64, 0x78, 0xa2, 0xb8, 0x01, 0x25, 0xd5, 0x45, 0x56, 0x2b,
+  0x6b, 0x50, 0x72, 0xb3, 0xc8, 0x6a, 0x65, 0x0d, 0xde, 0x93, 0xfa, 0x2d, 0x94, 0x5a, 0x49, 0xc3,
+  0x6c, 0xbc, 0xf0, 0x83, 0xc5, 0xbc, 0x5e, 0xd0, 0x30, 0x72, 0x5e, 0x86, 0x6e, 0xd0, 0xac, 0x66,
+  0x78, 0x58, 0xe0, 0x0f, 0x00, 0x8c, 0x5b, 0x2f, 0xf1, 0xfb, 0xde, 0xb8, 0x51, 0xc4, 0x30, 0x72,
+  0x9e, 0x9c, 0xa0, 0xbf, 0x7e, 0xe1, 0xce, 0x79, 0x00, 0xb3, 0x16, 0x78, 0xcd, 0xda, 0x85, 0xa1,
+  0xe7, 0x3b, 0x0c, 0xac, 0xa7, 0x33, 0x6f, 0x95, 0x2e, 0x0c, 0xdc, 0x5a, 0x87, 0x2e, 0x5c, 0x30,
+  0x03, 0x51, 0xd9, 0x42, 0xab, 0x68, 0xe1, 0x6e, 0xe6, 0x37, 0x6b, 0x16, 0x7c, 0xbe, 0x65, 0x10,
+  0x48, 0xe7, 0x3c, 0x94, 0xea, 0x25, 0xfe, 0x24, 0x2e, 0x62, 0x6e, 0x9b, 0x90, 0x46, 0x8d, 0x82,
+  0x37, 0x1e, 0x7a, 0x73, 0x6f, 0xa2, 0xac, 0x66, 0xbd, 0x38, 0xe1, 0x6e, 0x01, 0x0c, 0xe9, 0x2a,
+  0x4e, 0x00, 0x67, 0xe1, 0xb5, 0x6a, 0x13, 0xee, 0x16, 0xec, 0xd1, 0xb9, 0x0f, 0x9c, 0x8e, 0xc2,
+  0x84, 0x07, 0x77, 0x30, 0xf1, 0xfc, 0x8e, 0xa2, 0x04, 0x10, 0x27, 0xb8, 0x62, 0x79, 0x4c, 0xd2,
+  0xee, 0x92, 0x04, 0xb2, 0x1f, 0xe0, 0xd7, 0xd9, 0xb1, 0x41, 0xd8, 0xf9, 0xf6, 0x7e, 0xef, 0xbb,
+  0xfb, 0xcd, 0x4a, 0x84, 0xad, 0x36, 0x4b, 0xf5, 0x3a, 0x04, 0xd3, 0xda, 0x2a, 0x42, 0xa8, 0x9c,
+  0xe3, 0xaf, 0x28, 0x3f, 0xb0, 0x54, 0xe1, 0x17, 0x17, 0x1f, 0xb8, 0x13, 0x87, 0xfd, 0x96, 0x0d,
+  0xbd, 0x71, 0x67, 0xdd, 0x81, 0x33, 0xf0, 0x46, 0x5d, 0x75, 0x07, 0xa3, 0xd9, 0xcb, 0xa2, 0xb7,
+  0xea, 0x60, 0xf1, 0xf2, 0xb0, 0x80, 0x88, 0xc3, 0x01, 0x15, 0xf5, 0xc7, 0xde, 0x83, 0xf7, 0x2f,
+  0x28, 0x3e, 0x60, 0x9e, 0x4f, 0xfa, 0xe4, 0x7d, 0x5d, 0xfd, 0x41, 0x5f, 0xf9, 0x01, 0x9c, 0x05,
+  0xef, 0x11, 0x32, 0x56, 0xdf, 0x71, 0x3a, 0xcb, 0x0f, 0xa8, 0xbf, 0xab, 0xfc, 0x40, 0x3f, 0xf0,
+  0x2f, 0x7b, 0x77, 0x7f, 0xc1, 0xb4, 0x42, 0x78, 0x27, 0xea, 0x0e, 0xee, 0xb0, 0x4e, 0xee, 0x4c,
+  0xcd, 0x01, 0xd1, 0xb0, 0xa1, 0xd8, 0xca, 0xe8, 0x5c, 0xbd, 0xc1, 0x0b, 0x3f, 0xc8, 0x08, 0x6f,
+  0x70, 0x53, 0x19, 0xed, 0xf9, 0x5e, 0x66, 0xe7, 0x5e, 0xdc, 0x77, 0xb6, 0xcc, 0x59, 0xcb, 0x33,
+  0xaf, 0xec, 0xfb, 0xde, 0xfd, 0xdc, 0xf5, 0xbd, 0xde, 0x37, 0xf6, 0xe5, 0x26, 0x15, 0x47, 0xc9,
+  0x1e, 0x12, 0x88, 0x99, 0xd3, 0x33, 0x45, 0x06, 0x23, 0xf5, 0xca, 0x7e, 0x6d, 0xbc, 0x66, 0x81,
+  0x81, 0x2a, 0x28, 0x48, 0xd4, 0x5d, 0x52, 0xf8, 0x41, 0xc5, 0x37, 0xcb, 0x24, 0xc3, 0x58, 0x0a,
+  0x0c, 0x56, 0xfc, 0xeb, 0xca, 0x0b, 0xdc, 0x54, 0x66, 0x72, 0x7f, 0xae, 0xb0, 0xa0, 0x87, 0xea,
+  0xeb, 0x4a, 0x0a, 0x6c, 0x56, 0x7e, 0xd5, 0x8b, 0xfa, 0x45, 0x7f, 0x41, 0x01, 0x71, 0x15, 0x92,
+  0xa2, 0x54, 0x84, 0x7b, 0xf1, 0xfe, 0x91, 0x8d, 0x12, 0xb0, 0xcc, 0x4c, 0x42, 0x10, 0x18, 0x16,
+  0x69, 0x11, 0x15, 0x7b, 0xc5, 0x16, 0xf4, 0xad, 0x8c, 0x9f, 0xa8, 0x1a, 0x50, 0xce, 0xaa, 0x74,
+  0x35, 0xe0, 0xe1, 0xe7, 0x2a, 0x5a, 0xef, 0x2c, 0x18, 0xe8, 0x2b, 0x17, 0x40, 0x1d, 0xe4, 0x71,
+  0x2e, 0x4f, 0xbc, 0x92, 0x0f, 0x9f, 0xe5, 0xc9, 0x42, 0x81, 0xf8, 0xc8, 0x23, 0xf6, 0x50, 0xac,
+  0x8a, 0xbe, 0x3a, 0x81, 0xe3, 0x3f, 0xfd, 0x75, 0xfc, 0x47, 0xef, 0xf3, 0xd8, 0x23, 0x1b, 0x86,
+  0x75, 0x82, 0x83, 0xee, 0x57, 0xf2, 0x9b, 0xd1, 0x7a, 0xa8, 0x2d, 0x4e, 0x19, 0xb0, 0xb7, 0xeb,
+  0x04, 0x2e, 0xec, 0x34, 0xe9, 0x42, 0xfb, 0x4f, 0x10, 0x8e, 0x7e, 0x41, 0xdb, 0x04, 0xe7, 0x45,
+  0xf7, 0xfb, 0xf8, 0x2a, 0x2a, 0x42, 0x8a, 0x58, 0x68, 0x97, 0x0b, 0xf3, 0x87, 0x5d, 0xf3, 0xe9,
+  0x82, 0x00, 0xdb, 0x5d, 0xeb, 0x57, 0xdf, 0xcc, 0x84, 0x2a, 0x6d, 0x80, 0x20, 0x52, 0x1c, 0x65,
+  0x7c, 0xbe, 0x00, 0x80, 0xbd, 0xcc, 0xa6, 0x6e, 0xe0, 0x4d, 0xbc, 0xd3, 0xe8, 0x3f, 0x9b, 0x99,
+  0xf4, 0xe2, 0x0c, 0xf6, 0x8f, 0xdc, 0xab, 0x56, 0xd6, 0xc1, 0x15, 0x58, 0x66, 0x58, 0x44, 0xa0,
+  0x3c, 0xed, 0xd5, 0xd9, 0xe0, 0x3f, 0x1b, 0x16, 0xef, 0x22, 0x8e, 0xec, 0xcb, 0xec, 0x2e, 0xe4,
+  0x5f, 0xb3, 0xee, 0x1d, 0x71, 0x34, 0x7c, 0xad, 0x6d, 0x6b, 0x42, 0x96, 0x03, 0xbb, 0xd0, 0xb1,
+  0xeb, 0x45, 0x9d, 0x8f, 0x5d, 0xa0, 0x3f, 0x1c, 0xa6, 0x03, 0x28, 0x23, 0xef, 0xda, 0x9d, 0x85,
+  0xf9, 0xfb, 0x66, 0x78, 0x8d, 0xf8, 0xbf, 0x38, 0x63, 0xe7, 0x82, 0x98, 0xce, 0x8f, 0xb1, 0x54,
+  0xa2, 0xc6, 0xbb, 0x80, 0x10, 0x47, 0x6b, 0xcb, 0xbc, 0xa7, 0x04, 0x80, 0x39, 0xa0, 0xea, 0xaf,
+  0x9d, 0x3b, 0x6d, 0xc0, 0xff, 0xb5, 0xf9, 0x29, 0x31, 0xc5, 0xdd, 0x95, 0x5a, 0x06, 0x26, 0x97,
+  0xe3, 0x50, 0xf4, 0x0e, 0xaf, 0xec, 0x90, 0x7e, 0xbd, 0x06, 0x80, 0xf9, 0xe0, 0x13, 0xc4, 0x19,
+  0xfc, 0xbf, 0x36, 0x25, 0xc4, 0xb3, 0xf5, 0xe9, 0x42, 0x48, 0x50, 0x56, 0x98, 0x7a, 0x2a, 0x75,
+  0x95, 0x91, 0x3c, 0x81, 0xff, 0x53, 0x4e, 0xd9, 0x52, 0x37, 0x0b, 0xfb, 0xa7, 0xa8, 0x8d, 0xb9,
+  0x61, 0x8d, 0x15, 0x4d, 0xd4, 0xdf, 0xd6, 0xfc, 0xa5, 0x38, 0xf2, 0x77, 0x4b, 0xff, 0xeb, 0x01,
+  0x6b, 0x27, 0xd2, 0xaf, 0xe6, 0x08, 0x40, 0xd2, 0xfb, 0x9a, 0xb8, 0x3b, 0x41, 0xfe, 0x07, 0x95,
+  0x5d, 0x33, 0xbc, 0x2a, 0x8b, 0xd7, 0x38, 0x63, 0x58, 0xe4, 0xc5, 0x91, 0xdb, 0x67, 0x34, 0x57,
+  0x43, 0x81, 0x8b, 0x65, 0x32, 0xe3, 0x29, 0xc4, 0x22, 0x20, 0xfe, 0x63, 0x11, 0x77, 0x82, 0xfc,
+  0x7a, 0xf6, 0x22, 0x85, 0xd8, 0x54, 0x9e, 0x00, 0xf9, 0x89, 0xce, 0x82, 0xf8, 0xaf, 0x58, 0x95,
+  0xc5, 0x1a, 0x6e, 0xff, 0xc8, 0x40, 0xb9, 0xd6, 0xa5, 0x69, 0xe1, 0x4b, 0xe0, 0x3e, 0x48, 0x3f,
+  0xa6, 0x17, 0x00, 0x7a, 0xe0, 0x7e, 0x9d, 0xff, 0x30, 0x1f, 0xb6, 0x75, 0x14, 0xb5, 0x45, 0xf4,
+  0x00, 0xfe, 0x2a, 0x0b, 0xbb, 0x7c, 0x01, 0x5b, 0x1e, 0x7d, 0xb8, 0x62, 0x94, 0x6c, 0x5d, 0xfa,
+  0x3c, 0x95, 0xf0, 0x45, 0x27, 0x55, 0x97, 0x23, 0x99, 0xee, 0xe5, 0xbb, 0xec, 0xc2, 0xfc, 0x9d,
+  0x28, 0x67, 0x26, 0x18, 0xef, 0x85, 0xfc, 0x29, 0x43, 0xd6, 0xac, 0x46, 0x1f, 0x26, 0xaa, 0x97,
+  0xfc, 0x95, 0x1d, 0x13, 0xb5, 0xbd, 0xb5, 0xde, 0xf1, 0x87, 0x39, 0x2a, 0xa3, 0xd7, 0x09, 0xf7,
+  0xab, 0x98, 0xf0, 0x65, 0x36, 0xea, 0x41, 0xfb, 0xc1, 0x9b, 0xc9, 0x7d, 0x04, 0x93, 0x84, 0x27,
+  0x91, 0xfe, 0x32, 0xad, 0x00, 0x01, 0x64, 0xa0, 0x7e, 0xe5, 0x53, 0x7a, 0x99, 0xe0, 0x9a, 0x19,
+  0xbe, 0x92, 0x17, 0x4a, 0x5c, 0x2b, 0x03, 0xf7, 0x05, 0xea, 0xd0, 0x0b, 0xf7, 0xcf, 0xdd, 0xb1,
+  0x3b, 0x71, 0x3b, 0xf1, 0x7e, 0xbc, 0x3f, 0x3b, 0x81, 0xf7, 0x07, 0xe0, 0xec, 0xb7, 0x7a, 0x2d,
+  0x12, 0x3e, 0x61, 0x98, 0x25, 0xd3, 0x53, 0x78, 0xff, 0xfd, 0x99, 0x1f, 0x02, 0xe0, 0x6b, 0xb1,
+  0x12, 0xa5, 0x2e, 0x53, 0xa4, 0x58, 0xce, 0x70, 0x02, 0xe8, 0xaf, 0x6e, 0xed, 0xce, 0xff, 0x18,
+  0x40, 0x63, 0x8a, 0xfe, 0x09, 0xca, 0xc3, 0x82, 0xf6, 0xa2, 0x84, 0xf6, 0x6f, 0xaa, 0x3b, 0xbc,
+  0x93, 0xc0, 0x7e, 0x80, 0x16, 0x57, 0x79, 0x41, 0xc2, 0xf6, 0x53, 0x11, 0xd9, 0x6f, 0x4c, 0xdb,
+  0xf0, 0xbe, 0x33, 0xc7, 0x84, 0xe6, 0x93, 0xab, 0xf1, 0x7d, 0xff, 0xa5, 0x0f, 0xdf, 0x07, 0x0b,
+  0x6d, 0xdb, 0x8a, 0x3a, 0xbc, 0x8f, 0x0e, 0x0f, 0x4e, 0x20, 0x9c, 0xfa, 0x0c, 0x8c, 0x7f, 0x88,
+  0x36, 0x18, 0x88, 0xc9, 0x52, 0x64, 0x5d, 0xce, 0xae, 0x1f, 0xe1, 0xa7, 0x90, 0x3e, 0x83, 0x73,
+  0x6e, 0x99, 0xbf, 0x1e, 0x88, 0x7f, 0x01, 0x13, 0x66, 0x18, 0x08, 0x46, 0xea, 0xf6, 0x19, 0xc2,
+  0x14, 0xd4, 0xb8, 0x9a, 0xa3, 0xb3, 0x11, 0xfe, 0x91, 0xe7, 0x3b, 0x2f, 0xb3, 0xb1, 0xca, 0x46,
+  0x3b, 0xf0, 0x7d, 0xb4, 0xaa, 0x81, 0x3c, 0x89, 0xed, 0x13, 0x27, 0x50, 0xf9, 0x95, 0xb3, 0x5d,
+  0x97, 0xde, 0x96, 0x7e, 0x32, 0x20, 0x2b, 0x7a, 0x20, 0xfe, 0x81, 0xdc, 0xe4, 0xb5, 0xa1, 0xbb,
+  0xf0, 0x7d, 0x65, 0x17, 0x97, 0x74, 0x95, 0xc8, 0x5e, 0xc1, 0xaa, 0x97, 0x57, 0x44, 0xd5, 0x6c,
+  0x6b, 0x13, 0x0f, 0xa8, 0xfb, 0xcd, 0x53, 0x40, 0x3f, 0xb8, 0x82, 0x13, 0x40, 0x3f, 0x9a, 0x9b,
+  0x77, 0x18, 0x3a, 0x46, 0x25, 0x01, 0x5d, 0x89, 0x9b, 0x11, 0xd4, 0x4e, 0xbe, 0x47, 0xd2, 0x32,
+  0x29, 0x95, 0xfa, 0x34, 0x01, 0x7e, 0x60, 0xab, 0xe7, 0xe3, 0xcd, 0x8f, 0x0f, 0xba, 0x59, 0x9d,
+  0xe5, 0x3a, 0xcc, 0xef, 0xa3, 0x9c, 0x32, 0xd9, 0x07, 0xf5, 0x2f, 0x8e, 0xdb, 0x82, 0x76, 0x4a,
+  0xdb, 0xdf, 0x82, 0x18, 0xaf, 0xaa, 0x88, 0x13, 0x73, 0x0f, 0x3c, 0xe4, 0x20, 0x5b, 0x74, 0xeb,
+  0x62, 0x0f, 0xbe, 0x8d, 0xad, 0xb5, 0x9a, 0xc8, 0x36, 0xf8, 0x2f, 0x6c, 0x97, 0x66, 0x63, 0xff,
+  0x78, 0x05, 0x7b, 0x33, 0x02, 0xc7, 0x44, 0x83, 0x68, 0x03, 0xb6, 0x05, 0x75, 0xc9, 0xd8, 0x91,
+  0x1f, 0x3a, 0x9c, 0x47, 0x85, 0x47, 0x8f, 0x60, 0xce, 0xbc, 0x0f, 0xfb, 0x47, 0x53, 0x84, 0x9e,
+  0x10, 0x7c, 0x12, 0x33, 0x09, 0x9a, 0xf1, 0x50, 0x18, 0x44, 0x1f, 0x41, 0x56, 0x6b, 0x0e, 0xaa,
+  0x12, 0xe2, 0x21, 0xe8, 0xfb, 0x65, 0x81, 0x4f, 0x90, 0xf5, 0x43, 0xc2, 0x3e, 0xc2, 0x1b, 0x86,
+  0x53, 0x50, 0x3f, 0xce, 0x46, 0xb1, 0xc7, 0x95, 0x16, 0xcf, 0xab, 0x28, 0x67, 0x57, 0x90, 0xfe,
+  0x4a, 0xee, 0xf8, 0x3b, 0xe8, 0x0b, 0x37, 0x3f, 0x28, 0xb0, 0xe3, 0x1b, 0x90, 0x57, 0x46, 0x4d,
+  0x66, 0x15, 0x27, 0xc0, 0x7d, 0x37, 0x12, 0x61, 0x9e, 0xc2, 0x1e, 0x42, 0xf4, 0x78, 0x99, 0xc0,
+  0x19, 0xca, 0xdf, 0x12, 0xc8, 0xf5, 0x35, 0x2f, 0x5d, 0x2a, 0xed, 0x05, 0x72, 0x0e, 0x68, 0x40,
+  0x72, 0xa8, 0x35, 0x90, 0xbb, 0x48, 0x25, 0xaa, 0x77, 0xb0, 0x05, 0xa0, 0x58, 0x45, 0x7a, 0x12,
+  0xe6, 0x1f, 0xa9, 0xd8, 0xc9, 0xe7, 0x61, 0x3d, 0xee, 0x3c, 0xf9, 0x8b, 0x03, 0x7a, 0xb3, 0xa0,
+  0x22, 0x28, 0xc6, 0x4a, 0x51, 0xf0, 0x5c, 0xee, 0x4a, 0xbd, 0x6e, 0x4e, 0xff, 0x2b, 0x7f, 0x6e,
+  0xe0, 0xa1, 0x78, 0x85, 0x13, 0x27, 0xbb, 0xd1, 0xfc, 0x4f, 0xd5, 0x76, 0xc1, 0xd3, 0xa1, 0xe5,
+  0xa3, 0x84, 0x43, 0xff, 0xf0, 0x80, 0x59, 0x27, 0xb0, 0x3f, 0x55, 0x3f, 0xa9, 0xd7, 0x03, 0xe0,
+  0x0f, 0xf9, 0x4e, 0x46, 0x1a, 0xbc, 0x87, 0xe1, 0xae, 0xca, 0x68, 0x41, 0xfd, 0xea, 0x80, 0xa3,
+  0xc7, 0xe9, 0xc7, 0xed, 0x1f, 0x71, 0x02, 0xfd, 0x93, 0x03, 0x21, 0xba, 0xe3, 0x10, 0xc5, 0xb1,
+  0xa5, 0xb5, 0xe1, 0x65, 0x38, 0x6d, 0x41, 0x99, 0x8c, 0x13, 0x3f, 0x3c, 0x70, 0x37, 0xf7, 0x46,
+  0x8e, 0x7d, 0x3f, 0xd3, 0x8b, 0xd3, 0x07, 0x62, 0x07, 0xe3, 0x89, 0x8a, 0x2d, 0x6d, 0x98, 0xfe,
+  0x0e, 0xcc, 0x48, 0x06, 0x66, 0x83, 0xe1, 0x7b, 0x30, 0x46, 0x2d, 0xda, 0xb1, 0x32, 0xb8, 0xc3,
+  0x10, 0x4e, 0xf1, 0x39, 0xb8, 0xbe, 0xd4, 0x79, 0x94, 0xf1, 0xab, 0x68, 0x7b, 0xcd, 0xce, 0x9f,
+  0x21, 0x28, 0x05, 0x70, 0xd9, 0x52, 0x94, 0xaf, 0xfe, 0x19, 0x02, 0xde, 0x60, 0x7e, 0x0f, 0x44,
+  0x5f, 0x6e, 0x77, 0x8b, 0xdb, 0x84, 0x5d, 0xc6, 0xa0, 0x84, 0xef, 0xa7, 0x7e, 0x80, 0xa0, 0x9b,
+  0xdb, 0x36, 0x0a, 0x0f, 0x6a, 0xc1, 0xd9, 0x86, 0xbf, 0x47, 0x5c, 0x49, 0x93, 0xe4, 0xd7, 0x40,
+  0xe1, 0x2b, 0x68, 0xa2, 0x0e, 0xc1, 0x63, 0x56, 0xd6, 0x81, 0xc0, 0x53, 0xb6, 0xd4, 0x44, 0xdf,
+  0xd5, 0x0d, 0x7d, 0x0f, 0xf2, 0x4e, 0xf9, 0x11, 0x46, 0x74, 0x10, 0xc6, 0x90, 0x61, 0x7e, 0x47,
+  0x57, 0x8b, 0xc8, 0x12, 0xdb, 0x53, 0x84, 0xf7, 0x7e, 0xfa, 0xa7, 0x08, 0xea, 0xdb, 0x64, 0xd7,
+  0x6c, 0x04, 0x36, 0x05, 0xb5, 0x31, 0x12, 0xf5, 0x51, 0x48, 0xc6, 0x5a, 0x51, 0x40, 0x52, 0xc7,
+  0x25, 0x28, 0xc9, 0x8a, 0x87, 0x5d, 0xd0, 0xfb, 0x1d, 0x87, 0x24, 0x03, 0x8c, 0x75, 0x1b, 0x7c,
+  0x87, 0x0c, 0x81, 0xb7, 0xa1, 0x77, 0x45, 0x7f, 0x04, 0x3e, 0xc2, 0xb8, 0x70, 0x62, 0x64, 0xb4,
+  0x96, 0x1d, 0xb8, 0x7b, 0x45, 0x46, 0x49, 0x9c, 0x45, 0xd3, 0x06, 0xdd, 0x5f, 0xf0, 0xb0, 0x2b,
+  0x61, 0x2b, 0x4b, 0xb8, 0x96, 0xfd, 0x78, 0xbb, 0x1a, 0x38, 0x93, 0xef, 0xa7, 0xa0, 0x76, 0x1c,
+  0xf1, 0x7f, 0xff, 0x47, 0x5a, 0x63, 0xfe, 0xc4, 0x26, 0xe2, 0x15, 0x62, 0x97, 0x92, 0x2b, 0x26,
+  0xc3, 0x87, 0x84, 0x4f, 0x12, 0x73, 0xfe, 0x59, 0x3f, 0x4c, 0xf0, 0xcd, 0xdf, 0x7f, 0xff, 0x0d,
+  0x70, 0x81, 0xe9, 0x7b, 0xb2, 0x31, 0x1c, 0x75, 0xf6, 0x07, 0xf0, 0x03, 0xd3, 0x6f, 0x7f, 0xff,
+  0xcd, 0xa6, 0x88, 0xd5, 0xaf, 0x6b, 0xe4, 0x97, 0xa1, 0x38, 0x7e, 0x60, 0x7f, 0xfd, 0x06, 0xf2,
+  0xbb, 0x22, 0x8d, 0xe9, 0x07, 0x71, 0xff, 0x64, 0x3d, 0xf1, 0xe7, 0x3f, 0x41, 0xff, 0x9f, 0xd9,
+  0xdf, 0xfe, 0x46, 0x3d, 0x1f, 0xdd, 0x69, 0xf9, 0x1d, 0xfe, 0xff, 0x1e, 0x26, 0x29, 0x47, 0xe2,
+  0x87, 0x43, 0x74, 0x0c, 0x52, 0x1e, 0x67, 0x11, 0x05, 0x11, 0xd9, 0x25, 0x0e, 0x0b, 0xac, 0x80,
+  0x1c, 0x53, 0x7c, 0x8c, 0x92, 0xed, 0xe5, 0xc5, 0x9f, 0xc6, 0xfa, 0x2a, 0xff, 0xcf, 0xcc, 0x01,
+  0x6a, 0x09, 0x7c, 0xbc, 0xb8, 0xb2, 0xd7, 0xf7, 0x01, 0x46, 0xfc, 0x7f, 0x88, 0x85, 0x54, 0x1e,
+  0xe1, 0x5f, 0x00, 0x00,
+};
+
+// /lang-handler.js <- Web_JavaScript_Lang_Handler.h
+static const uint8_t ASSET_LANG_HANDLER_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5d, 0xdd, 0x92, 0xdb, 0xb6,
+  0x15, 0xbe, 0xdf, 0xa7, 0x60, 0xd3, 0x99, 0x48, 0x98, 0x58, 0x72, 0xa5, 0x75, 0x72, 0x61, 0xd7,
+  0x99, 0x91, 0x77, 0xe5, 0x44, 0xb1, 0xf7, 0x67, 0x56, 0xf2, 0xa4, 0x99, 0x4c, 0x46, 0x43, 0x91,
+  0xd8, 0x5d, 0xd6, 0x14, 0xc9, 0x90, 0xd0, 0xae, 0xd5, 0x64, 0x5f, 0xa3, 0x8f, 0xd2, 0x07, 0xea,
+  0x93, 0x14, 0xbf, 0xe4, 0x01, 0x08, 0x90, 0xa0, 0x27, 0xd3, 0x9b, 0xf6, 0x22, 0x8e, 0x48, 0x9e,
+  0xef, 0x3b, 0x1f, 0xfe, 0x0e, 0x40, 0x10, 0xc0, 0x86, 0xd5, 0x31, 0x8b, 0x82, 0xdb, 0x43, 0x16,
+  0x91, 0x24, 0xcf, 0x82, 0x34, 0x0f, 0xe3, 0xf7, 0x61, 0x76, 0x77, 0x08, 0xef, 0xf0, 0x18, 0x05,
+  0xbf, 0x9d, 0x90, 0xf2, 0x48, 0xff, 0x8d, 0xf2, 0xac, 0x22, 0x41, 0x89, 0xab, 0x82, 0xfe, 0xc0,
+  0xc1, 0xeb, 0x20, 0x7c, 0x0c, 0x13, 0x12, 0xdc, 0x62, 0x12, 0xdd, 0x8f, 0x47, 0xcf, 0xc3, 0x22,
+  0x79, 0x9e, 0x4a, 0xd4, 0x08, 0xbd, 0x92, 0xe6, 0x71, 0x48, 0xc2, 0xda, 0x54, 0x61, 0xa7, 0x7f,
+  0xaf, 0xf2, 0x6c, 0x4c, 0x6d, 0x92, 0xdb, 0x60, 0xcc, 0x2c, 0xa6, 0xd1, 0xa1, 0x2c, 0x71, 0x46,
+  0x98, 0x33, 0xf9, 0x93, 0x09, 0xa0, 0x40, 0xf8, 0xf4, 0xd5, 0xc9, 0xa1, 0xa0, 0xd7, 0x58, 0x69,
+  0x7b, 0x73, 0x20, 0x84, 0xd2, 0x31, 0xa2, 0xb0, 0x28, 0xd2, 0xe3, 0x22, 0x4d, 0x37, 0x65, 0x98,
+  0x55, 0x69, 0xc8, 0x92, 0xc1, 0xef, 0x3f, 0x9d, 0x3c, 0x05, 0x51, 0x48, 0x05, 0x06, 0x63, 0x5c,
+  0x96, 0x79, 0x89, 0x64, 0x3a, 0xf2, 0x14, 0x4f, 0xf9, 0x8d, 0xf1, 0xe8, 0x67, 0x45, 0xf7, 0x4b,
+  0xf0, 0x36, 0x4c, 0x52, 0x1c, 0x07, 0x24, 0xe7, 0x59, 0xf0, 0x72, 0xf4, 0x2c, 0x10, 0xa0, 0x57,
+  0x86, 0xa8, 0x2f, 0x96, 0x97, 0x5f, 0xbc, 0x0a, 0x9e, 0x3f, 0xa7, 0x80, 0x34, 0xdd, 0x85, 0xd1,
+  0x47, 0x06, 0x59, 0x66, 0x77, 0x69, 0x52, 0xdd, 0x33, 0x97, 0x27, 0x75, 0x56, 0x3a, 0x04, 0x53,
+  0x15, 0x71, 0x1e, 0x1d, 0xf6, 0x94, 0x72, 0xfa, 0xeb, 0x01, 0x97, 0xc7, 0x35, 0x4e, 0x71, 0x44,
+  0xf2, 0x92, 0x26, 0x61, 0x3c, 0x9a, 0xb2, 0x6c, 0x9c, 0xec, 0x48, 0x36, 0x42, 0xd3, 0xdb, 0xbc,
+  0x5c, 0x86, 0x34, 0x7f, 0xe9, 0x55, 0xf0, 0xfa, 0x5b, 0x8a, 0xa3, 0x3f, 0xa6, 0x51, 0x1a, 0x56,
+  0xd5, 0xfb, 0xa4, 0x22, 0xd3, 0x12, 0xef, 0xf3, 0x07, 0x3c, 0x1e, 0x85, 0xd4, 0xdd, 0x03, 0xcf,
+  0x76, 0x96, 0xa5, 0xcc, 0x86, 0x65, 0x5c, 0x85, 0x09, 0xe7, 0x0a, 0x5e, 0xbf, 0x7e, 0x1d, 0x80,
+  0x24, 0xa0, 0x16, 0x4f, 0x18, 0xc7, 0x90, 0x84, 0xa6, 0x81, 0xff, 0x1b, 0xea, 0x15, 0xa3, 0x0a,
+  0x1f, 0xea, 0xb4, 0x8c, 0x53, 0x49, 0x34, 0xbc, 0x72, 0x3c, 0xa3, 0xf6, 0x7b, 0x4c, 0xee, 0xf3,
+  0xf8, 0x65, 0x30, 0xba, 0xbe, 0x5a, 0x6f, 0x46, 0xcf, 0x4e, 0xee, 0x71, 0x18, 0xe3, 0xb2, 0x7a,
+  0x19, 0xfc, 0x16, 0x8c, 0xce, 0xf2, 0x8c, 0x50, 0xa5, 0x93, 0xcd, 0xb1, 0xc0, 0x23, 0x6a, 0xc2,
+  0x0a, 0x37, 0x89, 0x78, 0xa1, 0x3e, 0x67, 0x35, 0x67, 0x14, 0x3c, 0x3d, 0x3b, 0xd9, 0xe5, 0xf1,
+  0xf1, 0x65, 0xf0, 0xc3, 0xfa, 0xea, 0x72, 0x5a, 0x91, 0x32, 0xc9, 0xee, 0x92, 0xdb, 0xe3, 0xf8,
+  0xb7, 0x40, 0x39, 0x79, 0xc9, 0x7f, 0x05, 0x4f, 0x88, 0xa7, 0x64, 0x50, 0x5d, 0xac, 0x0e, 0x51,
+  0x84, 0xab, 0x0a, 0x56, 0x95, 0x34, 0xbf, 0xd3, 0x2a, 0xca, 0x9a, 0x66, 0x04, 0xaf, 0x1f, 0x3c,
+  0x13, 0x5e, 0x9d, 0x94, 0x98, 0x1c, 0xca, 0x2c, 0x20, 0xe5, 0x01, 0x7f, 0x7e, 0x9d, 0x63, 0xb9,
+  0x0b, 0xeb, 0xdc, 0x93, 0xa2, 0xbd, 0x0d, 0xd3, 0x8a, 0xf3, 0xd6, 0x05, 0x61, 0xaf, 0xee, 0x1d,
+  0x82, 0x17, 0x0c, 0x40, 0x33, 0x89, 0x4a, 0x6c, 0x10, 0xcc, 0x19, 0xac, 0x15, 0x2a, 0x9f, 0x2a,
+  0x12, 0xd2, 0x1b, 0x3b, 0x9c, 0x56, 0xac, 0x01, 0x76, 0xd4, 0x53, 0x66, 0x38, 0x49, 0x99, 0xa5,
+  0xaa, 0x79, 0x0d, 0xf4, 0xe7, 0xbf, 0xfc, 0x82, 0x02, 0xed, 0x72, 0x4a, 0xf0, 0x27, 0x22, 0xcb,
+  0x96, 0x12, 0x93, 0xf1, 0x88, 0x3d, 0xde, 0x92, 0x9c, 0x84, 0x36, 0xfc, 0x4c, 0xc7, 0xcf, 0x5c,
+  0x78, 0xbd, 0xea, 0x03, 0xc4, 0x5c, 0x27, 0x98, 0xbb, 0x08, 0x8a, 0x32, 0xff, 0x3b, 0x4d, 0x54,
+  0xd5, 0x04, 0x2d, 0x79, 0x67, 0x8d, 0xc3, 0x92, 0x96, 0x22, 0xc8, 0x83, 0x3b, 0x4c, 0x96, 0x29,
+  0x66, 0x3f, 0xdf, 0x1c, 0x57, 0xb4, 0xc5, 0x48, 0xc3, 0x49, 0xc5, 0x2d, 0x95, 0x06, 0x0d, 0x8e,
+  0x74, 0xb6, 0x69, 0x91, 0x86, 0x11, 0xbe, 0xcf, 0x53, 0x5a, 0xdb, 0xa5, 0x06, 0x7e, 0xdf, 0xa2,
+  0x22, 0xc9, 0x12, 0x92, 0x84, 0xe9, 0x65, 0x7e, 0x2d, 0x1e, 0x75, 0x09, 0x91, 0xb6, 0x93, 0x2c,
+  0x9f, 0x48, 0x22, 0x25, 0xc6, 0x64, 0x41, 0x2d, 0xde, 0x76, 0xb6, 0xe0, 0x7d, 0x41, 0x8e, 0xdb,
+  0x2c, 0xdf, 0x02, 0x2e, 0x4d, 0x93, 0xa8, 0x06, 0x03, 0x74, 0x55, 0x1c, 0xe0, 0xd0, 0xa6, 0xb1,
+  0x21, 0xab, 0x0f, 0x97, 0x46, 0xc1, 0xdb, 0xd6, 0x99, 0xe1, 0x47, 0x89, 0x7c, 0xc3, 0x02, 0xa7,
+  0x5b, 0x20, 0x35, 0x54, 0xaa, 0x44, 0xc4, 0x15, 0xca, 0x34, 0x3c, 0xd2, 0xe9, 0xda, 0x5a, 0xe8,
+  0x63, 0x25, 0x61, 0x2b, 0x49, 0x64, 0x4b, 0xc2, 0x84, 0xd0, 0x56, 0x57, 0xf5, 0x88, 0x50, 0x66,
+  0x50, 0x01, 0x80, 0x22, 0xc8, 0x63, 0xa9, 0xc4, 0xf2, 0xa1, 0xee, 0xfa, 0x36, 0x49, 0x09, 0x0d,
+  0xa8, 0x3d, 0x2d, 0xb8, 0x08, 0x33, 0x9c, 0x4e, 0x84, 0x2d, 0xf4, 0x2e, 0xd1, 0xbc, 0x11, 0x37,
+  0xbf, 0xdb, 0xbe, 0xc5, 0xb3, 0x2d, 0xed, 0x06, 0x4d, 0xe4, 0x0c, 0x20, 0x67, 0x1d, 0x48, 0xad,
+  0xf5, 0x2a, 0xc0, 0x1c, 0x80, 0xe7, 0x6e, 0x70, 0x94, 0xef, 0x8b, 0x14, 0x13, 0x1c, 0x9b, 0xf8,
+  0x53, 0x80, 0x3f, 0x75, 0xe3, 0x69, 0x0f, 0xf9, 0xd1, 0x84, 0xbe, 0x00, 0xd0, 0x17, 0x6e, 0x28,
+  0x6d, 0xc6, 0xad, 0xcc, 0xfa, 0x1a, 0x40, 0xbf, 0x76, 0x43, 0xb3, 0x9c, 0xb4, 0x12, 0xfc, 0x0d,
+  0x80, 0x7e, 0xe3, 0x86, 0xd2, 0xee, 0x3e, 0xc9, 0x68, 0xe4, 0x00, 0xa1, 0x8a, 0x15, 0xe0, 0x26,
+  0x21, 0x29, 0xee, 0xaa, 0x60, 0x32, 0xca, 0x9b, 0xed, 0x0f, 0x80, 0xbf, 0xfc, 0x12, 0x5e, 0x42,
+  0x01, 0xd3, 0x24, 0x8b, 0xd2, 0x43, 0x8c, 0xab, 0xf1, 0xe8, 0xfa, 0xe6, 0xea, 0x87, 0x65, 0xb0,
+  0x5e, 0x9e, 0x8d, 0x50, 0xf0, 0xfb, 0xef, 0x41, 0xaf, 0xfd, 0xe5, 0x55, 0xc0, 0x21, 0x67, 0x1b,
+  0x4f, 0xc0, 0xbb, 0xe5, 0xea, 0x52, 0x40, 0xde, 0x51, 0x08, 0x62, 0x3d, 0x9a, 0x1d, 0xe3, 0x8e,
+  0x53, 0x4f, 0x32, 0x63, 0x58, 0xd9, 0x5e, 0xe4, 0x71, 0xd8, 0xce, 0x1c, 0xad, 0x19, 0x8c, 0x47,
+  0x7f, 0x66, 0x96, 0x93, 0x3d, 0x33, 0x0d, 0xa6, 0xfc, 0x7f, 0x13, 0xc2, 0x20, 0x2a, 0x93, 0x74,
+  0x22, 0x64, 0x10, 0xb7, 0x45, 0x71, 0x8a, 0x2d, 0x0b, 0x09, 0xaa, 0x7a, 0x35, 0x82, 0x7a, 0x0b,
+  0x4a, 0xfa, 0x67, 0x8a, 0x5a, 0x22, 0x80, 0x7f, 0xe1, 0xba, 0xd5, 0x95, 0xb0, 0x47, 0x5b, 0x8e,
+  0xdb, 0x82, 0x67, 0xba, 0x84, 0x73, 0x5c, 0x45, 0x9e, 0x0a, 0x68, 0x91, 0x44, 0x50, 0x00, 0x83,
+  0xa2, 0x9a, 0xc4, 0xe1, 0x9e, 0x81, 0xdc, 0xde, 0xd9, 0x90, 0x4e, 0x64, 0xbd, 0x6f, 0x2e, 0xb0,
+  0x31, 0x20, 0xcc, 0x84, 0x9a, 0x80, 0x8f, 0x3d, 0xb5, 0x3b, 0xd3, 0xbc, 0xe0, 0xe3, 0x1a, 0x15,
+  0xa9, 0x60, 0xa6, 0x50, 0xa3, 0xba, 0x3c, 0x1c, 0xa8, 0x99, 0x1d, 0xa5, 0x5a, 0xba, 0x03, 0x35,
+  0xb7, 0xa3, 0x54, 0x23, 0x77, 0xa0, 0x4e, 0xed, 0x28, 0xd8, 0xbe, 0x61, 0x45, 0xbe, 0x2e, 0x93,
+  0xbc, 0x4c, 0xc8, 0x71, 0x50, 0xd6, 0x15, 0x12, 0x04, 0xb3, 0x4f, 0x27, 0x52, 0x59, 0xa8, 0xdf,
+  0xb5, 0x67, 0xa3, 0x62, 0xdb, 0xa6, 0xf9, 0xa3, 0x4a, 0x98, 0x03, 0x37, 0xb3, 0xe2, 0xf6, 0x38,
+  0x4e, 0x0e, 0xfb, 0x1e, 0xe8, 0xdc, 0x0a, 0xbd, 0x4f, 0xee, 0xee, 0xcd, 0x2c, 0x39, 0x0b, 0xb3,
+  0x08, 0xa7, 0x3d, 0x1d, 0x2b, 0xc8, 0x8d, 0x88, 0xdb, 0xc3, 0xbc, 0xa8, 0x19, 0x90, 0x4e, 0xd8,
+  0x6e, 0xd2, 0xb4, 0x63, 0xdc, 0x36, 0x78, 0xa0, 0xa1, 0xc4, 0xf4, 0xed, 0x6e, 0x80, 0x06, 0x6e,
+  0xaf, 0x69, 0x50, 0x0c, 0x48, 0x27, 0x74, 0x68, 0xa8, 0xf1, 0x42, 0x03, 0xcd, 0x51, 0xb2, 0xf1,
+  0x8e, 0x73, 0xcc, 0x7a, 0xd2, 0x13, 0xec, 0xda, 0x8c, 0xc8, 0xe2, 0xc5, 0x15, 0xf4, 0x98, 0xa5,
+  0x11, 0xf5, 0x14, 0xb8, 0x37, 0xf2, 0x35, 0xea, 0xac, 0x82, 0x0c, 0x2d, 0x9f, 0x19, 0x00, 0x15,
+  0xbc, 0x2f, 0x08, 0x36, 0x62, 0x60, 0x0c, 0x84, 0x68, 0xa4, 0x71, 0x0d, 0x8e, 0x85, 0x75, 0x3a,
+  0xbc, 0xe2, 0x21, 0xc8, 0x1b, 0x10, 0x0e, 0xdb, 0x1c, 0xac, 0x3d, 0xb7, 0xef, 0xfa, 0x86, 0xc5,
+  0x0e, 0x64, 0x4f, 0x68, 0xec, 0x40, 0xf6, 0x84, 0xc7, 0x0e, 0xe4, 0x80, 0x10, 0xa9, 0x58, 0xfc,
+  0xc3, 0x64, 0x93, 0xa3, 0x66, 0x94, 0xb4, 0x73, 0xc1, 0x9c, 0xfd, 0x9c, 0x68, 0xd9, 0x83, 0xed,
+  0x8b, 0x98, 0x3d, 0xf0, 0xbe, 0xa8, 0xf9, 0xb3, 0x68, 0x9f, 0xf4, 0x75, 0x9f, 0x27, 0x7c, 0xf4,
+  0x4b, 0x3d, 0xad, 0x54, 0x94, 0xf8, 0x36, 0xf9, 0x24, 0x66, 0x96, 0xd4, 0x14, 0x4e, 0x41, 0x83,
+  0x4c, 0x6f, 0x0e, 0x4a, 0xe0, 0x57, 0xc1, 0x48, 0x64, 0xa3, 0x80, 0xa9, 0x4c, 0x84, 0x24, 0x2c,
+  0xeb, 0x7e, 0x1e, 0x89, 0x3b, 0xb4, 0xdc, 0x33, 0x36, 0xff, 0xa3, 0x2e, 0xe3, 0x30, 0x49, 0x8f,
+  0xe0, 0xfa, 0x11, 0xe3, 0x8f, 0x71, 0x78, 0xac, 0x8c, 0x5b, 0x9a, 0xcd, 0x9e, 0xc6, 0x9d, 0x7b,
+  0x7a, 0xe7, 0x97, 0x93, 0x3a, 0x15, 0xe3, 0x8f, 0xf8, 0xf8, 0x2c, 0x48, 0x10, 0x4f, 0x87, 0x96,
+  0x82, 0x3a, 0x8b, 0x12, 0x90, 0x45, 0xd4, 0x1a, 0xbd, 0x0a, 0x9e, 0x60, 0x05, 0x7a, 0xa0, 0xa1,
+  0x72, 0x95, 0x15, 0x87, 0x21, 0x49, 0xe6, 0xa0, 0xba, 0xda, 0xd4, 0x0c, 0x08, 0xb0, 0x4d, 0x89,
+  0x0c, 0x7b, 0xb4, 0x5c, 0xa4, 0xfc, 0x1a, 0xf5, 0xd4, 0x0a, 0x06, 0x5e, 0x5d, 0x5a, 0x53, 0x73,
+  0xf5, 0x1e, 0xad, 0x45, 0x82, 0xda, 0xbc, 0x7e, 0x3d, 0x9b, 0x82, 0xb1, 0x49, 0x2e, 0x6f, 0x31,
+  0x6c, 0xf2, 0xca, 0x94, 0x22, 0x09, 0x90, 0xc9, 0x68, 0x97, 0xa1, 0x18, 0xb4, 0x29, 0x18, 0xbf,
+  0x9e, 0x4d, 0xbd, 0xc0, 0xbb, 0xfb, 0xb5, 0x16, 0x1d, 0x6a, 0x7b, 0xe8, 0x1a, 0xca, 0xb7, 0x26,
+  0x18, 0xe4, 0x8d, 0xcb, 0x70, 0xef, 0x31, 0x9e, 0x57, 0xfa, 0x32, 0x6a, 0x6d, 0x28, 0x62, 0x04,
+  0x08, 0xb2, 0xb5, 0xbb, 0x12, 0x35, 0xb3, 0xc0, 0xd0, 0xf6, 0xde, 0x44, 0x5a, 0xf8, 0x0d, 0xed,
+  0x95, 0x18, 0xd8, 0xb3, 0x01, 0x02, 0x04, 0xd9, 0xdc, 0x62, 0xdc, 0x5d, 0x9b, 0xb4, 0x18, 0x3a,
+  0x64, 0x55, 0xb2, 0xcc, 0x78, 0x6c, 0xa5, 0xe3, 0x2f, 0x86, 0xb6, 0x07, 0xfd, 0xd1, 0x78, 0x5b,
+  0xcf, 0x57, 0x76, 0x13, 0x74, 0x85, 0x64, 0x5f, 0x0e, 0x77, 0x5c, 0x6e, 0x18, 0x9e, 0xf4, 0x6c,
+  0x1b, 0x30, 0xac, 0x55, 0x39, 0xa6, 0xc7, 0x01, 0x93, 0x07, 0xb5, 0x98, 0xfd, 0xa2, 0x80, 0x42,
+  0xf9, 0x0f, 0x71, 0x6b, 0x3d, 0xda, 0x28, 0xd7, 0xe4, 0x41, 0x2d, 0xe6, 0x01, 0xe1, 0xe0, 0x03,
+  0xff, 0x9c, 0x32, 0x48, 0x8d, 0xf8, 0x02, 0x63, 0xa8, 0xa9, 0x79, 0x50, 0x8b, 0xd9, 0xae, 0xa6,
+  0x61, 0x91, 0xf3, 0x8b, 0x39, 0x49, 0x6e, 0xfd, 0x82, 0x13, 0x37, 0x95, 0x9f, 0x2f, 0x3a, 0x22,
+  0x94, 0xc1, 0x88, 0x4c, 0x17, 0x96, 0x59, 0x47, 0x66, 0xb0, 0xad, 0x49, 0x80, 0xb0, 0x4d, 0xb8,
+  0xeb, 0x99, 0xf8, 0xb3, 0xaa, 0xaa, 0xa7, 0x21, 0x49, 0xb8, 0xd3, 0x64, 0x31, 0x3e, 0x3e, 0x15,
+  0x08, 0xaf, 0x9c, 0x82, 0x28, 0xd9, 0xb1, 0x0d, 0x9f, 0x69, 0xf0, 0x59, 0x07, 0x7c, 0x9f, 0x97,
+  0xa5, 0x18, 0x35, 0xe9, 0x0c, 0x73, 0x8d, 0x61, 0xee, 0x64, 0x60, 0x23, 0x86, 0x36, 0xfa, 0x54,
+  0x43, 0x9f, 0x3a, 0xd1, 0x39, 0xed, 0x9f, 0xe3, 0x83, 0x99, 0xa3, 0x67, 0x69, 0x5e, 0x99, 0xf5,
+  0xce, 0xbf, 0xa0, 0xe1, 0xc4, 0x32, 0x64, 0x43, 0x3a, 0xb9, 0xa3, 0x61, 0xb2, 0xa7, 0xed, 0x29,
+  0x65, 0xbf, 0xca, 0x57, 0x17, 0xa9, 0xbb, 0xe2, 0xb5, 0x09, 0x91, 0xc5, 0x49, 0xc7, 0xb4, 0xb3,
+  0x51, 0x03, 0xd5, 0x7d, 0x8f, 0x4a, 0x68, 0xaa, 0xb3, 0x55, 0x40, 0x48, 0x27, 0xbe, 0x29, 0xe9,
+  0x37, 0xba, 0x84, 0x85, 0xbb, 0xed, 0xdd, 0x21, 0xb1, 0x32, 0xcd, 0x4c, 0xa6, 0x59, 0x1f, 0x13,
+  0x4d, 0x5d, 0x86, 0xf9, 0xe7, 0x37, 0x2b, 0xe1, 0xdc, 0x24, 0x9c, 0xf7, 0x11, 0x26, 0xd9, 0x6d,
+  0xde, 0x64, 0x5b, 0xea, 0xf5, 0xc1, 0x4d, 0x65, 0x50, 0xdd, 0x7d, 0x08, 0x58, 0x3d, 0x12, 0xe6,
+  0x97, 0x70, 0x38, 0x2f, 0xfb, 0x1f, 0x7e, 0x5f, 0x9b, 0x74, 0x25, 0x65, 0xb2, 0x57, 0x9f, 0x3d,
+  0xd9, 0x7d, 0x30, 0x0b, 0xbb, 0x59, 0x5e, 0x2c, 0xc4, 0x84, 0xad, 0xf9, 0xe0, 0xfb, 0xe5, 0xc5,
+  0x72, 0xc4, 0xa7, 0x65, 0x5b, 0x84, 0x22, 0x81, 0x34, 0xbb, 0xb7, 0xe4, 0x9e, 0x06, 0xe3, 0x2d,
+  0x5c, 0x0a, 0xf0, 0x14, 0x50, 0x8d, 0x38, 0xb0, 0xb8, 0xfa, 0xf0, 0xd3, 0x77, 0x1f, 0xde, 0x2f,
+  0x1c, 0xee, 0x16, 0xd7, 0xd7, 0xbd, 0xce, 0xc2, 0xa2, 0x90, 0x2f, 0xfc, 0x4d, 0x8f, 0xea, 0xf4,
+  0xf6, 0x6e, 0xb1, 0x59, 0x7e, 0x77, 0x75, 0xb3, 0xb2, 0x7a, 0x3b, 0x13, 0x0f, 0x7f, 0xb2, 0x3e,
+  0x54, 0xc8, 0xe5, 0x65, 0xaf, 0x22, 0x1a, 0x00, 0xf0, 0x1d, 0xed, 0xe9, 0x71, 0xe5, 0x23, 0x69,
+  0xb3, 0xb8, 0x59, 0x7d, 0x6f, 0x75, 0x79, 0x4e, 0x5d, 0xba, 0x1e, 0x7c, 0xb8, 0xe8, 0x95, 0xc1,
+  0xfa, 0x2b, 0x92, 0xec, 0xbd, 0xf2, 0xe5, 0xc7, 0xe4, 0x6d, 0x12, 0xac, 0xd7, 0xab, 0xf3, 0x4e,
+  0x56, 0xd6, 0x00, 0xb6, 0x55, 0x95, 0xc4, 0x3e, 0x94, 0xd7, 0x8b, 0xf5, 0xfa, 0xc7, 0xab, 0x9b,
+  0x73, 0x6b, 0x0a, 0xd6, 0xab, 0xb7, 0x37, 0xcb, 0x7e, 0x5f, 0x45, 0x58, 0x55, 0x8f, 0x79, 0xe9,
+  0xe5, 0x6f, 0xbd, 0x59, 0x6c, 0x56, 0x67, 0xc1, 0xea, 0xda, 0xee, 0x90, 0x3d, 0x7d, 0xc7, 0x9f,
+  0xf6, 0x26, 0x90, 0xd0, 0x00, 0x1e, 0x6d, 0x93, 0xc2, 0xc7, 0xeb, 0xfe, 0xfc, 0x72, 0xdd, 0x4f,
+  0xb9, 0x8f, 0x33, 0x58, 0x17, 0xc0, 0x9b, 0x1f, 0x6f, 0x2a, 0x5e, 0x9f, 0xda, 0xb9, 0xa5, 0xfe,
+  0xad, 0x1d, 0x80, 0x79, 0x60, 0xd4, 0xaf, 0x3b, 0xdb, 0x26, 0x1d, 0x81, 0x12, 0x1b, 0xcd, 0xcc,
+  0xa0, 0x99, 0x75, 0xd2, 0xc4, 0x61, 0xf9, 0x51, 0x5b, 0xe9, 0xc3, 0x2b, 0xdc, 0x7b, 0x11, 0x82,
+  0xdc, 0xe3, 0x33, 0x65, 0xa8, 0xa7, 0x46, 0x83, 0x23, 0x9d, 0xcd, 0xb7, 0x86, 0x37, 0x42, 0xd6,
+  0x87, 0x5d, 0xea, 0xa3, 0x63, 0x52, 0x49, 0x43, 0x28, 0x43, 0x81, 0x91, 0x46, 0xe5, 0x16, 0x61,
+  0x0a, 0x60, 0xa2, 0x7c, 0x04, 0xf0, 0x4c, 0x30, 0x05, 0x40, 0x30, 0xd2, 0xa8, 0x1c, 0x45, 0x61,
+  0xc9, 0x01, 0xd5, 0x4d, 0x0c, 0x78, 0x99, 0xa8, 0x7b, 0x16, 0xfd, 0x6d, 0xa2, 0xc5, 0x84, 0xda,
+  0xe4, 0x7e, 0xef, 0x13, 0x0a, 0xe6, 0x31, 0xab, 0x60, 0x28, 0x82, 0x53, 0x0b, 0x06, 0x0b, 0x32,
+  0x69, 0x7d, 0xde, 0x25, 0x08, 0xae, 0x88, 0x5c, 0x89, 0xe5, 0xdb, 0xdd, 0xca, 0x01, 0x1c, 0x40,
+  0xb6, 0x17, 0x66, 0xa9, 0x85, 0x57, 0xf6, 0x2f, 0x9b, 0x9b, 0xe5, 0x5a, 0x7e, 0x04, 0x75, 0xdb,
+  0xbc, 0x59, 0x7c, 0xf7, 0x7e, 0x71, 0xb9, 0x59, 0x89, 0x88, 0xb2, 0x73, 0xa5, 0x86, 0xa9, 0x30,
+  0xc2, 0x92, 0x9b, 0x73, 0xf9, 0xb7, 0xeb, 0xab, 0x9b, 0x5e, 0xcf, 0xe7, 0xab, 0xf5, 0xa2, 0xc7,
+  0x2b, 0xfe, 0x54, 0xe4, 0xa5, 0xbf, 0xdf, 0xd5, 0x85, 0x8f, 0xdf, 0xd5, 0xd9, 0xb2, 0xc7, 0x6d,
+  0xb2, 0xaf, 0xdd, 0x82, 0xb8, 0x19, 0x46, 0x11, 0xed, 0x17, 0xe8, 0x50, 0x8c, 0x8f, 0x4d, 0xfb,
+  0x8a, 0xb1, 0xb6, 0x6e, 0x06, 0xbe, 0x06, 0x41, 0x5d, 0x9a, 0x72, 0xbe, 0xae, 0x35, 0x7e, 0x22,
+  0xad, 0x8f, 0xd6, 0x1d, 0xe3, 0xa7, 0xeb, 0x9b, 0xd5, 0xc5, 0xe2, 0xe6, 0xa7, 0xe0, 0xc7, 0xd5,
+  0x5b, 0x59, 0x96, 0xc4, 0x32, 0x84, 0x1e, 0xfd, 0xfb, 0x9f, 0xff, 0x0a, 0x46, 0xc1, 0x57, 0x4d,
+  0x77, 0x47, 0x19, 0xc3, 0xf2, 0xb8, 0x7d, 0xa4, 0x6f, 0x11, 0xdd, 0xdd, 0xce, 0x9b, 0xc5, 0xd9,
+  0xbb, 0x0f, 0xd7, 0x43, 0xf9, 0xd9, 0x42, 0xc5, 0x43, 0xe1, 0x41, 0xbf, 0xb8, 0x0e, 0x2e, 0xae,
+  0xce, 0x97, 0x03, 0xa8, 0xc3, 0x62, 0x4b, 0x1b, 0x2d, 0xf6, 0x51, 0x4d, 0xab, 0xc4, 0x97, 0x5f,
+  0x9a, 0xfd, 0xf3, 0x0d, 0x6d, 0x1d, 0x57, 0x37, 0x9e, 0x1e, 0xd9, 0xb8, 0x59, 0x25, 0xa6, 0xa4,
+  0x6d, 0x21, 0x2f, 0x7b, 0x1c, 0xbf, 0x5d, 0x9c, 0x51, 0xf6, 0x9f, 0x02, 0xea, 0x65, 0xb9, 0xb1,
+  0x8e, 0x0f, 0xde, 0x2e, 0xde, 0xdc, 0xac, 0xde, 0x2d, 0x06, 0xf8, 0xbf, 0x0d, 0x59, 0xfd, 0x3a,
+  0x32, 0x01, 0xb8, 0x55, 0x3d, 0x79, 0x38, 0x5e, 0x14, 0x6b, 0x3a, 0x56, 0xea, 0x8a, 0x73, 0xdc,
+  0x6c, 0x12, 0x16, 0x13, 0x36, 0xa8, 0x52, 0x11, 0x0e, 0x60, 0x11, 0x24, 0x72, 0x8c, 0x2d, 0x68,
+  0xce, 0xeb, 0x43, 0x32, 0x4d, 0xc1, 0x45, 0xac, 0xc7, 0x38, 0xa7, 0x02, 0x36, 0x44, 0x31, 0x14,
+  0x30, 0x2c, 0x82, 0x44, 0x6e, 0x05, 0xfa, 0x00, 0x47, 0x28, 0xb8, 0x4f, 0x32, 0xb2, 0x28, 0x2e,
+  0xf3, 0x6b, 0x39, 0x88, 0xeb, 0x92, 0xc1, 0x6c, 0x99, 0x0a, 0xb6, 0x7a, 0x4d, 0x9a, 0x2b, 0x31,
+  0x26, 0x0d, 0x6a, 0x11, 0xbb, 0x65, 0xb1, 0x85, 0x21, 0x80, 0x0e, 0xea, 0x62, 0xe9, 0x59, 0xf0,
+  0x65, 0x9e, 0x3e, 0xba, 0x58, 0xfa, 0x26, 0x21, 0x37, 0xd7, 0x75, 0x35, 0x34, 0xa8, 0x45, 0x4c,
+  0xab, 0x57, 0x86, 0xcb, 0xef, 0x37, 0x17, 0xef, 0xcd, 0xa1, 0x20, 0x95, 0xc6, 0x8c, 0x69, 0x4d,
+  0xfc, 0x2a, 0x18, 0xfd, 0xb5, 0x2a, 0xc2, 0x2c, 0x48, 0xe2, 0xd7, 0x5f, 0x28, 0x47, 0x45, 0x89,
+  0x1f, 0x12, 0xfc, 0xf8, 0xc5, 0xb7, 0xac, 0xbe, 0x39, 0xb5, 0x19, 0xd6, 0x23, 0xa4, 0xe5, 0x03,
+  0x23, 0x7e, 0xce, 0x98, 0xbf, 0x9d, 0xa6, 0x79, 0x14, 0xa6, 0x23, 0xad, 0x62, 0x5c, 0x8b, 0x48,
+  0xe3, 0x57, 0x3f, 0x65, 0x58, 0x6a, 0x57, 0x52, 0xc0, 0x82, 0x5a, 0xbc, 0x5e, 0xaf, 0x0f, 0x6d,
+  0x49, 0x3e, 0xb5, 0x45, 0x97, 0x65, 0x56, 0x18, 0x1b, 0x1b, 0xb2, 0xfa, 0xf0, 0x7e, 0xeb, 0x10,
+  0x32, 0xa3, 0x7b, 0x1c, 0x7d, 0xdc, 0xe5, 0x9f, 0xd6, 0xf7, 0xf9, 0xa3, 0xa2, 0x90, 0x8c, 0x9d,
+  0x4b, 0xaf, 0x24, 0x6c, 0x52, 0x51, 0x5c, 0xad, 0x56, 0xc9, 0x57, 0xaa, 0x3b, 0xc8, 0x51, 0x97,
+  0x67, 0x57, 0x36, 0x53, 0x4b, 0x4b, 0xdd, 0xd7, 0x0a, 0x89, 0xbf, 0xe7, 0xac, 0x8a, 0x01, 0x15,
+  0x80, 0x23, 0x26, 0x49, 0x61, 0xad, 0x05, 0x92, 0x0e, 0x59, 0x9d, 0xf8, 0xbf, 0x6b, 0x35, 0x8d,
+  0x54, 0x52, 0x9c, 0xdf, 0x47, 0x45, 0x6f, 0x1b, 0x55, 0x12, 0x63, 0x6a, 0x0c, 0x5b, 0x28, 0xe0,
+  0x40, 0x26, 0x69, 0xaf, 0x26, 0xd1, 0x46, 0x6d, 0x79, 0xe7, 0x17, 0x56, 0x95, 0xa8, 0x56, 0x6c,
+  0x05, 0x2c, 0xa8, 0xc5, 0xeb, 0xf5, 0x0e, 0xd9, 0xca, 0xa5, 0x01, 0xf1, 0x0c, 0xca, 0xb2, 0x04,
+  0xb5, 0x16, 0x21, 0xb2, 0xfb, 0x71, 0x87, 0x37, 0x5b, 0x6c, 0xd3, 0x9c, 0xfa, 0x05, 0x38, 0x1b,
+  0x64, 0x50, 0x94, 0x7b, 0xc3, 0x87, 0x08, 0x7e, 0x41, 0x4e, 0x0c, 0x27, 0xda, 0x31, 0xae, 0xe1,
+  0x40, 0x26, 0xe9, 0xd0, 0x08, 0x27, 0x90, 0xfe, 0x01, 0x4e, 0x4a, 0xb2, 0xc6, 0x37, 0x9d, 0x0b,
+  0xd9, 0x1c, 0xfc, 0x01, 0xd1, 0x4d, 0x10, 0x7e, 0x46, 0x70, 0x13, 0xd2, 0xbb, 0x62, 0x9b, 0xa0,
+  0x46, 0x1d, 0x6e, 0x3f, 0x23, 0xb2, 0xc9, 0xb2, 0xf1, 0x0e, 0x6c, 0xaa, 0xd0, 0xad, 0x71, 0x4d,
+  0x27, 0x43, 0x36, 0x0f, 0x9f, 0x13, 0xd5, 0x04, 0x83, 0x57, 0x50, 0x93, 0xf2, 0xcc, 0x98, 0xd6,
+  0x30, 0x20, 0x83, 0xf1, 0x73, 0x22, 0x9a, 0x40, 0xfb, 0x05, 0x34, 0x29, 0xa8, 0x15, 0xcf, 0x1a,
+  0x0e, 0x64, 0x92, 0x0e, 0x8c, 0x66, 0x0d, 0xd0, 0x33, 0x98, 0x01, 0x49, 0x96, 0x58, 0x66, 0xd2,
+  0x21, 0xab, 0x93, 0x61, 0x91, 0x0c, 0x7a, 0xf4, 0x0b, 0x64, 0x16, 0x84, 0x6f, 0x1c, 0x63, 0x52,
+  0x58, 0x6d, 0x3b, 0x54, 0xfd, 0x4b, 0xbc, 0xa9, 0x29, 0xaf, 0xca, 0x87, 0x4a, 0xff, 0xbe, 0x63,
+  0x70, 0x20, 0x93, 0xd4, 0x51, 0x44, 0x72, 0xc9, 0xf8, 0x56, 0x50, 0x8e, 0xb4, 0xcd, 0x41, 0x87,
+  0x8a, 0x4f, 0xcb, 0x5d, 0xd0, 0x57, 0xbe, 0xce, 0x6d, 0x0d, 0x42, 0x8d, 0xa8, 0x3c, 0xea, 0xfd,
+  0x50, 0x6d, 0xd2, 0x01, 0x1c, 0xc8, 0x24, 0x75, 0xd5, 0x1a, 0xfa, 0xa8, 0x35, 0xd5, 0xd5, 0x20,
+  0xcf, 0xc4, 0x07, 0x1a, 0x1c, 0x7b, 0x6b, 0x8a, 0x14, 0xc2, 0x22, 0xac, 0x66, 0x43, 0x56, 0x1f,
+  0xae, 0x5c, 0x53, 0xcf, 0xb7, 0x24, 0xb7, 0x8a, 0xec, 0x8e, 0x4b, 0x9a, 0xba, 0x26, 0x20, 0x69,
+  0x78, 0xa4, 0xd3, 0x39, 0x84, 0xd0, 0xd6, 0x1e, 0xc6, 0x71, 0x29, 0x1b, 0x44, 0x4b, 0xc6, 0x3a,
+  0xb9, 0xcb, 0xc2, 0xd4, 0x5b, 0x4a, 0xc5, 0xcd, 0x2d, 0x72, 0x04, 0x0f, 0x6a, 0x53, 0xbb, 0x62,
+  0x11, 0x7f, 0x48, 0x2b, 0x15, 0xad, 0x5b, 0x77, 0xe4, 0x1e, 0x6e, 0x2c, 0xba, 0xcd, 0xbd, 0x26,
+  0x73, 0x98, 0x21, 0xa8, 0xe0, 0x35, 0xcc, 0x3d, 0x85, 0xc3, 0xfb, 0x7f, 0xf1, 0x52, 0x9f, 0xc4,
+  0x72, 0xe3, 0x51, 0xcc, 0xb7, 0x44, 0x8e, 0x1a, 0xb2, 0xc9, 0xaf, 0x87, 0x24, 0xfa, 0x38, 0x42,
+  0x01, 0xb1, 0xb7, 0x09, 0xfe, 0xd2, 0xcf, 0x6d, 0x58, 0x8b, 0x10, 0x33, 0x52, 0xf5, 0x7c, 0x83,
+  0x85, 0xae, 0x5e, 0x30, 0xd4, 0x49, 0xa8, 0x56, 0xd3, 0xec, 0xc3, 0x2c, 0xbc, 0xe3, 0x99, 0xdf,
+  0xc7, 0x2b, 0x16, 0x6b, 0x76, 0x92, 0xf2, 0xb5, 0x92, 0xfe, 0x8c, 0x62, 0x6b, 0x49, 0x0f, 0xa7,
+  0x30, 0x4a, 0xb2, 0xbb, 0x3e, 0x36, 0xb5, 0x13, 0xae, 0x93, 0x4d, 0x6e, 0x79, 0xcb, 0xc2, 0x87,
+  0x5e, 0xba, 0xfb, 0xbc, 0x24, 0xd1, 0x81, 0x6d, 0x8b, 0xeb, 0x66, 0x6c, 0xec, 0xba, 0x09, 0xa3,
+  0x43, 0x45, 0xf2, 0x7d, 0xf2, 0x8f, 0x50, 0x7c, 0xc8, 0xed, 0x24, 0x35, 0x6c, 0xbb, 0x89, 0xd9,
+  0xd6, 0xd1, 0x09, 0x9b, 0x8c, 0xe2, 0xdf, 0x3c, 0x3b, 0x79, 0x99, 0xe9, 0xb6, 0x36, 0x85, 0x2b,
+  0x01, 0x79, 0x05, 0x5b, 0x13, 0x5c, 0xcc, 0xba, 0x37, 0xd5, 0x31, 0xaf, 0x94, 0x5a, 0x54, 0xda,
+  0xc9, 0x4c, 0x35, 0xcc, 0x06, 0x8e, 0x00, 0x95, 0xd9, 0xbf, 0x81, 0xaa, 0x3c, 0x1b, 0xb5, 0x5d,
+  0xcf, 0x87, 0xb8, 0x9e, 0xb7, 0x5c, 0xcf, 0x81, 0xeb, 0x79, 0x67, 0x3b, 0x9a, 0x5b, 0x9c, 0x9f,
+  0x0e, 0x71, 0x7e, 0xda, 0x72, 0x7e, 0x0a, 0x9c, 0x9f, 0x76, 0x3a, 0x3f, 0xb5, 0x38, 0x7f, 0x31,
+  0xc4, 0xf9, 0x8b, 0x96, 0xf3, 0x17, 0xc0, 0xf9, 0x8b, 0x4e, 0xe7, 0x2f, 0x1c, 0xcb, 0xac, 0xfc,
+  0xfc, 0x7b, 0xac, 0xb3, 0x32, 0x16, 0x59, 0x69, 0x35, 0x80, 0x8e, 0x65, 0x48, 0x99, 0x67, 0x77,
+  0xdf, 0xc2, 0xe9, 0x4c, 0x15, 0x88, 0x14, 0xa7, 0x1c, 0x92, 0x08, 0xc3, 0xc0, 0x6d, 0xb9, 0x55,
+  0xab, 0x08, 0xb5, 0xd4, 0x2c, 0xe3, 0x84, 0x0c, 0x4b, 0x0b, 0x5f, 0x96, 0xac, 0xa7, 0x84, 0x91,
+  0x20, 0xc8, 0xe8, 0x9f, 0x0a, 0xc1, 0xd6, 0x9f, 0x06, 0xbe, 0x5f, 0xc1, 0x9a, 0x82, 0xb3, 0xbc,
+  0x38, 0x0e, 0x2c, 0x0d, 0x8a, 0x30, 0xcb, 0x82, 0xde, 0x42, 0x90, 0x71, 0x40, 0x39, 0x70, 0x36,
+  0x8f, 0x52, 0xa0, 0x76, 0xf6, 0x14, 0x2c, 0x68, 0x84, 0x4d, 0x1e, 0x06, 0x56, 0xa9, 0x50, 0x80,
+  0x8c, 0x74, 0x48, 0x2a, 0x64, 0x50, 0xfb, 0xa7, 0xa6, 0xa6, 0xed, 0x4f, 0x90, 0x34, 0xb5, 0xa7,
+  0xe9, 0x1c, 0xb3, 0xdd, 0x9e, 0xc3, 0x92, 0x14, 0x73, 0x4c, 0x6b, 0xa1, 0x2b, 0xbb, 0x89, 0x74,
+  0x5e, 0xff, 0xf4, 0x28, 0xce, 0xfe, 0xe4, 0x08, 0x4b, 0x23, 0x35, 0xac, 0x83, 0x5e, 0xc4, 0xb1,
+  0x5f, 0x3a, 0xf8, 0xea, 0x6a, 0x3a, 0x94, 0x83, 0xbb, 0x86, 0x28, 0x18, 0x29, 0x96, 0x7e, 0xd5,
+  0x7c, 0x3c, 0xc0, 0x19, 0xdc, 0x7a, 0x95, 0x8d, 0x45, 0xe9, 0x99, 0xdc, 0x64, 0x3b, 0x40, 0xae,
+  0xda, 0x97, 0xab, 0xed, 0x74, 0x92, 0xf7, 0x90, 0x46, 0xea, 0xa9, 0xbe, 0x21, 0xec, 0x49, 0x82,
+  0x32, 0xb4, 0xa4, 0x83, 0x6d, 0x31, 0xa9, 0x06, 0x24, 0x82, 0xed, 0x36, 0xa9, 0xcc, 0xad, 0x87,
+  0x15, 0x6a, 0xb8, 0x3c, 0xb5, 0x4b, 0x9e, 0x1e, 0xe1, 0xdc, 0xca, 0xa2, 0x5a, 0xad, 0x2c, 0x1e,
+  0x20, 0xbc, 0x6b, 0xdf, 0x1f, 0xd2, 0x48, 0x7d, 0x6a, 0xbc, 0x5a, 0x39, 0x8d, 0x1f, 0xe8, 0xe8,
+  0xa7, 0xbb, 0xca, 0x6b, 0xa6, 0x96, 0xb4, 0xac, 0x0f, 0x3b, 0xf6, 0xbf, 0x21, 0x85, 0x50, 0x49,
+  0x08, 0x4c, 0x8b, 0xa2, 0x41, 0x1a, 0x69, 0x7f, 0x5a, 0x1a, 0x2e, 0x77, 0x22, 0x94, 0x8d, 0x45,
+  0xfd, 0x39, 0x2e, 0x70, 0x16, 0xe3, 0x2c, 0x4a, 0x06, 0x55, 0xa3, 0x18, 0xc0, 0xf4, 0xcd, 0xb4,
+  0xcd, 0x7d, 0xd4, 0x72, 0xd0, 0x9f, 0x1a, 0x9d, 0xd7, 0x9d, 0x22, 0x68, 0x67, 0xa4, 0x4a, 0x0c,
+  0xea, 0xe9, 0x6b, 0x95, 0x5f, 0x72, 0xe4, 0x29, 0x01, 0xad, 0xbd, 0xfe, 0x94, 0x00, 0x35, 0x5c,
+  0xfd, 0xca, 0xe1, 0x99, 0x01, 0x6e, 0xdd, 0x8d, 0x95, 0x5d, 0x35, 0x3f, 0x37, 0x60, 0x98, 0x70,
+  0xcb, 0x51, 0x03, 0x82, 0x06, 0x69, 0xa4, 0xfe, 0x29, 0x90, 0x84, 0xfd, 0x89, 0xe0, 0x86, 0xd6,
+  0x74, 0xa8, 0x40, 0x18, 0x0f, 0x4a, 0x8a, 0xe3, 0xe0, 0x83, 0x9a, 0x0c, 0x99, 0xec, 0xde, 0x69,
+  0x02, 0xcc, 0xbd, 0xc9, 0xaa, 0x6d, 0xad, 0x29, 0x1b, 0x10, 0x6f, 0x65, 0xaa, 0xb4, 0x88, 0x0b,
+  0x48, 0x10, 0x64, 0xf4, 0x4e, 0x49, 0x6f, 0xdc, 0x85, 0x76, 0x46, 0x0a, 0xc4, 0x0b, 0xea, 0x46,
+  0xac, 0xfd, 0xf0, 0x48, 0x80, 0x7e, 0xfe, 0x4b, 0x83, 0x46, 0x80, 0xc9, 0x23, 0x40, 0xa9, 0x77,
+  0x67, 0x77, 0x78, 0x12, 0x2f, 0xce, 0xba, 0x58, 0xb9, 0xe0, 0xf4, 0xb8, 0x7e, 0x4c, 0x48, 0xf7,
+  0x71, 0x35, 0x8d, 0x60, 0x85, 0x99, 0x54, 0x1c, 0x54, 0xcf, 0x15, 0x6a, 0x54, 0xc8, 0xa0, 0xee,
+  0x4f, 0x81, 0xb2, 0xdf, 0x2a, 0x5a, 0x77, 0x52, 0x0c, 0x53, 0x23, 0x4d, 0x25, 0x5b, 0xa1, 0x78,
+  0x96, 0xd2, 0x97, 0x25, 0xbf, 0xf4, 0x70, 0xfb, 0x49, 0x94, 0xf2, 0x39, 0x1c, 0xb9, 0x07, 0xb1,
+  0xa6, 0x40, 0x80, 0xae, 0x3f, 0x0d, 0xdc, 0x76, 0x2b, 0xa9, 0xdc, 0xfa, 0x81, 0x99, 0xa1, 0x3d,
+  0xce, 0x0f, 0xbb, 0x14, 0x0f, 0x10, 0x2f, 0x00, 0xba, 0x7a, 0x40, 0x82, 0x20, 0xa3, 0x47, 0xc7,
+  0xc0, 0x8d, 0xfb, 0x13, 0x00, 0xed, 0xcc, 0x06, 0x1c, 0xee, 0xc4, 0x32, 0x37, 0xcf, 0xe6, 0x1b,
+  0xee, 0x26, 0x3b, 0x6e, 0x5f, 0x37, 0x5e, 0x45, 0x80, 0x1a, 0x2e, 0x8f, 0x86, 0x1b, 0xee, 0xb6,
+  0x8a, 0xa7, 0xa3, 0xd9, 0xd6, 0x56, 0x86, 0xea, 0xbb, 0x43, 0xb2, 0x09, 0x77, 0x7e, 0x92, 0xa9,
+  0x2d, 0xdc, 0x64, 0x20, 0xa0, 0x48, 0x52, 0xf4, 0x2b, 0xe5, 0x0b, 0x2f, 0x19, 0xdc, 0x2d, 0x53,
+  0x9a, 0x98, 0x03, 0x09, 0xb6, 0x70, 0xd6, 0x3f, 0xae, 0x70, 0x73, 0x6d, 0xa1, 0xae, 0x88, 0x2a,
+  0xf5, 0x4f, 0x8f, 0x31, 0xa8, 0xa0, 0xe8, 0x18, 0x7e, 0x8a, 0xb5, 0xbc, 0x7a, 0xfc, 0x13, 0x93,
+  0x53, 0x03, 0x02, 0x60, 0x33, 0x9b, 0x25, 0x66, 0x88, 0x6b, 0x3c, 0x82, 0x64, 0x1e, 0x31, 0xb0,
+  0x9e, 0x41, 0x73, 0x07, 0x41, 0x61, 0x62, 0xb6, 0xba, 0x90, 0x84, 0x7d, 0x1b, 0x20, 0x41, 0x93,
+  0x63, 0xb3, 0x75, 0x70, 0x07, 0xa4, 0x82, 0xa3, 0x9a, 0xc8, 0x63, 0xf2, 0xce, 0x22, 0xe1, 0x1a,
+  0x97, 0x55, 0x52, 0x49, 0x8c, 0xaf, 0x90, 0xa2, 0x06, 0x41, 0x39, 0x0d, 0x15, 0x32, 0xa8, 0xbb,
+  0xa4, 0xe9, 0x5c, 0xf2, 0xf5, 0x19, 0x97, 0xfb, 0x30, 0xa3, 0xb7, 0xd6, 0x42, 0xb7, 0xe7, 0x1b,
+  0xb4, 0x42, 0x99, 0xa5, 0x6b, 0xd2, 0xa1, 0x96, 0x03, 0x8f, 0x17, 0x0b, 0x85, 0xf0, 0x29, 0xf1,
+  0x96, 0xb1, 0x91, 0xf1, 0xe2, 0x0b, 0x5b, 0xef, 0x27, 0x32, 0x63, 0x1d, 0xa8, 0xf1, 0x99, 0x1a,
+  0x90, 0x20, 0xc8, 0x38, 0x7c, 0x25, 0x22, 0x14, 0xb5, 0x0e, 0x6f, 0x3d, 0x35, 0xc9, 0x0f, 0x2e,
+  0xea, 0xa3, 0x34, 0xc5, 0xe9, 0xca, 0x18, 0x13, 0x02, 0xac, 0x8e, 0x4a, 0x20, 0xe5, 0x28, 0x3c,
+  0xd4, 0xe2, 0xd5, 0x3c, 0xd4, 0x57, 0x67, 0xd0, 0x36, 0x1a, 0x34, 0x02, 0x4c, 0xfd, 0x65, 0x2c,
+  0xa5, 0x08, 0x2a, 0xad, 0x74, 0x47, 0xba, 0xb0, 0x95, 0x58, 0x88, 0x19, 0xfb, 0x8a, 0x93, 0x0b,
+  0x37, 0x63, 0x5d, 0xa0, 0x62, 0x41, 0x06, 0x6b, 0x77, 0x46, 0x41, 0x2e, 0xa8, 0x69, 0xf9, 0x69,
+  0x98, 0x26, 0xfc, 0xc9, 0xa6, 0x49, 0xb1, 0x20, 0x83, 0xb5, 0x5b, 0x13, 0xe4, 0x92, 0x7b, 0xf2,
+  0xf9, 0xea, 0xeb, 0x9e, 0x75, 0xf3, 0x3b, 0x92, 0x35, 0x6a, 0xd4, 0xb2, 0x69, 0xbe, 0x21, 0x5f,
+  0xa1, 0x51, 0x43, 0xd4, 0xb7, 0xca, 0x5b, 0x7e, 0x3b, 0xdb, 0x0f, 0xf3, 0xdb, 0x2c, 0xd7, 0xe6,
+  0x9f, 0x49, 0xf6, 0xb5, 0xdf, 0xfa, 0x67, 0xdf, 0x32, 0x6f, 0x35, 0x02, 0xe1, 0xcb, 0x6b, 0x07,
+  0x37, 0x69, 0x89, 0x6b, 0xc6, 0x21, 0x0d, 0x0d, 0xd2, 0x48, 0x07, 0xaf, 0xef, 0xd5, 0x74, 0x9d,
+  0x87, 0xd9, 0x1d, 0xdf, 0x11, 0xef, 0xdf, 0xae, 0x25, 0x92, 0x06, 0x7c, 0x06, 0x35, 0x04, 0x0a,
+  0x3e, 0xa4, 0xd3, 0xbb, 0x3e, 0xc5, 0x49, 0x65, 0x82, 0x28, 0x87, 0xdf, 0xe6, 0xe5, 0xa3, 0x1f,
+  0xc3, 0x32, 0x4b, 0xc4, 0xe9, 0xb9, 0x9d, 0x35, 0x57, 0x49, 0x7a, 0x14, 0xf6, 0x86, 0x26, 0xc9,
+  0x82, 0x0c, 0x56, 0xeb, 0xd7, 0x24, 0xa5, 0x09, 0x30, 0x69, 0x8a, 0xe4, 0xe1, 0x89, 0x95, 0xb7,
+  0x24, 0x78, 0x1a, 0x26, 0xd0, 0xa4, 0x78, 0x90, 0x49, 0xdc, 0x93, 0x57, 0xed, 0xc3, 0x35, 0xe5,
+  0x93, 0xef, 0x0e, 0x89, 0xb7, 0x26, 0xb0, 0x95, 0xb4, 0x41, 0x23, 0xc0, 0xd4, 0x23, 0x42, 0xe2,
+  0xf5, 0xa2, 0x4a, 0x6e, 0xfd, 0x05, 0xa8, 0x95, 0xfb, 0xb0, 0x90, 0xe8, 0x2d, 0x04, 0xc9, 0x7a,
+  0x34, 0x28, 0x0a, 0x4d, 0xc4, 0xaa, 0x2c, 0xd9, 0xa9, 0x24, 0x55, 0xb2, 0x4b, 0xb1, 0xb7, 0x98,
+  0x04, 0x80, 0x0c, 0x51, 0x90, 0x0f, 0xd9, 0x9c, 0xf8, 0xbc, 0x0a, 0x08, 0xbd, 0xba, 0x17, 0x7b,
+  0x1f, 0x22, 0x6d, 0x3d, 0x82, 0x94, 0xd2, 0x5e, 0x37, 0x6a, 0x20, 0x9a, 0x47, 0xa9, 0xe6, 0x77,
+  0x4f, 0x3e, 0x36, 0xaf, 0x3b, 0x52, 0x43, 0x9e, 0x13, 0x5c, 0x5e, 0xd0, 0x01, 0x40, 0x7f, 0x06,
+  0x72, 0xd3, 0xc9, 0x5e, 0x0e, 0x16, 0xb8, 0x84, 0x1a, 0x8d, 0x00, 0x93, 0x43, 0x02, 0x03, 0x1a,
+  0x7b, 0x87, 0x23, 0x66, 0xf4, 0x89, 0x5c, 0xe0, 0xec, 0xd0, 0xb3, 0x44, 0x88, 0x0f, 0xec, 0xe8,
+  0x9d, 0x03, 0x58, 0x1d, 0xa4, 0xa0, 0xa8, 0x59, 0x31, 0x41, 0xf0, 0x9e, 0xb5, 0x55, 0xf0, 0xd0,
+  0xb6, 0x14, 0x03, 0xf2, 0x4d, 0x18, 0xa6, 0x8e, 0xfb, 0x0c, 0xcf, 0xf7, 0x24, 0xaa, 0x5f, 0x96,
+  0xe5, 0x20, 0xe4, 0xd3, 0x16, 0x7e, 0xf5, 0x13, 0x96, 0xb3, 0x1a, 0x33, 0x73, 0x60, 0xe0, 0x77,
+  0x36, 0x61, 0x39, 0xaf, 0x31, 0x73, 0x07, 0xc6, 0xf8, 0xac, 0x25, 0x8c, 0x4f, 0x6b, 0xd8, 0xa9,
+  0x03, 0xd6, 0x7c, 0x3a, 0x7a, 0x72, 0x1e, 0xac, 0x0c, 0x4f, 0x60, 0xe6, 0xc7, 0x32, 0x27, 0x74,
+  0xc8, 0x20, 0x4f, 0x90, 0xbe, 0x3d, 0xa4, 0xa9, 0x38, 0xea, 0xa7, 0x39, 0xb9, 0x59, 0x9d, 0xbf,
+  0x8c, 0xcf, 0x9a, 0xbc, 0x1d, 0x37, 0x39, 0xff, 0xff, 0x92, 0xfc, 0xaf, 0x94, 0x24, 0x09, 0xf2,
+  0x5d, 0x85, 0xcb, 0x07, 0xde, 0x87, 0x67, 0xf8, 0x31, 0xb8, 0x38, 0x10, 0x5e, 0x86, 0x57, 0xf2,
+  0xf6, 0x78, 0xbc, 0x97, 0x77, 0x2a, 0x71, 0xaa, 0xd4, 0x49, 0x7d, 0xdd, 0x9c, 0x3a, 0xa5, 0x6e,
+  0x19, 0x16, 0xec, 0x30, 0x75, 0x1c, 0x5f, 0xe6, 0x31, 0x58, 0x94, 0x34, 0xce, 0xf8, 0x3a, 0xb7,
+  0x7a, 0xa3, 0x20, 0xbb, 0x6c, 0x8e, 0x5f, 0x67, 0x3b, 0xa2, 0xf4, 0x3b, 0xbc, 0x44, 0xc2, 0x24,
+  0xab, 0xcc, 0xb2, 0x6e, 0x17, 0x2d, 0x07, 0xfe, 0x8f, 0x97, 0xe9, 0x93, 0x5c, 0x45, 0xc3, 0xfe,
+  0x53, 0x25, 0x3b, 0x95, 0x3f, 0xc6, 0x75, 0x2b, 0x62, 0x47, 0xc6, 0x3f, 0x0b, 0x7e, 0x0b, 0xa8,
+  0xbb, 0x34, 0x66, 0xb9, 0xfc, 0x92, 0x9f, 0xd8, 0xfe, 0x2c, 0x60, 0x5f, 0x7d, 0x4a, 0x8c, 0xc5,
+  0xa5, 0x3c, 0x18, 0xac, 0x39, 0xf4, 0x1e, 0x93, 0x43, 0xf1, 0x47, 0x9f, 0xe0, 0x4f, 0xab, 0xc8,
+  0xf2, 0x81, 0x9d, 0xbb, 0xce, 0x5f, 0xd5, 0x69, 0x7d, 0x1b, 0x89, 0xf9, 0xba, 0x67, 0x81, 0x38,
+  0x72, 0x7f, 0x8c, 0xe0, 0x0a, 0x36, 0x5a, 0x43, 0xe5, 0x5f, 0x1e, 0x30, 0x4f, 0xf6, 0xaf, 0x4f,
+  0xab, 0xe6, 0xcf, 0xff, 0xd4, 0x3e, 0xe6, 0x5f, 0xff, 0xc3, 0x05, 0xd2, 0xf0, 0x33, 0xfe, 0x90,
+  0x82, 0x38, 0x34, 0x5f, 0xfb, 0x03, 0x00, 0x92, 0x4c, 0x16, 0xdb, 0x63, 0x92, 0xc5, 0xf9, 0xe3,
+  0x94, 0xe2, 0x59, 0x6d, 0x6e, 0xae, 0xa6, 0xe2, 0x88, 0x6e, 0x1c, 0xcb, 0xa1, 0xda, 0x2a, 0x66,
+  0xb2, 0xc0, 0x73, 0xf6, 0xa7, 0x16, 0xd8, 0xe1, 0x60, 0xd5, 0xdb, 0xbc, 0x94, 0x36, 0xe3, 0x4e,
+  0x38, 0x2f, 0xf0, 0xa6, 0xc8, 0x9b, 0x72, 0x68, 0x67, 0xea, 0xf9, 0xd5, 0x85, 0xac, 0x37, 0xef,
+  0xa9, 0x17, 0xfa, 0x42, 0x65, 0xe6, 0xaf, 0x48, 0x96, 0xfe, 0x07, 0x2f, 0x5e, 0x9d, 0xd8, 0x8b,
+  0xfc, 0xd5, 0x89, 0x3d, 0x78, 0x73, 0x1d, 0xff, 0x01, 0xae, 0xd6, 0x4a, 0xde, 0x43, 0x63, 0x00,
+  0x00,
+};
+
+// /app.js <- Web_JavaScript_UI.h, Web_JavaScript_Actions.h, Web_JavaScript_Core.h
+static const uint8_t ASSET_APP_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0x5d, 0x73, 0x1b, 0x39,
+  0x92, 0xe0, 0x3b, 0x7f, 0x05, 0xec, 0xd9, 0x58, 0x92, 0x61, 0x92, 0xd6, 0x47, 0xbb, 0x67, 0x46,
+  0x6a, 0xd9, 0x21, 0x4b, 0x74, 0xb7, 0xb6, 0xf5, 0xb5, 0x92, 0xdc, 0x3d, 0x1d, 0x5e, 0x47, 0xbb,
+  0x44, 0x82, 0x62, 0x8d, 0x8b, 0x2c, 0x4e, 0x55, 0xd1, 0xb2, 0xd6, 0xab, 0x88, 0x7b, 0xba, 0xd7,
+  0x7b, 0xb8, 0x88, 0xbd, 0x88, 0x8b, 0x7b, 0xb8, 0xb8, 0x1f, 0xb1, 0x71, 0x11, 0xb7, 0x6f, 0xf7,
+  0x4f, 0xe6, 0x0f, 0xdc, 0x5f, 0xb8, 0xfc, 0x00, 0x50, 0x00, 0xea, 0x83, 0x45, 0xc9, 0x33, 0xb7,
+  0x1b, 0x71, 0x3b, 0x3b, 0x63, 0x11, 0x05, 0x24, 0x12, 0x89, 0xcc, 0x44, 0x22, 0x91, 0x48, 0x8c,
+  0xe2, 0x79, 0x9a, 0x89, 0x9f, 0x8e, 0x2e, 0xae, 0xde, 0xee, 0x1f, 0xff, 0x7a, 0x72, 0x74, 0xfa,
+  0xeb, 0xd1, 0xd5, 0xf0, 0xe4, 0x52, 0xec, 0x89, 0x6f, 0x37, 0x76, 0x85, 0x10, 0xcf, 0x9f, 0x8b,
+  0x74, 0x1a, 0x27, 0x99, 0x4c, 0x44, 0x14, 0xa6, 0x59, 0x2a, 0x82, 0x44, 0x8a, 0x44, 0xce, 0xc7,
+  0x32, 0x91, 0x63, 0x71, 0x3b, 0x8d, 0x23, 0xd9, 0x1a, 0x39, 0x30, 0xce, 0x7e, 0x1a, 0x5e, 0x5c,
+  0x1e, 0xec, 0x9f, 0x22, 0x08, 0x84, 0x40, 0x30, 0xc2, 0x4c, 0xce, 0x52, 0xf1, 0x51, 0x2e, 0x32,
+  0x71, 0x2d, 0xef, 0xe2, 0xf9, 0x58, 0xc8, 0x60, 0x34, 0x15, 0x72, 0x7c, 0x23, 0x45, 0x3c, 0x11,
+  0xd9, 0x54, 0x8a, 0x4f, 0xa1, 0xbc, 0x5d, 0x40, 0x4f, 0x1e, 0xb8, 0xe1, 0xe5, 0xd5, 0xd1, 0xc9,
+  0xfe, 0xd5, 0x10, 0xc0, 0x6d, 0x7e, 0xa3, 0x51, 0x5a, 0x7c, 0x16, 0x0b, 0xc0, 0x08, 0xa1, 0x8a,
+  0xe5, 0x3c, 0x0b, 0x23, 0xf8, 0x53, 0x4c, 0x83, 0x14, 0x80, 0xcb, 0xb9, 0x98, 0xc9, 0x20, 0x5d,
+  0x02, 0x7a, 0x0a, 0x12, 0xe2, 0xfd, 0x13, 0x00, 0x4f, 0x01, 0xc4, 0x5c, 0xde, 0x8a, 0x93, 0x60,
+  0xd1, 0xe9, 0xee, 0x2a, 0xc4, 0xa0, 0x4a, 0x16, 0x84, 0x73, 0x00, 0xd6, 0x7f, 0x29, 0xde, 0x7d,
+  0xf9, 0x28, 0xef, 0x7a, 0x6a, 0x78, 0xf7, 0xef, 0x45, 0x38, 0x17, 0xe3, 0x30, 0x5d, 0x44, 0xc1,
+  0x9d, 0x88, 0x13, 0x28, 0xb2, 0x00, 0x9e, 0xc6, 0x63, 0xb9, 0x1a, 0x20, 0x7e, 0x01, 0x90, 0xf8,
+  0xe7, 0x97, 0x69, 0x36, 0x8b, 0x7a, 0x62, 0x0e, 0xed, 0xee, 0xbb, 0x0a, 0x10, 0xe2, 0xff, 0x83,
+  0x0c, 0x6f, 0xa6, 0x99, 0x0f, 0x0a, 0x00, 0xa9, 0x76, 0x7a, 0x30, 0x30, 0xe6, 0x9e, 0x98, 0x05,
+  0xc9, 0x0d, 0x20, 0x15, 0xce, 0x47, 0xd1, 0x72, 0x0c, 0x03, 0x9c, 0x2c, 0xe7, 0xa3, 0x2c, 0x8c,
+  0xe7, 0x0a, 0xe5, 0x63, 0x40, 0xac, 0x63, 0x10, 0xe8, 0x31, 0xd5, 0xbb, 0xe2, 0x4b, 0xcb, 0x90,
+  0x60, 0x90, 0xca, 0x92, 0x1a, 0xbb, 0x2d, 0x6e, 0xff, 0x73, 0x38, 0x1f, 0xc7, 0xb7, 0xf9, 0x77,
+  0xf8, 0x70, 0xef, 0xf7, 0x51, 0xa8, 0x03, 0xe0, 0xf3, 0xd1, 0xe0, 0x38, 0xf2, 0xce, 0x6e, 0xec,
+  0xce, 0xba, 0xe2, 0x9f, 0xfe, 0x49, 0xbc, 0x7b, 0xbf, 0xdb, 0x0a, 0x27, 0xa2, 0x43, 0x75, 0x07,
+  0x91, 0x9c, 0xdf, 0x64, 0x53, 0xf1, 0x5d, 0x91, 0xff, 0x10, 0xea, 0x22, 0xc8, 0x46, 0xd3, 0xf2,
+  0x21, 0x21, 0xc2, 0xd9, 0x32, 0x99, 0x23, 0x7e, 0xdc, 0x79, 0x3a, 0x4a, 0xe2, 0x28, 0x02, 0xaa,
+  0xef, 0xe5, 0x33, 0x30, 0x58, 0x00, 0xb3, 0xce, 0xb3, 0x61, 0x24, 0x67, 0xf0, 0xcf, 0xae, 0xaa,
+  0x89, 0x7c, 0x76, 0x15, 0x2f, 0xa0, 0xa2, 0x6e, 0x83, 0x78, 0xbe, 0x8e, 0x97, 0xf3, 0x71, 0x38,
+  0xbf, 0x39, 0x88, 0x42, 0xa8, 0x7b, 0x21, 0x47, 0x59, 0xa7, 0x3b, 0xc8, 0xa0, 0x5a, 0xdf, 0x82,
+  0x57, 0x53, 0xcf, 0x86, 0xfe, 0x3a, 0xce, 0xb2, 0x78, 0x06, 0x1d, 0xe8, 0xae, 0x9e, 0xe5, 0x5d,
+  0x8d, 0xa8, 0x1d, 0x4f, 0xba, 0x6e, 0x33, 0xa5, 0x5f, 0x50, 0x9f, 0xf8, 0x79, 0xef, 0xa5, 0xcd,
+  0x17, 0x44, 0x43, 0xfc, 0x3d, 0x00, 0x7e, 0x20, 0x12, 0xfa, 0x82, 0xb1, 0xdb, 0x8a, 0x24, 0x8c,
+  0x3f, 0x0b, 0x12, 0x04, 0xb1, 0xc1, 0x3f, 0xe3, 0xc9, 0x04, 0x66, 0x9a, 0x7f, 0xdf, 0x4e, 0xc3,
+  0x48, 0x8a, 0x0e, 0xd7, 0xf8, 0x4e, 0x38, 0xa4, 0xff, 0xdb, 0xbf, 0xd5, 0x55, 0x9f, 0x29, 0x34,
+  0x78, 0x6a, 0xde, 0x51, 0xed, 0xf7, 0x5d, 0xf1, 0x9d, 0x19, 0x05, 0x4e, 0x89, 0xae, 0xbb, 0x57,
+  0x52, 0xf9, 0xd9, 0xb3, 0xf7, 0xc4, 0x2f, 0xd8, 0x3d, 0x70, 0x0a, 0xd2, 0x17, 0x8b, 0x4d, 0xff,
+  0x58, 0x56, 0xd9, 0xfb, 0x77, 0x16, 0xe1, 0x6a, 0x3a, 0x02, 0x18, 0xba, 0x1b, 0x3d, 0xe0, 0x93,
+  0x20, 0x9b, 0x0e, 0x66, 0xc1, 0xe7, 0xce, 0x46, 0x4f, 0x11, 0xa1, 0x5f, 0x50, 0x45, 0xd0, 0x80,
+  0x31, 0xe2, 0xca, 0xe1, 0xdc, 0xe1, 0xbf, 0x1e, 0xa1, 0xfb, 0xac, 0xac, 0x15, 0x8e, 0x25, 0xb8,
+  0x8e, 0x3f, 0xc9, 0x9c, 0xb2, 0xd7, 0x32, 0x8a, 0x6f, 0xf9, 0x27, 0x03, 0x99, 0xc4, 0xc9, 0x10,
+  0x74, 0x59, 0x87, 0x60, 0x02, 0x83, 0x76, 0x71, 0x06, 0xbf, 0x30, 0x97, 0xc3, 0xb8, 0x08, 0xa7,
+  0xae, 0x82, 0xe2, 0x8e, 0x07, 0xd1, 0x8a, 0x52, 0x29, 0xb8, 0xea, 0xcb, 0x3d, 0xc4, 0xa3, 0xab,
+  0x3a, 0x28, 0xd4, 0xbc, 0xef, 0x6a, 0x76, 0x49, 0x17, 0xc1, 0x88, 0x18, 0xbd, 0x43, 0xda, 0x6a,
+  0xf1, 0x99, 0x7a, 0xec, 0x7c, 0x11, 0x96, 0xf2, 0xda, 0x11, 0x1d, 0x2a, 0x6d, 0x7f, 0x37, 0x0e,
+  0x3f, 0x89, 0x51, 0x14, 0xa4, 0xe9, 0xde, 0x53, 0x14, 0xcc, 0x3e, 0xb7, 0x7e, 0x0a, 0x78, 0xdd,
+  0x45, 0x72, 0xef, 0x29, 0x77, 0xb2, 0xd3, 0x86, 0xf1, 0x83, 0x52, 0x7d, 0x26, 0xda, 0x8b, 0xcf,
+  0x4f, 0x5f, 0x7e, 0xf7, 0x1c, 0x5a, 0xbd, 0x6c, 0x8b, 0xbc, 0xcf, 0xb9, 0x52, 0x77, 0xa5, 0x32,
+  0xf9, 0x8e, 0x61, 0x76, 0xda, 0xfc, 0x6f, 0x1f, 0xc4, 0xa1, 0xdd, 0xe3, 0x11, 0x77, 0x7b, 0x62,
+  0x30, 0x18, 0x30, 0xa1, 0xd2, 0x28, 0x1c, 0x49, 0x66, 0x43, 0x22, 0x39, 0x7c, 0xf3, 0x1a, 0x5e,
+  0xd3, 0xfc, 0x43, 0x5b, 0xa2, 0x41, 0x17, 0x27, 0x1a, 0xa8, 0x2b, 0x3a, 0x48, 0xf7, 0x10, 0x17,
+  0x80, 0x5d, 0x81, 0x24, 0x25, 0x64, 0x34, 0x0f, 0xf5, 0xa9, 0xf4, 0xd9, 0xb3, 0x5c, 0x0f, 0x19,
+  0x8d, 0xb9, 0xc7, 0x35, 0xdf, 0x85, 0x30, 0xae, 0xcd, 0xf7, 0x03, 0xe6, 0xa9, 0x2b, 0x92, 0x69,
+  0xf5, 0xc1, 0x2a, 0x64, 0xbd, 0x64, 0xda, 0xbe, 0x14, 0x1b, 0x5d, 0x47, 0x0e, 0x53, 0xe9, 0x70,
+  0x3b, 0x80, 0x0c, 0xb1, 0xef, 0xf7, 0x03, 0xa2, 0xba, 0x6e, 0x47, 0xac, 0x69, 0xe9, 0xcc, 0x1a,
+  0x1d, 0x86, 0x6a, 0x19, 0xc6, 0xf5, 0x71, 0x1e, 0xdf, 0xce, 0x95, 0xd6, 0xa4, 0x45, 0xc5, 0xd3,
+  0x9a, 0x8c, 0xd7, 0x13, 0xae, 0x06, 0xe2, 0x9f, 0x6b, 0xa3, 0x11, 0xc8, 0xd5, 0xf8, 0xd4, 0xa6,
+  0xc5, 0x93, 0xbd, 0x3d, 0x86, 0x37, 0x48, 0xc3, 0x7f, 0x94, 0xd8, 0x83, 0x86, 0x6e, 0xad, 0x2d,
+  0xb0, 0xb4, 0x4c, 0xc2, 0x04, 0xe8, 0xc4, 0x9c, 0xd2, 0x83, 0xa5, 0x4d, 0xa4, 0xf1, 0x4c, 0xc6,
+  0x73, 0x29, 0x88, 0x1d, 0x6f, 0x93, 0x38, 0x03, 0xa6, 0x9c, 0x67, 0x31, 0xad, 0xcb, 0xa6, 0xc3,
+  0x56, 0x8e, 0xa2, 0xb7, 0x8a, 0x50, 0x2f, 0xcc, 0x2b, 0x0a, 0xb7, 0x4c, 0x7e, 0xce, 0x0e, 0xe0,
+  0x17, 0xe8, 0x3a, 0xe8, 0xbd, 0xdd, 0xce, 0x15, 0xb5, 0xe6, 0x24, 0x5c, 0x09, 0x14, 0x3f, 0xe3,
+  0x9a, 0xcd, 0x28, 0x5e, 0x02, 0x5c, 0x25, 0x76, 0xa3, 0x65, 0x92, 0xc6, 0xae, 0x3a, 0x27, 0xb4,
+  0x0f, 0x70, 0xd4, 0x8a, 0x2f, 0xf2, 0x75, 0x07, 0x8d, 0x08, 0x43, 0x56, 0xa5, 0x55, 0x61, 0xbd,
+  0x55, 0x3a, 0x75, 0xc0, 0x43, 0xd5, 0xa0, 0x01, 0xa9, 0xe4, 0x4e, 0x68, 0x52, 0x39, 0x0a, 0x96,
+  0x2b, 0x4c, 0xe2, 0xd1, 0x32, 0x65, 0x06, 0x5a, 0x46, 0x11, 0xcf, 0x00, 0x37, 0x02, 0x8d, 0x45,
+  0x7f, 0x0c, 0x08, 0x3a, 0xd2, 0x1b, 0xff, 0xe8, 0x2a, 0x79, 0xe7, 0x4f, 0x38, 0xc2, 0x81, 0xc2,
+  0x3a, 0xed, 0x8c, 0x01, 0x16, 0x2e, 0x3f, 0x83, 0x00, 0x38, 0xe2, 0x93, 0x54, 0x8b, 0x51, 0xb7,
+  0x6b, 0x75, 0x52, 0x5e, 0x65, 0xd7, 0x03, 0x29, 0xf6, 0xa0, 0x37, 0xa6, 0x4a, 0xd7, 0xa2, 0x0e,
+  0xfd, 0x31, 0x98, 0x03, 0xbd, 0x2f, 0xc3, 0xeb, 0x08, 0x56, 0x26, 0xd4, 0x75, 0x06, 0x8d, 0x44,
+  0xce, 0x40, 0x0a, 0x3b, 0x5d, 0x55, 0x68, 0x46, 0x74, 0xcf, 0x5c, 0x45, 0x85, 0x88, 0xbd, 0xfe,
+  0xfa, 0x45, 0xe4, 0x66, 0xca, 0x0e, 0xfd, 0xef, 0x9b, 0x24, 0x9e, 0xfd, 0x00, 0x65, 0x1d, 0x1e,
+  0xe8, 0xfd, 0x6e, 0x4b, 0x71, 0x98, 0x45, 0xb6, 0x1e, 0x13, 0xa5, 0xab, 0xe1, 0x56, 0x20, 0x0d,
+  0x33, 0x53, 0x87, 0xf6, 0x3d, 0xb3, 0xdf, 0x17, 0x8b, 0x8d, 0x80, 0x80, 0x32, 0xc9, 0x5e, 0x4b,
+  0x98, 0x6d, 0x69, 0x41, 0xed, 0x69, 0x90, 0xba, 0x43, 0x4d, 0x4b, 0x98, 0x1e, 0xf5, 0xe7, 0x80,
+  0x74, 0x1e, 0x4a, 0x9e, 0x16, 0x0e, 0x92, 0x68, 0xcd, 0x1c, 0xc1, 0x0d, 0x74, 0x20, 0xf6, 0x84,
+  0x45, 0xaa, 0x3f, 0x2d, 0x65, 0x72, 0x77, 0x29, 0x23, 0x58, 0xd2, 0x63, 0x50, 0x49, 0x03, 0x54,
+  0x89, 0x05, 0x60, 0xef, 0x36, 0xde, 0x2b, 0x89, 0x24, 0x08, 0x5d, 0x06, 0x34, 0xa0, 0x7a, 0x1d,
+  0x5e, 0x97, 0x80, 0x9b, 0x07, 0xc1, 0x78, 0x6c, 0xf3, 0x14, 0x2b, 0xac, 0xc5, 0x32, 0x9d, 0x5a,
+  0x83, 0x60, 0xe3, 0x2a, 0x67, 0xe3, 0x77, 0x39, 0x21, 0xdf, 0x23, 0x3b, 0xb3, 0x50, 0x29, 0xce,
+  0x7a, 0x42, 0x60, 0xc1, 0xc2, 0x45, 0x9d, 0xdf, 0x35, 0x33, 0xe6, 0x4f, 0x32, 0x4f, 0xcd, 0x18,
+  0x06, 0x91, 0xc9, 0x0e, 0xf7, 0x8d, 0xea, 0x88, 0x8d, 0x25, 0x16, 0x3d, 0xc7, 0xa4, 0x2b, 0x99,
+  0x60, 0x4d, 0x21, 0xc0, 0x1e, 0x0c, 0xdf, 0x4c, 0xda, 0xfc, 0x39, 0x4a, 0x24, 0x94, 0x28, 0xfe,
+  0xec, 0xb4, 0x75, 0x95, 0x36, 0x74, 0xa3, 0xff, 0x86, 0x29, 0x83, 0x89, 0xfb, 0xe1, 0xea, 0xe4,
+  0x58, 0xb0, 0x6c, 0x0c, 0xb2, 0x24, 0x9c, 0x75, 0x8c, 0xc5, 0x66, 0xe0, 0x92, 0x84, 0x20, 0x50,
+  0x92, 0x6a, 0x05, 0x53, 0x09, 0xb7, 0x85, 0xe1, 0x35, 0x98, 0x9b, 0x48, 0x78, 0x36, 0x3b, 0x81,
+  0x4f, 0x5c, 0xcb, 0x93, 0xa4, 0x35, 0x09, 0x66, 0x6a, 0x81, 0x66, 0xd4, 0x97, 0x8b, 0x31, 0x23,
+  0xde, 0xb1, 0xd6, 0x62, 0xae, 0x05, 0x0a, 0xb4, 0x53, 0x6f, 0x9f, 0x76, 0x6b, 0xad, 0x52, 0x6d,
+  0x76, 0xea, 0x3e, 0x13, 0x09, 0x6c, 0x93, 0x66, 0xfb, 0xf3, 0x70, 0x16, 0x20, 0xbe, 0x6f, 0xb0,
+  0xbc, 0xa3, 0xfb, 0xb5, 0x30, 0xab, 0x36, 0xb0, 0xf1, 0xbf, 0xb6, 0xea, 0x74, 0x8c, 0x56, 0xe4,
+  0xa4, 0xe1, 0x27, 0xf8, 0x03, 0x69, 0x20, 0xe7, 0xb4, 0x56, 0x92, 0x29, 0x09, 0x8b, 0x24, 0x0f,
+  0xb3, 0x07, 0x32, 0xbb, 0x00, 0xee, 0x04, 0xc5, 0xb1, 0x23, 0xb2, 0x64, 0x29, 0x69, 0xd5, 0xbe,
+  0xa5, 0x8e, 0x4a, 0x5a, 0x27, 0x12, 0x97, 0x06, 0xd3, 0xba, 0xcc, 0xc2, 0x3f, 0x4f, 0xe2, 0x3f,
+  0x82, 0x10, 0x00, 0x3f, 0x1b, 0x66, 0xc8, 0x37, 0x35, 0x16, 0x37, 0x00, 0xf5, 0x14, 0x96, 0xaf,
+  0xef, 0x8e, 0xc6, 0x9d, 0xf6, 0x42, 0xb5, 0xeb, 0x23, 0x81, 0xdb, 0xc6, 0x74, 0x80, 0xad, 0x23,
+  0xda, 0xc2, 0xc1, 0x62, 0x01, 0x3a, 0x23, 0x48, 0x46, 0xd3, 0x2b, 0x28, 0x00, 0x93, 0xf9, 0x38,
+  0xbe, 0x95, 0xc9, 0x41, 0x90, 0x12, 0xe3, 0x72, 0xd5, 0x49, 0x18, 0x65, 0x92, 0x57, 0x6e, 0xac,
+  0xae, 0x01, 0xb6, 0x06, 0xfc, 0xa1, 0xb3, 0x40, 0xb2, 0x2e, 0x06, 0x23, 0x40, 0xfc, 0x26, 0x46,
+  0x7d, 0xb5, 0xc7, 0x15, 0x41, 0x1b, 0x20, 0xcd, 0x0e, 0x54, 0x79, 0xd7, 0x6d, 0xf0, 0x84, 0x30,
+  0xc0, 0x99, 0xcf, 0x71, 0x38, 0xc1, 0x75, 0x19, 0xd6, 0xa1, 0x57, 0xa2, 0x50, 0x46, 0x52, 0xb6,
+  0x18, 0x84, 0x60, 0x8a, 0xed, 0x40, 0x67, 0x73, 0x98, 0x42, 0x17, 0xdb, 0x81, 0xda, 0x7e, 0xa5,
+  0x1d, 0x04, 0xdc, 0xed, 0x1a, 0xf4, 0x59, 0x7d, 0x03, 0xf2, 0x7a, 0x1c, 0x2e, 0x1a, 0x8b, 0x01,
+  0xf6, 0x02, 0x35, 0xc6, 0x79, 0x0b, 0x55, 0x50, 0xd5, 0xa6, 0xa4, 0x89, 0xde, 0x65, 0xe9, 0x9d,
+  0x14, 0x77, 0xea, 0x29, 0x39, 0x36, 0xb8, 0x48, 0xe1, 0x90, 0x59, 0xb8, 0x23, 0xda, 0x51, 0x00,
+  0x46, 0x55, 0x9f, 0x6b, 0xb7, 0x6b, 0xcd, 0x44, 0x45, 0xf6, 0xfe, 0x4d, 0x12, 0x2f, 0x17, 0x7d,
+  0x6a, 0xf7, 0xf4, 0x25, 0x6a, 0xc3, 0x2c, 0x9f, 0xe3, 0x5f, 0xa7, 0x32, 0x80, 0xf6, 0xed, 0x2e,
+  0x9a, 0x8c, 0xb6, 0xb9, 0xa8, 0xd0, 0xd1, 0x46, 0xb1, 0xaa, 0xaf, 0xc4, 0xb0, 0x88, 0xd5, 0x82,
+  0x0c, 0x4f, 0xae, 0x04, 0x24, 0xf7, 0xf1, 0x72, 0x18, 0x52, 0x03, 0xeb, 0x52, 0x47, 0xf7, 0x46,
+  0xf9, 0x6b, 0x12, 0x35, 0xa6, 0x01, 0xd7, 0x5f, 0x9f, 0x08, 0xda, 0x66, 0xe6, 0x5d, 0x38, 0x9a,
+  0xb9, 0x3b, 0x62, 0x6b, 0x63, 0xf1, 0x79, 0xd7, 0x90, 0x47, 0x81, 0xae, 0xa6, 0x8e, 0x46, 0xf5,
+  0xaf, 0x49, 0x1f, 0xc3, 0x59, 0x8a, 0x3e, 0x28, 0x35, 0x55, 0x14, 0x02, 0xe5, 0x9c, 0xdd, 0xd5,
+  0x53, 0x86, 0xaa, 0xf4, 0xc1, 0x08, 0xce, 0x24, 0xec, 0x14, 0xa6, 0xdb, 0x2f, 0x4f, 0x63, 0x8d,
+  0x61, 0x0a, 0x0b, 0x26, 0x6c, 0x8f, 0xbf, 0x7b, 0x0e, 0xa5, 0xf6, 0xb0, 0xef, 0x5b, 0x75, 0xfe,
+  0x89, 0x6a, 0x15, 0x94, 0x8f, 0xc8, 0xac, 0x4a, 0x41, 0xfa, 0xf1, 0x00, 0xfa, 0xc8, 0x94, 0x8a,
+  0x88, 0x62, 0x20, 0xf4, 0x58, 0x6b, 0x2c, 0x16, 0x5d, 0x43, 0xad, 0x6e, 0x8b, 0xc5, 0x1b, 0x1b,
+  0xa5, 0x5a, 0xae, 0x88, 0xd6, 0x99, 0xd6, 0x2d, 0x47, 0x63, 0x22, 0x87, 0xd5, 0x46, 0x51, 0xa9,
+  0x05, 0x63, 0xd7, 0xa5, 0x79, 0xa7, 0xa0, 0x44, 0x36, 0x3c, 0x71, 0x3f, 0x40, 0xaa, 0x08, 0x47,
+  0x0f, 0x9d, 0xeb, 0x49, 0x75, 0x20, 0x83, 0xae, 0x69, 0x2b, 0xf1, 0x03, 0xc5, 0x82, 0x26, 0xb1,
+  0x5a, 0x11, 0x3f, 0xb4, 0x6c, 0xf2, 0xa6, 0xe1, 0x58, 0x5e, 0x07, 0x49, 0x5f, 0x73, 0xc6, 0xdf,
+  0x7c, 0xb1, 0xfa, 0xb9, 0x7f, 0x2a, 0x40, 0x6b, 0x07, 0xfa, 0x63, 0x3f, 0x1c, 0xef, 0x3d, 0xfd,
+  0x9b, 0x2f, 0x79, 0x1f, 0xf7, 0x4f, 0x5f, 0xb6, 0xca, 0xb8, 0x38, 0x9c, 0x4f, 0xe2, 0x8a, 0x4f,
+  0xa8, 0xdf, 0x9e, 0xbe, 0xfc, 0x9b, 0x2f, 0x32, 0x1d, 0x05, 0x0b, 0x49, 0x86, 0x80, 0x86, 0x87,
+  0x9f, 0xba, 0xf7, 0x3c, 0x91, 0xad, 0xbc, 0x1b, 0xd0, 0x7c, 0xa3, 0x24, 0x5c, 0xd0, 0x74, 0xbd,
+  0x12, 0x1f, 0xca, 0x80, 0x62, 0x95, 0x0a, 0xa0, 0x56, 0x6b, 0x0d, 0xfb, 0x03, 0xd1, 0xe3, 0xbe,
+  0xa5, 0x7a, 0x2a, 0x03, 0x38, 0x93, 0x59, 0x50, 0x31, 0x80, 0x45, 0x12, 0xc6, 0x49, 0x98, 0xdd,
+  0x09, 0xfd, 0x47, 0x3f, 0x47, 0x55, 0x17, 0xdd, 0xeb, 0x3d, 0x6d, 0x29, 0x84, 0x11, 0xce, 0x2d,
+  0xa2, 0x6b, 0x26, 0x5a, 0x0f, 0xda, 0xfd, 0xe7, 0x83, 0xc3, 0xa9, 0x29, 0x99, 0x8a, 0x1e, 0xa7,
+  0x1e, 0x8d, 0x91, 0x57, 0xcb, 0x78, 0x41, 0x98, 0x1a, 0xda, 0x18, 0xc8, 0xd7, 0x59, 0x5d, 0x72,
+  0x85, 0x8c, 0xda, 0xd1, 0x5b, 0xbe, 0x7a, 0xfe, 0x86, 0x9e, 0x74, 0x57, 0x58, 0x49, 0x55, 0x61,
+  0x08, 0x79, 0x95, 0x01, 0xec, 0xe0, 0xe6, 0x1d, 0xdb, 0x0e, 0xaa, 0xe7, 0x53, 0xc4, 0xdf, 0xc3,
+  0x85, 0x05, 0x98, 0x59, 0xde, 0xa8, 0x2b, 0x67, 0x7d, 0x06, 0xd1, 0x9a, 0x8f, 0xf5, 0x82, 0x15,
+  0x8e, 0x3d, 0x78, 0x3c, 0x1a, 0x4b, 0x92, 0x2b, 0x0d, 0x08, 0x85, 0x96, 0xe6, 0xee, 0x76, 0xd7,
+  0xdb, 0x46, 0xda, 0x7c, 0xb9, 0xdb, 0x18, 0x0c, 0x31, 0x63, 0x25, 0x2c, 0x9b, 0x99, 0x41, 0xba,
+  0x79, 0xa7, 0x5a, 0xd0, 0x47, 0x8a, 0x18, 0xeb, 0xd9, 0x43, 0xa4, 0x76, 0xfa, 0xa6, 0x6a, 0x6e,
+  0x11, 0x91, 0x06, 0xbd, 0xcc, 0xd8, 0x46, 0xe5, 0x6d, 0xea, 0xcb, 0x0a, 0x0f, 0xee, 0xbb, 0x87,
+  0x2a, 0x66, 0x5c, 0x37, 0x08, 0xb4, 0xbd, 0x02, 0xbd, 0xb7, 0x59, 0xcb, 0x65, 0x02, 0xda, 0x52,
+  0x18, 0xbc, 0x3a, 0x6d, 0x54, 0xec, 0x6a, 0x51, 0xa3, 0xe2, 0x5f, 0xe7, 0xf1, 0xaf, 0x66, 0x5e,
+  0x18, 0x28, 0x2a, 0xf9, 0x85, 0x5b, 0x89, 0x65, 0xc2, 0xaf, 0x08, 0x95, 0x1c, 0x8f, 0x6d, 0x1d,
+  0x77, 0x97, 0x60, 0x56, 0x83, 0x1a, 0x91, 0xf8, 0x57, 0x04, 0x03, 0x3b, 0x03, 0x0b, 0x2f, 0xb7,
+  0x3f, 0xda, 0x24, 0xb8, 0xa6, 0xe5, 0xea, 0x25, 0xa1, 0x04, 0x91, 0xdd, 0x56, 0x7a, 0x1b, 0x82,
+  0x8d, 0xe8, 0x08, 0xd1, 0x1b, 0x82, 0x41, 0xac, 0x01, 0xd6, 0xa1, 0x51, 0xf1, 0x3b, 0x2d, 0xab,
+  0x47, 0xdf, 0xb6, 0xcb, 0xd8, 0x2c, 0x85, 0x2d, 0x10, 0xec, 0x85, 0x60, 0xab, 0x86, 0x42, 0x72,
+  0x0d, 0x7b, 0xab, 0x8f, 0xbb, 0x0a, 0x88, 0xf9, 0xd0, 0x00, 0x4e, 0x0d, 0x18, 0x1c, 0x25, 0x40,
+  0xe0, 0x1f, 0xb0, 0xeb, 0x9a, 0x9b, 0x1f, 0xf3, 0x38, 0x93, 0xe6, 0x07, 0xec, 0x1f, 0x43, 0xe4,
+  0xaa, 0x46, 0x9d, 0x65, 0x77, 0x0b, 0xe9, 0x13, 0x48, 0xd1, 0xc0, 0xf4, 0x7e, 0x6f, 0xe0, 0x0c,
+  0x60, 0x97, 0x9e, 0x75, 0x3a, 0x41, 0x4f, 0x5c, 0xdb, 0x3a, 0x28, 0x47, 0x99, 0x7c, 0x28, 0xd7,
+  0xd6, 0x10, 0xd4, 0x16, 0x4b, 0xd8, 0x75, 0x5e, 0x89, 0x4d, 0x58, 0x22, 0xfa, 0x9b, 0xbb, 0x46,
+  0x0d, 0x85, 0x31, 0x3b, 0x2b, 0xc2, 0x9b, 0xe9, 0x8e, 0xd8, 0x46, 0xff, 0xdb, 0x38, 0x5c, 0xce,
+  0xc0, 0x1c, 0xeb, 0x89, 0x28, 0xbe, 0xdd, 0x81, 0xfa, 0xf7, 0x66, 0x7d, 0xed, 0x60, 0xf5, 0x77,
+  0xd7, 0x66, 0x31, 0x78, 0x8f, 0x82, 0xbe, 0xd5, 0x15, 0x7d, 0xf5, 0x25, 0xf0, 0xbf, 0xb0, 0xce,
+  0xab, 0x35, 0x9d, 0x6a, 0x45, 0x25, 0x0b, 0xb3, 0x48, 0xd6, 0x48, 0x09, 0x2b, 0xa4, 0x72, 0xd9,
+  0x28, 0x57, 0x03, 0x06, 0x8f, 0x59, 0xb0, 0xe8, 0xe0, 0xac, 0xe6, 0x1e, 0x5f, 0xd0, 0x0d, 0x19,
+  0x41, 0x87, 0xd2, 0x4a, 0x0b, 0x11, 0xf5, 0x17, 0xb5, 0x43, 0xdb, 0xb0, 0xeb, 0x5b, 0x5c, 0x0b,
+  0xd8, 0xd5, 0x1f, 0xa3, 0x85, 0xdb, 0xe1, 0xbf, 0x73, 0x3d, 0x77, 0x2b, 0xe5, 0xc7, 0x71, 0x70,
+  0x97, 0xd2, 0x4e, 0x17, 0x3f, 0x0d, 0x26, 0xb0, 0xe3, 0x25, 0x32, 0xb4, 0xf1, 0x5b, 0x74, 0xd7,
+  0x46, 0x9f, 0x8b, 0x6a, 0x37, 0xa0, 0xaa, 0x6a, 0x17, 0xfd, 0xc7, 0x38, 0x9c, 0x23, 0x0a, 0x58,
+  0x75, 0xa3, 0xb7, 0xd9, 0xdb, 0xea, 0x6d, 0xf7, 0xbe, 0x69, 0xeb, 0x19, 0x24, 0x83, 0x1a, 0xa0,
+  0x66, 0x1d, 0xd3, 0xc5, 0x2b, 0x64, 0x44, 0x04, 0xf3, 0xab, 0x2e, 0x22, 0x3b, 0x49, 0x95, 0xe1,
+  0x10, 0x2d, 0x14, 0x72, 0x7f, 0x82, 0x2a, 0x94, 0x9f, 0x24, 0x6c, 0x08, 0x5f, 0xc2, 0xc4, 0xbf,
+  0x52, 0xc0, 0x81, 0xbc, 0xe2, 0x7f, 0xff, 0x17, 0xab, 0x1d, 0x57, 0xd9, 0xe1, 0xcf, 0xbb, 0xe5,
+  0x4a, 0x5e, 0x11, 0xc9, 0x98, 0x9b, 0xc0, 0xec, 0x44, 0x99, 0x94, 0xd8, 0x0d, 0x3f, 0xee, 0xe0,
+  0x3c, 0xf2, 0x7c, 0xfc, 0x4a, 0xf2, 0xd5, 0xed, 0x09, 0x14, 0x2d, 0xbb, 0x9c, 0x44, 0xad, 0x8b,
+  0x5e, 0xb4, 0x4c, 0xda, 0xe5, 0x24, 0x75, 0x5d, 0x9c, 0x22, 0x16, 0x38, 0xfb, 0x9b, 0x11, 0x42,
+  0xf2, 0xb1, 0xa9, 0xfd, 0x70, 0x9c, 0xcc, 0x82, 0xec, 0x50, 0x39, 0x33, 0x70, 0xbf, 0x7e, 0x99,
+  0x25, 0x96, 0x1c, 0x3d, 0x31, 0x45, 0xda, 0xb9, 0xd2, 0x69, 0x63, 0x11, 0x2a, 0xeb, 0xb1, 0x72,
+  0xcc, 0x30, 0x24, 0xe5, 0x10, 0x41, 0x1f, 0x2b, 0x82, 0x33, 0xb0, 0xcc, 0x26, 0x3d, 0x06, 0x82,
+  0xdb, 0x15, 0xac, 0x2f, 0xb3, 0x38, 0x49, 0xe8, 0xc8, 0xc3, 0x7c, 0xa4, 0xda, 0xe8, 0xf4, 0x51,
+  0xdf, 0xd0, 0x19, 0xa8, 0x3e, 0xa8, 0x82, 0x1b, 0x55, 0x80, 0x5c, 0xbe, 0xa9, 0x84, 0x09, 0xfb,
+  0x84, 0x9d, 0xf4, 0x21, 0x77, 0x8d, 0xae, 0x1c, 0x66, 0x0f, 0x82, 0xe6, 0x7d, 0xb0, 0x47, 0x04,
+  0x54, 0x0b, 0x27, 0xbf, 0x52, 0xad, 0xf6, 0x4a, 0x50, 0xaa, 0xff, 0xd5, 0xd0, 0xb8, 0x62, 0x2e,
+  0x7c, 0x42, 0xc1, 0x3c, 0x8e, 0x47, 0x41, 0x24, 0xad, 0xd6, 0xed, 0x2c, 0xe9, 0x5f, 0x5d, 0xb4,
+  0xd1, 0xcf, 0x02, 0x18, 0x00, 0x47, 0x6e, 0xf5, 0xc7, 0xe1, 0x4d, 0x98, 0x41, 0xc9, 0x0c, 0x24,
+  0x74, 0xea, 0x94, 0xdc, 0xc9, 0x00, 0x66, 0xb5, 0x3d, 0x07, 0x8b, 0x20, 0x09, 0x47, 0x6a, 0xf7,
+  0xa3, 0x49, 0x79, 0x1d, 0xc5, 0xa3, 0x8f, 0x72, 0xfc, 0x1a, 0x09, 0x4d, 0xe2, 0x3a, 0x06, 0xc6,
+  0x84, 0x39, 0x9f, 0x8f, 0x42, 0x99, 0xb6, 0x48, 0xb6, 0xa1, 0x04, 0xd7, 0x9f, 0x97, 0xce, 0x22,
+  0x05, 0xc6, 0x95, 0x52, 0xbe, 0xca, 0xb8, 0xa2, 0x5a, 0xdd, 0xdc, 0xcd, 0xc1, 0x5f, 0x51, 0x12,
+  0xbd, 0x45, 0x05, 0x57, 0x3e, 0xe5, 0x07, 0x77, 0x77, 0x19, 0x08, 0xba, 0x4f, 0x8e, 0x73, 0xb6,
+  0x7a, 0x1d, 0x65, 0x6b, 0x2d, 0x3f, 0x6c, 0x99, 0xdb, 0xa6, 0x35, 0xd5, 0xce, 0xed, 0x6a, 0xde,
+  0x8f, 0x30, 0x38, 0xda, 0x8c, 0x28, 0x3d, 0xe4, 0xef, 0x44, 0xa8, 0x06, 0x6f, 0x8b, 0xcb, 0xbe,
+  0x8c, 0xa6, 0x72, 0xf4, 0xf1, 0x3a, 0xfe, 0x5c, 0x8e, 0x0e, 0x7e, 0x34, 0xc8, 0xd4, 0x75, 0x59,
+  0x62, 0xe4, 0x33, 0x78, 0xb6, 0xfb, 0xca, 0x7a, 0x26, 0x65, 0xdd, 0x07, 0x56, 0xa8, 0xfc, 0x58,
+  0xd7, 0xa1, 0xb3, 0xc5, 0xa1, 0x62, 0x6a, 0x62, 0x76, 0x4d, 0x45, 0x88, 0xa0, 0x51, 0xfa, 0xd7,
+  0xc1, 0xf8, 0x86, 0x36, 0x5d, 0xb9, 0x7e, 0x79, 0xc7, 0x8d, 0xe1, 0xf7, 0x7b, 0x6f, 0xf3, 0xa1,
+  0xba, 0xab, 0xd9, 0x75, 0x11, 0x60, 0xeb, 0xfb, 0x7a, 0x08, 0xd7, 0x6c, 0xc8, 0x3e, 0xb0, 0xb4,
+  0x15, 0x78, 0xd5, 0xf3, 0xb4, 0xb0, 0x9d, 0xb9, 0xe7, 0x5a, 0xa3, 0x0a, 0xa9, 0xbc, 0x11, 0xd8,
+  0xa4, 0xbb, 0xe5, 0x55, 0x4d, 0xad, 0x3b, 0xed, 0x6d, 0x7a, 0x3d, 0xfc, 0xf1, 0xf8, 0xe8, 0x97,
+  0xb3, 0x8b, 0x1d, 0x65, 0xba, 0x82, 0xaa, 0x29, 0xe0, 0xa0, 0x5d, 0x28, 0x46, 0x64, 0xb4, 0xd2,
+  0x86, 0x02, 0xcf, 0xca, 0xab, 0x10, 0x20, 0xa5, 0x4b, 0xe4, 0xc2, 0x36, 0xec, 0x15, 0xdf, 0xe9,
+  0x6d, 0x3d, 0x7c, 0x75, 0x99, 0x51, 0x3b, 0x81, 0x46, 0x71, 0x14, 0x83, 0xa8, 0xff, 0x66, 0x63,
+  0xb2, 0xb1, 0xfb, 0x54, 0xef, 0xe8, 0xf5, 0xf0, 0x5c, 0x61, 0xb3, 0xc6, 0x87, 0x22, 0xe7, 0x31,
+  0x9a, 0xf5, 0x15, 0xb7, 0x28, 0x30, 0x5b, 0x2e, 0x12, 0xf7, 0xee, 0x9c, 0x21, 0x42, 0x1e, 0x8f,
+  0x5d, 0x2f, 0xb3, 0x0c, 0xb8, 0xa2, 0x08, 0x8f, 0x0f, 0x06, 0x9e, 0xb6, 0x2a, 0xd9, 0x81, 0xbf,
+  0x40, 0x0b, 0xf5, 0x81, 0xe8, 0x02, 0x5c, 0xf2, 0xe3, 0xfe, 0xf1, 0xe1, 0xd1, 0xc5, 0x77, 0xcf,
+  0x19, 0xb2, 0xbb, 0x01, 0x46, 0x95, 0x96, 0x4f, 0xa3, 0x9e, 0x9f, 0xfb, 0x9c, 0x53, 0x48, 0x5c,
+  0xd1, 0x07, 0x8c, 0x0a, 0xc9, 0x2d, 0x69, 0xcc, 0x38, 0xa6, 0xc5, 0x53, 0x33, 0xf9, 0x39, 0x10,
+  0x3d, 0xf3, 0x3a, 0x5c, 0xe2, 0x4b, 0x05, 0xdd, 0x4d, 0x8b, 0x32, 0xb2, 0xe7, 0x1f, 0x2d, 0xdd,
+  0x43, 0x67, 0x36, 0x75, 0xba, 0x67, 0x15, 0x29, 0xad, 0x2e, 0xe9, 0x33, 0x01, 0xac, 0x52, 0x4d,
+  0x79, 0x65, 0x9c, 0xf8, 0xf2, 0xee, 0x3d, 0x4d, 0xec, 0x09, 0x30, 0x35, 0xc0, 0xc6, 0x55, 0xcc,
+  0x90, 0x77, 0xd1, 0x90, 0x17, 0xaa, 0x07, 0xf0, 0x87, 0x52, 0x76, 0xb0, 0x98, 0xe1, 0xc3, 0x77,
+  0xe1, 0x7c, 0xb1, 0x64, 0xa3, 0x09, 0xa6, 0x11, 0x79, 0xb9, 0x64, 0x26, 0xb0, 0xca, 0x53, 0xb4,
+  0x98, 0x46, 0x72, 0x1a, 0x47, 0xb0, 0x1c, 0x10, 0x12, 0x9d, 0x76, 0x30, 0x1e, 0xff, 0x9a, 0x2e,
+  0xaf, 0xd9, 0xa4, 0xaa, 0x55, 0xf2, 0x1f, 0x4a, 0xf9, 0x4f, 0x1f, 0x1e, 0xe6, 0xd8, 0xd4, 0xf0,
+  0xd4, 0x5f, 0x09, 0x53, 0xa5, 0x4d, 0x51, 0x3a, 0xca, 0x39, 0x94, 0x5a, 0x4d, 0x62, 0x30, 0x0b,
+  0x4b, 0x57, 0x45, 0xed, 0xf5, 0x4a, 0x17, 0xc1, 0xdc, 0xd5, 0xab, 0x60, 0x9e, 0xf4, 0x55, 0x68,
+  0x5a, 0xbd, 0xb6, 0xcf, 0x4d, 0x48, 0xa5, 0xc6, 0xf1, 0xd0, 0x07, 0x98, 0x05, 0x41, 0x9a, 0xb5,
+  0x85, 0x0d, 0x64, 0x5a, 0x56, 0xa8, 0xfc, 0x9f, 0xd4, 0x77, 0xfe, 0xf5, 0xe7, 0xff, 0xf8, 0xbf,
+  0x80, 0x37, 0xed, 0x6d, 0x82, 0xd5, 0xc8, 0xc0, 0x32, 0x4e, 0x3c, 0x07, 0x82, 0xfa, 0xe9, 0x99,
+  0x0d, 0x60, 0x66, 0xbd, 0x5d, 0x2c, 0xf4, 0x79, 0x8a, 0xc1, 0xa6, 0x6a, 0xcd, 0x0c, 0xc8, 0x4a,
+  0x4f, 0x9f, 0x16, 0xb8, 0xdb, 0xfa, 0xda, 0xbf, 0xce, 0x60, 0xcf, 0x38, 0x1e, 0xa3, 0x32, 0xab,
+  0xa7, 0x08, 0xcc, 0x20, 0xd4, 0xfd, 0x15, 0x67, 0x31, 0x57, 0x95, 0x6d, 0xc4, 0xc2, 0xb0, 0x77,
+  0x7d, 0x2f, 0xb0, 0xd5, 0xcc, 0x56, 0x76, 0x31, 0xca, 0x3e, 0xff, 0x8a, 0x15, 0xd7, 0x01, 0xcc,
+  0xe7, 0xb6, 0x8d, 0xb0, 0xe7, 0xaa, 0x2e, 0xf0, 0x32, 0x97, 0x65, 0xc1, 0x81, 0xa9, 0x8c, 0x5d,
+  0x64, 0x47, 0x67, 0x0b, 0xc4, 0xc7, 0x81, 0xb8, 0xa3, 0xb5, 0xfd, 0x5c, 0x59, 0x9c, 0x05, 0x11,
+  0x39, 0xbf, 0xf4, 0x8a, 0x8a, 0x05, 0x29, 0x2f, 0xac, 0xae, 0x1f, 0xbc, 0xa4, 0x56, 0x0c, 0xd4,
+  0xdd, 0xb5, 0x21, 0x69, 0x4f, 0x8f, 0x5b, 0x4d, 0xbb, 0x11, 0x6b, 0x5c, 0x7a, 0x54, 0x93, 0x48,
+  0x92, 0x16, 0x3c, 0x79, 0x39, 0x8e, 0x35, 0x00, 0x18, 0xc7, 0x0a, 0x08, 0xd6, 0x00, 0x56, 0xe2,
+  0xa0, 0x91, 0x2d, 0x47, 0xe3, 0xdc, 0x0c, 0xc5, 0x22, 0x2d, 0x0c, 0x35, 0xba, 0xbb, 0x94, 0x59,
+  0x06, 0xbb, 0x09, 0x26, 0x6e, 0x35, 0x9a, 0x8b, 0x45, 0x5f, 0x79, 0x0f, 0x7c, 0x1c, 0xe9, 0x98,
+  0x92, 0x61, 0x0c, 0xe0, 0xc7, 0x15, 0xd6, 0xb2, 0xb0, 0xa5, 0x56, 0x0d, 0xea, 0x15, 0x9d, 0x94,
+  0xd7, 0xfd, 0x51, 0x90, 0x6d, 0xd6, 0x77, 0xa8, 0x4f, 0x5c, 0x37, 0x57, 0x43, 0xda, 0x6a, 0x06,
+  0x69, 0x6b, 0x35, 0xa4, 0xed, 0x66, 0x90, 0xb6, 0xcd, 0xc9, 0xe8, 0x7c, 0x12, 0x1f, 0xc0, 0x50,
+  0xea, 0x7c, 0xb2, 0x58, 0x47, 0x8d, 0xd7, 0x6b, 0xb6, 0xd5, 0xa4, 0xd9, 0x56, 0xa1, 0xd9, 0x76,
+  0x93, 0x66, 0xdb, 0x85, 0x66, 0x9b, 0xa7, 0xc1, 0xa7, 0x46, 0x78, 0xf6, 0xe7, 0xc1, 0xa7, 0x22,
+  0xae, 0x0d, 0x5b, 0x6f, 0x95, 0xb6, 0xde, 0x6e, 0xd8, 0x7a, 0x5b, 0xb7, 0xa6, 0xf8, 0x44, 0x85,
+  0x77, 0xd7, 0x8c, 0xa0, 0x21, 0xbf, 0x58, 0x8d, 0xb7, 0x4c, 0xe3, 0xad, 0x86, 0x2c, 0x62, 0x35,
+  0xde, 0x36, 0x8d, 0xb7, 0x1b, 0x72, 0x85, 0x8d, 0x36, 0x0c, 0xb9, 0x6b, 0xd3, 0xfe, 0x01, 0xc8,
+  0xdb, 0x20, 0xb6, 0x1a, 0x82, 0xf0, 0x86, 0x60, 0x83, 0xd8, 0x6e, 0x08, 0x42, 0x0d, 0xc4, 0xf9,
+  0x96, 0x4d, 0xe5, 0x8c, 0x9d, 0xb0, 0xed, 0x08, 0xa3, 0x13, 0xdb, 0x8e, 0x52, 0xb9, 0x8e, 0xc7,
+  0x77, 0x58, 0x77, 0x3f, 0xcb, 0x92, 0x10, 0x56, 0x07, 0x49, 0x4e, 0x21, 0x58, 0x51, 0xb0, 0x55,
+  0xbb, 0x67, 0xda, 0x58, 0x46, 0x93, 0xdb, 0x96, 0x4d, 0xc5, 0xf2, 0xe6, 0xe4, 0x3b, 0xe4, 0xc5,
+  0xe2, 0x54, 0x66, 0xb7, 0x71, 0xf2, 0xf1, 0x08, 0xc6, 0xd3, 0xe9, 0x96, 0x2c, 0x26, 0xf6, 0xf7,
+  0x44, 0x4e, 0x12, 0x99, 0x4e, 0xd1, 0xad, 0x0c, 0x2a, 0x5f, 0x9a, 0xb0, 0x26, 0x5d, 0x0e, 0x3b,
+  0x05, 0x18, 0xa1, 0xfa, 0x67, 0x30, 0xe7, 0x96, 0xb8, 0x1a, 0x2d, 0x29, 0xa2, 0x8f, 0x1d, 0x74,
+  0x36, 0xc0, 0x62, 0x35, 0xdb, 0x8b, 0x3a, 0x91, 0x19, 0xec, 0x0f, 0xda, 0xcf, 0x83, 0x45, 0xf8,
+  0x5c, 0xd5, 0x7a, 0x9e, 0x52, 0xb5, 0x76, 0xb7, 0xc5, 0x67, 0x62, 0xd0, 0xed, 0x02, 0xa4, 0x42,
+  0xb2, 0x93, 0x94, 0xff, 0x1e, 0xfc, 0x31, 0x8d, 0xe7, 0x9d, 0xae, 0xae, 0x82, 0xc3, 0x76, 0x0e,
+  0xce, 0xba, 0x45, 0xec, 0x50, 0x90, 0xa0, 0xda, 0x6e, 0x09, 0x8a, 0x58, 0x4e, 0xbe, 0xe4, 0x16,
+  0x4e, 0x26, 0xe0, 0x23, 0x93, 0x04, 0x83, 0xdf, 0xf2, 0x9d, 0x2a, 0xb2, 0xc2, 0xcf, 0xe1, 0x9b,
+  0x70, 0xa5, 0x34, 0xde, 0x86, 0x93, 0xb0, 0xaf, 0x07, 0x60, 0x8b, 0xf3, 0xd1, 0xf9, 0xca, 0xb6,
+  0xe1, 0xc2, 0x6d, 0x72, 0x72, 0x78, 0x7a, 0xb9, 0xb2, 0xd1, 0x6c, 0x3c, 0x4f, 0x6d, 0xd1, 0x47,
+  0x2c, 0xbb, 0x06, 0x5f, 0x3f, 0xbc, 0x73, 0xff, 0x5c, 0x9c, 0xc4, 0x63, 0xd9, 0xce, 0xeb, 0x1f,
+  0x9d, 0x77, 0x15, 0x7e, 0x7e, 0xdd, 0xcd, 0xdf, 0x6f, 0x0d, 0x36, 0xbf, 0xfd, 0xdd, 0xe0, 0x9b,
+  0xc1, 0xa6, 0x55, 0x1f, 0x91, 0xea, 0x1a, 0xf4, 0xfc, 0x36, 0xe9, 0x2c, 0x48, 0xb2, 0x8f, 0x49,
+  0x30, 0x81, 0x9d, 0x52, 0xbc, 0x35, 0x8e, 0x07, 0x11, 0x3a, 0xe9, 0x8c, 0x33, 0x39, 0x58, 0xe4,
+  0x73, 0x51, 0xbd, 0xb2, 0x5a, 0xf4, 0xe3, 0xe9, 0xcc, 0xd9, 0x4b, 0xff, 0x5d, 0x18, 0x17, 0x9f,
+  0xe5, 0xec, 0xe6, 0x15, 0xc8, 0x72, 0x3b, 0xe5, 0xa8, 0x2e, 0x30, 0x2a, 0x46, 0x71, 0x32, 0x46,
+  0xeb, 0x8d, 0x41, 0x2b, 0x43, 0xc2, 0x0a, 0x76, 0x55, 0xe7, 0x23, 0x27, 0x14, 0x09, 0x29, 0x56,
+  0x9e, 0x58, 0xce, 0x90, 0x88, 0x0a, 0x3f, 0xab, 0x69, 0xd7, 0x86, 0x53, 0x4d, 0xfb, 0xfb, 0xb2,
+  0x48, 0x8a, 0x02, 0x43, 0xfe, 0xbb, 0x65, 0x3e, 0x90, 0xc2, 0x72, 0xf6, 0xc3, 0x61, 0x0d, 0x66,
+  0x3a, 0xd8, 0x14, 0x08, 0xd2, 0xc6, 0x9d, 0xb3, 0xa6, 0x0b, 0x6c, 0x4b, 0xa8, 0x42, 0x9a, 0x86,
+  0x63, 0xed, 0xa6, 0xd0, 0x1c, 0xca, 0x20, 0x0b, 0x3c, 0x4a, 0xf5, 0xc3, 0x05, 0x9d, 0x07, 0xbb,
+  0xec, 0x7a, 0xef, 0x31, 0x2c, 0x03, 0x28, 0x61, 0x59, 0xc6, 0x09, 0xc6, 0x41, 0x40, 0x2a, 0xf9,
+  0xf7, 0xfe, 0xa1, 0x1c, 0x6c, 0xce, 0xc1, 0x00, 0xf2, 0xdd, 0xea, 0xb6, 0xaa, 0x62, 0x01, 0xc0,
+  0x75, 0x30, 0xfa, 0xb8, 0x6c, 0xd0, 0x37, 0xd7, 0x5b, 0x5f, 0x82, 0x2a, 0xa6, 0x26, 0x8f, 0x82,
+  0x39, 0x9a, 0x07, 0xb5, 0x32, 0x56, 0x0e, 0xa0, 0x4a, 0xf0, 0x10, 0xa2, 0xff, 0xcd, 0xcc, 0x9a,
+  0x43, 0x2c, 0xbd, 0x00, 0x79, 0xf0, 0x2f, 0xaf, 0xf6, 0xe9, 0x40, 0x8b, 0x8a, 0x81, 0x44, 0x73,
+  0x30, 0xe6, 0x25, 0x85, 0x74, 0x38, 0xad, 0x7d, 0x19, 0x3c, 0xd0, 0x35, 0xa1, 0x33, 0xb7, 0x62,
+  0xbd, 0xbe, 0x18, 0x59, 0xed, 0xcc, 0x5a, 0x5c, 0xdb, 0xd3, 0x69, 0x9c, 0x89, 0x07, 0xf6, 0xa6,
+  0x22, 0x1b, 0x70, 0xd4, 0xf6, 0xb4, 0xe3, 0xe0, 0xec, 0xdf, 0x25, 0x36, 0x89, 0x5e, 0xf0, 0xb4,
+  0xf9, 0xa1, 0xaa, 0x5f, 0x1e, 0x1d, 0xe2, 0x64, 0x40, 0xdd, 0x49, 0x78, 0x83, 0x97, 0x1f, 0x88,
+  0xfe, 0x0a, 0x43, 0x5d, 0xb4, 0xeb, 0x02, 0x5f, 0x8d, 0xe1, 0xa3, 0x14, 0xa7, 0xd3, 0x98, 0x10,
+  0x6c, 0xd0, 0x18, 0x35, 0x43, 0xa1, 0x71, 0xbd, 0x6e, 0xd3, 0x4d, 0x6d, 0xf5, 0xa6, 0x7b, 0x0d,
+  0x6f, 0xe6, 0x41, 0xd4, 0xa8, 0x5f, 0xaa, 0x59, 0xaa, 0xef, 0x29, 0x52, 0xbe, 0x42, 0xe3, 0xaf,
+  0x54, 0x77, 0x6d, 0xd2, 0xea, 0x36, 0x97, 0xdc, 0xdb, 0x3d, 0x20, 0x59, 0xac, 0x1e, 0xf0, 0x67,
+  0xa3, 0x1e, 0xfa, 0x08, 0xbb, 0x63, 0x74, 0x29, 0x29, 0xb6, 0x7e, 0xbb, 0xeb, 0x41, 0x67, 0xb5,
+  0x6a, 0x7e, 0xac, 0xa9, 0x59, 0x1d, 0x1a, 0x36, 0x91, 0xd1, 0x04, 0x50, 0xb1, 0x07, 0x43, 0x0d,
+  0xcb, 0x3a, 0xc5, 0x8a, 0x74, 0x24, 0x3c, 0x7e, 0x3d, 0xb3, 0xa5, 0xad, 0xae, 0x21, 0x0c, 0x8f,
+  0x65, 0xc6, 0x8e, 0xfa, 0x9a, 0xc6, 0xb7, 0x57, 0x71, 0x90, 0x66, 0x9d, 0x99, 0x4c, 0xd3, 0xe0,
+  0x46, 0xf6, 0x04, 0x47, 0x44, 0x80, 0x96, 0x5f, 0x8e, 0x46, 0x50, 0xd6, 0xce, 0x97, 0x58, 0xf9,
+  0x39, 0x4c, 0x51, 0x64, 0x6c, 0x6e, 0xf0, 0xaf, 0x19, 0x64, 0x08, 0x4c, 0x33, 0x81, 0x6e, 0xd0,
+  0x35, 0x4d, 0xad, 0xe0, 0x7e, 0xed, 0x48, 0x81, 0xfa, 0x35, 0x41, 0xf9, 0xe3, 0x90, 0xf6, 0x6c,
+  0x54, 0xcd, 0x15, 0x37, 0x6e, 0x49, 0xb1, 0x02, 0x80, 0xb1, 0xae, 0xe2, 0x0e, 0x59, 0x0d, 0x6a,
+  0xd7, 0xdb, 0x11, 0x80, 0x16, 0x00, 0x6b, 0x82, 0xa2, 0xf3, 0x3b, 0xd4, 0x0c, 0x63, 0x61, 0x64,
+  0x76, 0x15, 0xce, 0x64, 0xbc, 0xcc, 0x9c, 0xf8, 0x32, 0x86, 0xca, 0x41, 0xec, 0xa7, 0xc4, 0xcc,
+  0x5c, 0x92, 0x8f, 0xe3, 0xbe, 0x27, 0xb6, 0x5e, 0x6c, 0x6c, 0xb8, 0xd6, 0x8a, 0x7d, 0x2a, 0x85,
+  0xfe, 0x6c, 0xbd, 0x41, 0xe0, 0x1f, 0xca, 0x6b, 0xd5, 0x36, 0x26, 0x1f, 0xba, 0x08, 0x57, 0xd2,
+  0x00, 0xfe, 0xf1, 0x9d, 0x34, 0xf0, 0x2b, 0x3f, 0xf0, 0x85, 0xcf, 0xe6, 0xb6, 0xc2, 0x6e, 0x61,
+  0x92, 0x83, 0xf4, 0x23, 0x48, 0x54, 0x10, 0x75, 0x0c, 0x2e, 0xe5, 0x51, 0x53, 0x39, 0x47, 0xb4,
+  0x2f, 0x87, 0xc7, 0xc3, 0x83, 0x2b, 0x71, 0x7e, 0x71, 0xf6, 0x77, 0xf8, 0xef, 0x9b, 0xa3, 0x8b,
+  0xcb, 0x2b, 0xdc, 0x70, 0x91, 0xe1, 0xef, 0xc6, 0x79, 0x54, 0x6a, 0x87, 0x19, 0xf6, 0xd9, 0xcf,
+  0x4f, 0x1f, 0xdb, 0xdd, 0xc1, 0xa7, 0x20, 0x5a, 0x4a, 0x75, 0x8d, 0xaa, 0x49, 0x3b, 0x15, 0xf0,
+  0xb6, 0x6e, 0x33, 0xe4, 0x0a, 0xbb, 0x19, 0x39, 0xb8, 0x9b, 0x35, 0xd5, 0x8e, 0x5d, 0xbb, 0x39,
+  0x87, 0xe4, 0x34, 0x45, 0x99, 0xa2, 0x15, 0x1c, 0x94, 0x6f, 0x01, 0xa0, 0xbc, 0x20, 0x27, 0xb3,
+  0xaa, 0x0a, 0xa4, 0xc4, 0xdb, 0x4b, 0xdd, 0x5a, 0xd7, 0x11, 0xba, 0xcd, 0xa9, 0x72, 0xd7, 0xba,
+  0x02, 0x84, 0xf7, 0x71, 0x74, 0x64, 0x56, 0x77, 0x77, 0x2d, 0xe2, 0x5b, 0x57, 0x7b, 0x0c, 0x7f,
+  0x4c, 0xc3, 0xb1, 0x74, 0xf9, 0x63, 0x5d, 0x84, 0x94, 0x34, 0x58, 0x38, 0x79, 0xec, 0x37, 0x1c,
+  0x87, 0x59, 0xde, 0x05, 0x42, 0xe1, 0xd0, 0xd2, 0x3c, 0x0c, 0x7a, 0xd5, 0x19, 0xa7, 0x6a, 0xa3,
+  0x22, 0xfe, 0x38, 0xae, 0x45, 0xf3, 0x5f, 0x25, 0xba, 0xe8, 0xb2, 0x2e, 0x67, 0xbe, 0xfc, 0x70,
+  0xbb, 0x51, 0x73, 0x8f, 0x07, 0xfd, 0x93, 0xe6, 0x66, 0x28, 0xb8, 0x0c, 0x69, 0x4e, 0xc8, 0x1b,
+  0x35, 0x2e, 0x61, 0x49, 0xe7, 0x0c, 0xa2, 0xd9, 0x28, 0x5c, 0xb6, 0x34, 0x27, 0x28, 0x1e, 0x77,
+  0x92, 0xa3, 0xbf, 0x27, 0xec, 0x63, 0x91, 0x46, 0xe0, 0x1f, 0xce, 0xa8, 0xc5, 0x79, 0x32, 0x7c,
+  0xba, 0x46, 0xbf, 0xb8, 0x32, 0x82, 0x1a, 0x1f, 0x30, 0xab, 0x08, 0xcd, 0x33, 0x05, 0x5e, 0x77,
+  0x99, 0xb1, 0x96, 0xdf, 0xeb, 0x06, 0xb7, 0x92, 0xe9, 0x95, 0x56, 0x6d, 0xd0, 0x0d, 0x0b, 0xaa,
+  0x1d, 0xc3, 0xbe, 0x9e, 0xc2, 0xf3, 0x62, 0x83, 0x1f, 0xd0, 0xf2, 0x61, 0x2a, 0xcf, 0xc4, 0xb3,
+  0x3f, 0x52, 0x45, 0x79, 0x23, 0xaf, 0x52, 0x52, 0xcd, 0x09, 0x5a, 0x8d, 0x58, 0x71, 0xd6, 0x1a,
+  0xe2, 0xc6, 0x8b, 0x32, 0xc0, 0xa2, 0x88, 0x89, 0x81, 0xce, 0xa4, 0xb1, 0x16, 0x95, 0xd9, 0x93,
+  0x58, 0x06, 0x63, 0x1e, 0xcf, 0x65, 0x7b, 0xf7, 0xdf, 0x2d, 0x87, 0x78, 0x9c, 0xaf, 0xf7, 0x56,
+  0x0d, 0x66, 0x4a, 0x79, 0x81, 0xfb, 0xf6, 0x59, 0x91, 0x86, 0xbf, 0xee, 0xe9, 0x8f, 0x86, 0xa5,
+  0x4e, 0x80, 0x4a, 0xc1, 0x34, 0x39, 0xfb, 0xb1, 0xe0, 0x6c, 0xad, 0x82, 0xb3, 0xd5, 0x0c, 0xce,
+  0xf6, 0x2a, 0x38, 0xdb, 0x75, 0x66, 0x00, 0xfa, 0xaa, 0xfb, 0x59, 0x7c, 0x73, 0x43, 0xe4, 0x51,
+  0x41, 0x1c, 0x18, 0x44, 0x59, 0xe5, 0x47, 0x1f, 0x07, 0xc9, 0x47, 0xe4, 0x6d, 0x8c, 0x25, 0x3f,
+  0x75, 0xf7, 0xbb, 0x57, 0xb1, 0x9a, 0x95, 0xdd, 0x12, 0xc7, 0x37, 0xde, 0xb8, 0x34, 0xb6, 0x39,
+  0xcd, 0x7f, 0xdd, 0xd6, 0x4f, 0xf7, 0xac, 0xc5, 0x6c, 0xb7, 0x45, 0x7f, 0x34, 0x50, 0x03, 0xce,
+  0xb6, 0x61, 0x3f, 0x8a, 0x60, 0xe7, 0x60, 0x80, 0x65, 0xc1, 0x35, 0xe9, 0x00, 0x8e, 0x8a, 0xd1,
+  0x41, 0xe1, 0x95, 0x02, 0x5c, 0x09, 0xb6, 0xd3, 0x7e, 0xa7, 0x8e, 0x9e, 0xaf, 0xf7, 0x9e, 0xde,
+  0x2c, 0xc3, 0xa7, 0xef, 0xdb, 0xdd, 0x57, 0x8f, 0xc7, 0x4d, 0x47, 0xdf, 0x59, 0x38, 0x8e, 0x10,
+  0xc7, 0xd1, 0x63, 0x70, 0x54, 0x30, 0x9b, 0xe0, 0xe9, 0xe9, 0xc4, 0xf5, 0x45, 0x2d, 0x6d, 0xa4,
+  0x15, 0xbd, 0x63, 0xde, 0x82, 0x88, 0xd3, 0x2e, 0xe4, 0x73, 0x76, 0x22, 0xe7, 0xcb, 0x8e, 0xc4,
+  0x4b, 0xb9, 0x3d, 0xe1, 0x5c, 0x1a, 0xd2, 0xc9, 0x2b, 0xe6, 0xcb, 0x5a, 0xe7, 0x01, 0x43, 0xe9,
+  0x63, 0x3d, 0xe2, 0x1f, 0xf8, 0x57, 0x29, 0xc7, 0x48, 0x4e, 0x70, 0x8f, 0x43, 0xb0, 0x61, 0x03,
+  0x76, 0x23, 0xff, 0xc0, 0xf9, 0x3c, 0xda, 0x4e, 0xad, 0x8c, 0x52, 0xdf, 0xe4, 0x95, 0x7e, 0x71,
+  0x2b, 0x55, 0x52, 0x91, 0xbe, 0x6a, 0x83, 0xc1, 0xdd, 0x05, 0x91, 0xe9, 0x60, 0x5d, 0x6f, 0xb2,
+  0x06, 0x6e, 0x9b, 0x49, 0x8b, 0x44, 0x4e, 0xc2, 0xcf, 0x3d, 0x91, 0x07, 0x99, 0x63, 0x78, 0xaa,
+  0x96, 0x71, 0x13, 0x83, 0x62, 0x07, 0x9a, 0x73, 0x54, 0x1d, 0x1a, 0xb0, 0xaa, 0xda, 0x83, 0x03,
+  0xcf, 0xbb, 0xa6, 0xa3, 0xb6, 0x09, 0x2f, 0xaf, 0x56, 0x20, 0x8c, 0x2a, 0x52, 0x86, 0x6d, 0x19,
+  0xee, 0xc6, 0xd2, 0x48, 0xf4, 0x6f, 0xf3, 0xf6, 0x14, 0x7a, 0x6e, 0x35, 0x37, 0x83, 0xed, 0x38,
+  0xb1, 0xe9, 0x30, 0x82, 0x4d, 0xbc, 0x75, 0xbc, 0xe9, 0x39, 0xf2, 0x83, 0xb1, 0x47, 0x42, 0xf8,
+  0xf7, 0x53, 0x18, 0x2f, 0xad, 0x6c, 0x17, 0x1a, 0xf2, 0xc3, 0x46, 0xa4, 0x36, 0x09, 0xf4, 0xb7,
+  0xd9, 0x6d, 0x73, 0xa6, 0x08, 0xe5, 0xc9, 0x20, 0xfc, 0xac, 0x04, 0x3a, 0xbf, 0xff, 0x7d, 0x2f,
+  0x4f, 0xbd, 0xb3, 0x09, 0x18, 0x05, 0x49, 0x2a, 0x8f, 0x60, 0xf3, 0xfd, 0x20, 0x92, 0x74, 0x79,
+  0xe8, 0xdd, 0xd2, 0xb9, 0xa6, 0xb9, 0x32, 0x58, 0x7d, 0x11, 0xc8, 0x19, 0x3b, 0x86, 0x0d, 0x7a,
+  0x8c, 0x5b, 0x0f, 0x83, 0xb3, 0xd3, 0x1d, 0xf1, 0x6e, 0xa3, 0x27, 0x00, 0x9d, 0xad, 0x1e, 0xde,
+  0x0a, 0xf9, 0xe6, 0x7d, 0x1e, 0x4b, 0xaf, 0x48, 0xbe, 0x67, 0x00, 0x50, 0x2f, 0xaa, 0x35, 0x56,
+  0xab, 0xe6, 0x32, 0x4d, 0x6d, 0xfb, 0xef, 0xf2, 0x8b, 0x10, 0xe6, 0x2b, 0x22, 0xd3, 0x15, 0x36,
+  0x77, 0xee, 0xb9, 0x1f, 0xbd, 0xfb, 0x0b, 0xce, 0x84, 0xb3, 0xe1, 0x44, 0xd7, 0x11, 0xac, 0x2d,
+  0x9f, 0x0a, 0xf0, 0x58, 0xdb, 0x71, 0x60, 0x12, 0x30, 0xe8, 0xe8, 0xd8, 0x3c, 0x8e, 0xb8, 0x19,
+  0x34, 0xdb, 0x02, 0xf2, 0x80, 0x29, 0xd7, 0xd7, 0xba, 0xde, 0x05, 0xfb, 0x1e, 0x0f, 0x5d, 0xdd,
+  0x6c, 0x06, 0xc2, 0x37, 0xa8, 0xbc, 0xcb, 0x0d, 0xeb, 0xfa, 0x19, 0x0a, 0x9c, 0x61, 0x09, 0x9a,
+  0xef, 0x70, 0xe0, 0x3d, 0x34, 0x85, 0xdd, 0xba, 0x2e, 0x9f, 0xab, 0xa3, 0xab, 0xe3, 0xa1, 0xb8,
+  0x18, 0xfe, 0xfd, 0xdb, 0xa3, 0x8b, 0xe1, 0x61, 0x85, 0xb3, 0x07, 0x5b, 0xab, 0x5e, 0x30, 0x46,
+  0x9f, 0x62, 0xf0, 0x5c, 0x30, 0x87, 0x98, 0xe1, 0x6e, 0x05, 0x14, 0x95, 0x3f, 0x47, 0x92, 0x6b,
+  0x0a, 0x19, 0xb9, 0x15, 0x8e, 0x77, 0x94, 0x83, 0xfe, 0x33, 0xed, 0xcf, 0x8e, 0xc6, 0xcf, 0x9e,
+  0xf5, 0x5a, 0x46, 0x13, 0xef, 0x94, 0x5c, 0x62, 0xeb, 0xb5, 0x68, 0x14, 0xbd, 0x96, 0xc5, 0x07,
+  0x50, 0x06, 0x93, 0x83, 0x0d, 0x99, 0xbe, 0xbd, 0x16, 0x25, 0x96, 0x68, 0x99, 0xe0, 0xd3, 0x1d,
+  0x3e, 0xb5, 0x87, 0x12, 0x1d, 0x1d, 0x09, 0x82, 0xf6, 0x1e, 0x61, 0xe4, 0xf1, 0xd8, 0x58, 0xd2,
+  0x52, 0x62, 0xa4, 0x35, 0xbc, 0xc2, 0x75, 0x60, 0x51, 0x98, 0x99, 0x3d, 0x77, 0x5c, 0xd0, 0xed,
+  0x73, 0x55, 0x0f, 0x63, 0x49, 0x5d, 0xcf, 0x4a, 0xe1, 0x62, 0x6c, 0xf1, 0xe6, 0xac, 0x13, 0xb8,
+  0xb6, 0xeb, 0x4c, 0xcd, 0xfe, 0xe5, 0x8f, 0xe2, 0xe0, 0x62, 0x08, 0xa4, 0x3d, 0x54, 0x0b, 0xf4,
+  0x20, 0x17, 0xad, 0xb3, 0xf9, 0xa5, 0x4c, 0x40, 0xf6, 0xad, 0xce, 0xed, 0x05, 0x3b, 0xf8, 0x44,
+  0xbb, 0x5e, 0x39, 0xf6, 0xc5, 0x50, 0x6f, 0x95, 0x57, 0x2a, 0xbc, 0x95, 0xfb, 0xed, 0x5c, 0x8a,
+  0x1e, 0xe9, 0xcd, 0x69, 0xa8, 0x20, 0x2a, 0x7c, 0x3b, 0x0f, 0xd3, 0x0f, 0xe5, 0x9e, 0x9e, 0x35,
+  0xd5, 0x43, 0xb9, 0xab, 0x67, 0x1d, 0xed, 0x50, 0xed, 0xef, 0x69, 0xaa, 0x1c, 0xca, 0x9d, 0x3d,
+  0xb5, 0xba, 0xa1, 0xd4, 0xdd, 0xf3, 0x6f, 0x41, 0x43, 0xe4, 0x3e, 0x3a, 0xf4, 0xe5, 0xf0, 0xde,
+  0xaf, 0x70, 0x79, 0x64, 0x4f, 0x38, 0x7e, 0x38, 0xe3, 0x55, 0xc3, 0x26, 0x7c, 0x2e, 0x60, 0xbb,
+  0xc9, 0x68, 0xdd, 0xd2, 0x1e, 0x33, 0xe3, 0xff, 0xe2, 0x53, 0x15, 0x5d, 0xd7, 0x13, 0x6f, 0x13,
+  0xf6, 0x5f, 0xfa, 0x73, 0x30, 0xc6, 0x44, 0x63, 0xaf, 0xc4, 0xd9, 0x35, 0xdd, 0xbf, 0xc6, 0xcc,
+  0x35, 0x37, 0xf3, 0xce, 0x97, 0x7b, 0x6d, 0x17, 0xd2, 0x3d, 0x2b, 0xa8, 0xb2, 0x53, 0x6c, 0x74,
+  0x8f, 0xb6, 0x91, 0x56, 0x21, 0x25, 0x7e, 0xa9, 0xc7, 0x6b, 0x8b, 0xb7, 0xe7, 0x87, 0xb6, 0xb6,
+  0xa0, 0xec, 0x6d, 0x8e, 0xb2, 0x60, 0x31, 0x44, 0x1c, 0x59, 0x8d, 0xda, 0xb4, 0xe4, 0x93, 0xa0,
+  0x9e, 0xa1, 0x57, 0x4f, 0x70, 0x7e, 0x1e, 0x45, 0x06, 0x2f, 0x3c, 0x83, 0x37, 0xa7, 0xe6, 0xce,
+  0xe1, 0xa3, 0xbc, 0xbb, 0xfa, 0xd2, 0xa2, 0x77, 0x75, 0x6a, 0x4f, 0x3c, 0x71, 0x4b, 0x0a, 0x04,
+  0xf2, 0xc8, 0xb1, 0x6a, 0xcc, 0xd6, 0x82, 0xe0, 0x75, 0x75, 0xef, 0x27, 0xbe, 0xe3, 0x00, 0xe5,
+  0xaf, 0x37, 0x3c, 0xe4, 0xa2, 0x11, 0x1e, 0x2b, 0x27, 0x33, 0x90, 0x85, 0xe1, 0xf1, 0xf0, 0x6a,
+  0xb8, 0x23, 0xcc, 0xbd, 0x57, 0xe6, 0x79, 0xb0, 0x2d, 0x5f, 0xb5, 0x4d, 0x56, 0x04, 0x05, 0xdb,
+  0xde, 0x15, 0xab, 0x13, 0x2a, 0xe7, 0x1e, 0x11, 0xd1, 0xcd, 0x29, 0x41, 0x41, 0xf0, 0xae, 0x1a,
+  0xf1, 0x35, 0x3b, 0xba, 0x65, 0xc4, 0x37, 0x96, 0x0d, 0x7e, 0x7c, 0x1f, 0xc6, 0xf4, 0x57, 0x73,
+  0xbd, 0x3c, 0xf4, 0x5a, 0x3e, 0x82, 0x57, 0x79, 0xfc, 0xae, 0x16, 0xc0, 0x6e, 0x73, 0xa2, 0x7b,
+  0x93, 0xe7, 0xcf, 0x0e, 0xa5, 0x30, 0x3c, 0x9a, 0x47, 0xe1, 0x9c, 0x64, 0xc8, 0x4c, 0xf1, 0x24,
+  0x94, 0x11, 0xfc, 0x23, 0x55, 0x92, 0x3a, 0x8a, 0xbc, 0x33, 0x31, 0x75, 0x2e, 0xe7, 0x1e, 0x68,
+  0x53, 0xc0, 0x34, 0x36, 0xc6, 0xc1, 0x57, 0x99, 0x6c, 0xf7, 0xce, 0x8f, 0x9b, 0x65, 0x56, 0xbb,
+  0xe2, 0xad, 0x2b, 0x41, 0x08, 0x55, 0x79, 0x15, 0x14, 0x54, 0x1b, 0x9d, 0x3c, 0xe9, 0xac, 0xce,
+  0x7b, 0xe3, 0x8a, 0x89, 0x5b, 0x52, 0x98, 0x1b, 0x23, 0x17, 0x66, 0xd0, 0x05, 0xe1, 0xb0, 0x7a,
+  0xf3, 0x24, 0xc5, 0xeb, 0x4d, 0x4b, 0x8a, 0x1d, 0x20, 0x3e, 0x1e, 0x1b, 0xc0, 0x47, 0x50, 0xdb,
+  0x00, 0xd5, 0x27, 0xa1, 0x8f, 0x54, 0x0b, 0xc6, 0x64, 0xb0, 0xe9, 0xe9, 0x5d, 0xd5, 0xb2, 0x13,
+  0x32, 0x82, 0x45, 0x64, 0x4e, 0x03, 0x4a, 0xef, 0x6e, 0xb5, 0x5e, 0xe5, 0x7b, 0xbf, 0xc1, 0x60,
+  0xe0, 0xd5, 0xc3, 0x7b, 0xac, 0x66, 0x2a, 0xba, 0x74, 0x03, 0xb8, 0x45, 0x7b, 0x5a, 0x67, 0x02,
+  0xbf, 0x08, 0xb4, 0x5e, 0xa9, 0x2b, 0x1e, 0x68, 0x4f, 0xf8, 0xf6, 0x26, 0xee, 0xca, 0x3c, 0xd8,
+  0x64, 0x2e, 0xaa, 0x8c, 0xa8, 0xde, 0x24, 0xd9, 0xe7, 0xb0, 0x6f, 0x5f, 0x93, 0x3a, 0xdf, 0x3f,
+  0x3c, 0xcc, 0x95, 0xb9, 0x4d, 0xe5, 0xc2, 0xf4, 0xe9, 0x24, 0xab, 0xee, 0xbe, 0x1b, 0x5d, 0x3c,
+  0xe5, 0x33, 0xf3, 0x97, 0xe6, 0xf5, 0xc2, 0xec, 0x14, 0xf8, 0x9d, 0x54, 0x4b, 0xce, 0xf1, 0x4f,
+  0x0a, 0x1c, 0xbf, 0x9a, 0x3c, 0x5a, 0x8d, 0x38, 0xda, 0xa3, 0x11, 0x8b, 0xfb, 0xa4, 0x02, 0xda,
+  0x1e, 0x9a, 0xbb, 0x34, 0x5f, 0xfd, 0xb4, 0x52, 0xc5, 0xc8, 0x7d, 0x0a, 0xc2, 0x28, 0xb8, 0x8e,
+  0xdc, 0x9b, 0x26, 0xf8, 0x77, 0x6b, 0xcd, 0x44, 0x1e, 0x44, 0x72, 0x57, 0x1f, 0xb3, 0xd5, 0x45,
+  0x43, 0x48, 0xcf, 0xe6, 0x1d, 0xce, 0xb5, 0xa5, 0x70, 0xea, 0xf2, 0xd5, 0xec, 0x4c, 0xe5, 0x5c,
+  0x40, 0xb6, 0x55, 0xdf, 0x71, 0xd5, 0xc1, 0x1f, 0xca, 0x16, 0xb0, 0x97, 0x47, 0x47, 0xe2, 0x75,
+  0xc0, 0x9c, 0x33, 0x82, 0x42, 0x4e, 0x09, 0x6b, 0x86, 0x4e, 0xcf, 0xc4, 0xd9, 0xd5, 0x0f, 0xc3,
+  0x0b, 0x81, 0xf3, 0x74, 0x59, 0x61, 0xed, 0x61, 0xfd, 0x9c, 0xea, 0xe7, 0xe1, 0xe8, 0xa3, 0x35,
+  0x59, 0x6e, 0x5f, 0xae, 0xe9, 0x91, 0x8f, 0x73, 0x92, 0xc4, 0x33, 0x92, 0xbf, 0x20, 0x01, 0xbb,
+  0xd8, 0x9e, 0xb3, 0x62, 0x52, 0x56, 0x55, 0x9e, 0x05, 0x23, 0x9c, 0xcc, 0x77, 0xdc, 0xf4, 0xbd,
+  0x9d, 0x5e, 0x7a, 0xf4, 0xb1, 0x34, 0xd7, 0x66, 0xa8, 0x72, 0x41, 0xc3, 0xe7, 0x45, 0xbc, 0xd0,
+  0xe9, 0x8d, 0xcc, 0xbc, 0xeb, 0x9e, 0xf5, 0x15, 0xfd, 0x44, 0xbb, 0xa3, 0x4c, 0xca, 0x4b, 0xd2,
+  0x22, 0xe8, 0xf8, 0x0c, 0xe7, 0xf8, 0x2d, 0xcf, 0xb0, 0xb9, 0xde, 0x16, 0x2a, 0x74, 0xf5, 0xa2,
+  0xc2, 0x08, 0x15, 0x8a, 0xd6, 0x61, 0x8e, 0x5d, 0xb0, 0x9b, 0x27, 0xce, 0x24, 0x6d, 0x54, 0x70,
+  0xe8, 0x36, 0xa5, 0x7d, 0xee, 0xdb, 0x45, 0x33, 0x55, 0xa5, 0xc6, 0x74, 0xef, 0x01, 0xf2, 0xc1,
+  0x01, 0x3b, 0x5b, 0x9f, 0x0a, 0xbc, 0xf5, 0x05, 0xa8, 0x30, 0x54, 0xb2, 0x6d, 0x9f, 0x8a, 0x78,
+  0x3e, 0x8a, 0xe0, 0xf7, 0xde, 0xd3, 0x70, 0xc2, 0xde, 0xe3, 0x01, 0x53, 0x0e, 0x06, 0x96, 0x4d,
+  0x43, 0xe8, 0x64, 0x14, 0xc5, 0xa9, 0x2c, 0xa0, 0xd4, 0xf5, 0xae, 0x15, 0xb2, 0x2b, 0x44, 0x5f,
+  0x87, 0xcf, 0x13, 0xda, 0x7d, 0xee, 0xdf, 0x86, 0x63, 0xcc, 0x65, 0xf0, 0x62, 0x03, 0x13, 0xda,
+  0x09, 0x2c, 0x51, 0xa9, 0xa1, 0xc5, 0x6f, 0x37, 0x3e, 0x4d, 0x77, 0x4b, 0xe1, 0xf0, 0xf5, 0xf8,
+  0x97, 0x2a, 0xec, 0xe5, 0x70, 0x78, 0x3e, 0x3c, 0x3d, 0x1c, 0x9e, 0x1e, 0xfc, 0x62, 0x5f, 0xe4,
+  0x53, 0x5d, 0x2c, 0x60, 0xc2, 0xc2, 0xf9, 0xcd, 0x8e, 0xd8, 0x10, 0xdb, 0xaa, 0x07, 0x4a, 0xa2,
+  0xc7, 0x29, 0x9f, 0x55, 0x1e, 0x3d, 0xa1, 0x2f, 0x55, 0xff, 0xee, 0x77, 0xbf, 0xdb, 0x15, 0x93,
+  0x98, 0x82, 0xe4, 0xfe, 0x11, 0x44, 0x6c, 0x73, 0x9b, 0xb2, 0xec, 0xb5, 0x7e, 0x9e, 0x86, 0xa3,
+  0x29, 0x4f, 0xf6, 0x6c, 0x89, 0xf1, 0xab, 0x32, 0x17, 0x3a, 0xce, 0x6a, 0xfc, 0xaa, 0x55, 0xd2,
+  0xf9, 0x24, 0x92, 0x9f, 0x71, 0x05, 0x12, 0xa0, 0xcf, 0x93, 0x49, 0x14, 0xdf, 0xf6, 0xef, 0x76,
+  0x44, 0xb0, 0xcc, 0xe2, 0x5d, 0xd1, 0x08, 0xaf, 0xa7, 0x78, 0x53, 0xd2, 0x93, 0x5e, 0xa3, 0x12,
+  0x0a, 0x77, 0xbd, 0xfb, 0x26, 0xb9, 0x42, 0xc9, 0x55, 0x3e, 0xba, 0xc7, 0x97, 0xcf, 0x26, 0x27,
+  0x4c, 0xb2, 0x74, 0x27, 0xdf, 0xf6, 0x3b, 0x1a, 0xc3, 0x7e, 0x48, 0xd5, 0x36, 0x53, 0xa8, 0x06,
+  0xa3, 0xce, 0x40, 0x61, 0x8d, 0x84, 0x51, 0xed, 0x8a, 0x20, 0x82, 0xfd, 0x13, 0xf5, 0x96, 0xee,
+  0x88, 0x11, 0xcc, 0xaa, 0x4c, 0x76, 0xc5, 0x4d, 0xb0, 0x80, 0xf1, 0x2a, 0xd4, 0x1d, 0x4a, 0x20,
+  0x4d, 0x6f, 0xd5, 0xc4, 0x5e, 0xc7, 0xd1, 0x38, 0xa7, 0xf9, 0x64, 0x32, 0x81, 0xd1, 0xc3, 0xd0,
+  0x15, 0x27, 0x6c, 0x73, 0xf3, 0xdf, 0x28, 0x34, 0xea, 0xc8, 0x8a, 0x55, 0x9c, 0x6b, 0xcb, 0x74,
+  0x44, 0x31, 0x96, 0xa3, 0x38, 0xa1, 0xac, 0xa8, 0x3b, 0x02, 0x2d, 0xcd, 0x7e, 0x36, 0x4d, 0xe2,
+  0xe5, 0xcd, 0x34, 0xef, 0xf2, 0xdb, 0x6f, 0xbf, 0xdd, 0xb5, 0x2e, 0x36, 0x2b, 0x45, 0x9a, 0x67,
+  0x9c, 0xf3, 0xa0, 0xda, 0x7d, 0xdb, 0xd7, 0xef, 0x1d, 0x4e, 0xd9, 0x24, 0xac, 0xff, 0xfc, 0xdf,
+  0xfe, 0xb3, 0x38, 0x3c, 0x3b, 0x1d, 0xea, 0xd4, 0x57, 0x6e, 0x82, 0x39, 0x75, 0x1b, 0x52, 0x9d,
+  0x15, 0xb4, 0xdb, 0xdd, 0xd2, 0xdc, 0x73, 0xcc, 0xe3, 0xc5, 0xcb, 0xa7, 0x7c, 0x6b, 0x98, 0x7f,
+  0x3c, 0x75, 0x2b, 0x5f, 0x67, 0x73, 0x6b, 0x72, 0x2b, 0x45, 0xf2, 0x20, 0x98, 0x8f, 0x64, 0xb4,
+  0xe2, 0xea, 0xe6, 0x07, 0x3f, 0x08, 0x8f, 0x93, 0x21, 0xef, 0x8f, 0xff, 0x18, 0xe0, 0x34, 0xa3,
+  0x1e, 0xe9, 0xb4, 0xaf, 0x29, 0x35, 0x32, 0x74, 0x40, 0xd9, 0x48, 0x94, 0x7a, 0xd1, 0xab, 0x68,
+  0xa5, 0xcf, 0xc3, 0x28, 0x97, 0x83, 0xcb, 0x4b, 0xde, 0x30, 0x69, 0xe5, 0x7e, 0x17, 0xd5, 0x25,
+  0xfc, 0xa5, 0xef, 0xb8, 0x08, 0xf1, 0x51, 0x12, 0x29, 0x76, 0x17, 0x98, 0xfe, 0xe4, 0x86, 0xdd,
+  0x7d, 0x68, 0x0d, 0x1c, 0xb9, 0xa0, 0xc7, 0x1d, 0x94, 0xdc, 0x6d, 0xbe, 0x80, 0x09, 0xa3, 0x20,
+  0x61, 0x4c, 0xb5, 0x39, 0x87, 0xb5, 0xf3, 0x37, 0x9b, 0x9b, 0x60, 0x2c, 0x5e, 0xd3, 0x8b, 0x1b,
+  0xf0, 0x7d, 0xf1, 0x59, 0xa4, 0x71, 0x04, 0x7d, 0xfd, 0x66, 0x7b, 0x7b, 0x7b, 0xb7, 0xe5, 0xc9,
+  0x27, 0x31, 0xb9, 0xca, 0x2b, 0xbd, 0x23, 0x16, 0x30, 0x9f, 0x28, 0x00, 0xad, 0x2c, 0x09, 0xe6,
+  0x69, 0xc8, 0xbc, 0x17, 0x44, 0x91, 0xd8, 0x18, 0x6c, 0xd1, 0xa5, 0x4c, 0x17, 0x8f, 0x9d, 0x29,
+  0x2a, 0x04, 0x15, 0x00, 0x9d, 0x77, 0x1f, 0xe0, 0x7f, 0x34, 0x06, 0x7d, 0x5b, 0x3e, 0x18, 0x2e,
+  0xde, 0xa9, 0xc6, 0x5c, 0xbb, 0xf0, 0x27, 0x66, 0x32, 0xfe, 0x43, 0x07, 0x86, 0x40, 0xcb, 0x05,
+  0x4e, 0xd3, 0xbb, 0xfc, 0xb2, 0x14, 0x66, 0xdc, 0x07, 0x41, 0x7b, 0xfa, 0x5e, 0x14, 0x86, 0xef,
+  0x74, 0x38, 0x79, 0x81, 0xff, 0x29, 0x74, 0x38, 0x1e, 0x8f, 0xd7, 0x00, 0x5a, 0x3e, 0x16, 0x42,
+  0xda, 0x83, 0xbb, 0xb1, 0xb1, 0x81, 0x70, 0x6d, 0xfe, 0xc2, 0xc4, 0x2c, 0x4e, 0x90, 0x27, 0xcd,
+  0x62, 0x61, 0xd7, 0xe8, 0x2b, 0x2b, 0xbd, 0xe0, 0x71, 0x3a, 0x8d, 0x87, 0xd9, 0x7b, 0x26, 0x67,
+  0xc7, 0x55, 0x83, 0x56, 0x76, 0xde, 0x0e, 0x32, 0x12, 0xf1, 0xdc, 0xe8, 0x89, 0x6a, 0xec, 0xfb,
+  0xdd, 0xd0, 0xc4, 0x3d, 0x3d, 0xbb, 0x12, 0x6f, 0xce, 0xde, 0x9e, 0xba, 0x7b, 0xe5, 0x0a, 0xc1,
+  0xf4, 0x1d, 0x72, 0xc5, 0x9c, 0x23, 0x26, 0xf3, 0xaf, 0xca, 0xc0, 0xe3, 0xf6, 0xb8, 0x7f, 0x7c,
+  0x31, 0xdc, 0x3f, 0xfc, 0x45, 0x6d, 0x3b, 0xd6, 0xec, 0xb0, 0xd8, 0x19, 0x99, 0x26, 0x7a, 0xc4,
+  0xd5, 0xd6, 0x7c, 0xbe, 0xec, 0xba, 0xfb, 0x9d, 0x3a, 0x47, 0x8e, 0xeb, 0xb8, 0x2f, 0x74, 0x0d,
+  0x26, 0x6b, 0xd9, 0x0d, 0xb8, 0x27, 0xfa, 0x02, 0x51, 0xb1, 0x41, 0x49, 0x42, 0xa3, 0x12, 0xaf,
+  0x49, 0xc5, 0x60, 0xd8, 0x87, 0x52, 0x49, 0x23, 0xfb, 0x64, 0xac, 0xbc, 0x8e, 0x6b, 0x61, 0xd5,
+  0x79, 0x7b, 0x5d, 0xb3, 0x4a, 0x87, 0x5d, 0x53, 0x33, 0x84, 0xc2, 0xd1, 0x18, 0x56, 0xa8, 0x72,
+  0x71, 0x3f, 0xf8, 0x95, 0xd9, 0xbf, 0xe0, 0xbe, 0xfb, 0x7a, 0x64, 0xb5, 0x78, 0xe4, 0xf8, 0xe8,
+  0xf4, 0x47, 0x71, 0x31, 0x3c, 0x39, 0xfb, 0xe9, 0x6b, 0xf1, 0x87, 0x47, 0x1b, 0x5e, 0x28, 0x74,
+  0x32, 0xd4, 0x9c, 0x16, 0x73, 0x75, 0x8d, 0x67, 0xfd, 0x28, 0xad, 0x92, 0x63, 0x89, 0xe6, 0x80,
+  0x6a, 0xce, 0x24, 0x9a, 0x9f, 0x39, 0x56, 0xc5, 0x71, 0x29, 0xf5, 0x43, 0xd9, 0x71, 0x5d, 0x05,
+  0xa0, 0x03, 0xbf, 0x4f, 0xf7, 0x4f, 0x9a, 0x9f, 0xe6, 0xe5, 0x19, 0x62, 0xdd, 0x03, 0x3d, 0x13,
+  0x5c, 0x81, 0x67, 0x7a, 0xd8, 0x99, 0x73, 0x66, 0xb7, 0x43, 0x14, 0xe9, 0xb5, 0x74, 0x34, 0xd4,
+  0x4e, 0x59, 0x22, 0x74, 0xfb, 0x48, 0x4f, 0xa7, 0x9e, 0x56, 0xbe, 0x15, 0x3c, 0xaa, 0x73, 0x72,
+  0xb8, 0xea, 0x83, 0xb8, 0x3c, 0xd9, 0x65, 0x31, 0x80, 0x70, 0x3d, 0x2f, 0xa5, 0xa6, 0x86, 0x75,
+  0x04, 0xe7, 0xe6, 0xcc, 0xcd, 0x7b, 0x1b, 0xd0, 0xde, 0x2c, 0x3f, 0xa0, 0x53, 0xc5, 0xf6, 0x19,
+  0x5d, 0x8e, 0x97, 0x7d, 0x6b, 0x60, 0x1c, 0x6a, 0x68, 0x87, 0x32, 0x03, 0xfb, 0xdc, 0x4e, 0x5e,
+  0xd1, 0x3c, 0x59, 0x6d, 0x69, 0xae, 0x4f, 0x9a, 0x64, 0x93, 0xb6, 0x76, 0x65, 0xe4, 0x74, 0x6d,
+  0xbc, 0x61, 0xc3, 0xcc, 0xb5, 0xb5, 0x91, 0x87, 0x35, 0x19, 0x6b, 0x1f, 0x1e, 0x90, 0xe8, 0x27,
+  0x4a, 0xfe, 0x0a, 0xc1, 0x9d, 0xeb, 0x05, 0x66, 0x56, 0x07, 0x78, 0xfe, 0x1b, 0x09, 0xa3, 0x65,
+  0x04, 0x8b, 0x9a, 0xed, 0x2f, 0xc2, 0x5d, 0xff, 0x5f, 0x69, 0xd6, 0x2b, 0x4d, 0x5b, 0x8e, 0xd0,
+  0x3b, 0x45, 0xe2, 0x54, 0x26, 0x18, 0x7c, 0xc8, 0x99, 0x7f, 0x2b, 0x3d, 0xce, 0x6c, 0xa6, 0xe0,
+  0xaa, 0x57, 0x55, 0x8d, 0x79, 0xd9, 0xa9, 0xa1, 0xaf, 0xc1, 0xec, 0x1c, 0xfe, 0x5f, 0x08, 0x71,
+  0xe7, 0xec, 0x50, 0xa9, 0xf3, 0x9c, 0xd0, 0xde, 0x69, 0xe1, 0x34, 0x98, 0x8f, 0x23, 0xa9, 0x42,
+  0x08, 0xf7, 0xa9, 0xac, 0xc3, 0x3b, 0xd3, 0xd2, 0x28, 0xc2, 0x87, 0xe7, 0xe9, 0x2e, 0xf2, 0xa4,
+  0xc9, 0x79, 0x4c, 0xdd, 0xe5, 0x89, 0x8e, 0xe9, 0x14, 0x7c, 0x67, 0x65, 0xae, 0xf3, 0xaa, 0x34,
+  0xe9, 0xbb, 0xad, 0x32, 0xe5, 0xed, 0x25, 0x30, 0x1e, 0x2f, 0x17, 0xb0, 0x95, 0x0e, 0x38, 0x57,
+  0xb1, 0x4a, 0xd0, 0xb7, 0xa0, 0x77, 0x8a, 0x06, 0x03, 0x3d, 0xac, 0x9e, 0xa8, 0x5a, 0x35, 0x89,
+  0xcc, 0x3b, 0x8e, 0xf2, 0xa5, 0x2b, 0x80, 0x9d, 0x03, 0x00, 0xd2, 0x6d, 0x97, 0xae, 0x80, 0x08,
+  0xbf, 0x94, 0x0d, 0x6c, 0x8b, 0xfb, 0xed, 0xf9, 0xf1, 0xd1, 0x41, 0x31, 0xac, 0xc4, 0x9f, 0x73,
+  0x05, 0xcb, 0x19, 0x91, 0x7e, 0x7c, 0x62, 0xc7, 0xb0, 0xa6, 0xf5, 0x06, 0xc8, 0x13, 0xbf, 0xac,
+  0x1e, 0x91, 0x02, 0x04, 0xbc, 0x07, 0x7a, 0x71, 0xf0, 0xc3, 0x11, 0x5a, 0x79, 0xe8, 0xf2, 0x78,
+  0x7b, 0x6a, 0x7e, 0x36, 0xe0, 0x4d, 0x36, 0xfd, 0x72, 0x3b, 0xa1, 0x00, 0xfe, 0xbe, 0x30, 0x3d,
+  0x9c, 0x85, 0x6a, 0x87, 0xef, 0x6e, 0xba, 0xa7, 0xb3, 0xfa, 0x16, 0x1c, 0x9f, 0xd2, 0xfa, 0x73,
+  0x60, 0x9d, 0xd3, 0x2e, 0xdc, 0xa4, 0x50, 0x16, 0xb3, 0xda, 0xef, 0xa0, 0x28, 0x6f, 0xbd, 0xcd,
+  0x3f, 0x4d, 0x0e, 0x5d, 0xf3, 0xa3, 0x80, 0x27, 0x25, 0xcc, 0xbe, 0x3a, 0x17, 0x7e, 0x45, 0x2e,
+  0x7f, 0xfd, 0x88, 0xd6, 0x4a, 0x6d, 0xf1, 0xd0, 0x33, 0xdc, 0xca, 0x29, 0x62, 0x3f, 0x83, 0x4e,
+  0xb3, 0x7d, 0xdf, 0x0a, 0xd2, 0xbb, 0xf9, 0x48, 0x38, 0x71, 0x4b, 0x4e, 0xaa, 0x29, 0xab, 0xc7,
+  0x1f, 0xf7, 0x7f, 0x81, 0xed, 0xe1, 0x11, 0x25, 0xd6, 0x04, 0xf1, 0xd1, 0x1d, 0x16, 0xee, 0x0b,
+  0x34, 0x08, 0x60, 0x2f, 0x5e, 0x3e, 0x50, 0x0b, 0x06, 0x59, 0x24, 0x57, 0xf1, 0xd6, 0x61, 0x2c,
+  0xfa, 0xe2, 0x12, 0xd3, 0x1e, 0xfc, 0x88, 0x69, 0x0f, 0xda, 0x5e, 0x57, 0xe6, 0x4e, 0x41, 0x93,
+  0xbe, 0xec, 0xcb, 0x09, 0x76, 0x37, 0x3f, 0x9f, 0x5d, 0xfc, 0x58, 0x05, 0x78, 0xab, 0x21, 0xe0,
+  0xad, 0x32, 0xc0, 0xe7, 0xc3, 0x8b, 0xcb, 0xb3, 0xd3, 0xfd, 0xe3, 0x2a, 0xe0, 0xdb, 0x0d, 0x81,
+  0x6f, 0x97, 0x02, 0x67, 0xb1, 0xb8, 0xf4, 0x81, 0xab, 0xbb, 0x08, 0x62, 0xdd, 0x3b, 0x0d, 0xaf,
+  0xd4, 0xdd, 0x05, 0x94, 0x77, 0x4e, 0xec, 0x63, 0x9e, 0x15, 0x0d, 0x52, 0xef, 0x26, 0x43, 0xb3,
+  0x99, 0x35, 0x17, 0xe2, 0x51, 0x44, 0x8a, 0x40, 0xb4, 0x50, 0xf8, 0x59, 0x01, 0x82, 0xc5, 0xaa,
+  0x0b, 0xf7, 0x85, 0x2e, 0x5e, 0x15, 0xc9, 0x93, 0xf3, 0x4c, 0x9f, 0xd8, 0x48, 0x91, 0xa9, 0xd8,
+  0xd9, 0xaa, 0x4c, 0x22, 0x56, 0x67, 0x9c, 0x4f, 0xa4, 0xa4, 0x33, 0x3f, 0x2f, 0x47, 0x45, 0x67,
+  0x3a, 0xc9, 0x42, 0xc3, 0xe1, 0x99, 0x64, 0x1b, 0x55, 0x63, 0xac, 0xef, 0xe6, 0x1c, 0x4c, 0x59,
+  0x28, 0x1f, 0xaf, 0xd3, 0xd5, 0x42, 0xb5, 0x31, 0xdd, 0x35, 0xe8, 0xa7, 0x3e, 0xc3, 0x81, 0xdf,
+  0x03, 0x66, 0x3a, 0x58, 0x7b, 0x28, 0x4d, 0xe7, 0x48, 0x77, 0xf2, 0xd8, 0x89, 0xb2, 0x12, 0x53,
+  0x34, 0xe8, 0x55, 0x27, 0x35, 0x59, 0x73, 0x9a, 0xb8, 0xd9, 0x3a, 0xb3, 0xa4, 0x3a, 0x5a, 0x6b,
+  0x92, 0xb8, 0x4d, 0xb3, 0x39, 0x52, 0xf0, 0xd7, 0x9b, 0x22, 0x6e, 0xd4, 0x74, 0x86, 0x54, 0x17,
+  0x8d, 0x27, 0x48, 0x35, 0x68, 0xe3, 0x85, 0xaa, 0x51, 0x10, 0x5d, 0x66, 0x71, 0x12, 0xdc, 0x48,
+  0xd4, 0x76, 0x14, 0x46, 0xd1, 0xf6, 0xb0, 0x81, 0x55, 0xf0, 0xef, 0x40, 0xe5, 0xc2, 0x26, 0x10,
+  0x53, 0xae, 0x87, 0x93, 0xbb, 0x4e, 0x09, 0xca, 0xfc, 0x6e, 0x41, 0x39, 0x3c, 0xea, 0xb4, 0x1e,
+  0x5a, 0x6a, 0x81, 0x29, 0xdc, 0xd5, 0xb1, 0xbd, 0xb8, 0xbf, 0xec, 0x5f, 0x1c, 0xef, 0x5f, 0x08,
+  0xbd, 0x5c, 0x1e, 0x1e, 0xb5, 0x95, 0x33, 0xc4, 0xbb, 0x39, 0x54, 0xa7, 0x20, 0x61, 0xfd, 0x9e,
+  0x85, 0xa9, 0x1c, 0x04, 0x51, 0xd4, 0x79, 0xc7, 0x8a, 0xde, 0x5a, 0x99, 0xaf, 0x62, 0xb5, 0xac,
+  0x77, 0x7b, 0xe6, 0x9b, 0x07, 0xa4, 0xd3, 0x6d, 0xbd, 0xef, 0x96, 0xe7, 0x0d, 0x8b, 0x61, 0x9f,
+  0x4c, 0x45, 0x9d, 0xf6, 0x6b, 0xe3, 0xeb, 0xa7, 0x95, 0x5f, 0x50, 0xf1, 0x0e, 0xde, 0x89, 0xc0,
+  0x3f, 0xf4, 0xe3, 0x3d, 0x3a, 0xd7, 0x45, 0x35, 0x1a, 0x5f, 0xa9, 0x23, 0x7b, 0xc7, 0x52, 0x77,
+  0x91, 0x2e, 0x7f, 0x86, 0x73, 0xfd, 0x35, 0x23, 0x4f, 0xfa, 0xb5, 0xf6, 0x0a, 0xe0, 0xa7, 0x4d,
+  0x7a, 0x90, 0x3e, 0xf7, 0x80, 0x3c, 0x4e, 0x5b, 0x7b, 0xc0, 0xd6, 0x57, 0xc9, 0x1e, 0x80, 0x87,
+  0x29, 0x5c, 0x2f, 0x1b, 0xd4, 0x43, 0xd4, 0xa7, 0x0b, 0xe2, 0x51, 0xca, 0xd1, 0x05, 0xb5, 0xb6,
+  0x06, 0x74, 0x9b, 0x3f, 0x48, 0xbf, 0x99, 0xf4, 0x56, 0x94, 0x29, 0x87, 0xff, 0x75, 0xee, 0xa2,
+  0x96, 0x9b, 0x3e, 0xba, 0x19, 0xa7, 0x06, 0xe3, 0x7f, 0x57, 0x34, 0xc3, 0x2a, 0xbb, 0x4e, 0x76,
+  0x2a, 0xea, 0xd2, 0xfa, 0x51, 0x0b, 0xc0, 0xaa, 0xe7, 0x40, 0xd1, 0xf4, 0xef, 0xfa, 0x5c, 0xda,
+  0x04, 0x9a, 0xae, 0xeb, 0x40, 0xc4, 0xb4, 0x3e, 0xe6, 0xcf, 0x26, 0x50, 0x8e, 0xce, 0x9d, 0xf6,
+  0x4c, 0x13, 0xeb, 0x47, 0x13, 0x18, 0x39, 0x75, 0x72, 0xce, 0xec, 0x5a, 0x5c, 0x5a, 0x0b, 0x23,
+  0xaf, 0x66, 0x83, 0xc8, 0x29, 0xe3, 0xfe, 0x6e, 0x00, 0xca, 0xa5, 0x8b, 0xe6, 0xce, 0xae, 0xe1,
+  0xd3, 0x06, 0x20, 0x34, 0x51, 0x72, 0xde, 0xec, 0x5a, 0x7c, 0xda, 0x00, 0x00, 0x53, 0xa4, 0xb0,
+  0xeb, 0xcb, 0x24, 0x3e, 0x90, 0xfb, 0x26, 0x54, 0x39, 0x9f, 0xd0, 0x39, 0x84, 0x41, 0x0a, 0xd6,
+  0xc1, 0x7e, 0x4a, 0x67, 0xf5, 0xe6, 0xed, 0x26, 0x9d, 0x10, 0xae, 0xdd, 0x7a, 0xb5, 0xae, 0xfe,
+  0x63, 0x2c, 0x5b, 0x3b, 0x6b, 0x2a, 0x08, 0xc7, 0x0b, 0x88, 0x45, 0xde, 0xe6, 0x74, 0x78, 0x7a,
+  0x35, 0xbc, 0x10, 0x3f, 0x1f, 0xbd, 0x39, 0x12, 0xa4, 0x80, 0xea, 0x72, 0xe7, 0xe4, 0xcd, 0x3e,
+  0x5c, 0x0d, 0x2f, 0xaf, 0x8e, 0x4e, 0xbf, 0x17, 0xfc, 0x94, 0x86, 0x97, 0x57, 0x9c, 0xc0, 0xc1,
+  0x4e, 0xf7, 0x03, 0xe6, 0x43, 0x4a, 0xee, 0x0c, 0x35, 0xf2, 0xd4, 0x9f, 0x22, 0xb8, 0x0d, 0xc2,
+  0x4c, 0x94, 0xa5, 0x0b, 0x45, 0x9a, 0xe2, 0xa3, 0x2f, 0xad, 0x99, 0xcc, 0xa6, 0xf1, 0x18, 0x76,
+  0x57, 0xe7, 0x67, 0x88, 0x51, 0x8b, 0x1f, 0x31, 0x49, 0x77, 0xc4, 0x17, 0xca, 0x7d, 0x86, 0x21,
+  0x0e, 0xfd, 0x2b, 0xbc, 0xbe, 0x82, 0xc9, 0xe7, 0x16, 0xec, 0xaf, 0x82, 0x19, 0x78, 0x8e, 0xb9,
+  0x44, 0xdb, 0xe2, 0xbe, 0xd7, 0x1a, 0x25, 0x72, 0x0c, 0x95, 0xc2, 0x20, 0x82, 0x46, 0x6d, 0x75,
+  0x84, 0x0c, 0x80, 0xf0, 0x60, 0x7f, 0xc7, 0xb7, 0x54, 0xbe, 0xa8, 0x4b, 0x04, 0x34, 0x63, 0xf7,
+  0x5d, 0xf3, 0x12, 0x95, 0x49, 0x51, 0x1a, 0x5b, 0xcf, 0x13, 0xf1, 0xf1, 0xac, 0x1a, 0x84, 0x97,
+  0xc4, 0xd4, 0xb6, 0x69, 0x38, 0x69, 0x17, 0xa7, 0xa7, 0xa2, 0x94, 0x6d, 0x67, 0xa7, 0xa7, 0xb0,
+  0x07, 0x3d, 0x3a, 0x3b, 0x15, 0x67, 0x3f, 0xd2, 0xce, 0xd1, 0x2a, 0x79, 0xb3, 0x7f, 0x74, 0x4c,
+  0x7e, 0x09, 0xbf, 0x15, 0x55, 0x34, 0xd3, 0x61, 0xac, 0x0a, 0xfb, 0xc8, 0x1d, 0x66, 0x23, 0x6f,
+  0x6f, 0xd5, 0x85, 0xda, 0x64, 0x61, 0x08, 0x36, 0x31, 0xba, 0x45, 0x03, 0x83, 0x72, 0x96, 0x21,
+  0xcd, 0x8b, 0xa6, 0x45, 0xa1, 0x83, 0xe1, 0xfe, 0xd5, 0xdb, 0x8b, 0x21, 0x9d, 0xed, 0xef, 0xff,
+  0x04, 0xbd, 0xed, 0xbf, 0x3e, 0x1e, 0xfa, 0xfd, 0x15, 0x5f, 0x90, 0xa6, 0x87, 0x90, 0x53, 0xef,
+  0x2a, 0x57, 0xfa, 0xa0, 0x07, 0xfc, 0x2c, 0x97, 0x55, 0xf3, 0xd7, 0x90, 0xd9, 0x3d, 0x55, 0x7c,
+  0x91, 0x99, 0x82, 0x85, 0x00, 0xfd, 0x8e, 0xec, 0xda, 0xb9, 0x61, 0xe9, 0x79, 0x2c, 0xa9, 0xa2,
+  0xfc, 0x06, 0x74, 0xf0, 0x8d, 0x14, 0x78, 0x67, 0x47, 0x94, 0xbd, 0xd7, 0x6b, 0xd5, 0x13, 0xa8,
+  0x8d, 0x91, 0x10, 0xdc, 0x87, 0x79, 0x7b, 0x5e, 0x46, 0xdd, 0xc2, 0x2d, 0xb1, 0xc2, 0xfd, 0x35,
+  0x19, 0x15, 0xef, 0xa5, 0x51, 0x2e, 0xb2, 0x68, 0x30, 0xe3, 0x17, 0x91, 0x31, 0x4b, 0x99, 0xfd,
+  0x48, 0x0f, 0xfb, 0xee, 0x8a, 0x17, 0x58, 0x0c, 0x53, 0x14, 0x9a, 0x17, 0x1f, 0xdb, 0xb0, 0x61,
+  0x14, 0xaf, 0x12, 0x94, 0x21, 0x67, 0x87, 0x1f, 0x37, 0xea, 0x8a, 0xcf, 0xeb, 0xb9, 0xa3, 0xba,
+  0x58, 0xee, 0x47, 0x74, 0x56, 0x78, 0x6b, 0xc5, 0xee, 0xad, 0x24, 0x52, 0xa0, 0xac, 0x2b, 0x15,
+  0x4a, 0x52, 0xdd, 0x89, 0xf7, 0x4c, 0xc0, 0x80, 0x9f, 0x15, 0xd0, 0xfa, 0xb3, 0x34, 0x51, 0x54,
+  0x73, 0x60, 0xfa, 0x21, 0x01, 0xca, 0x83, 0x50, 0xb8, 0xb3, 0xd3, 0x1c, 0x8e, 0x7a, 0x7a, 0x41,
+  0xb9, 0x75, 0xcb, 0xc2, 0xc1, 0x75, 0x9c, 0x47, 0x95, 0x1c, 0x7c, 0x94, 0x77, 0x8b, 0x04, 0xf3,
+  0xe7, 0xd5, 0x8b, 0x82, 0x62, 0xce, 0x01, 0x54, 0x27, 0x9f, 0x6e, 0x7b, 0x88, 0x11, 0x5f, 0x6d,
+  0x62, 0xff, 0x0a, 0x46, 0xa0, 0x97, 0x3c, 0xda, 0x45, 0x51, 0xc0, 0x47, 0x57, 0x00, 0x70, 0xe4,
+  0x1d, 0x79, 0x51, 0x48, 0x86, 0xba, 0x79, 0x51, 0xb8, 0x9a, 0x51, 0x23, 0x36, 0xea, 0xbe, 0xc6,
+  0x6e, 0x4b, 0x43, 0x54, 0xa7, 0x98, 0x3c, 0x6c, 0xe3, 0xd7, 0x7e, 0xac, 0x06, 0x18, 0x78, 0x2f,
+  0x04, 0x9b, 0xdc, 0x81, 0x51, 0xd7, 0x7f, 0x93, 0xb6, 0x04, 0x57, 0xeb, 0xf5, 0xd8, 0xdd, 0x95,
+  0x78, 0xf1, 0x71, 0x13, 0xa5, 0x9a, 0x78, 0x2c, 0x76, 0x4f, 0x10, 0x3d, 0x4d, 0x7f, 0x39, 0xc0,
+  0xbb, 0xf0, 0xd0, 0xd7, 0xa1, 0x9c, 0x04, 0xcb, 0x28, 0xd3, 0xab, 0x95, 0x93, 0x22, 0xa3, 0x5c,
+  0x5a, 0x0a, 0xf8, 0x6b, 0xf5, 0xfe, 0x33, 0xbd, 0x78, 0x8f, 0x0f, 0xb6, 0x65, 0x2a, 0xe2, 0xbd,
+  0xf8, 0x45, 0x8f, 0xd5, 0x7a, 0xd1, 0x56, 0x66, 0xc1, 0xcd, 0x41, 0x00, 0xbc, 0xa2, 0x82, 0xdd,
+  0x4f, 0x02, 0x8a, 0x50, 0xf7, 0x0c, 0x2c, 0x32, 0x10, 0xa8, 0xda, 0xb8, 0xb3, 0x4c, 0x22, 0xeb,
+  0xbd, 0x28, 0x2a, 0x43, 0x4a, 0x68, 0x38, 0xb8, 0x10, 0x50, 0x1d, 0xcd, 0x66, 0x31, 0x1d, 0xf0,
+  0xf1, 0x03, 0x82, 0xe5, 0xa6, 0x80, 0xce, 0x3e, 0xc0, 0xc0, 0x10, 0xb8, 0x6a, 0x33, 0x50, 0xb6,
+  0x06, 0xb5, 0x6d, 0x1f, 0x4d, 0xfa, 0xa7, 0xf1, 0x5c, 0xf6, 0xe9, 0x9d, 0x7a, 0xb0, 0x36, 0xb8,
+  0xfa, 0x00, 0x7b, 0x46, 0x08, 0xf7, 0xf5, 0xd6, 0x0d, 0xa0, 0xd4, 0xd3, 0xb8, 0xf8, 0x36, 0x85,
+  0x4a, 0x47, 0x8b, 0x96, 0xe1, 0xf6, 0xc6, 0x37, 0x74, 0xd5, 0xce, 0xa0, 0x62, 0xd2, 0x2e, 0xc4,
+  0xf8, 0xf4, 0x61, 0x82, 0x29, 0x13, 0xb8, 0x3a, 0x46, 0x08, 0x7f, 0xc3, 0x3c, 0x6f, 0x70, 0xe1,
+  0x7b, 0x3c, 0x88, 0x51, 0x25, 0x7a, 0x4a, 0xea, 0x2c, 0x7b, 0x06, 0x6c, 0x0b, 0xcf, 0x82, 0xc1,
+  0x3a, 0x9d, 0xae, 0xca, 0xfe, 0x91, 0xcf, 0x93, 0xdd, 0x4c, 0x51, 0x86, 0xa8, 0xdd, 0x1e, 0x5e,
+  0x05, 0x37, 0xed, 0xa2, 0xa1, 0x84, 0x03, 0xc1, 0x76, 0xf4, 0x60, 0xa7, 0x99, 0x9f, 0x94, 0xe7,
+  0x07, 0xcf, 0xba, 0xb0, 0x90, 0x47, 0x60, 0x9e, 0x29, 0xb7, 0x06, 0x6b, 0x41, 0xca, 0xc7, 0xec,
+  0xd1, 0x4c, 0x5f, 0x5d, 0xb2, 0x46, 0x49, 0x0f, 0x87, 0xfd, 0x0c, 0x26, 0x64, 0xba, 0x08, 0x46,
+  0xf2, 0x4d, 0x88, 0xd9, 0x60, 0x15, 0xbb, 0x24, 0x4b, 0x4a, 0x61, 0x43, 0x2b, 0xdf, 0x34, 0x4c,
+  0xed, 0xa3, 0x2f, 0xbc, 0x7d, 0x45, 0x65, 0xda, 0x2a, 0x31, 0x05, 0x5e, 0x4c, 0x0f, 0x2a, 0x95,
+  0x73, 0x18, 0x79, 0x3c, 0xa7, 0x0c, 0xd2, 0x76, 0x15, 0xff, 0x7c, 0xca, 0xfe, 0xc6, 0x4f, 0xb4,
+  0x52, 0xd6, 0xdd, 0xc8, 0xb4, 0x73, 0x0e, 0x4c, 0xe1, 0xdb, 0xa6, 0x55, 0x7e, 0xa5, 0x0d, 0x05,
+  0x5d, 0x88, 0xd9, 0x2b, 0x52, 0x3e, 0x5b, 0xdf, 0x50, 0x45, 0x28, 0x94, 0x43, 0x9e, 0x18, 0xea,
+  0x51, 0xa8, 0xff, 0x7b, 0xfe, 0x9c, 0x4d, 0xd3, 0x4f, 0x80, 0x27, 0xb6, 0x88, 0x27, 0x22, 0x03,
+  0x09, 0xe3, 0xe7, 0x7e, 0x05, 0x66, 0x9d, 0x49, 0x45, 0x07, 0x27, 0x0d, 0xbf, 0x90, 0xd5, 0x6d,
+  0x24, 0x93, 0x01, 0x73, 0x4d, 0x35, 0x64, 0x0e, 0x84, 0xcb, 0x6f, 0xa2, 0x20, 0xf8, 0x51, 0xfe,
+  0xe9, 0x76, 0x0a, 0xaa, 0x27, 0x37, 0xc9, 0x82, 0x04, 0x56, 0x2b, 0xd8, 0x12, 0xd9, 0xf4, 0xb5,
+  0x81, 0x5a, 0x6f, 0xd0, 0x58, 0x20, 0x09, 0x67, 0x03, 0x83, 0x41, 0xf2, 0x4c, 0x20, 0x3c, 0x8c,
+  0x20, 0xd6, 0x30, 0xf9, 0xc6, 0x11, 0xff, 0x49, 0xef, 0xd7, 0x90, 0x70, 0xea, 0xa6, 0x3b, 0x62,
+  0x83, 0xef, 0x0d, 0xf1, 0x5f, 0xf8, 0x02, 0x0e, 0x5e, 0x2d, 0xb8, 0xd7, 0x93, 0x81, 0x8f, 0x8b,
+  0xa7, 0x98, 0x36, 0x35, 0x71, 0x67, 0x89, 0xb4, 0x61, 0xea, 0xd3, 0x91, 0xb0, 0x22, 0xa5, 0x7c,
+  0x19, 0x2f, 0x93, 0x91, 0x14, 0x40, 0x4b, 0x22, 0x17, 0x57, 0x57, 0x4c, 0xb4, 0x4c, 0xa7, 0x17,
+  0xf6, 0xdc, 0xe4, 0x4d, 0xa3, 0x80, 0xf4, 0x81, 0xfa, 0x46, 0x57, 0x7a, 0x70, 0xb7, 0x08, 0x53,
+  0x81, 0x8d, 0xc4, 0x68, 0x1a, 0xc0, 0x7e, 0x31, 0xd2, 0x73, 0xee, 0xbe, 0x6a, 0xa0, 0x11, 0xd1,
+  0x60, 0xb0, 0x05, 0x4c, 0x5e, 0xc9, 0x93, 0x0a, 0x8a, 0xba, 0x50, 0x09, 0x07, 0x76, 0x89, 0x8a,
+  0xd3, 0x45, 0xe3, 0x76, 0x0a, 0x1d, 0x07, 0xf3, 0x3b, 0x20, 0xcc, 0x35, 0x03, 0x03, 0x19, 0x24,
+  0x34, 0xc6, 0x80, 0x1b, 0x0c, 0x6b, 0x84, 0x0f, 0x63, 0x6a, 0x0a, 0xe9, 0x2d, 0xac, 0x4a, 0x2e,
+  0xeb, 0xd2, 0x29, 0x95, 0x78, 0x1a, 0x7d, 0x25, 0x93, 0x99, 0x5a, 0x5c, 0xad, 0xd2, 0x13, 0x5e,
+  0xfa, 0x5d, 0xdc, 0x75, 0x24, 0x44, 0x38, 0x4e, 0x05, 0xdb, 0x06, 0x63, 0x71, 0x7d, 0xc7, 0xc3,
+  0xe0, 0x66, 0x9c, 0xe3, 0xc3, 0x3c, 0x78, 0x8c, 0x5f, 0xf1, 0x94, 0xda, 0xe9, 0xaf, 0x38, 0x61,
+  0xfc, 0xe1, 0x12, 0x73, 0xc0, 0x18, 0x71, 0x48, 0xf3, 0x63, 0x36, 0x72, 0xb6, 0x5e, 0xf1, 0xfd,
+  0xb0, 0xb2, 0xf3, 0xd0, 0x3c, 0x70, 0x6f, 0x73, 0x47, 0x9d, 0x64, 0xe6, 0x45, 0x5b, 0x3b, 0xd6,
+  0x19, 0x64, 0x5e, 0xbc, 0xbd, 0x63, 0x9d, 0x1e, 0xf6, 0x5a, 0x74, 0x1e, 0xb8, 0xa3, 0x4e, 0xff,
+  0x5a, 0xf7, 0xbb, 0xee, 0x34, 0xba, 0xa8, 0xe0, 0x96, 0x7a, 0xa7, 0xe4, 0x70, 0x0d, 0xdd, 0xcf,
+  0xe8, 0x53, 0xd8, 0x29, 0x39, 0x62, 0xe9, 0xb5, 0x2c, 0xf7, 0x12, 0xaa, 0x62, 0x53, 0xa0, 0x3d,
+  0x21, 0x4e, 0xe1, 0xd1, 0xb9, 0xf3, 0xb3, 0x1a, 0x6a, 0xee, 0x98, 0xe1, 0x06, 0xae, 0x77, 0xc5,
+  0x2e, 0xd3, 0x20, 0x73, 0xdf, 0xc7, 0x4e, 0xf5, 0x49, 0x83, 0xa1, 0x40, 0x38, 0x0f, 0x33, 0x8e,
+  0xe1, 0xe2, 0x45, 0x9c, 0x7f, 0x23, 0x19, 0x68, 0x91, 0x31, 0xaa, 0x40, 0x93, 0xe8, 0x4d, 0x12,
+  0xcf, 0xb4, 0x1f, 0xbc, 0xe4, 0x64, 0xc0, 0x6b, 0xe5, 0xd6, 0xb6, 0x59, 0x56, 0xef, 0x2f, 0x4b,
+  0x33, 0x23, 0x53, 0x45, 0x34, 0x48, 0xf2, 0x5a, 0x2b, 0x43, 0x29, 0xc9, 0x0e, 0xb5, 0xd5, 0x98,
+  0x75, 0xbb, 0x8e, 0xdf, 0x7a, 0x2d, 0xea, 0x7e, 0xda, 0x15, 0x38, 0x46, 0xa0, 0x03, 0xe1, 0xdd,
+  0xc6, 0x7b, 0x0e, 0xb5, 0xbc, 0xc7, 0x2c, 0xcc, 0x9b, 0x2a, 0x09, 0x33, 0xd3, 0xc9, 0x1f, 0x9d,
+  0xc6, 0xda, 0xd7, 0xc5, 0x60, 0xeb, 0x01, 0xef, 0x9b, 0xd1, 0x7b, 0x6f, 0xb8, 0xbb, 0x1f, 0xf5,
+  0x62, 0x96, 0xff, 0xa8, 0xbd, 0xaa, 0x59, 0x36, 0xa0, 0xc2, 0x0c, 0xe8, 0x85, 0xb0, 0x53, 0xb6,
+  0x3a, 0xda, 0x64, 0xf3, 0x56, 0x45, 0xdc, 0x2c, 0x50, 0x36, 0x9f, 0x22, 0x2b, 0xa8, 0x2a, 0x1c,
+  0xb5, 0x51, 0x8e, 0xc4, 0xbd, 0x43, 0x27, 0x83, 0x83, 0x96, 0x4d, 0xcc, 0xf2, 0x80, 0x1f, 0xfc,
+  0x07, 0x6e, 0xca, 0x29, 0x88, 0x97, 0x1a, 0x75, 0xcb, 0x2e, 0x4d, 0x25, 0xb7, 0xce, 0x2d, 0xe4,
+  0xd5, 0xee, 0x2a, 0x65, 0x8d, 0xb6, 0x9d, 0xe5, 0xf3, 0x95, 0x86, 0xba, 0x87, 0x41, 0x37, 0xb0,
+  0xfb, 0x8a, 0xc7, 0xf2, 0xed, 0xc5, 0xd1, 0x41, 0x3c, 0x03, 0x08, 0x78, 0x85, 0xc7, 0xf4, 0xaa,
+  0xcd, 0xf2, 0x12, 0xbf, 0x92, 0xe5, 0x95, 0x79, 0x13, 0x84, 0x11, 0x28, 0xcc, 0x2c, 0xa6, 0x51,
+  0xe7, 0x0b, 0x24, 0x5e, 0xfe, 0x04, 0x25, 0x8e, 0x8c, 0x82, 0x9e, 0x1a, 0xcf, 0x28, 0x2a, 0x89,
+  0x73, 0x56, 0x9e, 0x2a, 0x72, 0x76, 0x91, 0x59, 0xdf, 0x71, 0x8c, 0x3d, 0xcd, 0x2f, 0x96, 0x41,
+  0xe4, 0x72, 0xbe, 0x1b, 0x0c, 0xa4, 0x47, 0xc1, 0xb7, 0x9e, 0xf5, 0x90, 0x50, 0x10, 0xe1, 0x07,
+  0x7b, 0xbb, 0x2c, 0x53, 0xdf, 0x5d, 0xab, 0xe9, 0x2b, 0xff, 0x2a, 0x5a, 0x31, 0x06, 0x29, 0xb4,
+  0xe7, 0x2a, 0x8c, 0x24, 0x73, 0xf3, 0xbd, 0xf8, 0x55, 0xf9, 0xcc, 0x9c, 0xb2, 0x6e, 0x99, 0x4d,
+  0x55, 0x84, 0x71, 0xa5, 0xef, 0x12, 0x68, 0x00, 0x57, 0x7a, 0xd7, 0x5c, 0xce, 0x42, 0x18, 0xe7,
+  0x3a, 0xca, 0x99, 0x5e, 0xcf, 0x5b, 0x14, 0xdf, 0x74, 0xda, 0xc7, 0x54, 0x59, 0x7b, 0xf0, 0x3c,
+  0xed, 0xd1, 0x13, 0xc6, 0x35, 0x05, 0xaa, 0x11, 0x2a, 0x59, 0x50, 0x56, 0x7a, 0xe9, 0x10, 0x72,
+  0xc9, 0xd9, 0x9f, 0x23, 0x1b, 0x8e, 0x30, 0x39, 0xa1, 0x54, 0x9e, 0x40, 0x18, 0x9d, 0x81, 0xe2,
+  0x60, 0xed, 0xeb, 0x3c, 0x21, 0x98, 0xc4, 0x89, 0xe8, 0x60, 0xa6, 0xc0, 0x20, 0x83, 0x0d, 0xf8,
+  0x22, 0x63, 0xe3, 0x42, 0xff, 0xf8, 0x4e, 0x6c, 0x9b, 0x1f, 0xcf, 0x9e, 0x75, 0x2d, 0xa1, 0x31,
+  0x16, 0x51, 0xc1, 0x4a, 0xda, 0xf5, 0x1c, 0x80, 0x68, 0x6a, 0x63, 0x07, 0xd2, 0x32, 0x65, 0xa9,
+  0x80, 0xaf, 0x95, 0xf1, 0x0a, 0xaf, 0xae, 0x39, 0xab, 0x22, 0x5b, 0x99, 0x34, 0x96, 0x52, 0xea,
+  0xef, 0x95, 0x1a, 0xe9, 0x9e, 0x15, 0x16, 0x07, 0x3c, 0xf1, 0x4c, 0xb4, 0xff, 0x36, 0x0a, 0x67,
+  0x61, 0xb6, 0x07, 0x5a, 0x19, 0x3f, 0xe9, 0x9e, 0x5e, 0xc1, 0x07, 0xfe, 0x93, 0x5a, 0xa8, 0x52,
+  0x5c, 0x18, 0x1f, 0x26, 0xc3, 0x3c, 0xe8, 0x35, 0x04, 0x98, 0x7c, 0x0b, 0x48, 0x19, 0xd0, 0x53,
+  0x8e, 0x7c, 0x10, 0x11, 0x78, 0x7f, 0xa5, 0x02, 0xd2, 0x64, 0xa9, 0x14, 0x29, 0x9f, 0x29, 0x58,
+  0xfd, 0x2b, 0x34, 0x40, 0x9e, 0x10, 0x0c, 0xa3, 0x3b, 0xf1, 0x7c, 0x5f, 0x6f, 0xe5, 0xcd, 0x44,
+  0x50, 0xe9, 0x9c, 0xb2, 0xf8, 0x9b, 0x17, 0x23, 0xec, 0xf9, 0x40, 0x37, 0x50, 0xd1, 0x2a, 0xc6,
+  0xaf, 0x9a, 0x21, 0xec, 0x9b, 0xe4, 0xeb, 0xae, 0x51, 0x6e, 0x0c, 0xa1, 0xd6, 0x37, 0x1a, 0xc9,
+  0x32, 0xd6, 0x46, 0x31, 0xb5, 0x63, 0xf7, 0x72, 0xb2, 0x3e, 0x5a, 0xd6, 0x52, 0xb0, 0x1f, 0x4e,
+  0x96, 0x19, 0x1d, 0x36, 0x74, 0xf8, 0x90, 0xa2, 0x27, 0x68, 0x63, 0x8b, 0x07, 0x0b, 0xb4, 0x7c,
+  0x5b, 0x8b, 0x88, 0xed, 0x85, 0xd0, 0x95, 0xeb, 0xbd, 0x11, 0x08, 0x85, 0x46, 0xbc, 0x04, 0x3b,
+  0x65, 0x12, 0xce, 0x6b, 0x3c, 0x13, 0x0d, 0x8e, 0x41, 0x76, 0x4d, 0x4b, 0x82, 0xbb, 0xe7, 0x9f,
+  0x7b, 0x10, 0xce, 0x0f, 0x71, 0x62, 0xac, 0xe0, 0xfe, 0x4b, 0x8c, 0x56, 0x98, 0x90, 0x08, 0x20,
+  0x19, 0x1d, 0x3a, 0x15, 0xb9, 0xde, 0x4e, 0x92, 0xb1, 0xff, 0xd3, 0x50, 0x9d, 0x65, 0x3c, 0x29,
+  0x39, 0x87, 0x32, 0x21, 0xa0, 0x4d, 0x4e, 0x62, 0xfc, 0xfd, 0x33, 0xbf, 0x48, 0x62, 0xb4, 0x91,
+  0x7e, 0x8f, 0x82, 0xde, 0x91, 0x5b, 0xc9, 0x17, 0x6c, 0x9f, 0x55, 0x84, 0x61, 0xf8, 0x03, 0x18,
+  0x5e, 0x5c, 0x9c, 0x5d, 0xd4, 0xe2, 0xaf, 0xd9, 0xa9, 0x24, 0x33, 0x9e, 0xbe, 0x97, 0x56, 0x32,
+  0x44, 0xb5, 0xdf, 0xb1, 0x38, 0x50, 0x1d, 0x8f, 0x09, 0x4b, 0xd5, 0xa9, 0x1c, 0x69, 0xfa, 0x9d,
+  0x75, 0x6c, 0xaf, 0xdf, 0x6d, 0xb1, 0x92, 0x6f, 0x0c, 0xf8, 0x2c, 0x50, 0xfd, 0x69, 0x1e, 0x89,
+  0x19, 0x3f, 0x60, 0xdd, 0x0c, 0x51, 0x8f, 0x6e, 0x36, 0x35, 0x3e, 0xcd, 0x45, 0x3c, 0x52, 0x1a,
+  0x3e, 0x4a, 0x65, 0xb7, 0x14, 0x5b, 0xd5, 0x77, 0xe6, 0x28, 0x73, 0x52, 0x6a, 0x39, 0xcc, 0xca,
+  0x28, 0xb4, 0x7f, 0x75, 0xf0, 0x83, 0x4b, 0xa2, 0x57, 0xe1, 0x78, 0x4f, 0x67, 0xb1, 0xb2, 0xc0,
+  0xd0, 0x0b, 0x21, 0x95, 0xc9, 0x9c, 0x6a, 0x3b, 0xe1, 0xb8, 0xe2, 0xba, 0x5e, 0x2c, 0x9b, 0xbf,
+  0x3c, 0x6e, 0x7d, 0x91, 0xef, 0x25, 0x56, 0xe8, 0x34, 0x22, 0x14, 0x6e, 0xb3, 0x03, 0x72, 0xa6,
+  0xe8, 0xcd, 0x36, 0x2c, 0xe8, 0x62, 0x1e, 0xab, 0xa5, 0x06, 0x16, 0x1e, 0x12, 0xde, 0x87, 0xb0,
+  0x91, 0x79, 0x6d, 0xd7, 0xdc, 0x72, 0xa8, 0x61, 0x26, 0x0b, 0x27, 0xdb, 0xd8, 0xa8, 0x0e, 0xf0,
+  0xa6, 0x9a, 0xe5, 0x0e, 0x34, 0xc3, 0x83, 0x79, 0xd5, 0x02, 0x67, 0x96, 0x90, 0x45, 0x55, 0xe8,
+  0x3e, 0xd8, 0x74, 0x74, 0x39, 0xb8, 0x99, 0x39, 0x6c, 0x0f, 0x09, 0x59, 0x79, 0x51, 0x42, 0x90,
+  0xb2, 0xed, 0xa6, 0x61, 0xe8, 0x9a, 0xfb, 0x00, 0xeb, 0xb3, 0xb5, 0xd9, 0x8a, 0x28, 0x9e, 0x2b,
+  0x02, 0xcb, 0x99, 0xbb, 0x3a, 0xca, 0x7d, 0x1d, 0x16, 0xaf, 0xec, 0xd1, 0x62, 0xf4, 0xd5, 0xc9,
+  0x9f, 0x1e, 0xa1, 0xe7, 0x9e, 0x9b, 0xa3, 0xa6, 0x57, 0xf8, 0xdb, 0x11, 0xe8, 0x2f, 0xca, 0x41,
+  0x4e, 0x59, 0xc0, 0x0a, 0x69, 0xae, 0x4a, 0x72, 0x83, 0x55, 0x71, 0x37, 0x55, 0x55, 0xac, 0xcd,
+  0x7f, 0xda, 0x0c, 0x59, 0xa5, 0xab, 0xea, 0x07, 0xfd, 0x08, 0xc5, 0x55, 0x3d, 0x66, 0x32, 0x65,
+  0xd5, 0x54, 0x78, 0x9d, 0xe4, 0x33, 0xbf, 0x0a, 0xaf, 0xf5, 0x75, 0xdc, 0x3a, 0x08, 0x69, 0x43,
+  0xc3, 0x76, 0xdb, 0xe8, 0x3b, 0xee, 0xb7, 0x74, 0x5a, 0x34, 0xb0, 0xbc, 0xae, 0xfe, 0xb9, 0x61,
+  0xca, 0xbe, 0x58, 0xf6, 0x1f, 0x5b, 0xf5, 0x94, 0x95, 0xcf, 0xbe, 0xd9, 0x3c, 0x58, 0x80, 0x56,
+  0xfc, 0x0e, 0xdf, 0xf8, 0xe2, 0x6b, 0x5c, 0x09, 0x39, 0x85, 0x18, 0x4c, 0xf1, 0xd8, 0x8d, 0x6b,
+  0x12, 0x14, 0xac, 0xa6, 0x9a, 0x74, 0x2c, 0xc3, 0x99, 0xf3, 0xff, 0xd0, 0x65, 0x7c, 0xdc, 0x03,
+  0x20, 0x45, 0xa6, 0x32, 0x8a, 0x62, 0xb5, 0xe3, 0xb3, 0x3c, 0x4e, 0x9e, 0x6f, 0xd8, 0xb3, 0x3b,
+  0xa8, 0x4a, 0x3c, 0x3f, 0xb5, 0x3d, 0xbf, 0x1d, 0xb5, 0x01, 0xa5, 0xa2, 0xfc, 0xc5, 0x83, 0x38,
+  0x0b, 0x27, 0xca, 0xa2, 0x7b, 0x1d, 0x8c, 0x6f, 0x64, 0x47, 0xbd, 0x90, 0x88, 0xee, 0x6c, 0x8b,
+  0x69, 0xf3, 0x7d, 0x81, 0xb3, 0xb3, 0x36, 0x2b, 0x09, 0x58, 0x46, 0x20, 0x8d, 0xda, 0x87, 0x0f,
+  0x43, 0xbb, 0x01, 0xae, 0xe7, 0x9d, 0xd5, 0x2d, 0xfe, 0x7f, 0x22, 0xc5, 0x38, 0x4c, 0xcd, 0xb3,
+  0x88, 0xa2, 0x03, 0xa6, 0xbd, 0xe5, 0x27, 0x4e, 0xe4, 0x75, 0x1c, 0xe3, 0x83, 0x8c, 0xea, 0x4c,
+  0x15, 0x47, 0xce, 0x50, 0xac, 0xa1, 0x53, 0x47, 0xe4, 0xc6, 0x3b, 0xa0, 0x4f, 0xfc, 0xec, 0xa9,
+  0xae, 0x4d, 0x18, 0x5b, 0xb5, 0xeb, 0xc6, 0xa7, 0x1b, 0x29, 0x6a, 0xf8, 0x7d, 0x94, 0x51, 0x4e,
+  0x37, 0xc9, 0xc2, 0x99, 0x2c, 0xd6, 0xd7, 0xfe, 0x71, 0xa7, 0x2a, 0xd3, 0x04, 0x0f, 0x58, 0xbb,
+  0xa6, 0xaa, 0xa6, 0x53, 0xd7, 0x3f, 0x1e, 0x60, 0xa6, 0x41, 0xf6, 0xe5, 0x22, 0xf3, 0xca, 0x5f,
+  0xc7, 0x97, 0x18, 0xd5, 0x04, 0x53, 0x9d, 0xe5, 0x3f, 0x07, 0x98, 0xc6, 0x96, 0x5e, 0x8b, 0xe4,
+  0x38, 0x30, 0x8b, 0x7b, 0x07, 0x67, 0xe7, 0xc3, 0xd3, 0x5c, 0x61, 0x6a, 0x0c, 0x8a, 0xce, 0xb2,
+  0x12, 0x0f, 0xa8, 0x5a, 0x5b, 0xe8, 0x84, 0x80, 0x89, 0xae, 0xb4, 0x50, 0x61, 0x1a, 0xec, 0x27,
+  0xfd, 0x8c, 0x41, 0xfc, 0x5d, 0xc9, 0x1e, 0xdd, 0x08, 0x1d, 0x59, 0x17, 0x11, 0xe1, 0x8d, 0x07,
+  0xc2, 0x19, 0x1e, 0x19, 0x11, 0xb7, 0xeb, 0x94, 0x0f, 0x61, 0x9a, 0xca, 0xb1, 0xcf, 0xdc, 0x39,
+  0x0f, 0x3a, 0x22, 0xf0, 0xcc, 0x9c, 0x66, 0xd5, 0x4b, 0x06, 0x25, 0x85, 0x60, 0xc0, 0xb0, 0xa0,
+  0xb2, 0xcb, 0x28, 0x59, 0xe2, 0x6e, 0x8f, 0x77, 0x41, 0x2e, 0x33, 0xdb, 0x49, 0x32, 0xd1, 0x59,
+  0xa1, 0xb7, 0x30, 0xf8, 0xba, 0x25, 0xa2, 0xab, 0x80, 0xe3, 0x4f, 0xfd, 0x4a, 0x81, 0x86, 0x41,
+  0x04, 0xba, 0xa0, 0x4f, 0x1d, 0xae, 0x41, 0x74, 0xf3, 0xfd, 0x52, 0x46, 0xb6, 0x1e, 0x62, 0x58,
+  0x60, 0x76, 0x33, 0xc7, 0x7a, 0xc0, 0xd4, 0x55, 0xf9, 0xb5, 0xba, 0x67, 0x9c, 0x78, 0x7f, 0x1d,
+  0x63, 0x5b, 0x43, 0xcc, 0xdc, 0x4c, 0x58, 0x99, 0x05, 0xce, 0x9a, 0x65, 0x1a, 0xb7, 0x45, 0xb5,
+  0x52, 0x5e, 0x51, 0xdf, 0xe8, 0x35, 0xf0, 0x03, 0x12, 0xd2, 0x8e, 0x79, 0x5a, 0x92, 0x03, 0xd1,
+  0xac, 0xe8, 0xfa, 0x5a, 0x1f, 0x3e, 0x67, 0x2e, 0x61, 0x61, 0xf2, 0xbc, 0xf9, 0x7a, 0xff, 0x5c,
+  0x24, 0xba, 0xe2, 0x4b, 0xfe, 0x35, 0x18, 0x71, 0x90, 0x24, 0x6f, 0x62, 0x72, 0x57, 0x7b, 0x89,
+  0xdb, 0x4a, 0x35, 0x58, 0x74, 0xad, 0x5c, 0xa9, 0xc8, 0xb1, 0x64, 0xf1, 0xa2, 0x6e, 0x0b, 0xb3,
+  0x29, 0x1f, 0xb8, 0x29, 0xfb, 0x8c, 0xce, 0xc2, 0x40, 0x9c, 0xc2, 0x94, 0x0e, 0x07, 0xe5, 0xd8,
+  0x6c, 0x21, 0x55, 0xa2, 0x47, 0x17, 0x05, 0x63, 0x00, 0x8b, 0x57, 0xae, 0x09, 0x28, 0x76, 0xac,
+  0x7d, 0xcd, 0xae, 0x8d, 0x7c, 0xbc, 0x50, 0x4d, 0x97, 0x59, 0xf9, 0x53, 0x94, 0x79, 0xc2, 0x54,
+  0x4e, 0xc5, 0xf9, 0x52, 0x18, 0x83, 0x62, 0xcf, 0xf4, 0xff, 0x69, 0x60, 0xd2, 0xe5, 0xe5, 0x8f,
+  0x52, 0x7e, 0x69, 0xb9, 0x59, 0x9b, 0xf5, 0x97, 0x9e, 0x69, 0xc5, 0x9a, 0xfd, 0xa3, 0x94, 0x0b,
+  0x28, 0x9a, 0x80, 0x3e, 0x9f, 0x8f, 0x64, 0x8a, 0xf2, 0x4a, 0xa7, 0x6e, 0x38, 0x62, 0xca, 0xd9,
+  0x10, 0x27, 0x69, 0x1e, 0x40, 0x98, 0x27, 0xf6, 0xcc, 0xa1, 0x90, 0x83, 0xc4, 0x44, 0x1e, 0x79,
+  0x23, 0x03, 0x13, 0xa2, 0x6d, 0xbf, 0x63, 0x3d, 0x96, 0x9f, 0xed, 0x61, 0x1d, 0x61, 0x41, 0xdd,
+  0xd8, 0xcc, 0xc8, 0xb8, 0xe9, 0x4b, 0xca, 0xbf, 0x48, 0xcd, 0x53, 0xf4, 0x5b, 0x48, 0x2e, 0xef,
+  0x91, 0x1d, 0x5e, 0x83, 0x45, 0x12, 0x2f, 0xda, 0x86, 0x1b, 0x6b, 0x36, 0x9b, 0x94, 0x0e, 0xe6,
+  0xa5, 0x7e, 0x7d, 0xce, 0xf6, 0x25, 0x19, 0xee, 0x61, 0xbe, 0x2c, 0x15, 0x8d, 0x9a, 0xad, 0x8c,
+  0x71, 0x7a, 0x19, 0x0e, 0x35, 0x22, 0x9e, 0xc6, 0x33, 0xe9, 0xdd, 0xf4, 0x2e, 0x3b, 0xd7, 0x30,
+  0xe8, 0x7f, 0xb5, 0x1b, 0xae, 0x06, 0xd7, 0xfc, 0xa4, 0x56, 0xed, 0xb1, 0x48, 0x24, 0x2e, 0xa9,
+  0xb4, 0xa3, 0x82, 0x2d, 0x1c, 0x69, 0xc7, 0x09, 0xc5, 0xc3, 0x23, 0x7d, 0x74, 0xe6, 0x1f, 0x98,
+  0x77, 0x4b, 0xcf, 0xd0, 0xad, 0xb3, 0x36, 0x5e, 0xb8, 0x9c, 0x13, 0xb7, 0xea, 0xb3, 0xab, 0x35,
+  0x0f, 0x95, 0x56, 0x1e, 0xd6, 0xdd, 0xf7, 0xc4, 0xb6, 0x3a, 0x4e, 0x83, 0x85, 0x42, 0x0d, 0x33,
+  0xa3, 0xd1, 0x7f, 0x29, 0x39, 0xba, 0xc6, 0x2f, 0x79, 0x8e, 0x85, 0xc2, 0xb0, 0xad, 0x63, 0x67,
+  0x93, 0xed, 0xca, 0x27, 0xea, 0x97, 0x9a, 0xb3, 0xef, 0xd2, 0x69, 0x33, 0x99, 0xa6, 0x8a, 0x07,
+  0xdb, 0x85, 0x13, 0xcb, 0xe2, 0x8c, 0x81, 0x38, 0xbc, 0xb0, 0x8f, 0x0b, 0x9d, 0x8f, 0x56, 0xda,
+  0x50, 0x3c, 0x10, 0x7f, 0xf6, 0xcc, 0x3d, 0x23, 0x67, 0x6f, 0xfa, 0xcc, 0xc3, 0x71, 0xcd, 0x33,
+  0x2e, 0x86, 0xf6, 0xea, 0x4f, 0x55, 0x47, 0x5b, 0x05, 0x02, 0xe5, 0x2e, 0xf5, 0xad, 0x8d, 0x8d,
+  0x76, 0x83, 0x38, 0xea, 0x1a, 0xdf, 0xb4, 0x85, 0xbb, 0x0a, 0x1a, 0x71, 0xcf, 0x56, 0x9c, 0x25,
+  0x95, 0x5e, 0xaf, 0x22, 0x9b, 0xc1, 0x4d, 0x41, 0xae, 0x14, 0x81, 0x82, 0x45, 0x0e, 0x03, 0x57,
+  0x29, 0x74, 0x9b, 0xc5, 0x4a, 0x33, 0xd5, 0xcb, 0x7c, 0xc3, 0x9c, 0x36, 0xf5, 0x4f, 0xb9, 0xf5,
+  0x63, 0xa6, 0xc0, 0xb5, 0xa7, 0x70, 0x14, 0x30, 0xf1, 0xf4, 0xb2, 0x16, 0x2d, 0x45, 0xb8, 0x26,
+  0xa5, 0xe2, 0x36, 0xb8, 0x2b, 0x67, 0x2a, 0x85, 0x72, 0xb9, 0x17, 0xa1, 0xd4, 0x0e, 0xd6, 0xec,
+  0xe9, 0x87, 0x95, 0xb0, 0x93, 0x33, 0xd7, 0x68, 0x85, 0x70, 0x0f, 0xbd, 0xed, 0x6d, 0xf2, 0x28,
+  0x7b, 0x99, 0xbe, 0xf0, 0xe0, 0x79, 0x87, 0xf4, 0x25, 0x71, 0x25, 0x96, 0xcb, 0x94, 0xae, 0x1f,
+  0xa8, 0x50, 0x78, 0x74, 0xfb, 0xd2, 0xf0, 0x8a, 0x6f, 0xbe, 0xa9, 0x51, 0xbb, 0xd6, 0xbc, 0x6d,
+  0xd9, 0xa2, 0x80, 0xa4, 0x3a, 0x09, 0x6e, 0x59, 0x74, 0xcc, 0x21, 0x40, 0x1c, 0xcc, 0xe3, 0xdb,
+  0x8e, 0xeb, 0xd1, 0x2f, 0xbd, 0x9b, 0xe7, 0x39, 0xf2, 0x6b, 0x2f, 0x2f, 0xa4, 0xf9, 0x0d, 0xc8,
+  0xbf, 0xf6, 0xc5, 0x05, 0x27, 0x02, 0xa6, 0xf6, 0xde, 0x82, 0x39, 0xa7, 0x34, 0x41, 0x2a, 0x38,
+  0x70, 0x3a, 0xa1, 0xba, 0x3c, 0x3f, 0x7a, 0xf3, 0xe6, 0x52, 0xa8, 0x4b, 0x07, 0x13, 0x98, 0x9f,
+  0x3b, 0xe7, 0xae, 0x41, 0xe5, 0xd1, 0x16, 0x79, 0xc3, 0x4d, 0xfc, 0x8d, 0x81, 0xd4, 0xf0, 0xf2,
+  0xc1, 0x90, 0xee, 0x3d, 0x02, 0x0c, 0x34, 0x90, 0x6c, 0x28, 0xf9, 0x09, 0x59, 0xf9, 0x59, 0x67,
+  0x99, 0xfd, 0xe9, 0xcd, 0x97, 0x06, 0x77, 0xd1, 0x44, 0xc3, 0xa9, 0xd9, 0xeb, 0xea, 0x04, 0xc8,
+  0x6e, 0xd3, 0x15, 0x3a, 0xab, 0x50, 0xdd, 0x3e, 0x59, 0x77, 0x62, 0x93, 0xb4, 0xfd, 0xae, 0x0b,
+  0x7b, 0x58, 0x82, 0x00, 0x5b, 0xf7, 0xbb, 0x15, 0x53, 0xa4, 0x62, 0xf7, 0xe8, 0xdc, 0x90, 0x69,
+  0x8b, 0x54, 0x71, 0x27, 0xbd, 0x64, 0xa2, 0x08, 0xc8, 0xdb, 0x14, 0xe9, 0x3a, 0xe6, 0x58, 0x5f,
+  0xf1, 0xfd, 0xdb, 0x23, 0x61, 0x8f, 0x34, 0x4f, 0x85, 0x46, 0x12, 0xd6, 0x80, 0x4e, 0x26, 0xfc,
+  0xcc, 0xa3, 0x97, 0x07, 0xc1, 0x21, 0x97, 0xfa, 0x76, 0x58, 0xa0, 0x9a, 0xdf, 0xc8, 0x26, 0x5a,
+  0x59, 0x30, 0x95, 0xa6, 0x9d, 0xf7, 0x8d, 0x48, 0x68, 0x75, 0x52, 0xa0, 0xa4, 0x52, 0x20, 0x39,
+  0x7b, 0xd5, 0x50, 0xd4, 0xbf, 0xf8, 0xdc, 0x8c, 0xb0, 0x73, 0xaf, 0x87, 0x86, 0xcc, 0xef, 0x9d,
+  0x0f, 0x1b, 0xfc, 0xbc, 0x23, 0x62, 0x2d, 0x00, 0xa5, 0x7b, 0xaf, 0x63, 0xeb, 0x52, 0xb6, 0xd6,
+  0x69, 0xf5, 0x75, 0x72, 0xf9, 0x08, 0x38, 0xf7, 0x8d, 0x73, 0xaf, 0xfb, 0xa6, 0xfc, 0x5e, 0xb7,
+  0x96, 0x0b, 0x6c, 0x92, 0xcb, 0x99, 0xcf, 0xdf, 0xb6, 0x48, 0x50, 0x4d, 0xfb, 0x50, 0xad, 0x74,
+  0x39, 0xb5, 0x66, 0xc4, 0x5a, 0x55, 0xd5, 0x38, 0x2c, 0x34, 0xf5, 0x1c, 0x56, 0x61, 0xeb, 0xdf,
+  0x6a, 0xb7, 0xf1, 0x55, 0x6d, 0x3d, 0xb4, 0x8b, 0x1c, 0xe6, 0x63, 0x7f, 0x6a, 0x5c, 0x71, 0xb5,
+  0x83, 0x28, 0x65, 0xaf, 0xe2, 0x60, 0xec, 0xa5, 0xa6, 0x70, 0xe3, 0x7c, 0x9d, 0x95, 0x46, 0xcb,
+  0x20, 0x65, 0xfd, 0xb9, 0xf9, 0x7f, 0xb5, 0xde, 0xf8, 0x82, 0x62, 0x96, 0x9d, 0x15, 0xa7, 0xc2,
+  0x05, 0x6a, 0xa5, 0xee, 0x31, 0x71, 0xed, 0xc9, 0xf0, 0xe9, 0xf0, 0x0a, 0x03, 0x36, 0x85, 0x75,
+  0x42, 0xec, 0xde, 0x3e, 0x2b, 0xb9, 0x19, 0xa7, 0xef, 0xd7, 0x9d, 0x7e, 0x2f, 0xae, 0xce, 0xf4,
+  0xbd, 0xc4, 0xb6, 0x51, 0xce, 0xf8, 0x1c, 0x4b, 0x7e, 0x79, 0xf3, 0x24, 0x9e, 0xe3, 0x16, 0x19,
+  0x6f, 0x2c, 0x34, 0x13, 0x61, 0x33, 0x9c, 0xf2, 0xab, 0xf9, 0x78, 0x65, 0xb2, 0xba, 0x07, 0x7b,
+  0x83, 0x59, 0x70, 0x2a, 0x7e, 0x05, 0x2b, 0xab, 0x2a, 0x1a, 0xb2, 0x91, 0x45, 0x56, 0xb8, 0x97,
+  0x28, 0xfa, 0x62, 0xff, 0x5c, 0x9c, 0x9c, 0x1d, 0x0e, 0xc5, 0x3e, 0x94, 0xff, 0xe4, 0x5e, 0xfc,
+  0xab, 0x7c, 0x9f, 0x97, 0xb7, 0x67, 0xb4, 0x41, 0xcb, 0x37, 0x42, 0x56, 0x50, 0x51, 0xca, 0x41,
+  0x3e, 0xca, 0xa5, 0x18, 0x7c, 0xde, 0xcf, 0x8b, 0x37, 0x4d, 0x39, 0x9d, 0x30, 0xe4, 0x44, 0xe4,
+  0xb1, 0x1d, 0xe1, 0xf5, 0xa3, 0x4f, 0x41, 0x64, 0x06, 0xa7, 0x21, 0x3e, 0x7b, 0xb6, 0xdb, 0x2a,
+  0x93, 0x18, 0x66, 0x29, 0x94, 0x98, 0x72, 0x7e, 0xbf, 0xef, 0xb6, 0xd8, 0x85, 0x95, 0xcb, 0xdf,
+  0x4b, 0x3f, 0xa4, 0x40, 0x57, 0x71, 0xf3, 0xf3, 0xae, 0x67, 0x37, 0x1b, 0xc4, 0xbd, 0x61, 0x75,
+  0x57, 0x99, 0xc4, 0xe5, 0x06, 0x71, 0xee, 0x27, 0x31, 0x24, 0x7d, 0xb9, 0x67, 0x93, 0x72, 0xcd,
+  0x8e, 0x1f, 0x3d, 0xf3, 0xea, 0xc2, 0x59, 0x6b, 0x65, 0x6e, 0x0b, 0xb5, 0x37, 0x21, 0x6c, 0x8a,
+  0xd2, 0xb3, 0x0a, 0xe5, 0xfb, 0x9c, 0xbb, 0xb4, 0x31, 0x83, 0x69, 0xd0, 0xde, 0x04, 0x78, 0xd5,
+  0xe3, 0x0e, 0xcc, 0x0a, 0x69, 0x67, 0x8d, 0x54, 0x5f, 0x69, 0xc5, 0xd3, 0x09, 0xd3, 0x5a, 0xed,
+  0x3f, 0xff, 0xd7, 0xff, 0xfe, 0x7f, 0xfe, 0xe7, 0x7f, 0x82, 0x71, 0x1e, 0x5c, 0x9d, 0x5d, 0xfc,
+  0x22, 0x2e, 0x86, 0x97, 0xc3, 0x2b, 0xf1, 0xf3, 0xfe, 0xc5, 0x29, 0xea, 0x0b, 0xfe, 0xf8, 0x0f,
+  0xf3, 0x7f, 0x00, 0x25, 0xf9, 0xac, 0xd5, 0xbe, 0x02, 0xd9, 0x11, 0xb7, 0x61, 0x14, 0x89, 0xf3,
+  0xe1, 0xc5, 0xc9, 0xfe, 0xe9, 0xf0, 0xf4, 0xea, 0xf8, 0x17, 0xf5, 0xdc, 0xd6, 0x8e, 0xaa, 0xf3,
+  0xe7, 0xff, 0xf0, 0x3f, 0xc4, 0x3e, 0xd4, 0xc8, 0x2f, 0x45, 0xcc, 0x55, 0xe0, 0x97, 0x57, 0xc1,
+  0xb6, 0xc5, 0x50, 0x05, 0x48, 0x3c, 0x7a, 0xca, 0xef, 0x56, 0x74, 0xbd, 0xea, 0x74, 0x49, 0xd7,
+  0x37, 0x33, 0x72, 0xcc, 0x7e, 0x38, 0xba, 0x14, 0x07, 0xfb, 0xa7, 0x78, 0x2f, 0xf7, 0xf5, 0x50,
+  0xbc, 0x3d, 0xc5, 0x04, 0xfc, 0x4f, 0xcc, 0xe7, 0xfd, 0x44, 0x8a, 0xbb, 0x78, 0x09, 0xc6, 0xbd,
+  0xfa, 0xe3, 0x36, 0x98, 0x67, 0x68, 0x76, 0xe8, 0x78, 0xac, 0x57, 0xed, 0x96, 0xd2, 0xde, 0x86,
+  0x4a, 0x96, 0xb9, 0x1b, 0x2f, 0xaf, 0xd5, 0x4d, 0x51, 0x87, 0x74, 0x6f, 0x8e, 0x4e, 0xf7, 0x8f,
+  0x91, 0x41, 0xdf, 0x1c, 0x01, 0x35, 0x90, 0x5d, 0x72, 0x7c, 0xf0, 0xb6, 0xfb, 0x2f, 0xc3, 0x4b,
+  0xbe, 0xba, 0x21, 0x05, 0x7a, 0xb0, 0x91, 0x24, 0x18, 0x36, 0x08, 0xdd, 0xc2, 0x5f, 0x23, 0xa9,
+  0x5d, 0xb4, 0x13, 0x9e, 0x2e, 0x94, 0x33, 0x99, 0x0d, 0x0c, 0x22, 0x56, 0xaf, 0x39, 0x2a, 0x4b,
+  0x30, 0x8a, 0x8e, 0xf0, 0x4a, 0x21, 0x27, 0x3a, 0x04, 0x70, 0x9d, 0xbc, 0x2f, 0x1e, 0x0f, 0x22,
+  0xe7, 0xc2, 0xdc, 0xd1, 0xc6, 0x80, 0xd5, 0x1a, 0x85, 0x14, 0xda, 0xe4, 0x4e, 0xc4, 0x85, 0x4c,
+  0x30, 0xb7, 0xbc, 0xcb, 0x3b, 0xe5, 0x0b, 0x8a, 0xcb, 0x2b, 0x40, 0xf5, 0x83, 0xe1, 0x71, 0xd9,
+  0xb5, 0xeb, 0x07, 0xb7, 0x34, 0xa6, 0x42, 0x29, 0x52, 0x5e, 0x0a, 0xcf, 0xe1, 0xc5, 0x9b, 0xb3,
+  0x8b, 0x13, 0xe4, 0x56, 0x07, 0xba, 0x5e, 0xe3, 0x9a, 0x1a, 0x15, 0x8a, 0x62, 0x7d, 0xa2, 0x58,
+  0xa9, 0x4d, 0x51, 0xae, 0x32, 0xbf, 0xce, 0x2d, 0x79, 0x9f, 0x32, 0x67, 0x27, 0xe7, 0x94, 0xc8,
+  0xb0, 0x8f, 0x05, 0x57, 0xfb, 0x17, 0xb8, 0x7a, 0xab, 0x11, 0x39, 0xe6, 0x9f, 0xf1, 0x29, 0x96,
+  0xac, 0x74, 0xea, 0x34, 0x19, 0xeb, 0xa3, 0xbe, 0x18, 0x70, 0x9c, 0x77, 0xc7, 0xd5, 0x19, 0x2b,
+  0x27, 0xe9, 0x61, 0x57, 0xea, 0xdf, 0xd8, 0xfc, 0x57, 0x1b, 0x2a, 0xe6, 0xf6, 0x46, 0x31, 0x63,
+  0x05, 0x76, 0xb0, 0x2f, 0x2f, 0xe0, 0x2b, 0x03, 0xde, 0xad, 0xfa, 0x9a, 0x54, 0xbb, 0x93, 0xe0,
+  0xba, 0x3f, 0x97, 0xb7, 0x74, 0x69, 0xbd, 0xdd, 0xad, 0xbb, 0xff, 0xaa, 0x88, 0x46, 0x98, 0xd9,
+  0xcf, 0x3a, 0xde, 0xaf, 0x7a, 0x6d, 0x5e, 0xdd, 0x39, 0xcd, 0x82, 0x6b, 0xeb, 0x91, 0x79, 0xbc,
+  0x6d, 0xc4, 0xe6, 0x46, 0x70, 0x5d, 0xd3, 0xab, 0x72, 0x1b, 0x4b, 0xc7, 0x36, 0x29, 0xdc, 0xb9,
+  0x33, 0x37, 0x5d, 0xcd, 0x0d, 0x71, 0xf5, 0xed, 0x41, 0x98, 0xf1, 0x69, 0x59, 0xf5, 0x6b, 0xf2,
+  0x78, 0x89, 0x38, 0xbf, 0x5a, 0x5b, 0x91, 0xdb, 0xb8, 0xe8, 0x8b, 0x7b, 0xb4, 0x53, 0xfb, 0xde,
+  0x27, 0x76, 0x55, 0xe2, 0x65, 0x76, 0x10, 0x96, 0xce, 0x26, 0xdf, 0xb6, 0xee, 0x79, 0x14, 0xcd,
+  0x9d, 0xe2, 0x66, 0x60, 0xfc, 0xf2, 0xf7, 0x8a, 0x0e, 0x91, 0x71, 0x74, 0xa7, 0xd7, 0xd9, 0xbc,
+  0x31, 0xff, 0xf8, 0x79, 0x7d, 0x6b, 0x3b, 0xd1, 0x4b, 0xd9, 0x5a, 0x3d, 0x14, 0xb2, 0x81, 0xad,
+  0xe2, 0xd2, 0x45, 0x30, 0x97, 0x51, 0x9f, 0x4f, 0x85, 0x54, 0x4f, 0x9a, 0x21, 0xe0, 0x17, 0x03,
+  0x56, 0x57, 0xe9, 0x57, 0x5d, 0x10, 0x2f, 0xbd, 0xd9, 0x59, 0x60, 0x51, 0xee, 0xea, 0xe1, 0x48,
+  0x61, 0x5f, 0xd7, 0x5f, 0x87, 0x4b, 0xf3, 0xc8, 0xa4, 0x55, 0x73, 0x61, 0x3d, 0xd6, 0x3d, 0xa2,
+  0x67, 0x72, 0x1a, 0x4d, 0x48, 0xe1, 0xdd, 0xe8, 0xc6, 0x7d, 0xe8, 0x3c, 0xe6, 0xab, 0xfb, 0xb0,
+  0x9f, 0x65, 0x6f, 0xd4, 0x81, 0xc9, 0x95, 0xbe, 0xde, 0x38, 0xd6, 0x62, 0xdd, 0x8a, 0xac, 0xec,
+  0x4d, 0x47, 0x63, 0xf2, 0x9a, 0xaf, 0xd5, 0x8d, 0x49, 0xda, 0xbe, 0xba, 0x1b, 0x2f, 0x7d, 0xfa,
+  0x8a, 0x6e, 0xf2, 0xc7, 0x98, 0xd7, 0xa4, 0x59, 0xe1, 0x25, 0xe0, 0x86, 0xdd, 0xe0, 0x8e, 0xb9,
+  0x99, 0xc4, 0x7b, 0x0f, 0x82, 0xaf, 0xe8, 0xc1, 0x79, 0xf6, 0xbb, 0x81, 0x40, 0x73, 0x4e, 0x0b,
+  0x25, 0x4b, 0xea, 0xc0, 0xd6, 0x01, 0x22, 0xd6, 0xe3, 0xf0, 0xe2, 0xdb, 0xe3, 0x0f, 0x45, 0xa2,
+  0x00, 0x49, 0xac, 0x4f, 0x6f, 0x3f, 0x5d, 0xff, 0x43, 0x71, 0xf1, 0xe0, 0x88, 0xb5, 0xa5, 0xc5,
+  0x28, 0xfa, 0xc7, 0x62, 0xe2, 0x03, 0x12, 0xa5, 0xf9, 0x21, 0x1b, 0x88, 0x94, 0x01, 0xb4, 0x26,
+  0xc3, 0x3f, 0xaa, 0xaf, 0xb5, 0xb8, 0xde, 0xbe, 0x0c, 0xbb, 0xd2, 0x10, 0xd3, 0x3d, 0x3c, 0xc8,
+  0x12, 0xf3, 0x32, 0x8c, 0x40, 0xe5, 0x53, 0xce, 0xf3, 0x5f, 0x58, 0xd9, 0xe0, 0xd3, 0xc3, 0x10,
+  0x69, 0x60, 0x78, 0x35, 0x05, 0xab, 0x5f, 0x51, 0xb4, 0xc0, 0xab, 0xe7, 0x58, 0x1f, 0xb9, 0x62,
+  0x96, 0x23, 0xd0, 0xf9, 0x50, 0xda, 0x3b, 0xe7, 0x83, 0x52, 0x3f, 0xe8, 0x85, 0x41, 0xa6, 0xda,
+  0xfd, 0xd3, 0xf7, 0x1f, 0x6a, 0xde, 0xc5, 0x58, 0xb9, 0x0c, 0x7b, 0xd9, 0xa6, 0x4b, 0x26, 0x4d,
+  0xc7, 0x5d, 0x96, 0x0b, 0x8a, 0x4a, 0x4f, 0x4d, 0x69, 0x85, 0x9c, 0x57, 0xec, 0x98, 0x24, 0xfb,
+  0x59, 0x96, 0x84, 0xd7, 0xcb, 0x0c, 0x68, 0x93, 0x3f, 0x6d, 0xe6, 0x38, 0x4f, 0xdd, 0x56, 0x30,
+  0xf4, 0xf2, 0x26, 0x3d, 0x9d, 0xf5, 0xda, 0xe4, 0x17, 0xaa, 0x9b, 0xbf, 0x60, 0x84, 0x01, 0x37,
+  0x98, 0xb3, 0x88, 0x9d, 0xd3, 0xd6, 0xdc, 0x71, 0x81, 0x12, 0x30, 0xfa, 0xbb, 0x39, 0xa7, 0x1a,
+  0xb0, 0x86, 0x5f, 0x95, 0x6d, 0x76, 0xe5, 0xb2, 0xad, 0xa9, 0xb7, 0x9b, 0xbb, 0x83, 0xd4, 0x13,
+  0x79, 0x95, 0x93, 0x9e, 0xa3, 0x5c, 0x35, 0xe3, 0x4e, 0xef, 0x34, 0xef, 0xe6, 0xa9, 0xe5, 0x74,
+  0x9f, 0x66, 0x9c, 0x3d, 0x26, 0x19, 0xbd, 0xe8, 0x67, 0x38, 0xc2, 0x64, 0x09, 0xb3, 0xd8, 0x82,
+  0x82, 0xa2, 0x54, 0x23, 0xb5, 0xa3, 0xf4, 0x5a, 0xf9, 0x1c, 0xbd, 0xab, 0x89, 0xd5, 0xa0, 0x8a,
+  0x3b, 0x34, 0x7b, 0x36, 0x74, 0x2a, 0x79, 0xf7, 0xd9, 0xc0, 0x87, 0x34, 0x83, 0xde, 0x17, 0x51,
+  0x80, 0xc1, 0xd8, 0x7f, 0xfe, 0xe7, 0x7f, 0x45, 0xee, 0xf8, 0xf3, 0x3f, 0xff, 0x8b, 0x7f, 0x84,
+  0xec, 0x0d, 0xc9, 0x13, 0x8d, 0xc2, 0x78, 0xca, 0xbf, 0xff, 0xb5, 0x07, 0xf3, 0x2f, 0x3c, 0x98,
+  0x7f, 0xcd, 0x19, 0xbd, 0x7e, 0xa5, 0x83, 0x1d, 0x4a, 0x69, 0x7a, 0xf0, 0x26, 0x92, 0xac, 0x03,
+  0xeb, 0xd8, 0xc7, 0xf5, 0xa0, 0xbc, 0xb6, 0xd4, 0x78, 0xc0, 0x09, 0x27, 0x85, 0xaf, 0x15, 0xf4,
+  0x13, 0xa1, 0x94, 0x51, 0xd0, 0xb4, 0x6a, 0x32, 0xa2, 0x92, 0x54, 0xda, 0x7f, 0x81, 0x01, 0x95,
+  0xe4, 0xa4, 0xfd, 0x0b, 0x8c, 0xa7, 0x98, 0xa0, 0xbe, 0xc1, 0x66, 0xba, 0x12, 0x9c, 0x02, 0xd3,
+  0xc7, 0xcc, 0x5a, 0xa1, 0xbc, 0x2d, 0xf0, 0x9f, 0xbb, 0xed, 0xae, 0xca, 0xaa, 0xde, 0x08, 0x63,
+  0x3f, 0x5d, 0xfb, 0x63, 0xd0, 0xb6, 0x61, 0xfd, 0x35, 0x70, 0xf7, 0x12, 0x99, 0x3f, 0x06, 0x75,
+  0x0b, 0xd4, 0x63, 0x30, 0xcf, 0x53, 0xa5, 0xd7, 0x2f, 0xc8, 0x32, 0xcd, 0x0c, 0xe5, 0x6f, 0xc3,
+  0x49, 0x58, 0xc1, 0xfb, 0x9e, 0x05, 0x57, 0x92, 0x1a, 0xd6, 0x24, 0x7f, 0xed, 0x36, 0xe9, 0x52,
+  0x8d, 0xf2, 0x71, 0x3d, 0xaa, 0x21, 0xfa, 0x1d, 0xae, 0x06, 0x56, 0x89, 0x9b, 0xca, 0x4d, 0xd7,
+  0xa7, 0xe4, 0x74, 0xdd, 0xda, 0xd5, 0x67, 0x95, 0x51, 0x60, 0x83, 0xa2, 0xa7, 0x54, 0x2d, 0xab,
+  0x40, 0x47, 0x11, 0xab, 0x4b, 0x57, 0x0d, 0xb6, 0xd5, 0x7c, 0x82, 0x08, 0xa0, 0xea, 0x14, 0x8d,
+  0x8b, 0xbd, 0x97, 0x56, 0xd4, 0x4d, 0xcf, 0x89, 0x55, 0x72, 0xa7, 0xa3, 0x13, 0xa6, 0x6b, 0xbd,
+  0x9f, 0x1a, 0xe8, 0x13, 0x49, 0x42, 0x33, 0xb7, 0x37, 0x32, 0x32, 0x36, 0x9a, 0xbd, 0x1e, 0xb5,
+  0xdb, 0xa2, 0xbe, 0x56, 0x91, 0xf2, 0x5e, 0xa5, 0xe1, 0x0f, 0xc6, 0x87, 0xf0, 0x1d, 0x63, 0x5d,
+  0xca, 0x13, 0x9a, 0xb5, 0xbe, 0xd0, 0xc3, 0x4c, 0x9b, 0xfa, 0x19, 0xa6, 0xf6, 0xcf, 0xf2, 0x3a,
+  0x05, 0xf4, 0xc4, 0x85, 0x1c, 0x4b, 0x0c, 0x1f, 0xb7, 0x72, 0x4f, 0xe0, 0x57, 0x75, 0xc3, 0xc6,
+  0x7e, 0x13, 0xab, 0x8d, 0xd1, 0x9d, 0x98, 0x38, 0xea, 0x56, 0x35, 0xc5, 0xc3, 0xcd, 0x64, 0x1e,
+  0xfe, 0x23, 0x39, 0xd3, 0x35, 0xea, 0xed, 0xfc, 0xd9, 0x2c, 0x68, 0x32, 0x05, 0x6b, 0x10, 0xbd,
+  0xba, 0xee, 0x73, 0x87, 0x18, 0x5e, 0xc0, 0xf8, 0x6c, 0x19, 0x7c, 0xae, 0x64, 0x30, 0x13, 0x27,
+  0x52, 0x52, 0x58, 0xfc, 0x39, 0x2c, 0xb5, 0x0d, 0x10, 0xc2, 0x6a, 0x98, 0x11, 0x0c, 0x33, 0x55,
+  0xc2, 0x44, 0x30, 0x1e, 0x78, 0xba, 0x06, 0xe5, 0x71, 0xa2, 0x2e, 0xaa, 0x1a, 0x5c, 0x66, 0xb0,
+  0x79, 0x5e, 0xce, 0xea, 0xb0, 0xd9, 0x36, 0xd8, 0xfc, 0x10, 0x83, 0xe9, 0x78, 0x34, 0x83, 0x31,
+  0x7d, 0x22, 0x46, 0x71, 0x91, 0x31, 0x19, 0xdf, 0x7c, 0x84, 0x8e, 0x43, 0x0a, 0x5a, 0x4b, 0xe2,
+  0x78, 0x06, 0x38, 0xcc, 0xe3, 0x4f, 0x8c, 0x92, 0xbe, 0x7f, 0xbd, 0x16, 0x32, 0xdf, 0x18, 0x64,
+  0xde, 0x84, 0xd9, 0x1c, 0xb3, 0xfe, 0x7e, 0x1f, 0x43, 0x8d, 0x86, 0x98, 0xfc, 0x2c, 0xe5, 0xc7,
+  0x08, 0xa6, 0x0a, 0xc8, 0x86, 0x87, 0xf9, 0x48, 0x94, 0x71, 0x28, 0x81, 0xab, 0xa3, 0x60, 0xbe,
+  0xde, 0x14, 0xbd, 0x30, 0x78, 0x50, 0xc2, 0x2a, 0x41, 0xa4, 0xb9, 0xbc, 0x4b, 0x51, 0x34, 0x5d,
+  0x5c, 0xf2, 0xeb, 0xc1, 0x2e, 0x2e, 0x47, 0xf1, 0x95, 0xba, 0x33, 0x86, 0x49, 0x4e, 0xa0, 0x7e,
+  0xf2, 0x08, 0x8e, 0xf9, 0xd6, 0xa0, 0x73, 0x2c, 0x83, 0x64, 0x2e, 0x4e, 0x31, 0x02, 0xf8, 0x63,
+  0x18, 0x15, 0x28, 0x53, 0x85, 0xcd, 0xd9, 0x1c, 0x9f, 0x3f, 0x07, 0x13, 0x7c, 0x09, 0x32, 0xcd,
+  0x87, 0xb1, 0x23, 0x99, 0xe4, 0x37, 0xce, 0xd6, 0x9e, 0xa8, 0xdf, 0xe6, 0x04, 0x9a, 0xc6, 0x8b,
+  0x05, 0x32, 0x00, 0x0a, 0xec, 0x7a, 0x13, 0x75, 0x83, 0xe7, 0x9f, 0xc9, 0x1d, 0xa1, 0x93, 0x2e,
+  0x31, 0x1e, 0x47, 0x7a, 0x88, 0x44, 0xf1, 0x6d, 0x19, 0x16, 0xad, 0x42, 0xaa, 0xc2, 0x5c, 0xd4,
+  0x8d, 0x36, 0xa1, 0x5f, 0x99, 0x4a, 0x80, 0x76, 0x48, 0xf2, 0x2e, 0xa6, 0x30, 0x8f, 0x94, 0x06,
+  0x64, 0x16, 0xd3, 0x72, 0x50, 0x90, 0x76, 0x72, 0x49, 0x52, 0x84, 0xb5, 0xa9, 0xca, 0xaa, 0x82,
+  0x0f, 0x69, 0x59, 0xfa, 0xc5, 0xdb, 0xa3, 0xe7, 0x6f, 0xff, 0x80, 0x78, 0xce, 0x47, 0xe1, 0x22,
+  0x22, 0xa4, 0xd1, 0x2e, 0xdb, 0x61, 0x87, 0x59, 0xe9, 0xdc, 0x5a, 0x57, 0x6e, 0x69, 0x10, 0x74,
+  0x33, 0x0f, 0x5b, 0x6c, 0x6d, 0x6c, 0xbd, 0xe8, 0x6f, 0x6e, 0xf4, 0x37, 0x5f, 0x60, 0x2d, 0x7d,
+  0x83, 0x74, 0x47, 0xbc, 0x33, 0x23, 0xe2, 0xeb, 0xbb, 0x6d, 0x3c, 0xf7, 0xa4, 0xa8, 0x6b, 0x04,
+  0x05, 0x2a, 0x03, 0x56, 0x0f, 0xad, 0x95, 0x52, 0xb7, 0x03, 0x8c, 0x38, 0x81, 0xa9, 0x12, 0x46,
+  0xdd, 0x28, 0x08, 0x6a, 0x74, 0xb7, 0x21, 0xde, 0x7b, 0xc0, 0x7d, 0x62, 0x14, 0xdc, 0xc5, 0x64,
+  0x6a, 0x54, 0x36, 0xde, 0x36, 0x8d, 0x15, 0x05, 0xe9, 0x09, 0x6f, 0x91, 0x8e, 0xd4, 0xd6, 0xd7,
+  0x1f, 0x56, 0xde, 0xd2, 0x24, 0xe6, 0x6c, 0x7f, 0x8f, 0x79, 0x6c, 0x60, 0x6e, 0xe7, 0xf8, 0x64,
+  0x06, 0x6a, 0x17, 0xe2, 0x88, 0x62, 0xcb, 0xf7, 0x3d, 0xef, 0xd5, 0xdf, 0x77, 0xef, 0x1d, 0xa5,
+  0x59, 0x3e, 0xb3, 0x97, 0x32, 0x5b, 0x2e, 0x50, 0xd4, 0x64, 0x14, 0x2f, 0x50, 0x6d, 0x09, 0x39,
+  0xff, 0x14, 0x26, 0xf1, 0x5c, 0xa9, 0x30, 0x4f, 0x2c, 0x61, 0xa9, 0xc2, 0x5c, 0x8a, 0x89, 0xfc,
+  0xd3, 0x12, 0xc8, 0x80, 0x41, 0x87, 0x71, 0xc4, 0x02, 0x41, 0x24, 0x41, 0xdd, 0xb1, 0xe6, 0x74,
+  0x72, 0x46, 0x52, 0x7f, 0x36, 0xb7, 0x57, 0xcc, 0xa6, 0x46, 0xe4, 0x14, 0x38, 0x6a, 0xf0, 0x47,
+  0xc6, 0x60, 0xbe, 0x98, 0x35, 0x9b, 0x48, 0x1e, 0xf3, 0x85, 0x84, 0x65, 0xd1, 0x52, 0x28, 0x0d,
+  0x26, 0xf1, 0x80, 0x62, 0xe5, 0x30, 0xfc, 0xe1, 0x7b, 0x3a, 0x89, 0x5e, 0xc4, 0x29, 0xf2, 0xd1,
+  0x5d, 0x59, 0xeb, 0xda, 0xe9, 0xd8, 0xae, 0x9a, 0x8e, 0x23, 0x84, 0x42, 0xd3, 0xa0, 0xce, 0xb9,
+  0x71, 0xf3, 0x6f, 0xf8, 0xcc, 0x9d, 0x8c, 0x93, 0xe0, 0xa3, 0xb4, 0x16, 0xd6, 0xeb, 0x30, 0x92,
+  0xfd, 0x49, 0x02, 0x8c, 0x32, 0x8e, 0xee, 0xd4, 0x92, 0xa6, 0x41, 0xd4, 0x4d, 0x89, 0xd1, 0x56,
+  0x2b, 0x65, 0x6c, 0x6b, 0x63, 0xc5, 0xac, 0x9c, 0x10, 0x12, 0x0a, 0x5f, 0x91, 0x1b, 0x09, 0x95,
+  0x5c, 0x9e, 0xcf, 0xc9, 0x55, 0x70, 0x8d, 0xd1, 0x5c, 0x98, 0x1a, 0x66, 0xa6, 0xcc, 0x83, 0xda,
+  0x96, 0xd6, 0xa4, 0x24, 0x71, 0x9a, 0xf6, 0xaf, 0x93, 0xf8, 0x36, 0x95, 0x09, 0x65, 0xa0, 0x07,
+  0x75, 0xda, 0x50, 0x42, 0x36, 0xdf, 0x3b, 0x8b, 0xa7, 0x35, 0x27, 0x5b, 0xf9, 0x9c, 0x68, 0x93,
+  0xe1, 0x4f, 0x4b, 0x58, 0xcb, 0x64, 0x12, 0xdd, 0x29, 0x5b, 0xa1, 0xd4, 0xd8, 0xc1, 0xf1, 0xff,
+  0xfd, 0xb6, 0x8e, 0xb9, 0x40, 0x97, 0x30, 0x87, 0x2f, 0xe0, 0x7c, 0x84, 0x30, 0x17, 0x37, 0xd3,
+  0xec, 0xeb, 0xe8, 0xbb, 0x6f, 0x56, 0xcc, 0xc5, 0x41, 0x1c, 0xa1, 0x8d, 0x2c, 0xd2, 0x00, 0x34,
+  0x2c, 0xe1, 0xb0, 0x96, 0x96, 0x83, 0x2d, 0x78, 0xa2, 0xe2, 0x8e, 0x60, 0xed, 0x5d, 0x4c, 0xd3,
+  0x86, 0xb3, 0xf1, 0x73, 0x82, 0xdc, 0x98, 0x2e, 0x67, 0xb8, 0x41, 0xc9, 0x09, 0xb5, 0xa6, 0xba,
+  0x7a, 0x51, 0x35, 0x17, 0x97, 0x18, 0x45, 0xbe, 0x04, 0x1a, 0x67, 0x68, 0xfb, 0xcd, 0xd8, 0xf6,
+  0x2b, 0x4c, 0xc4, 0xeb, 0x38, 0xfe, 0x48, 0x51, 0x3c, 0x7c, 0x7f, 0x91, 0x8d, 0x2b, 0x5a, 0x26,
+  0x25, 0x4d, 0xc3, 0x27, 0xa5, 0xf4, 0xd5, 0x2c, 0x80, 0x99, 0x8c, 0x17, 0x06, 0x93, 0xd5, 0x72,
+  0xd1, 0x4c, 0x59, 0xd5, 0x0e, 0xed, 0x5b, 0x67, 0x68, 0xdb, 0x16, 0x9b, 0x05, 0x60, 0xe8, 0x88,
+  0xc8, 0x32, 0x07, 0x6f, 0x03, 0x36, 0x51, 0x3c, 0x2e, 0x9b, 0xc6, 0x98, 0xdc, 0x96, 0x57, 0x12,
+  0x1c, 0xd4, 0x82, 0x1a, 0xa2, 0x36, 0xd4, 0x0d, 0xbe, 0x82, 0xac, 0x6f, 0x7e, 0xbb, 0x82, 0xbf,
+  0x5e, 0x2f, 0xef, 0x74, 0xcf, 0xae, 0xfd, 0xd1, 0x80, 0xc7, 0xb4, 0x44, 0x11, 0xbe, 0x2a, 0xb6,
+  0x6d, 0x21, 0x85, 0x1c, 0xdf, 0xc8, 0xa6, 0x7c, 0xb6, 0x8f, 0x57, 0x80, 0xc5, 0x24, 0x4c, 0xc8,
+  0x09, 0x1b, 0x64, 0x0d, 0x17, 0x53, 0x6e, 0x96, 0x4a, 0x60, 0x8e, 0x71, 0x75, 0xbb, 0xda, 0x09,
+  0xfc, 0x6d, 0xd5, 0x04, 0x22, 0x45, 0xd0, 0xf4, 0x99, 0x2c, 0x61, 0x87, 0x93, 0xc1, 0x2a, 0x51,
+  0x98, 0x3a, 0x34, 0xf6, 0x04, 0xde, 0x30, 0x4f, 0xe3, 0x09, 0xab, 0x84, 0x51, 0x3c, 0x99, 0x48,
+  0xcc, 0x54, 0x0c, 0xda, 0x2f, 0x9f, 0xb8, 0xa2, 0xc5, 0xcd, 0x96, 0xdc, 0x6a, 0x0d, 0xbd, 0xca,
+  0x0a, 0x3a, 0x91, 0x01, 0x85, 0xef, 0x05, 0x9f, 0x82, 0x30, 0xc2, 0x4e, 0x05, 0x25, 0xb9, 0x6e,
+  0x36, 0x6d, 0xaf, 0x49, 0xc7, 0x8a, 0x58, 0x59, 0xc3, 0xa0, 0x52, 0xa2, 0xf8, 0xa6, 0xe9, 0x84,
+  0xfd, 0x14, 0xa6, 0x18, 0x2c, 0xa6, 0x69, 0x23, 0x52, 0x58, 0x38, 0x2b, 0x66, 0xbb, 0x48, 0xfe,
+  0x6f, 0x2d, 0xfa, 0xff, 0xce, 0xa1, 0xff, 0x37, 0x39, 0xfd, 0x4f, 0x62, 0x80, 0x0d, 0xb2, 0xa3,
+  0x37, 0x30, 0x09, 0xfc, 0x0f, 0x20, 0x5a, 0x98, 0x85, 0xed, 0x0d, 0x01, 0xf2, 0xbe, 0x04, 0x15,
+  0x00, 0x63, 0x40, 0xd7, 0xad, 0x78, 0x06, 0xd8, 0x24, 0x9c, 0x9a, 0x35, 0x4b, 0x80, 0xa7, 0x59,
+  0xa7, 0xfc, 0xc5, 0x8d, 0x98, 0x4d, 0x42, 0x04, 0xa4, 0x20, 0x99, 0xf5, 0xc9, 0x9a, 0x6e, 0x30,
+  0x07, 0x9b, 0x2f, 0xa8, 0x4d, 0xb2, 0x9c, 0xcf, 0x0b, 0xcb, 0x5c, 0x95, 0xd9, 0xc2, 0x4d, 0x46,
+  0x60, 0xaa, 0xf5, 0xc7, 0xf1, 0xed, 0x7c, 0x6d, 0x6b, 0xe5, 0xf7, 0x95, 0x14, 0x97, 0x01, 0xc6,
+  0xa8, 0x4a, 0x66, 0x6a, 0x0c, 0xd1, 0xbc, 0x85, 0xad, 0x49, 0xe5, 0x9e, 0x7b, 0x0a, 0xd5, 0xb3,
+  0xe9, 0x1d, 0xa8, 0x6d, 0xcc, 0xe4, 0x89, 0x4d, 0x4e, 0x40, 0x0c, 0x83, 0xbb, 0xfe, 0x9b, 0x24,
+  0x84, 0x7f, 0xbe, 0x92, 0xe2, 0x5a, 0x45, 0xf5, 0x73, 0x10, 0x2e, 0xc2, 0x33, 0xba, 0x13, 0xea,
+  0x65, 0x84, 0x26, 0xbc, 0x0f, 0xc2, 0x0d, 0x04, 0x07, 0x9b, 0x37, 0x94, 0x9c, 0x80, 0xa4, 0x91,
+  0x6d, 0x82, 0x0b, 0x11, 0xe9, 0x47, 0xe4, 0x76, 0x1e, 0xf8, 0xfa, 0x1a, 0x67, 0x73, 0xc3, 0x99,
+  0x80, 0x17, 0xbe, 0xf5, 0x4e, 0x51, 0xbd, 0xb0, 0xb4, 0xa5, 0x71, 0x92, 0x56, 0x9a, 0xec, 0x18,
+  0xc3, 0x2d, 0x61, 0x17, 0x4d, 0xd2, 0x0f, 0x18, 0x4d, 0x97, 0xb3, 0x70, 0x8c, 0x0f, 0x95, 0xe7,
+  0x0d, 0x1f, 0x6f, 0x94, 0xfc, 0x76, 0x05, 0xed, 0xcf, 0x12, 0x3c, 0xa2, 0x1b, 0x5e, 0x9e, 0x6f,
+  0x6f, 0xe1, 0x66, 0x70, 0x19, 0x35, 0x5d, 0x31, 0xde, 0x44, 0x41, 0x3a, 0x45, 0x75, 0x3f, 0x03,
+  0x69, 0x91, 0xcd, 0xd8, 0xfe, 0x04, 0xef, 0x99, 0xeb, 0xe1, 0x61, 0x0c, 0x31, 0x2e, 0xaa, 0x69,
+  0xc3, 0x85, 0x22, 0x37, 0xf5, 0x89, 0xba, 0xf9, 0x5d, 0x87, 0x07, 0x4c, 0xdf, 0x66, 0xd5, 0xf4,
+  0x29, 0x5b, 0x6b, 0x0c, 0x63, 0xbb, 0x8e, 0x41, 0x15, 0x91, 0xab, 0x23, 0x99, 0xb0, 0x42, 0xf6,
+  0x4c, 0x9a, 0x65, 0x18, 0x8d, 0xd1, 0xda, 0xb7, 0x6a, 0x67, 0x31, 0x10, 0x91, 0xee, 0x81, 0xd0,
+  0xea, 0xdf, 0x60, 0x22, 0xd7, 0xb0, 0xf5, 0xb7, 0x56, 0x4c, 0xa5, 0xda, 0xd0, 0xbe, 0x3d, 0x2a,
+  0xdd, 0x06, 0x57, 0xda, 0xf9, 0x6a, 0xbf, 0x09, 0x6b, 0xc7, 0x75, 0x90, 0xca, 0x86, 0x62, 0x64,
+  0xef, 0x8a, 0x30, 0xee, 0x2b, 0x84, 0xcd, 0x37, 0xc7, 0x25, 0x35, 0x95, 0xa6, 0xcd, 0x0d, 0x7b,
+  0x42, 0xb6, 0xaa, 0x26, 0xc4, 0x38, 0x09, 0x82, 0x65, 0x16, 0xcf, 0xd8, 0xe5, 0x14, 0x8e, 0x61,
+  0xcd, 0x2c, 0xcc, 0xc7, 0xf0, 0xf3, 0x22, 0x42, 0x91, 0x46, 0x3f, 0x87, 0x5d, 0x3b, 0x1d, 0xc9,
+  0x79, 0x00, 0x04, 0xb7, 0xa6, 0x61, 0x1e, 0x67, 0x72, 0xad, 0xd5, 0x7c, 0x1d, 0x73, 0x72, 0xd3,
+  0xdd, 0x4a, 0x7e, 0x6b, 0x31, 0x97, 0x02, 0x2f, 0xce, 0xef, 0xb2, 0x69, 0x3c, 0x57, 0xde, 0xab,
+  0xc2, 0x40, 0xde, 0xc0, 0x72, 0x07, 0xa2, 0xa5, 0x16, 0x75, 0x55, 0x17, 0x20, 0x82, 0xd5, 0x3f,
+  0x9b, 0xe1, 0x72, 0x6a, 0xda, 0x7d, 0x05, 0xae, 0xda, 0x5e, 0xb5, 0x83, 0xfc, 0x99, 0x22, 0xa2,
+  0x59, 0x35, 0x88, 0x17, 0xe2, 0x13, 0x10, 0x3f, 0x6e, 0xea, 0x9e, 0xd1, 0xe3, 0x1d, 0xc5, 0x63,
+  0xc4, 0x5b, 0x7e, 0x96, 0xc9, 0x28, 0x4c, 0x1b, 0x5b, 0x94, 0x57, 0xb8, 0x9d, 0x9e, 0xd0, 0x6b,
+  0x1f, 0xf2, 0x73, 0x30, 0x7b, 0x80, 0x9c, 0x7f, 0x53, 0x35, 0x15, 0xe7, 0x09, 0x7a, 0xe0, 0x61,
+  0x23, 0xf2, 0x77, 0x60, 0x77, 0x5d, 0x12, 0xf1, 0x8b, 0xb6, 0x61, 0x1c, 0x7d, 0x32, 0xb8, 0xc3,
+  0xee, 0x2b, 0xc2, 0x6c, 0xcf, 0xb4, 0x73, 0x0b, 0xa3, 0xbb, 0x3a, 0xd3, 0x70, 0x0d, 0xea, 0x6f,
+  0xae, 0xa0, 0xfe, 0x31, 0xec, 0xa7, 0x0e, 0xf0, 0xfa, 0x11, 0x70, 0xfc, 0x1d, 0x8e, 0x05, 0x0c,
+  0xc4, 0x59, 0x2a, 0x3a, 0x2f, 0x9e, 0xc3, 0xf2, 0xdc, 0x6d, 0x28, 0xe1, 0xac, 0xa9, 0xd2, 0x59,
+  0x60, 0xdd, 0x5f, 0x79, 0x00, 0x31, 0xdd, 0x2d, 0xe0, 0x6f, 0x73, 0x62, 0x7a, 0xde, 0xcf, 0x54,
+  0x39, 0x50, 0x4b, 0x34, 0x26, 0xec, 0x0f, 0xe2, 0x78, 0xcc, 0xab, 0x5d, 0xbc, 0x4c, 0xe5, 0x34,
+  0x06, 0xc4, 0xf0, 0x7c, 0xe5, 0x6b, 0xed, 0x91, 0x56, 0xed, 0xc1, 0x4f, 0xc2, 0x88, 0x97, 0x7f,
+  0x79, 0xb3, 0xc2, 0x4e, 0xb6, 0x56, 0xba, 0x64, 0x19, 0xaa, 0x8d, 0xf7, 0x27, 0x79, 0x23, 0x69,
+  0x67, 0xd0, 0x94, 0x85, 0x5f, 0x63, 0x96, 0x2d, 0xed, 0x9e, 0xae, 0xb4, 0x35, 0x4a, 0x16, 0xbb,
+  0x48, 0x06, 0x64, 0x3a, 0x97, 0x6f, 0xe3, 0xea, 0xe6, 0xcb, 0xf8, 0x92, 0x2b, 0x33, 0x5a, 0xd5,
+  0x67, 0xaf, 0xea, 0x76, 0xad, 0x9c, 0x5e, 0xe5, 0xd9, 0xab, 0x6a, 0x92, 0x55, 0xe9, 0xd6, 0xf7,
+  0xea, 0x32, 0xe0, 0xad, 0x7e, 0xb5, 0x87, 0x13, 0x96, 0x04, 0x8b, 0x05, 0xa5, 0xcb, 0xf8, 0x3e,
+  0x8a, 0xaf, 0x83, 0x28, 0x4f, 0x68, 0x44, 0xb6, 0xe7, 0x0f, 0x57, 0x27, 0xc7, 0xa0, 0xf6, 0xe8,
+  0xfc, 0x4f, 0x27, 0xe9, 0x4b, 0xd5, 0xa5, 0x21, 0x75, 0xea, 0xe7, 0x25, 0x5b, 0x6b, 0xe3, 0x99,
+  0x19, 0xb2, 0x9a, 0x13, 0x14, 0x55, 0x3c, 0x52, 0x3c, 0x3c, 0x3b, 0x51, 0x07, 0xc8, 0x26, 0x91,
+  0xbb, 0xb9, 0x4e, 0xa2, 0x11, 0x54, 0x89, 0x48, 0xdc, 0x67, 0x86, 0xd4, 0xfb, 0x15, 0xf0, 0xcd,
+  0x1a, 0x88, 0xf3, 0x02, 0xf4, 0x43, 0xda, 0xff, 0x5f, 0x11, 0x71, 0x72, 0x10, 0x22, 0xf8, 0x00,
+  0x00,
+};
+
+// / <- Web_Interface.h
+static const uint8_t ASSET_INDEX_HTML[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x3d, 0xc9, 0x72, 0x1b, 0x49,
+  0x76, 0x77, 0x7e, 0x45, 0x0a, 0x33, 0x56, 0x01, 0x21, 0x2c, 0x5c, 0x24, 0x8d, 0x1a, 0x14, 0xa0,
+  0x80, 0x48, 0x50, 0xc2, 0x10, 0x04, 0x18, 0x04, 0xa8, 0x36, 0xa7, 0xa3, 0x3d, 0x93, 0xa8, 0x4a,
+  0x00, 0x35, 0x28, 0x54, 0x61, 0x6a, 0x21, 0x05, 0x51, 0x8c, 0xf0, 0xc9, 0x67, 0xdb, 0x87, 0xb1,
+  0x0f, 0x3e, 0xf9, 0x23, 0xc6, 0x07, 0xcf, 0xc9, 0x9f, 0xd2, 0x5f, 0xe2, 0xf7, 0x72, 0xa9, 0x0d,
+  0x55, 0x20, 0x40, 0x52, 0xdd, 0xe3, 0x70, 0x4c, 0x8f, 0x40, 0xe4, 0xf2, 0xf2, 0xbd, 0x97, 0x6f,
+  0xcd, 0x0d, 0x6f, 0x9f, 0x1d, 0xf7, 0x8f, 0x86, 0x57, 0xe7, 0x6d, 0x32, 0xf5, 0xe7, 0x56, 0x73,
+  0xe7, 0x2d, 0x7e, 0x10, 0x8b, 0xda, 0x93, 0x46, 0xc1, 0x77, 0x0b, 0x58, 0xc0, 0xa8, 0x01, 0x1f,
+  0x73, 0xe6, 0x53, 0xa2, 0x4f, 0xa9, 0xeb, 0x31, 0xbf, 0x51, 0xb8, 0x1c, 0x9e, 0x54, 0xde, 0x14,
+  0x54, 0xb1, 0x4d, 0xe7, 0xac, 0x51, 0xb8, 0x36, 0xd9, 0xcd, 0xc2, 0x71, 0xfd, 0x02, 0xd1, 0x1d,
+  0xdb, 0x67, 0x36, 0x34, 0xbb, 0x31, 0x0d, 0x7f, 0xda, 0x30, 0xd8, 0xb5, 0xa9, 0xb3, 0x0a, 0xff,
+  0x52, 0x36, 0x6d, 0xd3, 0x37, 0xa9, 0x55, 0xf1, 0x74, 0x6a, 0xb1, 0xc6, 0x5e, 0x75, 0x17, 0xa1,
+  0xf8, 0xa6, 0x6f, 0x31, 0x62, 0x1a, 0x8d, 0xc2, 0x82, 0x4e, 0x58, 0x85, 0x7f, 0x2d, 0x34, 0x87,
+  0xce, 0xfe, 0xb1, 0x43, 0x2a, 0x64, 0x30, 0xa7, 0xae, 0x7f, 0xea, 0xd2, 0xb1, 0xff, 0xb6, 0xc6,
+  0xab, 0xa0, 0x87, 0x65, 0xda, 0x33, 0xe2, 0x32, 0xab, 0x51, 0xf0, 0xfc, 0xa5, 0xc5, 0xbc, 0x29,
+  0x63, 0x30, 0xf0, 0xd4, 0x65, 0xe3, 0x46, 0xa1, 0x46, 0x17, 0x8b, 0xaa, 0xee, 0x79, 0xef, 0xae,
+  0x1b, 0x6f, 0x5e, 0x8d, 0x7f, 0xf3, 0xfa, 0x95, 0xa1, 0xe3, 0x20, 0x35, 0x49, 0xc9, 0xc8, 0x31,
+  0x96, 0xf0, 0x61, 0x98, 0xd7, 0x44, 0xb7, 0xa8, 0xe7, 0x01, 0x9a, 0x8e, 0x3b, 0xf3, 0x16, 0x54,
+  0x67, 0x85, 0x64, 0xb9, 0x67, 0x1a, 0x6c, 0x44, 0xdd, 0xec, 0xd2, 0x0a, 0x82, 0x63, 0x79, 0x95,
+  0x82, 0x04, 0x4e, 0x12, 0x60, 0xb3, 0x8e, 0x22, 0xe8, 0x9c, 0x0d, 0xc2, 0xf3, 0xa9, 0xef, 0xa5,
+  0xc1, 0x43, 0x59, 0xa1, 0x99, 0x2e, 0xa9, 0x5c, 0x53, 0x2b, 0x90, 0xa3, 0xf9, 0x8e, 0x0f, 0xdc,
+  0xf5, 0xa9, 0x37, 0x83, 0xbe, 0xbb, 0x02, 0xfc, 0x4a, 0x7b, 0x8b, 0x8e, 0x98, 0x05, 0xe8, 0xf4,
+  0xcf, 0xbb, 0xad, 0x33, 0xd9, 0x26, 0x03, 0x91, 0x7b, 0x07, 0xa3, 0xba, 0x6f, 0x5e, 0xb3, 0x0d,
+  0x47, 0x6b, 0x9d, 0x0e, 0x3b, 0x27, 0x8f, 0x18, 0x4c, 0x50, 0xb6, 0x70, 0x9d, 0x3f, 0x32, 0xdd,
+  0xbf, 0x7f, 0xb8, 0xf3, 0x8b, 0xfe, 0x6f, 0xdb, 0xc9, 0xe1, 0x92, 0x1f, 0x59, 0xb3, 0x46, 0x47,
+  0x9c, 0xe3, 0xa3, 0xc0, 0xf7, 0x1d, 0x3b, 0xa3, 0xb6, 0x40, 0x0c, 0xea, 0xd3, 0x8a, 0x4e, 0x7d,
+  0x36, 0x71, 0xdc, 0x65, 0xa3, 0xf0, 0x3d, 0x88, 0x8e, 0x44, 0x8f, 0x8e, 0xb0, 0x7c, 0xaf, 0xd0,
+  0xfc, 0xbe, 0x7f, 0x71, 0xfa, 0xb6, 0x26, 0x60, 0xac, 0x03, 0x46, 0x04, 0xfb, 0x56, 0x60, 0x9e,
+  0x33, 0xd7, 0x73, 0x6c, 0x6a, 0x25, 0xe0, 0xee, 0x03, 0x45, 0xed, 0x8b, 0x41, 0xbf, 0xd7, 0xea,
+  0x6e, 0x02, 0x7b, 0x15, 0xa8, 0xe2, 0x5b, 0x1c, 0xe8, 0x81, 0x64, 0xd3, 0xd1, 0x70, 0x10, 0x03,
+  0xba, 0x46, 0x24, 0x19, 0x75, 0xf5, 0x29, 0x4c, 0x93, 0x69, 0x2f, 0x02, 0x9f, 0xf8, 0xcb, 0x05,
+  0xe8, 0xbd, 0xcf, 0x3e, 0xa3, 0xce, 0x8b, 0x96, 0x72, 0x7a, 0x54, 0x4b, 0xa1, 0xd3, 0xa9, 0xb2,
+  0x85, 0x05, 0xaa, 0x36, 0x75, 0x2c, 0xd0, 0x1e, 0x89, 0x17, 0xa1, 0x2e, 0xad, 0x56, 0xab, 0x85,
+  0xe6, 0x9a, 0xb1, 0x51, 0x6d, 0x93, 0x02, 0xa2, 0x44, 0xa1, 0x62, 0x99, 0x9e, 0x9f, 0x18, 0x4a,
+  0x16, 0x35, 0xf3, 0xa5, 0x4d, 0x02, 0x1d, 0x3b, 0x8e, 0x2f, 0x74, 0x38, 0x9b, 0x93, 0x23, 0xdf,
+  0x16, 0x80, 0x6d, 0x76, 0xa3, 0x44, 0x8f, 0x17, 0x36, 0x5f, 0x90, 0xab, 0x76, 0xaf, 0x43, 0xa4,
+  0x94, 0xdd, 0x33, 0x21, 0x21, 0x18, 0x30, 0x9e, 0xbe, 0x69, 0x4f, 0x3c, 0x01, 0xa3, 0x75, 0xd5,
+  0xba, 0xe8, 0xb6, 0x2e, 0x56, 0x59, 0xbf, 0x8a, 0xf0, 0x82, 0xda, 0x28, 0xd4, 0xab, 0x65, 0xd9,
+  0x66, 0x48, 0x54, 0x71, 0xab, 0x53, 0x71, 0x9d, 0x1b, 0x55, 0xcb, 0x6d, 0xa5, 0x98, 0xb1, 0x0a,
+  0xb5, 0xcc, 0x89, 0x5d, 0xd7, 0xc1, 0x4e, 0x33, 0xf7, 0x90, 0xdb, 0xe6, 0xfa, 0xde, 0xee, 0xee,
+  0xdf, 0x1d, 0xa6, 0x78, 0x1c, 0x01, 0x12, 0x14, 0xe8, 0x81, 0xeb, 0x42, 0x1f, 0xc5, 0x0c, 0x29,
+  0x40, 0x64, 0xd0, 0x3e, 0x5a, 0x55, 0x47, 0xd1, 0xd9, 0x0b, 0x46, 0xf9, 0xfd, 0x2b, 0x06, 0xf3,
+  0xf4, 0xf4, 0x44, 0xe5, 0x90, 0x5f, 0x19, 0x9b, 0x16, 0x20, 0x0b, 0x22, 0x2c, 0xe9, 0xf8, 0x63,
+  0xe0, 0xf9, 0xe6, 0x78, 0x59, 0x91, 0xfe, 0x46, 0x11, 0xb3, 0x3a, 0x9d, 0xf1, 0xee, 0xc8, 0xfa,
+  0xa4, 0xe6, 0x89, 0x72, 0xb0, 0x66, 0x16, 0xda, 0xc4, 0xcb, 0xb3, 0xcb, 0xdc, 0xf9, 0x4c, 0xc3,
+  0x49, 0x03, 0x10, 0x50, 0x95, 0xa5, 0x7b, 0x18, 0x10, 0xdd, 0x99, 0x2f, 0x2c, 0xe6, 0x33, 0x03,
+  0x70, 0x69, 0x9d, 0xb5, 0xce, 0xba, 0xad, 0x5e, 0xab, 0xf7, 0x50, 0x60, 0x68, 0x99, 0x0b, 0xcd,
+  0x0f, 0xfd, 0x8b, 0xf6, 0xa7, 0x87, 0x82, 0x00, 0x6d, 0x05, 0x51, 0x05, 0x47, 0xf1, 0x60, 0x24,
+  0x6c, 0xd0, 0xb1, 0x42, 0xb3, 0xd7, 0x1f, 0x3e, 0x14, 0x80, 0xcb, 0xe6, 0xa6, 0xcd, 0x85, 0xfc,
+  0x63, 0x6b, 0xd8, 0x01, 0x95, 0x19, 0x9e, 0xb5, 0x36, 0x56, 0x9a, 0x0c, 0xc3, 0xc1, 0xfd, 0x15,
+  0x97, 0x1a, 0x6a, 0xda, 0x00, 0x56, 0x9a, 0xc4, 0x64, 0x61, 0xa2, 0x07, 0x9b, 0x2f, 0xfc, 0x25,
+  0xf7, 0xc8, 0x40, 0xc9, 0xdb, 0xe9, 0x01, 0xef, 0xa1, 0x42, 0x19, 0xdb, 0xc9, 0xd0, 0x86, 0x4e,
+  0xf7, 0xac, 0x7d, 0xdc, 0x81, 0xa0, 0xe3, 0xa0, 0xf9, 0x76, 0x91, 0x68, 0xee, 0x31, 0x0b, 0x05,
+  0x3f, 0xec, 0x32, 0x70, 0x2c, 0xe2, 0x53, 0x0c, 0x06, 0xa8, 0x4d, 0x46, 0xa6, 0x4b, 0x78, 0x0d,
+  0xf1, 0x98, 0x6e, 0xda, 0x6f, 0x6b, 0x8b, 0x84, 0x6e, 0x64, 0x7b, 0xb2, 0x24, 0x33, 0xc7, 0xe0,
+  0x59, 0x80, 0xe5, 0xe6, 0xd8, 0x04, 0x0b, 0x6f, 0x3a, 0x76, 0x65, 0x8c, 0xee, 0x80, 0x1b, 0xb1,
+  0x78, 0x29, 0x67, 0xb3, 0x54, 0x24, 0xd7, 0x9c, 0x4c, 0xfd, 0xfa, 0xde, 0xde, 0xee, 0xe2, 0x33,
+  0x68, 0xcf, 0xb3, 0xb7, 0x10, 0x0c, 0xd9, 0x19, 0x3d, 0xa8, 0x31, 0x61, 0xa1, 0xa5, 0xcf, 0xa8,
+  0x02, 0xf4, 0xb0, 0x67, 0x33, 0x77, 0x9e, 0x43, 0x4c, 0xe0, 0x8f, 0x0a, 0x9a, 0x54, 0x21, 0x9f,
+  0x2f, 0x62, 0x1d, 0x62, 0x4c, 0x9f, 0x3b, 0x46, 0xe4, 0x04, 0xbd, 0x59, 0x45, 0x7c, 0xcf, 0x68,
+  0xa3, 0x0c, 0x40, 0x66, 0x9d, 0x0c, 0xbd, 0xb8, 0xb5, 0x96, 0x8a, 0x20, 0xb8, 0x96, 0xeb, 0xc3,
+  0x44, 0x3f, 0x5e, 0x2d, 0x46, 0x97, 0x80, 0x10, 0x07, 0x69, 0xc9, 0x12, 0x2e, 0xec, 0x3d, 0xf5,
+  0x2c, 0x73, 0xc6, 0xfd, 0x17, 0x84, 0xb2, 0x00, 0x89, 0xba, 0x8c, 0xa6, 0x90, 0x90, 0xa5, 0x2b,
+  0xf0, 0xb8, 0xf9, 0x4b, 0x82, 0x6b, 0xe9, 0xe6, 0xcc, 0xa2, 0x73, 0x5a, 0x26, 0x06, 0x04, 0xd7,
+  0x4b, 0x8b, 0xba, 0x65, 0x9c, 0x4f, 0xf8, 0x94, 0x2e, 0x52, 0x01, 0xcb, 0xa2, 0x76, 0xec, 0xb8,
+  0x73, 0x65, 0xf1, 0x85, 0xa0, 0x25, 0xeb, 0x45, 0xd9, 0x2a, 0x59, 0xc0, 0x05, 0x00, 0xed, 0x2c,
+  0x70, 0x36, 0x09, 0x0f, 0xba, 0x42, 0xe3, 0xe1, 0xb8, 0xec, 0xfa, 0x6d, 0x4d, 0x54, 0xa5, 0x9b,
+  0x48, 0xe3, 0x00, 0xff, 0xe6, 0xb5, 0x90, 0xca, 0xef, 0xf8, 0x79, 0x0d, 0x62, 0xca, 0x0d, 0xb2,
+  0xe4, 0x5a, 0xd4, 0x9f, 0xd3, 0xa8, 0x6d, 0x4d, 0x20, 0xbc, 0x1d, 0x35, 0x0b, 0xd7, 0x74, 0x5c,
+  0xd3, 0x5f, 0xae, 0x50, 0x64, 0x21, 0x63, 0x8e, 0x03, 0x2f, 0x98, 0xe5, 0x61, 0x33, 0x67, 0x86,
+  0x19, 0xcc, 0x41, 0x31, 0x38, 0x64, 0x66, 0x34, 0xfb, 0xae, 0x4f, 0xf3, 0x1a, 0x4f, 0x41, 0x6d,
+  0x40, 0xb2, 0x82, 0x99, 0xc7, 0x66, 0x59, 0x28, 0xc7, 0x25, 0xcc, 0x40, 0xd3, 0x91, 0xc4, 0x5e,
+  0x14, 0xa5, 0x05, 0x82, 0x9b, 0x98, 0x2c, 0x6b, 0xf6, 0xa8, 0x09, 0x76, 0xd9, 0x82, 0xf1, 0x00,
+  0x3b, 0x49, 0x01, 0xf8, 0x18, 0x36, 0x73, 0xa9, 0x4b, 0x96, 0x4e, 0x2e, 0x4b, 0x0c, 0x6a, 0x5a,
+  0xc0, 0xca, 0x8f, 0xcc, 0x25, 0x93, 0x20, 0x77, 0x9e, 0x6f, 0x18, 0x9b, 0x19, 0x74, 0xe9, 0xe1,
+  0x34, 0x82, 0x25, 0x23, 0xa6, 0x6e, 0xae, 0x6b, 0xca, 0x21, 0x62, 0x43, 0xd0, 0x9c, 0xdc, 0xb9,
+  0x00, 0xad, 0x9e, 0x62, 0xc3, 0xd6, 0x32, 0xd1, 0x2a, 0x9b, 0xc1, 0x76, 0x30, 0x1f, 0xa1, 0x2d,
+  0xbf, 0x9f, 0xc5, 0xec, 0x9a, 0xb9, 0xcb, 0x02, 0x01, 0xb1, 0x6b, 0x14, 0xf6, 0xe0, 0x93, 0x7e,
+  0x6e, 0x14, 0xbe, 0xfb, 0xae, 0xa0, 0x86, 0x85, 0x22, 0xae, 0xe5, 0x8d, 0x02, 0x92, 0x5c, 0x04,
+  0x9a, 0x6b, 0x53, 0xc4, 0xb4, 0x46, 0x97, 0xa5, 0x75, 0x33, 0x83, 0xde, 0xdf, 0xb1, 0x33, 0xf2,
+  0x07, 0x51, 0x1d, 0xc6, 0x80, 0x31, 0x4c, 0x74, 0x6a, 0xeb, 0x18, 0xd6, 0x75, 0xce, 0x87, 0x6b,
+  0xc2, 0xfa, 0xb0, 0x3f, 0x78, 0x06, 0x13, 0x32, 0xc7, 0xe5, 0x2a, 0x1c, 0xb0, 0x06, 0x28, 0x36,
+  0xfd, 0xee, 0xe5, 0x60, 0x78, 0x99, 0x1f, 0x50, 0xe6, 0xa0, 0x2e, 0xe0, 0x81, 0xe4, 0xfb, 0x95,
+  0xc7, 0x1b, 0x5a, 0x6e, 0x63, 0x3b, 0xe4, 0xf8, 0xf2, 0x77, 0xed, 0x5e, 0xb7, 0xbd, 0xbd, 0xb1,
+  0x8d, 0xd0, 0x78, 0x12, 0x5b, 0x1b, 0x81, 0xfb, 0x25, 0x4d, 0x6d, 0x8c, 0xa8, 0xff, 0xfb, 0x96,
+  0x36, 0x22, 0xe6, 0xf1, 0x86, 0xf6, 0xe7, 0xb1, 0xaf, 0x31, 0x21, 0x78, 0x42, 0xf3, 0x1a, 0x41,
+  0xfd, 0x7f, 0x6f, 0x5d, 0x23, 0x56, 0xfc, 0xc2, 0xc6, 0x35, 0x42, 0xe4, 0x51, 0xb6, 0x35, 0x02,
+  0xe3, 0x51, 0xcc, 0xe8, 0x4e, 0x5b, 0x57, 0xc7, 0xed, 0xe1, 0xc3, 0xec, 0xaa, 0xca, 0x74, 0x1f,
+  0x1f, 0xbe, 0xc6, 0x96, 0xb4, 0xb6, 0x0f, 0x5f, 0x15, 0x1a, 0xb8, 0x58, 0x9b, 0xbd, 0x06, 0x63,
+  0x98, 0x5b, 0xc7, 0xb0, 0x89, 0x2c, 0x3e, 0x13, 0xa8, 0xb4, 0xb0, 0x9e, 0xb9, 0x6a, 0x51, 0x37,
+  0x0b, 0x5f, 0xd4, 0x10, 0x1b, 0xd8, 0x1a, 0xd2, 0xc7, 0x29, 0x37, 0xb7, 0x0b, 0xee, 0xee, 0xeb,
+  0x14, 0x37, 0x42, 0xab, 0x6d, 0x23, 0x6d, 0x79, 0x64, 0x3c, 0xa0, 0xc8, 0x7c, 0x82, 0x90, 0x20,
+  0x04, 0x25, 0xa3, 0x82, 0x15, 0xe1, 0x7d, 0x00, 0xac, 0x60, 0x21, 0x94, 0x5d, 0x26, 0x8c, 0x86,
+  0xe9, 0xc1, 0x64, 0x2f, 0xeb, 0xb6, 0x63, 0x33, 0xc8, 0x18, 0x3f, 0x5c, 0xf6, 0x8e, 0xda, 0xdd,
+  0x6e, 0xfb, 0x61, 0x0a, 0x92, 0xc8, 0x24, 0x1f, 0xa5, 0x25, 0xef, 0x3b, 0xdd, 0xe3, 0xce, 0x45,
+  0xe7, 0xac, 0xdb, 0xbe, 0xc8, 0x5a, 0xf4, 0x53, 0x8b, 0x6f, 0x39, 0xcb, 0xbc, 0xb1, 0xea, 0xe4,
+  0x02, 0x11, 0x14, 0x48, 0x2c, 0x2b, 0x3e, 0x0c, 0x07, 0x22, 0xf8, 0xfe, 0x12, 0x48, 0xce, 0x5f,
+  0xf6, 0x8b, 0x41, 0xca, 0x02, 0x31, 0x77, 0x5c, 0xee, 0x62, 0xae, 0x5a, 0x17, 0x9d, 0x87, 0x42,
+  0x41, 0x33, 0x8f, 0x78, 0x90, 0x8f, 0xad, 0x93, 0x61, 0xeb, 0x81, 0x40, 0x1c, 0x30, 0xd6, 0x46,
+  0x80, 0x41, 0x5b, 0xfb, 0xe8, 0xac, 0x73, 0xcf, 0x1a, 0xb0, 0x82, 0x94, 0x3d, 0x0f, 0xf1, 0x81,
+  0x54, 0x93, 0xd4, 0x02, 0xb7, 0xda, 0x15, 0x8a, 0x73, 0x32, 0x12, 0x00, 0x51, 0x10, 0x87, 0xbe,
+  0xc8, 0x5f, 0xaf, 0xd4, 0x1d, 0xcb, 0x71, 0xeb, 0xbf, 0x7a, 0xfd, 0xfa, 0x35, 0x48, 0x5f, 0xd7,
+  0x01, 0xd3, 0x65, 0x4f, 0xc0, 0xc0, 0xe0, 0x72, 0xc9, 0xce, 0x3d, 0x33, 0x1f, 0x8e, 0x90, 0x83,
+  0x95, 0x9c, 0x9c, 0x04, 0x62, 0xa2, 0xec, 0x97, 0xc6, 0x8d, 0x4f, 0x79, 0x0c, 0x2f, 0xfc, 0xfe,
+  0x4b, 0xe3, 0xa4, 0x24, 0x28, 0x86, 0x96, 0x2c, 0x7a, 0x42, 0xcc, 0x1e, 0x13, 0x14, 0x38, 0xb6,
+  0x6e, 0x99, 0xfa, 0xac, 0x51, 0xd0, 0x2d, 0xc7, 0x63, 0xbd, 0x98, 0xa9, 0x39, 0xc3, 0x46, 0xc5,
+  0x12, 0xda, 0xc7, 0xf3, 0xd6, 0x03, 0x7d, 0x7b, 0xc8, 0xa8, 0x47, 0x99, 0xad, 0x70, 0x1f, 0xe0,
+  0x89, 0x4d, 0xd6, 0x24, 0x30, 0xd1, 0x36, 0x77, 0xb6, 0xb6, 0x0e, 0x80, 0xb3, 0xcd, 0x38, 0x73,
+  0xc1, 0xc4, 0xb4, 0x3e, 0x74, 0x5b, 0xbd, 0xe1, 0xf6, 0x40, 0x4c, 0x7b, 0xec, 0x80, 0x1f, 0xeb,
+  0x9d, 0xf4, 0x7f, 0x26, 0xbb, 0xc2, 0xc9, 0xcd, 0xee, 0xec, 0x49, 0x6a, 0xf2, 0xe5, 0x10, 0x7b,
+  0xf2, 0x9d, 0xc3, 0x95, 0xbe, 0x6a, 0xb3, 0xb4, 0x7d, 0xd6, 0x22, 0xcf, 0xc9, 0x71, 0x07, 0xbc,
+  0x32, 0x2f, 0x4a, 0xee, 0xa9, 0x28, 0x8f, 0x38, 0xb6, 0xd8, 0xe7, 0xc3, 0xf4, 0xc6, 0x04, 0xdf,
+  0x5c, 0xae, 0x8c, 0x98, 0x0f, 0x2a, 0x6b, 0x1f, 0xf2, 0x71, 0x2b, 0xa6, 0xcf, 0xe6, 0x9e, 0x1a,
+  0x7d, 0x42, 0x17, 0xf5, 0x7d, 0xb1, 0xfa, 0x9a, 0x20, 0xc0, 0x9f, 0xb2, 0x39, 0x03, 0x03, 0x34,
+  0x99, 0x58, 0x91, 0xf3, 0xc5, 0x21, 0xea, 0x7b, 0xbc, 0x29, 0x5f, 0xa8, 0x4d, 0xb4, 0x55, 0x9b,
+  0xad, 0x47, 0x9d, 0x53, 0xb9, 0x1a, 0x9b, 0xa2, 0x4b, 0x00, 0xab, 0x78, 0x37, 0xa6, 0x8f, 0x5b,
+  0x79, 0xc9, 0x40, 0x52, 0x9f, 0x32, 0x7d, 0x36, 0x72, 0x3e, 0xcb, 0x55, 0xd7, 0xc4, 0xe8, 0xbc,
+  0x8e, 0x19, 0xe9, 0x51, 0x25, 0x38, 0xcb, 0xe4, 0x99, 0x65, 0x38, 0x66, 0xc8, 0xa3, 0x5c, 0x14,
+  0x4f, 0xfb, 0x57, 0x97, 0x51, 0xf3, 0x15, 0xb9, 0xc0, 0x33, 0x08, 0x01, 0x9e, 0x06, 0x10, 0x11,
+  0x96, 0xe3, 0x16, 0x32, 0x59, 0x8d, 0x9c, 0x7b, 0x23, 0x19, 0x97, 0x94, 0x4b, 0x04, 0xb0, 0xba,
+  0xd9, 0x23, 0x8e, 0x36, 0xb4, 0x7b, 0x82, 0x42, 0xd5, 0xa6, 0xc2, 0x40, 0xd2, 0xdb, 0xf9, 0xbe,
+  0x58, 0xb5, 0x4b, 0x00, 0x39, 0x6e, 0xa7, 0x80, 0x18, 0xa0, 0xcb, 0xc7, 0xed, 0xed, 0x80, 0x0c,
+  0x2f, 0x52, 0x40, 0xf0, 0xd4, 0xc5, 0x70, 0x9b, 0x25, 0x9c, 0x15, 0x21, 0xbf, 0x4f, 0x92, 0x2f,
+  0xaf, 0x3e, 0x5c, 0x76, 0x5b, 0x20, 0xcd, 0xef, 0x5b, 0x83, 0x6e, 0xe7, 0x43, 0x27, 0x9a, 0xab,
+  0xdc, 0x9c, 0x22, 0x04, 0x11, 0x4b, 0x2b, 0x64, 0x59, 0x25, 0x3a, 0xdf, 0x90, 0x4c, 0x00, 0x56,
+  0x0f, 0x3b, 0x14, 0x9e, 0x06, 0xff, 0xd3, 0xd6, 0xb0, 0xfd, 0xa1, 0x7f, 0xd1, 0x21, 0x9d, 0x01,
+  0x0f, 0xf5, 0x1e, 0x4b, 0x00, 0xdf, 0xb5, 0x4f, 0xe2, 0x7e, 0x2a, 0xf6, 0xcd, 0x4d, 0xb2, 0x57,
+  0x78, 0x04, 0xd4, 0xfd, 0x3c, 0xa8, 0xfb, 0x8f, 0x81, 0x7a, 0x90, 0x07, 0xf5, 0xe0, 0x69, 0xf8,
+  0xcb, 0xc7, 0xc3, 0x68, 0xdf, 0x37, 0x23, 0x65, 0x1d, 0x42, 0xa8, 0xfa, 0x91, 0xd4, 0xc8, 0xa0,
+  0x85, 0xae, 0x72, 0x8d, 0xfd, 0x9b, 0xb8, 0xa6, 0x71, 0x88, 0xff, 0x40, 0xbe, 0x38, 0x87, 0x12,
+  0x1f, 0x03, 0x01, 0x2b, 0x98, 0xdb, 0x5e, 0x7d, 0x6f, 0xec, 0x12, 0xf8, 0x3f, 0x57, 0xd9, 0xbd,
+  0x57, 0xa0, 0xb3, 0x19, 0x86, 0x70, 0x41, 0x0d, 0x8c, 0x00, 0x84, 0x31, 0x1c, 0x51, 0x7d, 0x36,
+  0x71, 0x9d, 0xc0, 0x36, 0xea, 0xd7, 0xd4, 0x2d, 0x56, 0x2a, 0x21, 0x56, 0xa3, 0x49, 0xe9, 0x70,
+  0xe4, 0xb8, 0x40, 0x7f, 0x7d, 0x6f, 0xf1, 0x99, 0x78, 0x0e, 0x98, 0x1f, 0x92, 0x6e, 0xc3, 0xeb,
+  0x55, 0xbb, 0x8a, 0x0b, 0xa1, 0x45, 0xe0, 0x85, 0xb6, 0x62, 0xed, 0x76, 0x78, 0xda, 0xb4, 0x86,
+  0x30, 0xbd, 0x60, 0x94, 0x62, 0x52, 0xac, 0x28, 0xc5, 0x89, 0x91, 0xe5, 0xe8, 0xb3, 0xc3, 0x31,
+  0xb8, 0x80, 0x8a, 0x67, 0x7e, 0x61, 0xf5, 0x3d, 0xc0, 0x54, 0x86, 0x3b, 0x29, 0x4c, 0x79, 0xff,
+  0xd2, 0x21, 0xe8, 0xc9, 0xc4, 0xb4, 0x01, 0x6f, 0x50, 0xfc, 0x39, 0x47, 0xd4, 0x82, 0x99, 0x01,
+  0xd4, 0xd1, 0x7d, 0x20, 0x53, 0xf6, 0x38, 0xee, 0x7c, 0x2a, 0x42, 0xc3, 0x19, 0x6e, 0xd5, 0xa9,
+  0x8d, 0xf5, 0xcc, 0x3c, 0x6d, 0x05, 0x97, 0x37, 0x79, 0xb8, 0x20, 0x33, 0x4a, 0xa2, 0xe5, 0x0d,
+  0xe3, 0xdb, 0x82, 0x23, 0x90, 0x33, 0x51, 0x30, 0xa6, 0x73, 0xd3, 0x5a, 0xd6, 0xb5, 0x23, 0x27,
+  0x70, 0x4d, 0xe6, 0x92, 0x1e, 0xbb, 0xd1, 0xca, 0x73, 0xc7, 0x76, 0xb8, 0x7f, 0x03, 0xd4, 0x2a,
+  0x95, 0x2a, 0xff, 0xaf, 0x52, 0xc9, 0x32, 0xec, 0x8f, 0x65, 0x77, 0xaa, 0xe8, 0x67, 0x62, 0xb7,
+  0x90, 0xf8, 0x3c, 0x6e, 0x23, 0xc0, 0x5f, 0x8e, 0xdb, 0xf5, 0x55, 0x46, 0x6f, 0xec, 0x2d, 0xd6,
+  0x84, 0xf6, 0xf1, 0xf0, 0x2f, 0xd1, 0x99, 0xea, 0x3a, 0x28, 0xd3, 0x9a, 0x72, 0xae, 0xcc, 0xb9,
+  0x95, 0xf2, 0xa8, 0x8a, 0x18, 0x2d, 0x2c, 0xc6, 0x13, 0x72, 0x18, 0x3f, 0xb3, 0xb4, 0x18, 0x44,
+  0x1d, 0x65, 0x9c, 0xfc, 0xd3, 0x9f, 0xff, 0x4a, 0x5a, 0xe7, 0xe4, 0xac, 0x7f, 0x8c, 0x5b, 0xec,
+  0xc3, 0x61, 0xa7, 0xf7, 0x61, 0x90, 0x9c, 0x9a, 0x95, 0x9e, 0xb8, 0x65, 0x1f, 0x78, 0xea, 0x20,
+  0x9e, 0xfa, 0xda, 0x6c, 0xf1, 0x90, 0x60, 0x4d, 0xf4, 0x11, 0x41, 0x58, 0x1f, 0x73, 0xc6, 0x50,
+  0x7f, 0xac, 0xc9, 0xe5, 0x7f, 0x56, 0x10, 0x49, 0xcf, 0x34, 0x00, 0xc5, 0x73, 0x32, 0x18, 0x74,
+  0x8e, 0x49, 0xb1, 0xa5, 0xeb, 0xcc, 0xf3, 0xc8, 0xb9, 0x63, 0x02, 0x16, 0x3d, 0x3a, 0x67, 0xa5,
+  0x47, 0x3b, 0x6c, 0x31, 0x44, 0xd2, 0x8d, 0x44, 0x6e, 0xba, 0xc2, 0x3d, 0x77, 0xb8, 0x64, 0xbb,
+  0x52, 0xc1, 0x13, 0xba, 0xf4, 0x38, 0x53, 0xd3, 0x96, 0xc3, 0xe0, 0x5f, 0x38, 0x06, 0x1e, 0x8b,
+  0x80, 0x36, 0x37, 0xc0, 0x47, 0xdc, 0x96, 0x20, 0xea, 0x0b, 0x71, 0xd9, 0x9f, 0x02, 0xd3, 0x65,
+  0x46, 0x95, 0xf4, 0x17, 0xcc, 0x26, 0x36, 0x84, 0xc5, 0x8e, 0x3b, 0x23, 0x63, 0xc7, 0x25, 0x8c,
+  0x7a, 0x4b, 0x32, 0x36, 0x5d, 0x4f, 0x68, 0x16, 0x01, 0xf0, 0xc1, 0xe2, 0xfe, 0x34, 0xf5, 0x41,
+  0x6c, 0x9e, 0x1b, 0x98, 0x3a, 0xce, 0x8f, 0x7b, 0x03, 0xf2, 0xb1, 0x3f, 0x18, 0xf6, 0x5a, 0x67,
+  0x6d, 0x60, 0x36, 0x88, 0x17, 0xcc, 0xe7, 0x13, 0xb0, 0x98, 0x83, 0x4f, 0xb2, 0xd8, 0x43, 0x4e,
+  0xce, 0x38, 0x27, 0x7d, 0x67, 0xdf, 0x88, 0x58, 0xbc, 0x52, 0xb1, 0x21, 0x8b, 0x71, 0x0c, 0x54,
+  0x24, 0x90, 0x0f, 0x94, 0x69, 0x2e, 0x27, 0xd7, 0x26, 0xad, 0x93, 0xa9, 0xef, 0x2f, 0xea, 0xb5,
+  0x5a, 0x64, 0xaf, 0x54, 0xe3, 0x85, 0xcb, 0xf0, 0x9c, 0x6e, 0xa1, 0x99, 0x1e, 0x52, 0xea, 0x42,
+  0x15, 0x4c, 0x17, 0xb5, 0xb2, 0xb2, 0xef, 0x75, 0x3a, 0xf2, 0x20, 0xad, 0x97, 0xab, 0x8d, 0x95,
+  0x1b, 0xc8, 0xc8, 0x37, 0x50, 0xfd, 0xbf, 0x90, 0xf3, 0x8b, 0xce, 0x59, 0xeb, 0xe2, 0x8a, 0x7c,
+  0xdf, 0x39, 0xe9, 0x6c, 0xa1, 0xf6, 0x6a, 0x1c, 0xa5, 0xfb, 0x3d, 0xc7, 0x27, 0x47, 0xc2, 0xc2,
+  0x31, 0x63, 0x1b, 0x13, 0x90, 0xd6, 0xfd, 0x34, 0x01, 0x4f, 0x23, 0x99, 0x21, 0xba, 0xdc, 0x0a,
+  0x7c, 0x6f, 0x9e, 0x98, 0xd2, 0x0e, 0xf4, 0xa4, 0x9e, 0x3c, 0x85, 0x09, 0x48, 0x0c, 0x92, 0x14,
+  0xd2, 0x2b, 0x70, 0x37, 0x84, 0x0f, 0x8b, 0x03, 0x15, 0x9e, 0x5a, 0xf1, 0xd4, 0xc8, 0x91, 0x69,
+  0xe0, 0x63, 0x9d, 0xb7, 0x06, 0x83, 0xef, 0xfb, 0x17, 0xc7, 0xd9, 0x74, 0x85, 0x8d, 0xb7, 0xa1,
+  0x2d, 0xea, 0x94, 0xa0, 0xef, 0xa7, 0x7f, 0xfc, 0xcf, 0xcc, 0xff, 0xf2, 0x69, 0x08, 0x93, 0xe2,
+  0xb5, 0xc9, 0xb2, 0x37, 0x75, 0x6e, 0x32, 0xa8, 0x8b, 0xc7, 0x0c, 0xb2, 0x7d, 0x45, 0x34, 0x95,
+  0x4d, 0x54, 0x1f, 0x88, 0x34, 0xa0, 0x98, 0x9c, 0xcb, 0xe2, 0xd5, 0x44, 0xfa, 0x9b, 0x4c, 0x03,
+  0x2a, 0x85, 0xa9, 0x57, 0xcc, 0x05, 0x0c, 0x3f, 0x6c, 0x0d, 0x3b, 0x47, 0xa4, 0x73, 0x4e, 0x5a,
+  0xc7, 0xc7, 0x17, 0xed, 0xc1, 0xe0, 0x89, 0x64, 0x0c, 0x60, 0x27, 0x67, 0x60, 0xef, 0xbb, 0xfd,
+  0xea, 0xde, 0xeb, 0x37, 0xd5, 0xbd, 0xea, 0xde, 0xee, 0xee, 0x46, 0xa6, 0x4e, 0x81, 0x32, 0xa6,
+  0x3a, 0x20, 0xda, 0x65, 0xf4, 0x9a, 0x11, 0x7e, 0x24, 0x8f, 0x3b, 0x8d, 0xe3, 0x8f, 0x47, 0xe7,
+  0xa4, 0x48, 0x03, 0x08, 0xe3, 0x90, 0x98, 0xd2, 0x37, 0x70, 0x17, 0x0a, 0x81, 0x0c, 0x9f, 0xf1,
+  0x44, 0x5c, 0xda, 0xc4, 0x5d, 0x6c, 0xc3, 0xaa, 0xcd, 0x5d, 0x43, 0xa2, 0xc7, 0x03, 0xfc, 0x43,
+  0xce, 0x6a, 0x60, 0xb8, 0xbf, 0xe5, 0x33, 0x2f, 0x42, 0x4b, 0xd8, 0xca, 0x61, 0x7b, 0x30, 0x24,
+  0x47, 0xfd, 0x5e, 0xaf, 0x7d, 0x34, 0xec, 0xf4, 0x7b, 0x9b, 0x9c, 0xe5, 0x7c, 0xa4, 0xb3, 0xc1,
+  0x54, 0x32, 0x58, 0x6c, 0xee, 0x6b, 0xde, 0xb7, 0x8e, 0x4e, 0x2f, 0xcf, 0xb7, 0x75, 0x35, 0x72,
+  0x94, 0x94, 0xa7, 0x19, 0x9b, 0x93, 0xc0, 0x7d, 0x9c, 0xab, 0x49, 0xa1, 0xff, 0x34, 0x42, 0xad,
+  0xb0, 0xfd, 0x96, 0x8e, 0x26, 0x3e, 0x46, 0xfa, 0x24, 0x0f, 0xd6, 0x7c, 0x43, 0x4f, 0x23, 0x87,
+  0xfe, 0x76, 0x8e, 0x26, 0x3d, 0xc0, 0xcf, 0xe8, 0x67, 0x56, 0x68, 0xbb, 0xdf, 0xcd, 0x88, 0x2e,
+  0x3f, 0xaf, 0x97, 0x89, 0xe9, 0xc3, 0x37, 0x72, 0x32, 0x72, 0x84, 0x5c, 0x1f, 0xb3, 0xbf, 0xb1,
+  0x8f, 0x91, 0x90, 0x7e, 0x31, 0x17, 0x23, 0xc7, 0x7f, 0x7a, 0x0f, 0x13, 0x07, 0xbc, 0xde, 0xc1,
+  0x84, 0x32, 0xb2, 0x39, 0xbb, 0x36, 0x77, 0x33, 0xf1, 0x0e, 0xb9, 0x5e, 0x46, 0x82, 0x7d, 0xa4,
+  0xb3, 0x49, 0x58, 0xcb, 0x4d, 0x7d, 0xcd, 0xea, 0x64, 0x46, 0xcb, 0x20, 0x15, 0xb1, 0x97, 0xb5,
+  0xf3, 0x76, 0xfa, 0x32, 0xa7, 0x32, 0x71, 0x45, 0x06, 0xaa, 0xa4, 0x0f, 0x50, 0x2e, 0xe5, 0xe8,
+  0xf2, 0xe2, 0xa2, 0xdd, 0x8b, 0xe3, 0x41, 0x50, 0x13, 0x2e, 0x41, 0xfc, 0xa7, 0x2f, 0x73, 0x47,
+  0x95, 0x30, 0x70, 0x35, 0xb5, 0x70, 0x5f, 0x23, 0xe5, 0x15, 0xe3, 0x4e, 0x4a, 0x56, 0xc5, 0x44,
+  0x2d, 0x5e, 0x22, 0x17, 0x2e, 0x30, 0xdd, 0xad, 0x67, 0xfa, 0x38, 0xd9, 0x38, 0x76, 0x05, 0x4f,
+  0xad, 0x7a, 0x89, 0x9e, 0x32, 0x57, 0x5e, 0xe3, 0xd7, 0x9e, 0x04, 0x4d, 0x5d, 0xe5, 0x6a, 0xc0,
+  0x46, 0xf5, 0x27, 0x19, 0x3a, 0xdb, 0xe2, 0x2c, 0xdc, 0x5c, 0xe5, 0x5b, 0x63, 0x8b, 0x46, 0x0e,
+  0xad, 0x9b, 0x61, 0xb8, 0xa0, 0x0b, 0xdb, 0x22, 0x89, 0xbd, 0x95, 0xe9, 0x7a, 0x59, 0xdd, 0xfb,
+  0xd6, 0xc8, 0x7a, 0xe6, 0x04, 0xef, 0x19, 0x36, 0x07, 0xfc, 0x93, 0x0c, 0x7c, 0x40, 0x62, 0xe2,
+  0x4f, 0xb7, 0x66, 0xad, 0x04, 0xf3, 0x4d, 0x16, 0x23, 0x95, 0xea, 0xc5, 0xba, 0x71, 0x85, 0x93,
+  0xe8, 0xac, 0xde, 0xcf, 0x8d, 0xd7, 0x66, 0xf1, 0x24, 0x5e, 0x2f, 0x77, 0x37, 0x3e, 0x31, 0xd7,
+  0x33, 0x97, 0x8e, 0x9d, 0x4d, 0x78, 0xbc, 0x83, 0xa0, 0xbe, 0x99, 0x5e, 0x13, 0x23, 0x9f, 0xf6,
+  0xd6, 0xce, 0xd6, 0x03, 0x70, 0xc2, 0x68, 0x65, 0x53, 0x7c, 0xe4, 0xfd, 0x22, 0x28, 0x46, 0x9b,
+  0x17, 0xad, 0x72, 0xde, 0xab, 0xa0, 0x0f, 0xc0, 0xab, 0x73, 0xbe, 0x3d, 0x56, 0x9b, 0x8b, 0xf5,
+  0x03, 0x10, 0x42, 0x5f, 0xb9, 0x3d, 0x4a, 0xc2, 0xcf, 0xa6, 0xfd, 0x8f, 0xf2, 0x38, 0x99, 0x62,
+  0xbc, 0x82, 0x66, 0xe4, 0xe3, 0xa7, 0x07, 0x89, 0x9a, 0x98, 0x33, 0x88, 0xbe, 0x57, 0xfe, 0x14,
+  0x98, 0xfa, 0xac, 0xd0, 0xfc, 0xd8, 0xf9, 0x5d, 0xb7, 0xc3, 0xf7, 0x5e, 0x5b, 0xbd, 0x0f, 0x9d,
+  0x23, 0x7e, 0x45, 0x2c, 0xe6, 0x70, 0x45, 0x07, 0xee, 0xdc, 0xa3, 0xfe, 0xb8, 0x65, 0xc2, 0xbb,
+  0x57, 0xf6, 0x80, 0x93, 0x55, 0xb2, 0x72, 0x67, 0x6c, 0xa6, 0x36, 0x01, 0xf9, 0xb5, 0x31, 0x52,
+  0x8c, 0xfc, 0x2e, 0x07, 0x20, 0x2e, 0x26, 0x9f, 0x76, 0x06, 0x9d, 0x41, 0xbb, 0x2b, 0xc9, 0x2b,
+  0x93, 0xd5, 0x46, 0xfb, 0x20, 0xda, 0x67, 0xad, 0x8b, 0xe1, 0xe9, 0x45, 0xeb, 0x64, 0xb8, 0xa6,
+  0xdd, 0x01, 0x1e, 0x19, 0xeb, 0x85, 0xa0, 0x64, 0x3c, 0xb4, 0x29, 0x0d, 0x30, 0xca, 0x7e, 0x95,
+  0x14, 0xe2, 0x57, 0x68, 0x0b, 0x04, 0xdc, 0xb2, 0x63, 0x07, 0xc4, 0xb4, 0x98, 0xbc, 0x00, 0xe7,
+  0x58, 0x81, 0xe7, 0x07, 0x6e, 0x60, 0x6f, 0x07, 0x1c, 0x50, 0x3b, 0xa8, 0x12, 0x71, 0xfa, 0x14,
+  0x01, 0xd8, 0x8c, 0xf8, 0x78, 0x06, 0x75, 0x09, 0xec, 0x9a, 0x45, 0xb7, 0xea, 0x36, 0x07, 0xf8,
+  0xb2, 0xd0, 0x7c, 0x09, 0x1c, 0xa7, 0x13, 0x42, 0x2d, 0xdf, 0xa7, 0x33, 0x13, 0x30, 0x4f, 0xa0,
+  0x3b, 0xc1, 0x73, 0xfb, 0x84, 0xcd, 0x2c, 0xb6, 0x54, 0xb0, 0x9f, 0x48, 0x62, 0x52, 0xd7, 0x0a,
+  0xaf, 0xfa, 0xbd, 0xf6, 0xb0, 0x73, 0xd6, 0xd9, 0x58, 0x64, 0xd2, 0x27, 0x41, 0xdf, 0x7a, 0xbe,
+  0xeb, 0xd8, 0x93, 0xa6, 0xe0, 0x4e, 0x5f, 0x30, 0x78, 0x4e, 0x51, 0x7b, 0x44, 0x05, 0x17, 0xac,
+  0x88, 0xcc, 0x8c, 0x09, 0x02, 0x9a, 0x67, 0x81, 0x65, 0x51, 0x7b, 0x73, 0x36, 0x2a, 0x2c, 0xf0,
+  0x50, 0x75, 0x1a, 0x87, 0xe3, 0xe0, 0x0b, 0xb3, 0x2d, 0x36, 0x67, 0x31, 0x1c, 0xe4, 0xdc, 0x7d,
+  0x61, 0xae, 0x09, 0x93, 0xe7, 0x01, 0xe3, 0xc5, 0x04, 0x9a, 0x0b, 0x52, 0x90, 0xd7, 0x4a, 0x0a,
+  0xdb, 0x4d, 0x64, 0xc8, 0x07, 0x67, 0xb1, 0x4c, 0x63, 0x70, 0x0a, 0x65, 0x14, 0x8f, 0x28, 0xc7,
+  0xb9, 0xa0, 0xc6, 0x24, 0x4d, 0x52, 0x38, 0xed, 0x9f, 0x5f, 0xb5, 0xba, 0xad, 0x02, 0x9f, 0x6b,
+  0xba, 0xb4, 0x4d, 0x21, 0x9f, 0x06, 0xb3, 0xc9, 0x0c, 0xfb, 0x6e, 0x2f, 0xa8, 0x0a, 0x1d, 0xbc,
+  0x0e, 0xcf, 0x2f, 0x0c, 0x27, 0x31, 0x6a, 0x81, 0x33, 0xba, 0x4e, 0xf1, 0x24, 0x81, 0x51, 0xeb,
+  0x62, 0xd0, 0xf9, 0x84, 0x4c, 0x08, 0x95, 0x65, 0x69, 0x12, 0x8a, 0xbd, 0x40, 0xd6, 0x29, 0x78,
+  0xb2, 0xed, 0x39, 0x63, 0x30, 0xbc, 0x73, 0x9c, 0xc6, 0x64, 0x60, 0x5a, 0xf9, 0x58, 0x0c, 0x3a,
+  0xdd, 0x24, 0x06, 0x33, 0x6a, 0x99, 0xba, 0x09, 0xec, 0x10, 0x9a, 0x66, 0x5a, 0x4f, 0xac, 0x0d,
+  0xb1, 0xcb, 0xcc, 0xdb, 0xab, 0x02, 0x3f, 0xcc, 0x4f, 0x0d, 0x23, 0x22, 0x91, 0x5f, 0xb7, 0x21,
+  0xed, 0x59, 0x06, 0xa7, 0x95, 0x06, 0x8c, 0xd8, 0x92, 0x7e, 0x89, 0xa9, 0xbb, 0x4d, 0x95, 0x28,
+  0x6e, 0xcc, 0x60, 0x71, 0x17, 0x41, 0xde, 0xe9, 0x4e, 0x0f, 0x3e, 0x04, 0xb1, 0x9b, 0xa7, 0x64,
+  0x8f, 0xd7, 0x80, 0x09, 0xf7, 0x40, 0xac, 0x6c, 0x03, 0xb1, 0x98, 0x05, 0x7e, 0xb0, 0xa4, 0x71,
+  0x2b, 0xe6, 0x8b, 0x7e, 0xb6, 0x61, 0x12, 0xd3, 0xa3, 0x2e, 0xf3, 0xa1, 0x91, 0xb3, 0x0c, 0xb6,
+  0x43, 0x0a, 0xd3, 0x48, 0x6f, 0x05, 0xa3, 0xc0, 0xb5, 0x40, 0xef, 0xd2, 0xf8, 0x94, 0x09, 0xde,
+  0x3c, 0x2a, 0x93, 0x9e, 0xe3, 0x97, 0x49, 0x74, 0x7b, 0x48, 0xcd, 0xf5, 0x4b, 0x02, 0xf2, 0x6f,
+  0x84, 0x26, 0x9b, 0x8e, 0x60, 0xee, 0x41, 0x1c, 0x6d, 0xf3, 0xcb, 0x56, 0x18, 0xc5, 0x8e, 0xf8,
+  0xcb, 0xd1, 0xe5, 0x79, 0x7b, 0x32, 0x00, 0x96, 0x2c, 0x59, 0x0a, 0x33, 0x71, 0xe6, 0xbf, 0x78,
+  0xc5, 0x40, 0xd4, 0x4a, 0x65, 0xc2, 0x0f, 0xf3, 0x17, 0x07, 0xd4, 0x35, 0xe1, 0x8b, 0x3c, 0xaf,
+  0x5f, 0x3c, 0x35, 0xdd, 0xb9, 0xf9, 0xc5, 0x2c, 0x6d, 0x85, 0x07, 0xbe, 0x58, 0x20, 0x9e, 0x34,
+  0x51, 0x78, 0xb4, 0x2c, 0x5f, 0x30, 0x02, 0x50, 0x88, 0x61, 0xc0, 0x6f, 0xed, 0xc8, 0xf9, 0x02,
+  0xd1, 0x07, 0x6b, 0xc5, 0x17, 0x5f, 0xf0, 0xf1, 0x09, 0xe1, 0x0f, 0xd8, 0x03, 0x39, 0x61, 0xb0,
+  0x05, 0xb3, 0xc1, 0xc2, 0xe8, 0x66, 0x7c, 0x8a, 0xde, 0xd3, 0x89, 0x39, 0xb7, 0x00, 0xe2, 0x2c,
+  0x3d, 0x3f, 0x80, 0x16, 0xbe, 0xa1, 0xe1, 0x81, 0xc8, 0x86, 0x6d, 0x24, 0x06, 0x2e, 0xb0, 0xc1,
+  0xf4, 0x08, 0x08, 0x12, 0xa2, 0x41, 0x20, 0xca, 0x05, 0x71, 0x79, 0x5a, 0xc5, 0x14, 0xf7, 0xf4,
+  0x0b, 0xcd, 0x93, 0x4e, 0x77, 0x78, 0xd1, 0xee, 0xb6, 0x71, 0xc9, 0x62, 0x43, 0xb5, 0x94, 0x77,
+  0xfe, 0xf9, 0xd3, 0x0b, 0x8a, 0x4c, 0x7c, 0x82, 0x21, 0x46, 0xe0, 0x30, 0x98, 0x0b, 0x26, 0xe3,
+  0xf4, 0xc3, 0x5f, 0x1e, 0x74, 0x30, 0xdd, 0x4d, 0xd9, 0xa9, 0x06, 0x90, 0x4f, 0x33, 0x84, 0x13,
+  0x8a, 0x4f, 0x34, 0x24, 0xb4, 0xde, 0x60, 0x3a, 0x0b, 0x15, 0x0b, 0xfe, 0x05, 0x9e, 0xa9, 0x51,
+  0xb7, 0x1c, 0x2b, 0xf6, 0x82, 0x43, 0x48, 0x52, 0xf8, 0x92, 0xc3, 0x9a, 0x31, 0x1f, 0x3e, 0x62,
+  0x5a, 0x95, 0xd1, 0x44, 0xd6, 0xf0, 0xc9, 0x86, 0x5a, 0xaf, 0x3f, 0xac, 0x45, 0x8f, 0x26, 0x24,
+  0xb8, 0xea, 0x62, 0x68, 0x84, 0x03, 0x12, 0x84, 0xe2, 0x32, 0xb4, 0x83, 0x4f, 0x2a, 0x16, 0xea,
+  0xb5, 0x98, 0xd6, 0x05, 0x1e, 0x36, 0xfc, 0xd4, 0x26, 0xbd, 0xd6, 0xa7, 0xce, 0x87, 0xd6, 0xe0,
+  0x0a, 0x57, 0x61, 0x36, 0x94, 0x8f, 0xf0, 0xc5, 0x99, 0x94, 0x87, 0xa4, 0x2b, 0x51, 0x0b, 0x58,
+  0x1e, 0x30, 0x82, 0x1e, 0xf8, 0xe5, 0x19, 0x3a, 0x43, 0x68, 0xc0, 0x0d, 0xa7, 0xf7, 0x90, 0x88,
+  0x45, 0x3d, 0x9b, 0x13, 0x9e, 0x92, 0x55, 0xc3, 0x87, 0x67, 0xed, 0x8e, 0xd9, 0x04, 0x94, 0x1c,
+  0x8c, 0x4b, 0xdc, 0x75, 0x5c, 0x02, 0x0a, 0x60, 0x75, 0xe6, 0x68, 0xa8, 0x30, 0x3c, 0xc8, 0x8a,
+  0xc2, 0x2b, 0x36, 0xbd, 0xde, 0x28, 0x12, 0x17, 0x0d, 0x37, 0x8b, 0xc6, 0x45, 0xdb, 0x44, 0x44,
+  0x8e, 0x59, 0x01, 0xea, 0x7b, 0x2c, 0x4e, 0x7a, 0xaa, 0x69, 0x9d, 0x3a, 0xae, 0xaf, 0x07, 0xf8,
+  0x04, 0x13, 0x90, 0xd1, 0xba, 0xea, 0x77, 0xf9, 0xd9, 0xf5, 0x0d, 0x27, 0x94, 0x3f, 0x35, 0x51,
+  0xe1, 0x67, 0xf2, 0x23, 0xb6, 0xa2, 0xcf, 0x1d, 0x26, 0xac, 0x1a, 0x9f, 0x67, 0xb4, 0x6a, 0x22,
+  0x0c, 0x34, 0xc2, 0x38, 0x90, 0xcc, 0x99, 0x0d, 0x93, 0xba, 0xe9, 0x4c, 0x1a, 0x4e, 0x30, 0x02,
+  0x9c, 0x53, 0xe3, 0x1d, 0x99, 0x63, 0x3f, 0x35, 0xa0, 0x70, 0x7f, 0x23, 0x7e, 0xbd, 0x98, 0x5c,
+  0x83, 0xdf, 0x0f, 0xaf, 0xae, 0x45, 0x28, 0x18, 0x2a, 0x58, 0x9d, 0x71, 0x6b, 0xbf, 0xb1, 0x92,
+  0xd2, 0x51, 0x45, 0x2c, 0x3a, 0x46, 0x18, 0x9c, 0xb4, 0xde, 0x93, 0xf7, 0x3c, 0xa6, 0x48, 0xb9,
+  0x93, 0x2f, 0x30, 0xa2, 0x8d, 0x6a, 0x09, 0xda, 0x69, 0xa7, 0x33, 0x8d, 0xa9, 0xf9, 0xc5, 0x32,
+  0x63, 0xf9, 0xc6, 0x13, 0x2b, 0xac, 0x0e, 0x3a, 0xe4, 0x80, 0xbb, 0xa4, 0xa2, 0x97, 0x14, 0xd2,
+  0x6e, 0x7b, 0x00, 0xf6, 0x63, 0x0b, 0x9b, 0x3e, 0x09, 0x4c, 0x7e, 0x17, 0x20, 0xb2, 0x47, 0x97,
+  0x1d, 0xf0, 0xe0, 0xa0, 0x17, 0x5e, 0xdc, 0x7d, 0x5f, 0x2e, 0x27, 0x01, 0xe7, 0x2f, 0x67, 0xfa,
+  0x04, 0x84, 0xb5, 0x1c, 0xa5, 0xb1, 0xe0, 0xac, 0xe6, 0x68, 0xef, 0x41, 0x82, 0x31, 0xa8, 0x65,
+  0x73, 0x88, 0xb9, 0x88, 0x21, 0x95, 0x6e, 0x8b, 0xe8, 0x0b, 0x0f, 0x9c, 0xc7, 0xcc, 0x30, 0x4b,
+  0x98, 0x0d, 0xbc, 0xfe, 0x5d, 0x3b, 0x85, 0xc0, 0x89, 0x0f, 0x20, 0x1d, 0xe8, 0x04, 0x14, 0xc6,
+  0x23, 0x4b, 0xba, 0x78, 0x40, 0x14, 0x03, 0xec, 0x73, 0xe9, 0x84, 0xc5, 0xed, 0xc5, 0xd2, 0xf4,
+  0x53, 0xbe, 0x0c, 0x63, 0x38, 0x08, 0x9b, 0x88, 0x23, 0x36, 0x13, 0x66, 0x2a, 0x88, 0xc2, 0x7c,
+  0x7e, 0x09, 0x72, 0x65, 0x50, 0x90, 0xf5, 0x19, 0xda, 0x2b, 0xf7, 0x49, 0x67, 0x97, 0x2f, 0xab,
+  0x85, 0x18, 0x7e, 0x6a, 0x5f, 0xc0, 0xa4, 0xb4, 0x4e, 0xf1, 0x20, 0xf8, 0xc6, 0x33, 0xcb, 0x41,
+  0x88, 0x17, 0x9b, 0x90, 0x12, 0x1e, 0xf8, 0x97, 0xa5, 0x3c, 0x5e, 0xb3, 0x90, 0xb2, 0xf6, 0xe0,
+  0xfc, 0x60, 0x9f, 0xe8, 0xe6, 0x94, 0x7e, 0x01, 0xbd, 0xa1, 0x64, 0x70, 0xde, 0x39, 0x39, 0x19,
+  0x90, 0x29, 0x1d, 0x83, 0x6c, 0x79, 0xbc, 0x48, 0x51, 0x58, 0xdd, 0x58, 0x91, 0x71, 0xe8, 0x05,
+  0xae, 0xd3, 0x79, 0xe2, 0x96, 0x48, 0xdb, 0x62, 0x33, 0xdf, 0x05, 0xf6, 0xcd, 0x30, 0xfe, 0xf3,
+  0x18, 0x22, 0x30, 0x06, 0x83, 0x7c, 0x03, 0xf1, 0x30, 0xcc, 0xa7, 0xb8, 0x77, 0x1d, 0x80, 0x92,
+  0xd8, 0x73, 0x86, 0xd3, 0x09, 0x6d, 0x40, 0xd4, 0x50, 0x8b, 0xae, 0x41, 0xae, 0x84, 0x6c, 0x7d,
+  0x01, 0x8f, 0x01, 0x8a, 0x16, 0x6c, 0x8e, 0x06, 0x60, 0x00, 0xfa, 0xc9, 0x17, 0x3d, 0x57, 0xe7,
+  0x9a, 0xa7, 0x3f, 0x03, 0x3a, 0x4b, 0x45, 0xf4, 0x7c, 0xdf, 0x51, 0xf2, 0x06, 0x64, 0x1c, 0x65,
+  0x2d, 0x92, 0x74, 0xb4, 0x71, 0xd3, 0x50, 0xef, 0x93, 0xe8, 0xac, 0xd9, 0x28, 0x2e, 0x7c, 0x83,
+  0xdd, 0xf1, 0xfb, 0x36, 0xc6, 0xe5, 0x93, 0x7f, 0x89, 0xc2, 0x70, 0xcb, 0x28, 0xb6, 0x69, 0x5e,
+  0x23, 0x17, 0x60, 0x32, 0x20, 0x06, 0xd9, 0xe6, 0x6c, 0x66, 0xaa, 0x34, 0xdc, 0x3a, 0xa4, 0x63,
+  0x5c, 0x6e, 0x85, 0x7f, 0x1f, 0xbf, 0x7d, 0x5e, 0x58, 0xa3, 0x44, 0xea, 0x08, 0xaf, 0x3c, 0x2c,
+  0x6e, 0xb1, 0xb1, 0x5f, 0x3f, 0x08, 0x4f, 0x96, 0xff, 0xea, 0xe5, 0xcb, 0x97, 0xf2, 0xbc, 0x70,
+  0x7d, 0xf7, 0xb0, 0x70, 0x9f, 0xa4, 0xa8, 0xad, 0x44, 0xf1, 0xb4, 0x59, 0x18, 0xbc, 0xf3, 0xfd,
+  0xee, 0x25, 0x1e, 0xaf, 0x42, 0xec, 0x48, 0x91, 0xcb, 0x85, 0x5a, 0x02, 0x27, 0xec, 0xb3, 0x6e,
+  0x05, 0x06, 0x33, 0x4a, 0xa1, 0xe0, 0x6c, 0x20, 0x93, 0x6a, 0xfb, 0xd3, 0x16, 0x7d, 0x0b, 0xcd,
+  0x8e, 0xfc, 0xab, 0x4e, 0xd4, 0x83, 0x7f, 0x65, 0xc8, 0x32, 0x21, 0x97, 0x29, 0x13, 0x61, 0x85,
+  0xc5, 0x68, 0x9b, 0x83, 0x56, 0x68, 0x81, 0xc2, 0x7d, 0x56, 0xa0, 0x39, 0xe2, 0xba, 0x8b, 0x4b,
+  0x20, 0xf8, 0xa2, 0x95, 0x47, 0x8a, 0xb8, 0x47, 0x0a, 0xac, 0x0c, 0x30, 0x7b, 0x93, 0xb9, 0xd6,
+  0x23, 0xee, 0x06, 0xe0, 0xd9, 0x7f, 0x79, 0x3a, 0xdb, 0x77, 0xe4, 0x5d, 0x81, 0xc2, 0x3d, 0x9b,
+  0x7f, 0xe1, 0x3d, 0xbf, 0x31, 0x83, 0x88, 0xad, 0xa8, 0xd5, 0x40, 0xe3, 0x6b, 0x82, 0x86, 0x1a,
+  0xfb, 0x8c, 0xef, 0x92, 0x6a, 0xa5, 0x2a, 0xb8, 0x03, 0xbb, 0xe8, 0x36, 0x9a, 0x6e, 0x15, 0x89,
+  0x2d, 0x96, 0x64, 0x09, 0x4e, 0x47, 0xa3, 0x79, 0xeb, 0xbb, 0xcb, 0xdb, 0xdf, 0x0e, 0xfa, 0xbd,
+  0xea, 0x02, 0x5f, 0x39, 0xe5, 0xa5, 0xa5, 0xc3, 0x3b, 0x88, 0xaf, 0x00, 0x1e, 0x2b, 0xdd, 0x52,
+  0x50, 0x55, 0xbf, 0xa8, 0xb5, 0x39, 0x30, 0x32, 0xa6, 0xa0, 0xba, 0x06, 0xe1, 0xad, 0xf0, 0x5d,
+  0x54, 0x7b, 0x02, 0xdf, 0x6e, 0xa6, 0x68, 0x5f, 0xc4, 0x70, 0x80, 0x1a, 0xe4, 0xa1, 0x90, 0x08,
+  0x50, 0xb0, 0x4d, 0x00, 0x9a, 0xd0, 0x09, 0x35, 0x6d, 0xad, 0x74, 0x08, 0xe9, 0x7a, 0xe0, 0xda,
+  0x00, 0xd8, 0xb1, 0x21, 0x5e, 0x1c, 0x59, 0xce, 0xa8, 0x61, 0xb3, 0x1b, 0xf2, 0x1e, 0xfe, 0x28,
+  0xfe, 0x80, 0xe0, 0x7e, 0x2c, 0xdf, 0x62, 0x40, 0x5f, 0xd7, 0xe8, 0x62, 0x61, 0xc9, 0xcb, 0x8a,
+  0xb5, 0x3f, 0x7a, 0x8e, 0xad, 0xdd, 0x95, 0x0e, 0x45, 0x2f, 0xc8, 0xd2, 0x1b, 0x37, 0x60, 0x48,
+  0x9d, 0x9b, 0xea, 0xe5, 0x45, 0xb7, 0x2a, 0xd6, 0xf7, 0xfa, 0x23, 0x9c, 0x70, 0xf8, 0x5e, 0x44,
+  0xa0, 0xaa, 0x29, 0x6d, 0x18, 0x8e, 0x1e, 0x40, 0xd4, 0xe4, 0xcb, 0x66, 0x6d, 0x8c, 0x1b, 0x6c,
+  0xa0, 0x84, 0x02, 0x32, 0xb4, 0xca, 0xdf, 0x4c, 0x05, 0x78, 0xf0, 0x27, 0x80, 0xb3, 0x2d, 0x87,
+  0x1a, 0x0d, 0x8d, 0x6f, 0x6a, 0xfc, 0x5e, 0x88, 0x6c, 0x95, 0x0f, 0x7d, 0x18, 0x42, 0xc1, 0xf7,
+  0xd4, 0xaa, 0x80, 0x1a, 0x24, 0xa8, 0x47, 0x40, 0xaf, 0x51, 0xa4, 0x08, 0x86, 0x73, 0xbf, 0x58,
+  0x4a, 0x35, 0x73, 0xd9, 0xdc, 0xb9, 0x66, 0x61, 0xb3, 0x18, 0xca, 0xe0, 0x32, 0x9c, 0x59, 0x0c,
+  0x65, 0xc0, 0x00, 0x98, 0x5d, 0x0a, 0x15, 0x31, 0xd2, 0x36, 0xb1, 0x7b, 0xec, 0xdb, 0x91, 0x44,
+  0xf2, 0x57, 0x66, 0x9b, 0xed, 0xbf, 0x3f, 0xef, 0x5f, 0x0c, 0xef, 0xbf, 0x96, 0x98, 0x14, 0x8f,
+  0x10, 0xbf, 0x09, 0xf3, 0x25, 0x27, 0xde, 0x2f, 0x3b, 0x46, 0x51, 0x93, 0xd0, 0x83, 0x05, 0x72,
+  0x00, 0x64, 0x45, 0x12, 0xb4, 0x01, 0x42, 0xe6, 0x5c, 0x20, 0xd4, 0x39, 0x4b, 0x21, 0x94, 0xf1,
+  0x52, 0x03, 0xa4, 0x5a, 0x2c, 0x71, 0x56, 0x48, 0x8c, 0x57, 0x20, 0xb8, 0x87, 0xbe, 0x00, 0x53,
+  0xc5, 0xb9, 0x9d, 0x79, 0xcf, 0x9e, 0x13, 0xc1, 0x05, 0x0d, 0x34, 0x74, 0x5c, 0xf4, 0xa7, 0xa6,
+  0x57, 0x45, 0x70, 0xde, 0x0f, 0xbb, 0x3f, 0x3e, 0x7f, 0xae, 0xe3, 0x39, 0x23, 0x77, 0x5e, 0xd4,
+  0x2e, 0x18, 0x7a, 0x26, 0x46, 0x04, 0xfc, 0x77, 0xe4, 0x48, 0x6c, 0xd2, 0x09, 0x9b, 0x73, 0x63,
+  0x5a, 0x16, 0x19, 0x31, 0x82, 0x77, 0x74, 0x6f, 0x40, 0x59, 0xc1, 0x3c, 0x56, 0xb5, 0x52, 0xe9,
+  0x36, 0x43, 0x69, 0x04, 0x55, 0x5a, 0xf9, 0x76, 0xce, 0xfc, 0xa9, 0x63, 0xd4, 0xb5, 0xf3, 0xfe,
+  0x60, 0xa8, 0x95, 0x85, 0x0b, 0xf1, 0xea, 0xb7, 0xda, 0x91, 0xb0, 0xae, 0x95, 0x21, 0x10, 0xa6,
+  0x65, 0x09, 0x6b, 0x19, 0x45, 0xa0, 0x9e, 0xc0, 0xf3, 0x2e, 0xae, 0x83, 0xd8, 0x2a, 0xd2, 0x41,
+  0x50, 0x40, 0xa1, 0x61, 0x46, 0xd5, 0x0b, 0xf8, 0x41, 0x82, 0x77, 0x9a, 0xb4, 0x99, 0xae, 0x20,
+  0xc9, 0x78, 0x06, 0xc3, 0x9c, 0x70, 0xbd, 0xab, 0x13, 0xed, 0x85, 0x51, 0x65, 0xae, 0xeb, 0xb8,
+  0xa5, 0x43, 0x60, 0x46, 0xd8, 0xa7, 0x84, 0x1b, 0x38, 0x88, 0x03, 0x08, 0x18, 0x32, 0xb6, 0x88,
+  0x42, 0x75, 0x57, 0xf8, 0xf6, 0xa7, 0x99, 0xc7, 0x14, 0xef, 0x28, 0x2e, 0x2b, 0x80, 0x2b, 0xf3,
+  0x1f, 0xe4, 0x49, 0x25, 0x04, 0xe1, 0x4a, 0x4f, 0x5a, 0x47, 0xe0, 0x41, 0xaf, 0xd0, 0x93, 0xb6,
+  0x87, 0x1b, 0xf9, 0x51, 0xc2, 0xb9, 0x91, 0xe3, 0x4d, 0x15, 0x76, 0x06, 0x8a, 0x0f, 0x5e, 0x30,
+  0x64, 0x53, 0xc8, 0x73, 0x98, 0x65, 0x3e, 0xc6, 0xab, 0xae, 0x90, 0xfc, 0x40, 0xe7, 0x6a, 0xe8,
+  0x07, 0xaf, 0x5e, 0xbe, 0xda, 0xc2, 0xbf, 0xaa, 0x81, 0x21, 0xd4, 0x83, 0xa4, 0x7e, 0x52, 0x68,
+  0xbe, 0x87, 0xf4, 0xc8, 0x03, 0x65, 0x26, 0xb1, 0x25, 0xa4, 0x30, 0xcc, 0x8b, 0x02, 0xb1, 0x95,
+  0x05, 0x6a, 0xa6, 0x43, 0x0c, 0x69, 0xe2, 0x8a, 0xde, 0x62, 0xd3, 0x31, 0xa3, 0xf7, 0x87, 0x7f,
+  0xfa, 0x8f, 0x7f, 0x23, 0x61, 0x14, 0x8c, 0x61, 0xdc, 0x35, 0xdb, 0x66, 0xfd, 0x46, 0x01, 0xe4,
+  0xb7, 0x96, 0x11, 0x16, 0xfa, 0x67, 0x15, 0x25, 0x92, 0xe2, 0x4a, 0x94, 0x58, 0xda, 0x02, 0xa6,
+  0x38, 0xf9, 0x82, 0x40, 0xb9, 0xab, 0x56, 0x37, 0x2c, 0x14, 0xf4, 0x7c, 0x48, 0x09, 0x5b, 0x17,
+  0x39, 0x5f, 0x79, 0x49, 0x5f, 0x4e, 0x54, 0xc6, 0x80, 0x26, 0xd8, 0x98, 0x6b, 0x0c, 0xce, 0x47,
+  0x56, 0x2c, 0x22, 0x0e, 0xa7, 0x65, 0x82, 0x2b, 0x77, 0xc0, 0x7c, 0x1b, 0x82, 0xdc, 0x2f, 0xcf,
+  0x52, 0x01, 0x8e, 0x34, 0xdb, 0xa1, 0x85, 0xe6, 0xaf, 0x77, 0x0b, 0x6b, 0x76, 0x22, 0xc0, 0x5f,
+  0xa0, 0x80, 0xad, 0x98, 0xe2, 0x08, 0x3d, 0x75, 0x69, 0x70, 0x6f, 0x1f, 0x84, 0x6a, 0xff, 0x65,
+  0xf2, 0xe6, 0xa0, 0xc2, 0x5a, 0xd2, 0x30, 0x1e, 0x8f, 0xd5, 0xcd, 0xc1, 0xfd, 0x15, 0x11, 0x4c,
+  0x5e, 0x15, 0x44, 0x40, 0x10, 0xd2, 0x78, 0xd0, 0x6d, 0x81, 0x97, 0x6f, 0x98, 0x9b, 0x73, 0x53,
+  0x4b, 0x5c, 0xf2, 0xc2, 0xe6, 0xf1, 0x77, 0x74, 0x43, 0x37, 0x91, 0xd2, 0x93, 0x94, 0x6a, 0xaf,
+  0x3f, 0x8e, 0x94, 0x93, 0xfb, 0x45, 0xef, 0x16, 0x2f, 0x32, 0xca, 0x57, 0xc4, 0x42, 0x94, 0xce,
+  0x41, 0x38, 0x0b, 0xcd, 0x63, 0x3a, 0xa5, 0x10, 0xbd, 0x7c, 0xb1, 0x78, 0x36, 0x34, 0x31, 0xf9,
+  0x52, 0x86, 0xd4, 0x00, 0x2a, 0x5f, 0x50, 0xc7, 0xc3, 0x5b, 0x5e, 0xbd, 0x56, 0x8b, 0xb6, 0xc7,
+  0xab, 0xfa, 0xb4, 0x26, 0xef, 0xac, 0x40, 0x9e, 0x3a, 0xc1, 0x37, 0xe0, 0x7f, 0x3f, 0x82, 0x0c,
+  0x6e, 0x56, 0xc8, 0x1a, 0x1f, 0x5f, 0x67, 0x8f, 0x6f, 0xae, 0x87, 0xbd, 0xc9, 0x4f, 0xff, 0xf4,
+  0xaf, 0x6f, 0x6b, 0x74, 0xd3, 0x47, 0x16, 0xb6, 0x7c, 0x43, 0x27, 0x3a, 0x49, 0xf9, 0xf8, 0x47,
+  0x74, 0xa2, 0x93, 0x7c, 0x0f, 0x7b, 0x00, 0x8a, 0x5b, 0x49, 0x48, 0x18, 0x71, 0xb9, 0x2a, 0x3c,
+  0x16, 0x16, 0x95, 0xe4, 0x37, 0x16, 0xee, 0x47, 0xf9, 0x17, 0x9f, 0x3b, 0x17, 0xb1, 0x73, 0x9a,
+  0x7a, 0x52, 0x6f, 0x8b, 0xfe, 0x46, 0x20, 0x7c, 0x33, 0x12, 0x22, 0x76, 0x33, 0x1f, 0x00, 0x24,
+  0xdc, 0xad, 0x94, 0xdb, 0x8f, 0x9b, 0x80, 0x20, 0xd2, 0xe1, 0xa4, 0xd0, 0x91, 0x9b, 0x8d, 0x03,
+  0x7c, 0x4b, 0x21, 0xc1, 0x40, 0x4f, 0x77, 0xcd, 0x85, 0xdf, 0xdc, 0x19, 0x07, 0x36, 0x6f, 0x4b,
+  0x1c, 0x08, 0x33, 0x33, 0x1e, 0xed, 0xb8, 0xdd, 0x11, 0xc1, 0x2d, 0x9f, 0xab, 0x46, 0x6e, 0x4c,
+  0xb7, 0xfa, 0xb2, 0x10, 0x84, 0xbc, 0x3b, 0xfc, 0x8f, 0x2a, 0x47, 0xb9, 0x6b, 0x7a, 0x7e, 0x15,
+  0xac, 0x07, 0x04, 0xc3, 0x7c, 0x83, 0x00, 0xab, 0x11, 0xb2, 0x63, 0xb1, 0xaa, 0xe5, 0x4c, 0x8a,
+  0xda, 0x0f, 0xf1, 0xc1, 0x7f, 0x24, 0x83, 0xa5, 0x8d, 0x57, 0x43, 0xc9, 0xc8, 0x75, 0x6e, 0x3c,
+  0xc6, 0x13, 0x39, 0x88, 0xb4, 0xd8, 0x18, 0x03, 0x2e, 0x2b, 0x7c, 0xbc, 0x04, 0xa1, 0x78, 0xd0,
+  0xf2, 0xbd, 0x68, 0x75, 0x0c, 0x8d, 0x86, 0xce, 0x31, 0xff, 0x15, 0x84, 0x22, 0x56, 0x31, 0x7f,
+  0x68, 0xce, 0x99, 0x13, 0xf8, 0xc5, 0x62, 0x89, 0x34, 0x9a, 0xe4, 0x76, 0x27, 0xa4, 0xe0, 0x4f,
+  0x01, 0x73, 0x97, 0x03, 0xf9, 0xe2, 0x41, 0xcb, 0xb2, 0x00, 0x03, 0xf5, 0xa2, 0xc6, 0x3f, 0xa8,
+  0x07, 0x56, 0x0a, 0x3f, 0x42, 0x78, 0x0a, 0x43, 0xb6, 0x29, 0xc4, 0x6c, 0x7e, 0xa3, 0xe9, 0xc7,
+  0x68, 0x11, 0x01, 0x77, 0x44, 0x0e, 0x0c, 0x97, 0x0d, 0x3b, 0x06, 0x38, 0xf9, 0x22, 0x0f, 0x00,
+  0x7f, 0x97, 0xcf, 0x9c, 0x75, 0x88, 0x9a, 0x46, 0x0c, 0x45, 0xf8, 0xf6, 0xeb, 0x46, 0x21, 0x0c,
+  0x1d, 0xe2, 0x28, 0xeb, 0x8d, 0xa6, 0x5e, 0xe5, 0xa6, 0xbc, 0x2a, 0xe3, 0xdb, 0x86, 0x86, 0x01,
+  0x6e, 0x02, 0x7e, 0xe6, 0x54, 0x26, 0xdf, 0x08, 0x02, 0x90, 0x29, 0x28, 0xfc, 0xe2, 0xad, 0x76,
+  0xb8, 0x83, 0x53, 0x11, 0x9f, 0x38, 0xaf, 0xa8, 0xf1, 0x9e, 0x38, 0xc2, 0x5d, 0x99, 0x1c, 0xec,
+  0xee, 0xe2, 0x1f, 0x91, 0x94, 0xe5, 0xbd, 0x0d, 0x73, 0xbb, 0xb3, 0x95, 0x68, 0xad, 0x99, 0x87,
+  0xc4, 0x70, 0xab, 0xe8, 0x61, 0x72, 0x10, 0x0a, 0xb5, 0x24, 0xaf, 0x63, 0x34, 0x24, 0xd5, 0xda,
+  0x0b, 0xac, 0x7f, 0xa1, 0x85, 0x84, 0x1f, 0x26, 0x5b, 0xb6, 0xf3, 0x55, 0x20, 0x84, 0x05, 0x18,
+  0x40, 0x9c, 0xfc, 0x2c, 0xec, 0x51, 0x92, 0x69, 0xe8, 0x4e, 0x58, 0x52, 0x35, 0x6d, 0x9b, 0xb9,
+  0x1f, 0x87, 0x67, 0xdd, 0x86, 0xf6, 0xc0, 0x17, 0x7b, 0x00, 0x31, 0x9e, 0x49, 0x1c, 0xc1, 0x34,
+  0x33, 0x43, 0xe6, 0x13, 0x71, 0x4e, 0x79, 0x35, 0x41, 0x4b, 0x69, 0x27, 0xcc, 0x03, 0x62, 0x19,
+  0xb7, 0x48, 0xcb, 0x4b, 0xaa, 0x12, 0x53, 0x82, 0xa4, 0x36, 0xc6, 0x99, 0x86, 0x59, 0xc1, 0x02,
+  0x2a, 0x21, 0x4f, 0x2e, 0x4b, 0xea, 0x54, 0x46, 0x70, 0xfb, 0x60, 0xa2, 0xc6, 0xbb, 0x18, 0x7e,
+  0x86, 0xb9, 0xc5, 0x0b, 0x4d, 0x52, 0xa5, 0x98, 0x75, 0x27, 0x86, 0xd1, 0x21, 0xb2, 0xf0, 0x1b,
+  0x8d, 0xc6, 0xee, 0x23, 0x86, 0x7a, 0xf3, 0xe6, 0x4d, 0x18, 0xb8, 0xbc, 0x14, 0x4f, 0xbf, 0xf4,
+  0x1c, 0xc2, 0xf7, 0x9d, 0xc9, 0x18, 0x23, 0x97, 0x95, 0xa1, 0xe5, 0x9c, 0xcb, 0xbd, 0xa9, 0x33,
+  0x88, 0x93, 0xd0, 0x14, 0x35, 0xc0, 0x7c, 0x68, 0xf8, 0x33, 0x14, 0x5a, 0x9d, 0x60, 0xe8, 0xa4,
+  0x1c, 0x57, 0x55, 0x35, 0xdc, 0x2b, 0xef, 0x68, 0xea, 0x27, 0x25, 0xf2, 0xda, 0xec, 0x63, 0x1b,
+  0x19, 0xd9, 0xe6, 0xb5, 0x39, 0xd8, 0xb9, 0x03, 0xcd, 0x62, 0x3e, 0xff, 0xa5, 0x98, 0x86, 0x16,
+  0x09, 0x21, 0xf5, 0xbd, 0x86, 0xa1, 0x9a, 0x99, 0xcc, 0xfb, 0xfa, 0xf5, 0xf6, 0x2e, 0x65, 0x46,
+  0x8f, 0xc2, 0x4a, 0x98, 0x2d, 0xec, 0x50, 0xca, 0x6e, 0xb0, 0x0c, 0xd7, 0xc3, 0xa0, 0x5d, 0x02,
+  0x0d, 0xe8, 0x00, 0xf6, 0xa3, 0x18, 0x0e, 0x89, 0x57, 0x46, 0x88, 0x69, 0xf3, 0xd1, 0x43, 0xcd,
+  0x51, 0xc1, 0x79, 0x03, 0x4b, 0x7f, 0x90, 0xad, 0x7e, 0x14, 0x92, 0xaf, 0xea, 0xbe, 0x7e, 0x45,
+  0x01, 0x74, 0xc6, 0x61, 0xe3, 0x67, 0x8d, 0x86, 0xe6, 0xf0, 0x75, 0x08, 0xad, 0x14, 0xc9, 0x1b,
+  0xe6, 0x16, 0x45, 0xad, 0x63, 0x5f, 0x53, 0x0c, 0x10, 0x55, 0x5b, 0x7e, 0x19, 0x40, 0x31, 0x44,
+  0x90, 0x82, 0x43, 0x94, 0x55, 0xbd, 0x20, 0x0b, 0x10, 0x0e, 0x58, 0x34, 0x63, 0xb2, 0xf2, 0x88,
+  0x0b, 0x8d, 0x58, 0xf1, 0xa8, 0xce, 0xd8, 0xd2, 0x2b, 0x86, 0xbd, 0xaa, 0x16, 0x3f, 0x77, 0x2b,
+  0xd8, 0xcb, 0x7f, 0xe7, 0x04, 0xd7, 0xec, 0x78, 0x07, 0x98, 0xdf, 0xdd, 0x38, 0xe9, 0xd8, 0x47,
+  0xd1, 0x1e, 0xf6, 0x57, 0xf4, 0x73, 0xe9, 0x69, 0xa8, 0xe2, 0x1f, 0x54, 0x5b, 0xc1, 0x01, 0x21,
+  0x5a, 0xcf, 0x9f, 0x93, 0x96, 0xeb, 0xd2, 0x65, 0xd5, 0xf4, 0xf8, 0xa7, 0x28, 0x2e, 0x01, 0x88,
+  0xd4, 0xb8, 0x2f, 0x1a, 0x02, 0x5c, 0x88, 0xdb, 0x5d, 0x48, 0x90, 0xb4, 0xb7, 0x47, 0x72, 0x16,
+  0x1a, 0x69, 0x99, 0x0c, 0x39, 0x4f, 0xbe, 0x7e, 0x55, 0x73, 0x95, 0x37, 0xdf, 0x73, 0xd1, 0x05,
+  0xa7, 0x5b, 0x31, 0x93, 0x68, 0x95, 0x26, 0x7c, 0x4d, 0x8e, 0x52, 0x3a, 0x4c, 0x72, 0xb3, 0xcb,
+  0x6f, 0x55, 0x34, 0x12, 0xcc, 0x25, 0xa0, 0x92, 0x64, 0x8f, 0xbc, 0x23, 0xbe, 0xb4, 0xcf, 0xbf,
+  0x97, 0xb5, 0x5a, 0x89, 0xd4, 0x57, 0x0a, 0x3d, 0x2d, 0x84, 0x89, 0x84, 0x2a, 0x80, 0x69, 0xf6,
+  0xa7, 0x41, 0x62, 0xdb, 0x24, 0x3c, 0xce, 0x26, 0x04, 0x86, 0x8a, 0xf1, 0x02, 0x94, 0x7f, 0xcd,
+  0xaa, 0xc2, 0x76, 0x8b, 0x0a, 0xca, 0xfc, 0x4b, 0xce, 0xbc, 0xd0, 0x30, 0xb7, 0xba, 0xef, 0xea,
+  0x1a, 0x58, 0xaf, 0x04, 0xe7, 0xd0, 0x88, 0x89, 0x67, 0xf9, 0xd7, 0x2e, 0xc3, 0x83, 0xd5, 0x8b,
+  0xf3, 0xf2, 0x85, 0x46, 0xc2, 0x02, 0xce, 0x1a, 0x28, 0xf8, 0x9f, 0xff, 0x82, 0xb2, 0x24, 0x7f,
+  0x78, 0xb3, 0x90, 0x7d, 0xd1, 0x50, 0x2b, 0xbf, 0x05, 0x72, 0xef, 0x6a, 0x42, 0x06, 0xad, 0xda,
+  0xd3, 0x08, 0xfe, 0x33, 0x5e, 0xfb, 0xf5, 0xeb, 0xb3, 0x1c, 0xc1, 0xcf, 0x56, 0x79, 0x65, 0x89,
+  0x5d, 0x35, 0x1a, 0x88, 0xa8, 0x82, 0x5b, 0x16, 0x7d, 0x93, 0xca, 0x1e, 0x9f, 0xfd, 0x64, 0xa2,
+  0x2a, 0x9f, 0x18, 0x91, 0xeb, 0xd8, 0x2a, 0x3b, 0x16, 0xec, 0x0d, 0x67, 0x48, 0xae, 0x51, 0x14,
+  0x05, 0x3b, 0x95, 0xda, 0xbd, 0xd0, 0x4a, 0x6f, 0x03, 0x2b, 0xb5, 0x06, 0x09, 0x70, 0xc8, 0x2e,
+  0xfc, 0x8f, 0x3f, 0x92, 0xa3, 0x7c, 0x08, 0x77, 0x5c, 0x87, 0x3b, 0xa2, 0x73, 0x2c, 0x3a, 0xbc,
+  0xe5, 0xba, 0x0f, 0x01, 0x09, 0x9e, 0xd6, 0xc7, 0x45, 0xe9, 0xdb, 0x10, 0x53, 0xcb, 0x4c, 0xfc,
+  0x98, 0x43, 0xc5, 0xd1, 0xc5, 0x89, 0x7e, 0x3d, 0x7a, 0x45, 0xce, 0x9b, 0x55, 0x30, 0x77, 0x01,
+  0xa4, 0xaa, 0xa6, 0x01, 0x73, 0x22, 0xca, 0xa3, 0x86, 0xa2, 0x0a, 0xc3, 0xe0, 0xaa, 0x17, 0x8c,
+  0x80, 0x08, 0x18, 0xa1, 0xb8, 0x5b, 0xde, 0xdb, 0x2d, 0x85, 0x8d, 0xc3, 0xe3, 0x30, 0xd8, 0x16,
+  0x30, 0x09, 0xbf, 0xbf, 0xdb, 0xab, 0x8b, 0x66, 0x19, 0xd4, 0x29, 0x2f, 0x49, 0x29, 0x4d, 0xe7,
+  0xe0, 0x28, 0xa9, 0x09, 0x30, 0xda, 0x4f, 0xff, 0xfe, 0x2f, 0x5a, 0x1d, 0xfe, 0xfd, 0x67, 0x0d,
+  0xc0, 0x41, 0x8a, 0xf9, 0xdf, 0x28, 0x93, 0x55, 0xae, 0x12, 0xf0, 0x5d, 0x88, 0xbd, 0x7a, 0x3b,
+  0x2d, 0xeb, 0x7d, 0x18, 0x19, 0xcb, 0x14, 0x15, 0x29, 0xc8, 0x74, 0x25, 0xc7, 0x96, 0x99, 0x74,
+  0xc2, 0x31, 0xde, 0xdd, 0x83, 0x36, 0xe2, 0xf9, 0xb4, 0x58, 0xdc, 0xc5, 0x6c, 0x4c, 0x2d, 0xb0,
+  0xa4, 0x96, 0x69, 0x71, 0xb4, 0x62, 0xbf, 0x12, 0xa2, 0x49, 0x0f, 0x94, 0x11, 0x9d, 0x64, 0xef,
+  0x28, 0x6a, 0x2f, 0x38, 0x14, 0x2d, 0xec, 0x9e, 0x48, 0x54, 0x64, 0x30, 0x26, 0xa1, 0xad, 0x86,
+  0xff, 0xd5, 0xb4, 0x0c, 0xc5, 0x22, 0x7e, 0xb4, 0x7d, 0x5c, 0x12, 0xe1, 0x13, 0x33, 0x8a, 0xf6,
+  0x35, 0x40, 0xe9, 0xf2, 0x9d, 0x5c, 0x06, 0x99, 0x08, 0x5f, 0xf8, 0xd1, 0xca, 0x62, 0x0c, 0x74,
+  0xfa, 0x0b, 0xdc, 0x73, 0x41, 0x1b, 0xd3, 0xb7, 0x07, 0xcc, 0xbd, 0x86, 0x36, 0x3c, 0x40, 0xec,
+  0xd8, 0x3e, 0x07, 0x85, 0xec, 0xa1, 0x80, 0x5c, 0x15, 0xe5, 0x13, 0x42, 0xdb, 0xf2, 0x6d, 0x34,
+  0x6a, 0x3d, 0xd1, 0x20, 0x2a, 0x2f, 0x87, 0xf2, 0x92, 0x6c, 0x11, 0x16, 0x63, 0x18, 0xb0, 0xa7,
+  0xdd, 0xa9, 0xe0, 0x13, 0x91, 0xc9, 0x89, 0xd3, 0x4b, 0x62, 0x26, 0xee, 0x4a, 0x87, 0xeb, 0x19,
+  0x92, 0xb6, 0xef, 0x31, 0x86, 0x88, 0x02, 0x24, 0x57, 0xfc, 0x95, 0xcf, 0x14, 0xa6, 0x82, 0x60,
+  0x7c, 0x81, 0x46, 0xc2, 0x43, 0x9b, 0xd1, 0x60, 0x55, 0x79, 0xfd, 0x66, 0xc8, 0xd7, 0x63, 0x42,
+  0x82, 0xc2, 0x56, 0xa9, 0x24, 0xa1, 0x91, 0x83, 0x6b, 0x02, 0x51, 0xd9, 0xe6, 0x87, 0xa4, 0x69,
+  0xd6, 0x5e, 0x24, 0x86, 0x06, 0x95, 0xfd, 0x51, 0x4b, 0xe6, 0x13, 0xf1, 0x6c, 0x02, 0x86, 0x04,
+  0x13, 0xcb, 0xf3, 0x1e, 0x35, 0x66, 0x2c, 0x31, 0x92, 0x3f, 0xb0, 0xe3, 0xc5, 0x53, 0x23, 0x00,
+  0xa4, 0x7a, 0x44, 0x01, 0xf5, 0xda, 0x64, 0x4a, 0x72, 0x6d, 0x5d, 0x13, 0xe9, 0x18, 0x50, 0xfd,
+  0x20, 0x3f, 0x92, 0x1d, 0xf2, 0x29, 0xe7, 0x0d, 0x25, 0x32, 0xb2, 0x53, 0x49, 0x7e, 0xf2, 0xac,
+  0x44, 0xee, 0x76, 0x34, 0x32, 0xca, 0x60, 0x70, 0x7e, 0xad, 0xb2, 0xa8, 0xfd, 0xf4, 0xe7, 0xbf,
+  0x6a, 0x65, 0xf8, 0xf7, 0x2f, 0x3c, 0xe1, 0x63, 0x96, 0xc7, 0xb2, 0xc8, 0x49, 0xa5, 0xd4, 0x2b,
+  0xb4, 0x64, 0xac, 0x47, 0xfc, 0xfc, 0x84, 0xfc, 0x85, 0x13, 0xf2, 0x57, 0x91, 0xb9, 0x2a, 0x71,
+  0xbf, 0x03, 0xc3, 0x8e, 0xa9, 0xb3, 0x78, 0x0d, 0x3a, 0xae, 0x1a, 0xef, 0xf1, 0x07, 0x80, 0x8a,
+  0xbc, 0xd9, 0x4e, 0x55, 0x6e, 0x99, 0xc6, 0xd3, 0x37, 0x9e, 0x4e, 0xa5, 0x12, 0x38, 0x5e, 0x06,
+  0x5e, 0x95, 0x95, 0x0e, 0x1f, 0x99, 0xb0, 0xb5, 0x11, 0x92, 0x5a, 0x80, 0x49, 0xfc, 0xf8, 0x91,
+  0x27, 0xb3, 0xa8, 0xbb, 0x64, 0x06, 0x9e, 0x47, 0x00, 0x4f, 0xec, 0x30, 0xac, 0x10, 0xb2, 0x2d,
+  0xbf, 0xdc, 0x97, 0xd3, 0xca, 0xb5, 0x85, 0x75, 0x29, 0x6d, 0x98, 0xd1, 0xe6, 0x8d, 0x7c, 0xcb,
+  0x81, 0xd4, 0x65, 0x6e, 0x79, 0x87, 0x46, 0x26, 0x9d, 0xf9, 0xf1, 0x1f, 0x59, 0xda, 0x70, 0xb1,
+  0x8b, 0xb7, 0x95, 0x52, 0x20, 0xe8, 0xa8, 0xf2, 0x01, 0x9a, 0x98, 0xb2, 0xf2, 0xca, 0x84, 0x30,
+  0xc4, 0x9b, 0x1c, 0xca, 0xfa, 0xd4, 0xda, 0x0a, 0xbe, 0xb6, 0xa9, 0x85, 0x52, 0x9d, 0xd9, 0x84,
+  0x2f, 0xe2, 0x44, 0xf8, 0x3e, 0x68, 0x71, 0x4e, 0xc5, 0x73, 0xa3, 0xc6, 0xbd, 0xeb, 0x56, 0xb1,
+  0xd5, 0xa6, 0x6a, 0xc2, 0x98, 0x48, 0x6a, 0xe4, 0x43, 0xc4, 0x60, 0xd8, 0x21, 0x9b, 0x66, 0x63,
+  0xd3, 0x66, 0xc6, 0xf3, 0xe7, 0x7c, 0x20, 0xf9, 0xb1, 0xd6, 0x2c, 0x3d, 0x7f, 0x0e, 0x43, 0x00,
+  0xb3, 0x32, 0x9c, 0x00, 0x1d, 0xc5, 0x3c, 0xd0, 0x28, 0xd2, 0x1a, 0x19, 0xc2, 0x96, 0x35, 0xbe,
+  0xee, 0x86, 0xf9, 0xd2, 0x86, 0x93, 0xe5, 0xdb, 0xb8, 0xe8, 0x96, 0xeb, 0x03, 0x32, 0x17, 0x41,
+  0xef, 0x59, 0x8c, 0xbb, 0x67, 0xd5, 0x10, 0xf8, 0x0b, 0xda, 0x89, 0xd8, 0x6f, 0xe2, 0x79, 0xf8,
+  0xde, 0x35, 0x48, 0x4c, 0xd2, 0xd3, 0xe4, 0xd1, 0x7e, 0xf8, 0x4d, 0x97, 0x33, 0x43, 0x34, 0xfe,
+  0x56, 0xd7, 0x28, 0x57, 0x56, 0xeb, 0xb6, 0x58, 0xa6, 0xe4, 0xf1, 0x45, 0x14, 0x5e, 0xac, 0x04,
+  0x60, 0x6b, 0x0c, 0xaf, 0x98, 0x29, 0x67, 0x3c, 0xc6, 0x1f, 0xe8, 0xc5, 0x03, 0x25, 0xb8, 0xec,
+  0x5c, 0x2c, 0x21, 0x92, 0x08, 0xe3, 0x0b, 0x20, 0xdf, 0xe7, 0x95, 0xc5, 0x52, 0xad, 0xf2, 0x7a,
+  0x57, 0xae, 0xd4, 0x65, 0xdb, 0x33, 0xd9, 0xfe, 0xf1, 0x9b, 0xff, 0xdc, 0x12, 0x8a, 0xac, 0xc0,
+  0x1c, 0x2f, 0x8b, 0xb7, 0x02, 0xbd, 0xba, 0xf8, 0xb8, 0x2b, 0xdd, 0xad, 0x5f, 0x28, 0x47, 0xfe,
+  0xf0, 0x32, 0xc0, 0x87, 0xfb, 0x96, 0xf2, 0xfe, 0x2e, 0xf7, 0x3f, 0xa1, 0x1d, 0xcf, 0xed, 0xac,
+  0x24, 0xd7, 0x76, 0x6e, 0x20, 0xa7, 0x8f, 0xd8, 0xa1, 0xf8, 0x34, 0x8a, 0x3a, 0xf1, 0x15, 0xb4,
+  0x25, 0xa3, 0x6e, 0x1d, 0x5b, 0x23, 0xbf, 0x4e, 0x02, 0xcb, 0xba, 0x82, 0x82, 0x62, 0xa9, 0xbc,
+  0xc3, 0x7f, 0x26, 0x25, 0xac, 0x39, 0xc3, 0x6f, 0xc5, 0x12, 0x79, 0x41, 0xf6, 0xca, 0x3b, 0x68,
+  0xaf, 0x55, 0x85, 0x80, 0x5e, 0xde, 0x99, 0x3a, 0x41, 0x04, 0xe7, 0x23, 0x7c, 0xf1, 0x38, 0x10,
+  0xc8, 0x11, 0x7d, 0x16, 0x41, 0xe1, 0x5f, 0xa1, 0x66, 0x27, 0xbd, 0x4e, 0xf6, 0x03, 0x92, 0x9a,
+  0xb3, 0xcd, 0xe0, 0x3b, 0x44, 0xfc, 0x92, 0x32, 0xae, 0x95, 0xc4, 0xf0, 0x2f, 0x25, 0xa7, 0x12,
+  0x27, 0x0f, 0x1a, 0xdc, 0xee, 0xc8, 0xa9, 0x23, 0x72, 0xee, 0x76, 0xd4, 0xe4, 0x91, 0xf4, 0xec,
+  0x91, 0xac, 0xe9, 0xdb, 0xe1, 0xf3, 0x47, 0x52, 0x13, 0x18, 0x1f, 0x76, 0x27, 0x3c, 0xcc, 0x21,
+  0x17, 0x62, 0x71, 0x2b, 0x43, 0xfd, 0xad, 0x0e, 0x77, 0xec, 0x44, 0x27, 0xac, 0xc4, 0x4e, 0x47,
+  0x16, 0xb9, 0x62, 0xd2, 0x04, 0x95, 0x42, 0xc2, 0x0d, 0x42, 0x6d, 0x83, 0xe0, 0xd6, 0x9b, 0x81,
+  0x74, 0x8b, 0x03, 0xa4, 0x48, 0xb7, 0x38, 0x94, 0x15, 0x8f, 0x32, 0xb8, 0xeb, 0x4f, 0x80, 0x96,
+  0xb1, 0x86, 0x04, 0x2e, 0x0e, 0x8c, 0x20, 0x14, 0x14, 0x96, 0x04, 0x4b, 0x11, 0xa0, 0x3c, 0x43,
+  0x92, 0x0e, 0x10, 0x92, 0xa2, 0x77, 0x9f, 0x34, 0x81, 0x24, 0x60, 0x79, 0x5c, 0x14, 0xc0, 0x97,
+  0x0e, 0x44, 0x36, 0x5c, 0x82, 0x50, 0xc0, 0x18, 0x80, 0xd1, 0xf2, 0x8b, 0xfb, 0x65, 0xa2, 0xed,
+  0x46, 0x5e, 0x8e, 0xcb, 0x16, 0x74, 0x2c, 0xae, 0x4a, 0xd7, 0x46, 0xfd, 0x51, 0x68, 0xa3, 0x71,
+  0x23, 0xa9, 0x55, 0xf5, 0x28, 0x8c, 0x51, 0xbd, 0x94, 0xc6, 0x8d, 0x10, 0xe3, 0x02, 0x1a, 0x75,
+  0x0d, 0x05, 0x76, 0x93, 0xce, 0xc8, 0x59, 0x68, 0x04, 0xbd, 0xff, 0xf0, 0xeb, 0x5b, 0xe0, 0xcc,
+  0x5d, 0xf5, 0xd7, 0xb7, 0x9c, 0x52, 0xfc, 0x03, 0x51, 0xbe, 0xfb, 0x43, 0x14, 0xd4, 0xce, 0xa3,
+  0xa6, 0x88, 0xed, 0x5d, 0x1d, 0xda, 0xf2, 0xc1, 0xb0, 0x51, 0xae, 0xa1, 0x8d, 0xbf, 0x75, 0x8b,
+  0x71, 0x57, 0x14, 0xc9, 0x00, 0x28, 0x39, 0xfe, 0x06, 0xdd, 0xb9, 0xaa, 0xa4, 0xbb, 0x4b, 0x9c,
+  0x30, 0x90, 0x20, 0x45, 0xb9, 0x54, 0x0c, 0xfa, 0xc1, 0x17, 0x02, 0xb5, 0x30, 0x90, 0xd0, 0x70,
+  0x69, 0xf3, 0x19, 0x96, 0xc3, 0x27, 0xce, 0x38, 0xa4, 0xbf, 0x37, 0x30, 0x75, 0x15, 0xbe, 0x68,
+  0x0d, 0x9e, 0x89, 0x1b, 0x5d, 0xd4, 0x63, 0xd2, 0x24, 0xaf, 0x76, 0xd1, 0x6c, 0x81, 0x84, 0xae,
+  0xb1, 0x75, 0x18, 0x2d, 0x64, 0x6c, 0x0c, 0x66, 0xa9, 0x8b, 0xdc, 0x73, 0x49, 0x88, 0x32, 0x57,
+  0x7b, 0xb9, 0xf5, 0xb8, 0x6a, 0x36, 0x89, 0x08, 0xdb, 0x01, 0x7e, 0x07, 0x83, 0xe7, 0x6b, 0x6a,
+  0x15, 0xe3, 0x8d, 0xca, 0xe4, 0xf5, 0xae, 0x30, 0xac, 0x6f, 0x6b, 0x6a, 0x07, 0x56, 0x6e, 0xc5,
+  0x12, 0xcf, 0xd5, 0x1b, 0x85, 0x1a, 0xbe, 0x4e, 0x0e, 0x2a, 0xfd, 0xee, 0xba, 0x41, 0x5f, 0x8d,
+  0x5e, 0x1b, 0x07, 0xfb, 0xaf, 0xf8, 0x53, 0xef, 0xb9, 0x6d, 0x2b, 0x53, 0xd0, 0x5f, 0x8b, 0xb9,
+  0xa2, 0xcf, 0x6f, 0x7e, 0xa3, 0x53, 0xaa, 0xef, 0xeb, 0xf9, 0x7d, 0x90, 0x69, 0xbc, 0xe9, 0xab,
+  0x5d, 0x3a, 0xfe, 0x6e, 0xcf, 0x18, 0x25, 0x9a, 0xd6, 0xe4, 0x4f, 0xb6, 0xd7, 0xf8, 0x6f, 0xd4,
+  0xff, 0x2f, 0xfe, 0x44, 0xc1, 0x3d, 0xb3, 0x7e, 0x00, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+  {"/app.css", "text/css", ASSET_APP_CSS, sizeof(ASSET_APP_CSS), "\"85f765dc9cb1d746\"", "public, max-age=31536000, immutable"},
+  {"/lang.js", "application/javascript", ASSET_LANG_JS, sizeof(ASSET_LANG_JS), "\"a5b6d32549cb163f\"", "public, max-age=31536000, immutable"},
+  {"/lang-handler.js", "application/javascript", ASSET_LANG_HANDLER_JS, sizeof(ASSET_LANG_HANDLER_JS), "\"77caac2c446d73c3\"", "public, max-age=31536000, immutable"},
+  {"/app.js", "application/javascript", ASSET_APP_JS, sizeof(ASSET_APP_JS), "\"50af91dbdcce5b55\"", "public, max-age=31536000, immutable"},
+  {"/", "text/html", ASSET_INDEX_HTML, sizeof(ASSET_INDEX_HTML), "\"50f75fb127aa8730\"", "no-cache"},
+};
+
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+
+#endif
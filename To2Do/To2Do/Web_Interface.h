@@ -66,6 +66,10 @@ const char* getHTML() {
 <select class="modal-select" id="modal-task-priority"><option value="low">Dusuk</option><option value="medium" selected>Orta</option><option value="high">Yuksek</option></select>
 <input type="date" class="modal-date" id="modal-task-date">
 </div>
+<div class="modal-form-row">
+<select class="modal-select" id="modal-task-repeat"><option value="">Tekrar yok</option><option value="daily">Her gun</option><option value="weekdays">Hafta ici</option><option value="weekly">Haftalik</option><option value="monthly">Aylik</option></select>
+<input type="number" class="modal-date" id="modal-task-every" min="1" max="99" value="1" title="Her (gun/hafta/ay)">
+</div>
 <div class="modal-actions">
 <button class="modal-btn" id="modal-task-cancel">IPTAL</button>
 <button class="modal-btn primary" id="modal-task-create">OLUSTUR</button>
@@ -82,6 +86,10 @@ const char* getHTML() {
 <select class="modal-select" id="edit-task-priority"><option value="low">Dusuk</option><option value="medium">Orta</option><option value="high">Yuksek</option></select>
 <input type="date" class="modal-date" id="edit-task-date">
 </div>
+<div class="modal-form-row">
+<select class="modal-select" id="edit-task-repeat"><option value="">Tekrar yok</option><option value="daily">Her gun</option><option value="weekdays">Hafta ici</option><option value="weekly">Haftalik</option><option value="monthly">Aylik</option></select>
+<input type="number" class="modal-date" id="edit-task-every" min="1" max="99" value="1" title="Her (gun/hafta/ay)">
+</div>
 <div class="modal-actions">
 <button class="modal-btn" id="edit-task-cancel">IPTAL</button>
 <button class="modal-btn primary" id="edit-task-save">KAYDET</button>
@@ -372,10 +380,10 @@ const char* getHTML() {
 <p class="info-text" id="info-backup-included">Included: Projects, Tasks, GUI Settings</p>
 <p class="info-text" id="info-backup-excluded">Excluded: WiFi credentials (for security)</p>
 <div style="display:grid;grid-template-columns:1fr 1fr;gap:10px;margin-top:15px;">
-<button class="settings-btn" onclick="fetch('/api/backup/export').then(r=>r.text()).then(data=>{const blob=new Blob([data],{type:'application/json'});const url=window.URL.createObjectURL(blob);const a=document.createElement('a');a.href=url;a.download='To2Do_Backup.json';document.body.appendChild(a);a.click();document.body.removeChild(a);window.URL.revokeObjectURL(url);})" style="margin:0;" id="btn-backup-export">EXPORT</button>
+<button class="settings-btn" onclick="fetch('/api/backup/export').then(r=>r.text()).then(data=>{try{JSON.parse(data);}catch(e){alert('Export failed (data changed while exporting), please try again');return;}const blob=new Blob([data],{type:'application/json'});const url=window.URL.createObjectURL(blob);const a=document.createElement('a');a.href=url;a.download='To2Do_Backup.json';document.body.appendChild(a);a.click();document.body.removeChild(a);window.URL.revokeObjectURL(url);})" style="margin:0;" id="btn-backup-export">EXPORT</button>
 <button class="settings-btn" onclick="document.getElementById('backup-upload').click()" style="margin:0;" id="btn-backup-import">IMPORT</button>
 </div>
-<input type="file" id="backup-upload" accept=".json" style="display:none" onchange="if(this.files[0]){const f=new FileReader();f.onload=e=>{if(confirm('Restore backup? Current data will be overwritten.')){fetch('/api/backup/import',{method:'POST',headers:{'Content-Type':'application/json'},body:e.target.result}).then(r=>r.json()).then(d=>{alert(d.success?'Backup restored!':'Failed: '+d.error);if(d.success)location.reload();})}};f.readAsText(this.files[0])}">
+<input type="file" id="backup-upload" accept=".json" style="display:none" onchange="if(this.files[0]&&confirm('Restore backup? Current data will be overwritten.')){fetch('/api/backup/import',{method:'POST',headers:{'Content-Type':'application/json'},body:this.files[0]}).then(r=>r.json()).then(d=>{alert(d.success?'Backup restored!':'Failed: '+d.error);if(d.success)location.reload();})}">
 </div>
 </div>
 </div>
@@ -440,8 +448,8 @@ const contentId='notif-'+type+'-content';
 const contentEl=document.getElementById(contentId);
 if(!contentEl)return;
 contentEl.innerHTML='<p style="text-align:center;color:#666;">Loading...</p>';
-fetch('/api/notifications/'+type)
-.then(r=>r.json())
+fetchCached('/api/notifications/'+type)
+.then(r=>JSON.parse(r.text))
 .then(d=>{
 console.log('Notification response:',d);
 if(d.error){
@@ -498,6 +506,11 @@ continue;
 }
 html+='<div style="margin-bottom:15px;"><strong>'+projName+'</strong> ('+tasks.length+')<ul style="margin:5px 0 0 20px;padding:0;">';
 tasks.forEach(t=>{
+// Recurring: one entry per occurrence, a click marks just that occurrence
+if(t.recurring){
+html+='<li class="notif-occurrence" data-task-id="'+t.id+'" data-occurrence="'+t.date.substring(0,10)+'" data-completed="'+(t.completed?1:0)+'" style="margin:5px 0;color:#aaa;cursor:pointer;">'+(t.completed?'☑':'☐')+' ↻ '+t.title+' <span style="font-size:11px;color:#666;">('+t.date+')</span></li>';
+return;
+}
 html+='<li style="margin:5px 0;color:#aaa;">'+t.title+' <span style="font-size:11px;color:#666;">('+t.date+')</span></li>';
 });
 html+='</ul></div>';
@@ -506,6 +519,12 @@ html+='</div></div>';
 }
 contentEl.innerHTML='<div class="accordion">'+html+'</div>';
 setTimeout(()=>{
+contentEl.querySelectorAll('.notif-occurrence').forEach(item=>{
+item.addEventListener('click',()=>{
+app.patchTaskOnServer(parseInt(item.dataset.taskId),{occurrence:item.dataset.occurrence,completed:item.dataset.completed!=='1'})
+.then(()=>loadNotifications(type));
+});
+});
 contentEl.querySelectorAll('.accordion-header').forEach(header=>{
 header.addEventListener('click',e=>{
 const accordionName=e.currentTarget.dataset.accordion;
@@ -533,16 +552,25 @@ console.error('Notification error:',e);
 contentEl.innerHTML='<p style="text-align:center;color:#f00;">Error loading notifications</p>';
 });
 }
-function updateNotificationBadge(){
-fetch('/api/notifications/today').then(r=>r.json()).then(d=>{
+// counts: pushed by /api/events ("counts"); without it the badge is fetched
+function updateNotificationBadge(counts){
+if(!counts){
+fetchCached('/api/notifications/today').then(r=>JSON.parse(r.text)).then(d=>updateNotificationBadge({today:d.count}));
+return;
+}
 const badge=document.getElementById('notification-badge');
-if(d.count>0){
-badge.textContent=d.count;
+if(counts.today>0){
+badge.textContent=counts.today;
 badge.style.display='flex';
 }else{
 badge.style.display='none';
 }
-});
+// Open modal follows the change too
+const modal=document.getElementById('notification-modal');
+const tab=document.querySelector('[data-tab^="notif-"].active');
+if(counts.overdue!==undefined&&modal&&modal.classList.contains('active')&&tab){
+loadNotifications(tab.dataset.tab.replace('notif-',''));
+}
 }
 document.getElementById('notification-btn')?.addEventListener('click',openNotificationModal);
 document.querySelectorAll('[data-tab^="notif-"]').forEach(tab=>{
@@ -605,8 +633,11 @@ const timeStr = `${hour}:${minute}`;
 document.getElementById('current-date').textContent = dateStr;
 document.getElementById('current-time').textContent = timeStr;
 
-// Also sync to device periodically (every minute when time updates)
-syncBrowserDateToDevice();
+// Also sync to device periodically (every minute when time updates).
+// Another open tab that just did it is reported on /api/events - skip then
+if (typeof app === 'undefined' || !app || Date.now() - app.lastTimeSync > 50000) {
+  syncBrowserDateToDevice();
+}
 }
 
 // Load time immediately on page load
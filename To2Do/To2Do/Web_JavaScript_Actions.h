@@ -17,6 +17,7 @@ function showTaskModal() {
     document.getElementById('modal-task-type').value = 'task';
     document.getElementById('modal-task-priority').value = 'medium';
     document.getElementById('modal-task-date').value = '';
+    writeRepeat('modal', null);
     document.getElementById('task-modal').classList.add('active');
     document.getElementById('modal-task-title').focus();
 }
@@ -34,6 +35,7 @@ function showEditTaskModal(taskId) {
     document.getElementById('edit-task-type').value = task.type;
     document.getElementById('edit-task-priority').value = task.priority;
     document.getElementById('edit-task-date').value = task.date;
+    writeRepeat('edit', task.repeat);
     document.getElementById('edit-task-modal').classList.add('active');
     document.getElementById('edit-task-title').focus();
     
@@ -76,16 +78,9 @@ function showSettingsModal() {
     // Load network settings
     loadNetworkSettingsToModal();
     
-    // Update INFO tab with current network status
-    updateNetworkInfo();
-    
-    // Start periodic network status updates (every 5 seconds while modal is open)
-    if (app.networkStatusInterval) {
-        clearInterval(app.networkStatusInterval);
-    }
-    app.networkStatusInterval = setInterval(() => {
-        updateNetworkInfo();
-    }, 5000);
+    // Update INFO tab with current network status (fresh RSSI); later
+    // changes arrive as "network" events
+    updateNetworkInfo(true);
     
     // Open modal with GUI tab active by default
     const modal = document.getElementById('settings-modal');
@@ -102,12 +97,6 @@ function showSettingsModal() {
 function hideSettingsModal() {
     document.getElementById('settings-modal').classList.remove('active');
     
-    // Stop periodic updates
-    if (app.networkStatusInterval) {
-        clearInterval(app.networkStatusInterval);
-        app.networkStatusInterval = null;
-    }
-    
     // Restore theme if cancelled
     applySettings();
 }
@@ -122,17 +111,42 @@ function showContextMenu(event, projectId) {
 
 // ==================== TASK ACTIONS ====================
 
+// Repeat fields <-> task.repeat (rules are expanded on the device, see
+// Recurrence.h). "weekdays" is weekly Monday-Friday; weekdays 0 = Monday.
+function writeRepeat(prefix, repeat) {
+    let value = repeat ? repeat.freq : '';
+    if (value === 'weekly' && (repeat.days || []).join() === '0,1,2,3,4') value = 'weekdays';
+    document.getElementById(prefix + '-task-repeat').value = value;
+    document.getElementById(prefix + '-task-every').value = repeat ? (repeat.every || 1) : 1;
+}
+
+// previous: the rule being edited - custom weekday sets survive an edit
+function readRepeat(prefix, previous) {
+    const value = document.getElementById(prefix + '-task-repeat').value;
+    if (!value) return null;
+    const every = Math.min(99, Math.max(1, parseInt(document.getElementById(prefix + '-task-every').value) || 1));
+    if (value === 'weekdays') return { freq: 'weekly', every, days: [0, 1, 2, 3, 4] };
+    const repeat = { freq: value, every };
+    if (value === 'weekly' && previous && previous.freq === 'weekly' && previous.days) repeat.days = previous.days;
+    return repeat;
+}
+
 function createTask() {
     const title = document.getElementById('modal-task-title').value.trim();
     const description = document.getElementById('modal-task-desc').value.trim();
     const type = document.getElementById('modal-task-type').value;
     const priority = document.getElementById('modal-task-priority').value;
     const date = document.getElementById('modal-task-date').value;
+    const repeat = readRepeat('modal', null);
 
     if (!title) {
         showToast('TITLE REQUIRED', 'error');
         return;
     }
+    if (repeat && !date) {
+        showToast('DATE REQUIRED', 'error');
+        return;
+    }
 
     const newTask = {
         id: app.nextTaskId++,
@@ -146,6 +160,7 @@ function createTask() {
         checklist: [],
         dependencies: []
     };
+    if (repeat) newTask.repeat = repeat;
 
     app.tasks.push(newTask);
     hideTaskModal();
@@ -153,7 +168,7 @@ function createTask() {
     renderProjects();
     updateStats();
     showToast('TASK CREATED');
-    app.saveToServer();
+    app.createTaskOnServer(newTask);
 }
 
 function saveEditedTask() {
@@ -166,24 +181,31 @@ function saveEditedTask() {
     const type = document.getElementById('edit-task-type').value;
     const priority = document.getElementById('edit-task-priority').value;
     const date = document.getElementById('edit-task-date').value;
+    const repeat = readRepeat('edit', task.repeat);
 
     if (!title) {
         showToast('TITLE REQUIRED', 'error');
         return;
     }
+    if (repeat && !date) {
+        showToast('DATE REQUIRED', 'error');
+        return;
+    }
 
     task.title = title;
     task.description = description;
     task.type = type;
     task.priority = priority;
     task.date = date;
+    // The device keeps the completed occurrences when the rule changes
+    task.repeat = repeat && task.repeat && task.repeat.done ? Object.assign({}, repeat, { done: task.repeat.done }) : repeat;
 
     hideEditTaskModal();
     renderTasks();
     renderProjects();
     updateStats();
     showToast('TASK UPDATED');
-    app.saveToServer();
+    app.patchTaskOnServer(taskId, { title, description, type, priority, date, repeat });
 }
 
 function toggleTask(taskId) {
@@ -192,7 +214,7 @@ function toggleTask(taskId) {
         task.completed = !task.completed;
         renderTasks();
         updateStats();
-        app.saveToServer();
+        app.patchTaskOnServer(taskId, { completed: task.completed });
     }
 }
 
@@ -210,7 +232,7 @@ function deleteTask(taskId) {
         renderProjects();
         updateStats();
         showToast('DELETED', 'error');
-        app.saveToServer();
+        app.deleteTaskOnServer(taskId);
     }
 }
 
@@ -244,7 +266,7 @@ function toggleChecklist(taskId, checklistId) {
         if (item) {
             item.completed = !item.completed;
             renderTasks();
-            app.saveToServer();
+            app.patchChecklistOnServer(taskId, checklistId, { completed: item.completed });
         }
     }
 }
@@ -256,10 +278,11 @@ function addChecklistItem(taskId, text) {
         const newId = task.checklist.length > 0 
             ? Math.max(...task.checklist.map(c => c.id)) + 1 
             : 1;
-        task.checklist.push({ id: newId, text, completed: false });
+        const item = { id: newId, text, completed: false };
+        task.checklist.push(item);
         renderTasks();
         showToast('SUBTASK ADDED');
-        app.saveToServer();
+        app.addChecklistOnServer(taskId, item);
     }
 }
 
@@ -269,7 +292,7 @@ function removeChecklistItem(taskId, checklistId) {
         task.checklist = task.checklist.filter(c => c.id !== checklistId);
         renderTasks();
         showToast('SUBTASK DELETED');
-        app.saveToServer();
+        app.deleteChecklistOnServer(taskId, checklistId);
     }
 }
 
@@ -279,8 +302,9 @@ function addDependency(taskId) {
     const task = app.tasks.find(t => t.id === taskId);
     if (!task) return;
 
+    // Tasks already waiting on this one would close a cycle (the device rejects it too)
     const availableTasks = app.tasks
-        .filter(t => t.projectId === app.currentProject && t.id !== taskId)
+        .filter(t => t.projectId === app.currentProject && t.id !== taskId && !dependsOn(t.id, taskId))
         .map(t => ({ id: t.id, title: t.title, completed: t.completed }));
 
     if (availableTasks.length === 0) {
@@ -291,6 +315,21 @@ function addDependency(taskId) {
     showDependencyPicker(taskId, availableTasks);
 }
 
+// True if task fromId waits on targetId, directly or through other tasks
+function dependsOn(fromId, targetId) {
+    const seen = new Set();
+    const stack = [fromId];
+    while (stack.length > 0) {
+        const id = stack.pop();
+        if (id === targetId) return true;
+        if (seen.has(id)) continue;
+        seen.add(id);
+        const task = app.tasks.find(t => t.id === id);
+        if (task) stack.push(...task.dependencies);
+    }
+    return false;
+}
+
 function showDependencyPicker(taskId, availableTasks) {
     // Create modal HTML
     const modalHTML = `
@@ -371,7 +410,12 @@ function selectDependency(taskId, depId) {
     task.dependencies.push(depId);
     renderTasks();
     showToast('DEPENDENCY ADDED');
-    app.saveToServer();
+    app.patchTaskOnServer(taskId, { dependencies: task.dependencies }).then(data => {
+        if (!data) {
+            task.dependencies = task.dependencies.filter(d => d !== depId);
+            renderTasks();
+        }
+    });
     closeDependencyPicker();
 }
 
@@ -388,7 +432,7 @@ function removeDependency(taskId, depId) {
         task.dependencies = task.dependencies.filter(d => d !== depId);
         renderTasks();
         showToast('LINK REMOVED');
-        app.saveToServer();
+        app.patchTaskOnServer(taskId, { dependencies: task.dependencies });
     }
 }
 
@@ -419,7 +463,7 @@ function createProject() {
     updateStats();
     showToast('PROJECT CREATED');
     selectProject(newProject.id);
-    app.saveToServer();
+    app.createProjectOnServer(newProject);
 }
 
 function editProjectDetails() {
@@ -458,7 +502,7 @@ function updateProject() {
     renderProjects();
     renderTasks();
     showToast('PROJECT UPDATED');
-    app.saveToServer();
+    app.patchProjectOnServer(project.id, { name, description: desc, priority });
 }
 
 function handleContextAction(action, projectId) {
@@ -476,13 +520,13 @@ function handleContextAction(action, projectId) {
             app.projects.push(copy);
             renderProjects();
             showToast('DUPLICATED');
-            app.saveToServer();
+            app.createProjectOnServer(copy);
             break;
         case 'archive':
             project.archived = !project.archived;
             renderProjects();
             showToast(project.archived ? 'ARCHIVED' : 'UNARCHIVED');
-            app.saveToServer();
+            app.patchProjectOnServer(projectId, { archived: project.archived });
             break;
         case 'delete':
             if (confirm('DELETE PROJECT: ' + project.name + '?')) {
@@ -495,7 +539,7 @@ function handleContextAction(action, projectId) {
                 renderTasks();
                 updateStats();
                 showToast('DELETED', 'error');
-                app.saveToServer();
+                app.deleteProjectOnServer(projectId);
             }
             break;
     }
@@ -613,81 +657,57 @@ async function testWiFiConnection(type) {
 
 // ==================== TASK EVENT BINDING ====================
 
-function bindTaskEvents() {
-    const container = document.getElementById('tasks-container');
+// Delegated once on the list containers: nodes patched in later need no listeners
+function bindListEvents() {
+    const tasks = document.getElementById('tasks-container');
+    const projects = document.getElementById('projects-list');
 
-    container.querySelectorAll('.task-checkbox').forEach(el => {
-        el.addEventListener('click', () => {
-            const taskId = parseInt(el.dataset.taskId);
-            toggleTask(taskId);
-        });
-    });
+    tasks.addEventListener('click', (e) => {
+        const el = e.target.closest('[data-task-id]');
+        if (!el || !tasks.contains(el)) return;
+        const taskId = parseInt(el.dataset.taskId);
 
-    container.querySelectorAll('.checklist-checkbox').forEach(el => {
-        el.addEventListener('click', () => {
-            const taskId = parseInt(el.dataset.taskId);
-            const checklistId = parseInt(el.dataset.checklistId);
-            toggleChecklist(taskId, checklistId);
-        });
-    });
-
-    container.querySelectorAll('.checklist-input').forEach(el => {
-        el.addEventListener('keypress', (e) => {
-            if (e.key === 'Enter') {
-                const taskId = parseInt(el.dataset.taskId);
-                const text = el.value.trim();
-                if (text) {
-                    addChecklistItem(taskId, text);
-                    el.value = '';
-                }
-            }
-        });
-    });
-
-    container.querySelectorAll('.task-action-btn.edit').forEach(el => {
-        el.addEventListener('click', () => {
-            const taskId = parseInt(el.dataset.taskId);
+        if (el.matches('.task-checkbox')) {
+            toggleTask(taskId);
+        } else if (el.matches('.checklist-checkbox')) {
+            toggleChecklist(taskId, parseInt(el.dataset.checklistId));
+        } else if (el.matches('.checklist-remove')) {
+            removeChecklistItem(taskId, parseInt(el.dataset.checklistId));
+        } else if (el.matches('.dependency-remove')) {
+            removeDependency(taskId, parseInt(el.dataset.depId));
+        } else if (el.matches('.task-action-btn.edit')) {
             showEditTaskModal(taskId);
-        });
-    });
-
-    container.querySelectorAll('.task-action-btn.delete').forEach(el => {
-        el.addEventListener('click', () => {
-            const taskId = parseInt(el.dataset.taskId);
+        } else if (el.matches('.task-action-btn.delete')) {
             deleteTask(taskId);
-        });
+        } else if (el.matches('.task-action-btn.add-dep')) {
+            addDependency(taskId);
+        }
     });
 
-    container.querySelectorAll('.task-action-btn.add-dep').forEach(el => {
-        el.addEventListener('click', () => {
-            const taskId = parseInt(el.dataset.taskId);
-            addDependency(taskId);
-        });
+    tasks.addEventListener('keypress', (e) => {
+        const el = e.target;
+        if (e.key !== 'Enter' || !el.matches('.checklist-input')) return;
+        const text = el.value.trim();
+        if (text) {
+            addChecklistItem(parseInt(el.dataset.taskId), text);
+            el.value = '';
+        }
     });
 
-    container.querySelectorAll('.dependency-remove').forEach(el => {
-        el.addEventListener('click', () => {
-            const taskId = parseInt(el.dataset.taskId);
-            const depId = parseInt(el.dataset.depId);
-            removeDependency(taskId, depId);
-        });
+    projects.addEventListener('click', (e) => {
+        const el = e.target.closest('.sidebar-project');
+        if (el) selectProject(parseInt(el.dataset.projectId));
     });
 
-    container.querySelectorAll('.checklist-remove').forEach(el => {
-        el.addEventListener('click', () => {
-            const taskId = parseInt(el.dataset.taskId);
-            const checklistId = parseInt(el.dataset.checklistId);
-            removeChecklistItem(taskId, checklistId);
-        });
+    projects.addEventListener('contextmenu', (e) => {
+        const el = e.target.closest('.sidebar-project');
+        if (!el) return;
+        e.preventDefault();
+        showContextMenu(e, parseInt(el.dataset.projectId));
     });
 
-    // Date click removed - use edit button instead
-    // container.querySelectorAll('.task-date-display').forEach(el => {
-    //     el.addEventListener('click', () => {
-    //         const taskId = parseInt(el.dataset.taskId);
-    //         editTaskDate(taskId);
-    //     });
-    // });
+    bindListWindowing(tasks);
+    bindListWindowing(projects);
 }
 )XJSACTX";
 }
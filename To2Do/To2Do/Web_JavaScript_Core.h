@@ -4,6 +4,30 @@
 // Core Library - Veri Yönetimi, Server İletişimi ve Sistem Stabilitesi
 const char* getJavaScriptCore() {
   return R"XJSCOREX(
+// ==================== CONDITIONAL FETCH ====================
+// Keeps ETag + body per URL; a 304 reply reuses the cached body
+const etagCache = new Map();
+
+async function fetchCached(url) {
+    const cached = etagCache.get(url);
+    const options = { credentials: 'include' };
+    if (cached) {
+        options.headers = { 'If-None-Match': cached.etag };
+    }
+    
+    const response = await fetch(url, options);
+    if (response.status === 304 && cached) {
+        return { ok: true, status: 304, text: cached.text, etag: cached.etag };
+    }
+    
+    const text = response.ok ? await response.text() : '';
+    const etag = response.headers.get('ETag');
+    if (response.ok && etag) {
+        etagCache.set(url, { etag, text });
+    }
+    return { ok: response.ok, status: response.status, text, etag };
+}
+
 // ==================== CORE APPLICATION CLASS ====================
 class WorkspaceFinal {
     constructor() {
@@ -14,7 +38,21 @@ class WorkspaceFinal {
         this.currentFilter = 'all';
         this.nextProjectId = 1;
         this.nextTaskId = 1;
-        this.networkStatusInterval = null;
+        this.revision = 0;
+        this.dataEtag = null;        // data version of the loaded pages (ETag of /api/projects)
+        this.loadedCategories = new Set(); // categories whose projects are in this.projects
+        this.loadedProjects = new Set();   // projects whose tasks are all in this.tasks
+        this.totals = { projects: 0, tasks: 0, open: 0 };
+        this.countsTimer = null;
+        this.events = null;          // EventSource on /api/events
+        this.pushRevision = 0;       // last revision seen on the push channel
+        this.networkStatus = null;   // last pushed /api/network/status
+        this.lastTimeSync = 0;       // when any tab last set the device clock
+        this.connectionTimeout = null;
+        this.searchTerm = '';
+        this.searchMatches = null;   // project ids matched by /api/search, null = filter by name
+        this.searchTimer = null;
+        this.searchSeq = 0;
         
 
         
@@ -50,6 +88,7 @@ class WorkspaceFinal {
         await this.loadSettingsFromServer();
         applySettings();
         await this.loadFromServer();
+        this.connectEvents();
         
         // Force render after data is loaded
         setTimeout(() => {
@@ -59,71 +98,316 @@ class WorkspaceFinal {
             
             // Auto-select first project if exists
             if (this.projects.length > 0 && !this.currentProject) {
-                this.selectProject(this.projects[0].id);
+                selectProject(this.projects[0].id);
             }
         }, 100);
     }
 
     // ==================== DATA PERSISTENCE ====================
 
+    // Only what is on screen: the projects of the current category (with
+    // task counts) and the tasks of the selected project, fetched on demand
     async loadFromServer() {
+        this.loadedCategories.clear();
+        this.loadedProjects.clear();
+        this.tasks = this.tasks.filter(t => t.projectId === this.currentProject);
+        await this.loadCategory(this.currentCategory);
+        if (this.currentProject !== null) {
+            await this.loadProjectTasks(this.currentProject);
+        }
+    }
+
+    async loadCategory(category, reload = false) {
+        if (this.loadedCategories.has(category) && !reload) return;
         try {
-            const response = await fetch('/api/todos', {credentials: 'include'});
-            
+            const response = await fetchCached('/api/projects?category=' + encodeURIComponent(category));
             if (!response.ok) {
-                console.error('Failed to load todos from server:', response.status);
+                console.error('Failed to load projects from server:', response.status);
                 return;
             }
             
-            const text = await response.text();
-            
-            // If empty or invalid, keep current state (don't overwrite with demo)
-            if (!text || text === '{}' || text.trim() === '' || text === '[]') {
-                console.log('No todos found on server, keeping current state');
+            const data = JSON.parse(response.text);
+            this.projects = this.projects.filter(p => p.category !== category).concat(data.projects);
+            this.totals = data.totals;
+            this.dataEtag = response.etag;
+            this.nextProjectId = Math.max(this.nextProjectId, data.nextProjectId);
+            this.nextTaskId = Math.max(this.nextTaskId, data.nextTaskId);
+            this.loadedCategories.add(category);
+            console.log('Loaded', data.projects.length, 'projects in', category);
+        } catch (error) {
+            console.error('Load error:', error);
+        }
+    }
+
+    // Every page of one project's tasks. Pages must come from the same data
+    // version and a change pushed meanwhile means starting over; once the
+    // project is marked loaded, pushed records keep it current.
+    async loadProjectTasks(projectId) {
+        if (this.loadedProjects.has(projectId)) return;
+        try {
+            for (let attempt = 0; attempt < 3; attempt++) {
+                const revision = this.pushRevision;
+                const tasks = [];
+                let etag = null;
+                let cursor = 0;
+                while (cursor !== null) {
+                    const response = await fetchCached('/api/tasks?project=' + projectId + '&limit=100' + (cursor ? '&cursor=' + cursor : ''));
+                    if (!response.ok) {
+                        console.error('Failed to load tasks from server:', response.status);
+                        return;
+                    }
+                    if (etag && response.etag !== etag) break;
+                    etag = response.etag;
+                    const page = JSON.parse(response.text);
+                    tasks.push(...page.tasks);
+                    cursor = page.next;
+                }
+                if (cursor !== null || this.pushRevision !== revision) continue;
+                
+                this.tasks = this.tasks.filter(t => t.projectId !== projectId).concat(tasks);
+                this.loadedProjects.add(projectId);
                 return;
             }
-            
-            const data = JSON.parse(text);
-            
-            if (data.projects && data.tasks) {
-                this.projects = data.projects;
-                this.tasks = data.tasks;
-                this.nextProjectId = Math.max(...this.projects.map(p => p.id), 0) + 1;
-                this.nextTaskId = Math.max(...this.tasks.map(t => t.id), 0) + 1;
-                console.log('Loaded from server:', this.projects.length, 'projects,', this.tasks.length, 'tasks');
-            } else {
-                console.warn('Invalid data structure from server');
-            }
         } catch (error) {
             console.error('Load error:', error);
         }
     }
 
-    async saveToServer() {
+    // Single-entity mutations: each call sends only the changed record
+    async sendMutation(method, url, body) {
         try {
-            const data = {
-                projects: this.projects,
-                tasks: this.tasks
-            };
+            const options = { method, credentials: 'include' };
+            if (body !== undefined) {
+                options.headers = { 'Content-Type': 'application/json' };
+                options.body = JSON.stringify(body);
+            }
             
-            console.log('Saving to server:', data.projects.length, 'projects,', data.tasks.length, 'tasks');
-            
-            const response = await fetch('/api/todos', {
-                method: 'POST',
-                headers: { 'Content-Type': 'application/json' },
-                credentials: 'include',
-                body: JSON.stringify(data)
-            });
+            const response = await fetch(url, options);
             
             if (!response.ok) {
-                console.error('Save failed:', response.status);
+                console.error('Save failed:', method, url, response.status);
                 showToast('SAVE FAILED!', 'error');
-            } else {
-                console.log('✓ Saved to server successfully');
+                return null;
             }
+            
+            const data = await response.json();
+            this.revision = data.revision;
+            return data;
         } catch (error) {
             console.error('Server save error:', error);
             showToast('SAVE ERROR!', 'error');
+            return null;
+        }
+    }
+
+    // The server may assign a different id if ours is already taken
+    async createTaskOnServer(task) {
+        const data = await this.sendMutation('POST', '/api/tasks', task);
+        if (data && data.id !== task.id) {
+            task.id = data.id;
+            this.nextTaskId = Math.max(this.nextTaskId, data.id + 1);
+            // The pushed record may have arrived first
+            this.tasks = this.tasks.filter(t => t === task || t.id !== task.id);
+            renderTasks();
+        }
+    }
+
+    patchTaskOnServer(taskId, fields) {
+        return this.sendMutation('PATCH', '/api/tasks?id=' + taskId, fields);
+    }
+
+    deleteTaskOnServer(taskId) {
+        return this.sendMutation('DELETE', '/api/tasks?id=' + taskId);
+    }
+
+    async createProjectOnServer(project) {
+        this.loadedProjects.add(project.id); // a new project has no tasks to fetch
+        const data = await this.sendMutation('POST', '/api/projects', project);
+        if (data && data.id !== project.id) {
+            if (this.currentProject === project.id) this.currentProject = data.id;
+            project.id = data.id;
+            this.loadedProjects.add(data.id);
+            this.nextProjectId = Math.max(this.nextProjectId, data.id + 1);
+            this.projects = this.projects.filter(p => p === project || p.id !== project.id);
+            renderProjects();
+        }
+    }
+
+    patchProjectOnServer(projectId, fields) {
+        return this.sendMutation('PATCH', '/api/projects?id=' + projectId, fields);
+    }
+
+    deleteProjectOnServer(projectId) {
+        return this.sendMutation('DELETE', '/api/projects?id=' + projectId);
+    }
+
+    async addChecklistOnServer(taskId, item) {
+        const data = await this.sendMutation('POST', '/api/tasks/checklist?task=' + taskId, { text: item.text, completed: item.completed });
+        if (data && data.id !== item.id) {
+            item.id = data.id;
+            renderTasks();
+        }
+    }
+
+    patchChecklistOnServer(taskId, itemId, fields) {
+        return this.sendMutation('PATCH', '/api/tasks/checklist?task=' + taskId + '&id=' + itemId, fields);
+    }
+
+    deleteChecklistOnServer(taskId, itemId) {
+        return this.sendMutation('DELETE', '/api/tasks/checklist?task=' + taskId + '&id=' + itemId);
+    }
+
+    // ==================== PUSH EVENTS ====================
+    // /api/events keeps every open tab in sync: mutations made elsewhere arrive
+    // as journal records and are applied in place, no reload and no polling
+
+    connectEvents() {
+        if (!window.EventSource) return;
+        
+        const source = new EventSource('/api/events');
+        const on = (name, handler) => source.addEventListener(name, event => handler(JSON.parse(event.data)));
+        
+        on('hello', data => {
+            this.pushRevision = data.revision;
+            this.onNetworkStatus(data.network);
+            updateNotificationBadge(data.counts);
+            if (data.etag !== this.dataEtag) {
+                this.resync(); // changed while we were disconnected (or the device rebooted)
+            }
+        });
+        on('change', data => this.applyChange(data));
+        on('counts', data => updateNotificationBadge(data));
+        on('network', data => this.onNetworkStatus(data));
+        on('time', data => this.onTimeSync(data));
+        on('resync', () => this.resync());
+        
+        this.events = source;
+    }
+
+    eventsConnected() {
+        return this.events && this.events.readyState === EventSource.OPEN;
+    }
+
+    async resync() {
+        await this.loadFromServer();
+        this.renderPushedChanges();
+    }
+
+    applyChange(data) {
+        if (data.revision <= this.pushRevision) return; // already part of hello
+        
+        const missed = data.revision !== this.pushRevision + 1;
+        this.pushRevision = data.revision;
+        if (missed || data.truncated) {
+            this.resync();
+            return;
+        }
+        
+        for (const record of data.records || []) {
+            this.applyRecord(record);
+        }
+        this.dataEtag = data.etag;
+        this.nextProjectId = Math.max(this.nextProjectId, ...this.projects.map(p => p.id + 1));
+        this.nextTaskId = Math.max(this.nextTaskId, ...this.tasks.map(t => t.id + 1));
+        
+        if (data.records) {
+            this.renderPushedChanges();
+            this.refreshCounts();
+        }
+        if (data.settings) {
+            this.loadSettingsFromServer().then(() => applySettings());
+        }
+    }
+
+    // Same record format as the device journal (put / del / drop)
+    applyRecord(record) {
+        if (record.c === 'tasks' && !this.loadedProjects.has(record.p)) {
+            return; // fetched with the project when it is opened
+        }
+        const list = record.c === 'projects' ? this.projects : this.tasks;
+        if (record.op === 'put') {
+            const existing = list.find(item => item.id === record.v.id);
+            if (existing) {
+                Object.assign(existing, record.v); // keep references held by open editors
+            } else {
+                list.push(record.v);
+            }
+        } else if (record.op === 'del') {
+            const index = list.findIndex(item => item.id === record.id);
+            if (index >= 0) list.splice(index, 1);
+        } else if (record.op === 'drop') {
+            this.tasks = this.tasks.filter(task => task.projectId !== record.p);
+        }
+    }
+
+    renderPushedChanges() {
+        if (this.currentProject !== null && !this.projects.some(p => p.id === this.currentProject)) {
+            this.currentProject = null;
+        }
+        renderProjects();
+        renderTasks();
+        updateStats();
+        if (this.searchTerm) this.fetchSearch();
+    }
+
+    // Task counts of projects not loaded yet and the totals come from the
+    // device; refetched shortly after a burst of changes
+    refreshCounts() {
+        clearTimeout(this.countsTimer);
+        this.countsTimer = setTimeout(async () => {
+            this.loadedCategories.clear();
+            await this.loadCategory(this.currentCategory);
+            renderProjects();
+            updateStats();
+        }, 300);
+    }
+
+    // ==================== SEARCH ====================
+    // The device searches task titles, descriptions and checklists too;
+    // a project is shown if its name or any of its tasks match
+
+    runSearch(term) {
+        this.searchTerm = term.trim();
+        clearTimeout(this.searchTimer);
+        if (!this.searchTerm) {
+            this.searchMatches = null;
+            renderProjects();
+            return;
+        }
+        this.searchTimer = setTimeout(() => this.fetchSearch(), 150);
+    }
+
+    async fetchSearch() {
+        const seq = ++this.searchSeq;
+        let matches = null;
+        try {
+            const response = await fetchCached('/api/search?q=' + encodeURIComponent(this.searchTerm) + '&limit=200');
+            if (response.ok) {
+                const data = JSON.parse(response.text);
+                matches = new Set(data.projects.map(p => p.id));
+                data.tasks.forEach(task => matches.add(task.projectId));
+            }
+        } catch (error) {
+            console.error('Search error:', error);
+        }
+        if (seq !== this.searchSeq) return; // a newer query is on its way
+        this.searchMatches = matches;
+        renderProjects();
+    }
+
+    onNetworkStatus(data) {
+        this.networkStatus = data;
+        if (this.connectionTimeout && data.mode === 'STA' && data.connected) {
+            clearTimeout(this.connectionTimeout);
+            this.connectionTimeout = null;
+            showToast('WIFI CONNECTED!');
+        }
+        updateNetworkInfo();
+    }
+
+    onTimeSync(data) {
+        if (data.syncs > 0) {
+            this.lastTimeSync = Date.now();
         }
     }
 
@@ -151,9 +435,9 @@ class WorkspaceFinal {
     async loadSettingsFromServer() {
         try {
             // Load GUI settings
-            const settingsResponse = await fetch('/api/settings', {credentials: 'include'});
+            const settingsResponse = await fetchCached('/api/settings');
             if (settingsResponse.ok) {
-                const data = await settingsResponse.json();
+                const data = JSON.parse(settingsResponse.text);
                 this.settings = {
                     ...this.settings,
                     ...data
@@ -164,9 +448,9 @@ class WorkspaceFinal {
             }
             
             // Load network settings
-            const networkResponse = await fetch('/api/network/settings', {credentials: 'include'});
+            const networkResponse = await fetchCached('/api/network/settings');
             if (networkResponse.ok) {
-                const networkData = await networkResponse.json();
+                const networkData = JSON.parse(networkResponse.text);
                 this.networkSettings = {
                     ...this.networkSettings,
                     ...networkData
@@ -224,7 +508,18 @@ class WorkspaceFinal {
         }
     }
     
+    // The "network" event reports the new connection; polling only without a push channel
     startConnectionMonitoring() {
+        if (this.eventsConnected()) {
+            clearTimeout(this.connectionTimeout);
+            this.connectionTimeout = setTimeout(() => {
+                this.connectionTimeout = null;
+                showToast('CONNECTION FAILED - AP MODE ACTIVE', 'error');
+                updateNetworkInfo(true);
+            }, 30000);
+            return;
+        }
+        
         let attempts = 0;
         const maxAttempts = 10;
         
@@ -313,6 +608,8 @@ class WorkspaceFinal {
     // ==================== EVENT BINDING ====================
 
     bindEvents() {
+        bindListEvents();
+
         // FAB
         document.getElementById('fab-new-task').addEventListener('click', () => {
             showTaskModal();
@@ -320,17 +617,19 @@ class WorkspaceFinal {
 
         // Category tabs
         document.querySelectorAll('.sidebar-tab').forEach(tab => {
-            tab.addEventListener('click', (e) => {
+            tab.addEventListener('click', async (e) => {
                 this.currentCategory = e.target.dataset.category;
                 document.querySelectorAll('.sidebar-tab').forEach(t => t.classList.remove('active'));
                 e.target.classList.add('active');
                 renderProjects();
+                await this.loadCategory(this.currentCategory);
+                renderProjects();
             });
         });
 
         // Project search
         document.getElementById('project-search').addEventListener('input', (e) => {
-            renderProjects(e.target.value);
+            this.runSearch(e.target.value);
         });
 
         // New project
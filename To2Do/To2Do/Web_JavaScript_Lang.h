@@ -69,6 +69,12 @@ const LANG = {
     priority_low: "Low",
     priority_medium: "Medium",
     priority_high: "High",
+    repeat_none: "None",
+    repeat_daily: "Daily",
+    repeat_weekdays: "Weekdays",
+    repeat_weekly: "Weekly",
+    repeat_monthly: "Monthly",
+    repeat_every: "Every (days/weeks/months)",
     
     // Project modal
     modal_new_project: "NEW PROJECT",
@@ -102,6 +108,7 @@ const LANG = {
     notif_week: "THIS WEEK",
     notif_overdue: "OVERDUE",
     notif_loading: "Loading...",
+    tasks_loading: "Loading tasks...",
     notif_project: "project",
     notif_projects: "projects",
     notif_task: "task",
@@ -298,6 +305,12 @@ const LANG = {
     priority_low: "Niedrig",
     priority_medium: "Mittel",
     priority_high: "Hoch",
+    repeat_none: "Keine",
+    repeat_daily: "Taglich",
+    repeat_weekdays: "Werktags",
+    repeat_weekly: "Wochentlich",
+    repeat_monthly: "Monatlich",
+    repeat_every: "Alle (Tage/Wochen/Monate)",
     
     // Project modal
     modal_new_project: "NEUES PROJEKT",
@@ -331,6 +344,7 @@ const LANG = {
     notif_week: "DIESE WOCHE",
     notif_overdue: "UBERFALLIG",
     notif_loading: "Wird geladen...",
+    tasks_loading: "Aufgaben werden geladen...",
     notif_project: "Projekt",
     notif_projects: "Projekte",
     notif_task: "Aufgabe",
@@ -527,6 +541,12 @@ const LANG = {
     priority_low: "Dusuk",
     priority_medium: "Orta",
     priority_high: "Yuksek",
+    repeat_none: "Tekrar yok",
+    repeat_daily: "Her gun",
+    repeat_weekdays: "Hafta ici",
+    repeat_weekly: "Haftalik",
+    repeat_monthly: "Aylik",
+    repeat_every: "Her (gun/hafta/ay)",
     
     // Project modal
     modal_new_project: "YENI PROJE",
@@ -560,6 +580,7 @@ const LANG = {
     notif_week: "BU HAFTA",
     notif_overdue: "GECMIS",
     notif_loading: "Yukleniyor...",
+    tasks_loading: "Gorevler yukleniyor...",
     notif_project: "proje",
     notif_projects: "proje",
     notif_task: "gorev",
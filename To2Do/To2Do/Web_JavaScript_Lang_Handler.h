@@ -157,6 +157,17 @@ function applyAllTranslations() {
     editTaskPrioritySelect.options[2].text = t('priority_high');
   }
   
+  // Repeat options (create and edit modals)
+  ['modal', 'edit'].forEach(prefix => {
+    const repeatSelect = document.getElementById(prefix + '-task-repeat');
+    if (repeatSelect) {
+      ['repeat_none', 'repeat_daily', 'repeat_weekdays', 'repeat_weekly', 'repeat_monthly']
+        .forEach((key, i) => { repeatSelect.options[i].text = t(key); });
+    }
+    const everyInput = document.getElementById(prefix + '-task-every');
+    if (everyInput) everyInput.title = t('repeat_every');
+  });
+  
   const editTaskCancelBtn = document.getElementById('edit-task-cancel');
   if (editTaskCancelBtn) editTaskCancelBtn.textContent = t('btn_cancel');
   
@@ -4,54 +4,178 @@
 // UI Library - Arayüz Render Fonksiyonları
 const char* getJavaScriptUI() {
   return R"XJSUIX(
+// ==================== KEYED LIST RENDERING ====================
+// Lists are patched, not rebuilt: every item keeps its node together with the
+// HTML it was built from, and only items whose HTML changed are replaced.
+// Click handlers sit on the list containers (bindListEvents), so new nodes
+// need no listeners. Long lists are windowed: only items in or near the
+// viewport get nodes, two spacers stand in for the rest.
+
+const VIRTUAL_MIN_ITEMS = 60;   // shorter lists are rendered whole
+const VIRTUAL_OVERSCAN = 6;     // items kept beyond each edge of the viewport
+const VIRTUAL_ESTIMATE = 140;   // px per item until it has been measured
+
+const listViews = new Map();    // container -> [{key, render}] in display order
+const listNodes = new Map();    // container -> Map(key -> {html, node})
+const itemHeights = new Map();  // key -> measured px, margin included
+
+// items: [{key, render: () => html}]; render is only called for the window
+function renderList(container, items) {
+    listViews.set(container, items);
+    renderWindow(container);
+}
+
+function renderWindow(container) {
+    const items = listViews.get(container) || [];
+    if (items.length < VIRTUAL_MIN_ITEMS) {
+        patchList(container, items);
+        return;
+    }
+
+    const scroller = container.parentElement;
+    const viewTop = scroller.getBoundingClientRect().top - container.getBoundingClientRect().top;
+    const viewBottom = viewTop + scroller.clientHeight;
+    const height = item => itemHeights.get(item.key) || VIRTUAL_ESTIMATE;
+
+    let start = 0;
+    let offset = 0;
+    while (start < items.length && offset + height(items[start]) <= viewTop) {
+        offset += height(items[start++]);
+    }
+    let end = start;
+    while (end < items.length && offset < viewBottom) {
+        offset += height(items[end++]);
+    }
+    start = Math.max(0, start - VIRTUAL_OVERSCAN);
+    end = Math.min(items.length, end + VIRTUAL_OVERSCAN);
+
+    let above = 0;
+    let below = 0;
+    items.forEach((item, i) => {
+        if (i < start) above += height(item);
+        else if (i >= end) below += height(item);
+    });
+
+    const spacer = (key, px) => ({ key, render: () => '<div class="list-spacer" style="height:' + px + 'px"></div>' });
+    const nodes = patchList(container, [spacer('spacer-top', above), ...items.slice(start, end), spacer('spacer-bottom', below)]);
+
+    // Distance to the next node's top = height + margin
+    for (let i = 1; i < nodes.length - 1; i++) {
+        const measured = nodes[i + 1].offsetTop - nodes[i].offsetTop;
+        if (measured > 0) itemHeights.set(items[start + i - 1].key, measured);
+    }
+}
+
+// Puts exactly these items into container, reusing unchanged nodes; returns the nodes
+function patchList(container, items) {
+    let known = listNodes.get(container);
+    if (!known || container.childNodes.length !== known.size) {
+        known = new Map(); // first render, or someone else wrote into the container
+        listNodes.set(container, known);
+        container.textContent = '';
+    }
+
+    const nodes = [];
+    const seen = new Set();
+    let cursor = container.firstChild;
+    for (const item of items) {
+        const html = item.render();
+        let entry = known.get(item.key);
+        let focused = null;
+        if (entry && entry.html !== html) {
+            if (entry.node.contains(document.activeElement)) focused = document.activeElement;
+            if (entry.node === cursor) cursor = cursor.nextSibling;
+            entry.node.remove();
+            entry = null;
+        }
+        if (!entry) {
+            entry = { html, node: nodeFromHtml(html) };
+            known.set(item.key, entry);
+        }
+        if (entry.node === cursor) {
+            cursor = cursor.nextSibling;
+        } else {
+            container.insertBefore(entry.node, cursor);
+        }
+        if (focused && focused.classList.length > 0) {
+            // e.g. the checklist input of a task that just got a new item
+            const again = entry.node.querySelector('.' + focused.classList[0]);
+            if (again) again.focus();
+        }
+        seen.add(item.key);
+        nodes.push(entry.node);
+    }
+
+    for (const [key, entry] of known) {
+        if (!seen.has(key)) {
+            entry.node.remove();
+            known.delete(key);
+        }
+    }
+    return nodes;
+}
+
+function nodeFromHtml(html) {
+    const template = document.createElement('template');
+    template.innerHTML = html.trim();
+    return template.content.firstElementChild;
+}
+
+// Scrolling only moves the window of long lists; at most once per frame
+function bindListWindowing(container) {
+    let frame = 0;
+    const update = () => {
+        if (frame || (listViews.get(container) || []).length < VIRTUAL_MIN_ITEMS) return;
+        frame = requestAnimationFrame(() => {
+            frame = 0;
+            renderWindow(container);
+        });
+    };
+    container.parentElement.addEventListener('scroll', update, { passive: true });
+    window.addEventListener('resize', update);
+}
+
 // ==================== UI RENDERING FUNCTIONS ====================
 // Project and Task Render Functions
 
-function renderProjects(searchTerm = '') {
+function renderProjects() {
     const container = document.getElementById('projects-list');
+    const term = app.searchTerm.toLowerCase();
     const filtered = app.projects
         .filter(p => p.category === app.currentCategory)
-        .filter(p => !searchTerm || p.name.toLowerCase().includes(searchTerm.toLowerCase()));
+        .filter(p => !term || (app.searchMatches ? app.searchMatches.has(p.id) : p.name.toLowerCase().includes(term)));
 
     const active = filtered.filter(p => !p.archived);
     const archived = filtered.filter(p => p.archived);
 
-    let html = '';
+    const items = [];
 
     if (active.length > 0) {
-        html += '<div class="project-group-label">' + t('projects_header') + '</div>';
+        items.push({ key: 'label-active', render: () => '<div class="project-group-label">' + t('projects_header') + '</div>' });
         active.forEach(project => {
-            html += renderProject(project);
+            items.push({ key: 'p' + project.id, render: () => renderProject(project) });
         });
     }
 
     if (archived.length > 0) {
-        html += '<div class="project-group-label" style="margin-top: 20px;">' + t('archive_header') + '</div>';
+        items.push({ key: 'label-archive', render: () => '<div class="project-group-label" style="margin-top: 20px;">' + t('archive_header') + '</div>' });
         archived.forEach(project => {
-            html += renderProject(project);
+            items.push({ key: 'p' + project.id, render: () => renderProject(project) });
         });
     }
 
     if (filtered.length === 0) {
-        html = '<div class="empty-state"><h3>No projects found</h3></div>';
+        items.push({ key: 'empty', render: () => '<div class="empty-state"><h3>No projects found</h3></div>' });
     }
 
-    container.innerHTML = html;
-
-    container.querySelectorAll('.sidebar-project').forEach(el => {
-        el.addEventListener('click', () => {
-            selectProject(parseInt(el.dataset.projectId));
-        });
-
-        el.addEventListener('contextmenu', (e) => {
-            e.preventDefault();
-            showContextMenu(e, parseInt(el.dataset.projectId));
-        });
-    });
+    renderList(container, items);
 }
 
 function renderProject(project) {
-    const taskCount = app.tasks.filter(t => t.projectId === project.id).length;
+    // Loaded projects count locally, the others use the device's count
+    const taskCount = app.loadedProjects.has(project.id)
+        ? app.tasks.filter(t => t.projectId === project.id).length
+        : (project.taskCount || 0);
     const activeClass = app.currentProject === project.id ? 'active' : '';
 
     return `
@@ -72,6 +196,11 @@ function selectProject(projectId) {
     app.currentProject = projectId;
     renderProjects();
     renderTasks();
+    if (!app.loadedProjects.has(projectId)) {
+        app.loadProjectTasks(projectId).then(() => {
+            if (app.currentProject === projectId) renderTasks();
+        });
+    }
     
     const project = app.projects.find(p => p.id === projectId);
     if (project) {
@@ -83,8 +212,15 @@ function selectProject(projectId) {
 function renderTasks() {
     const container = document.getElementById('tasks-container');
     
+    const emptyState = html => renderList(container, [{ key: 'empty', render: () => '<div class="empty-state">' + html + '</div>' }]);
+
     if (!app.currentProject) {
-        container.innerHTML = '<div class="empty-state"><h3>' + t('empty_no_project') + '</h3><p>' + t('empty_select_project') + '</p></div>';
+        emptyState('<h3>' + t('empty_no_project') + '</h3><p>' + t('empty_select_project') + '</p>');
+        return;
+    }
+
+    if (!app.loadedProjects.has(app.currentProject)) {
+        emptyState('<h3>' + t('tasks_loading') + '</h3>');
         return;
     }
 
@@ -112,12 +248,17 @@ function renderTasks() {
     });
 
     if (filtered.length === 0) {
-        container.innerHTML = '<div class="empty-state"><h3>' + t('empty_title') + '</h3><p>' + t('empty_desc') + '</p></div>';
+        emptyState('<h3>' + t('empty_title') + '</h3><p>' + t('empty_desc') + '</p>');
         return;
     }
 
-    container.innerHTML = filtered.map(task => renderTask(task)).join('');
-    bindTaskEvents();
+    renderList(container, filtered.map(task => ({ key: 't' + task.id, render: () => renderTask(task) })));
+}
+
+function repeatLabel(repeat) {
+    const weekdays = repeat.freq === 'weekly' && (repeat.days || []).join() === '0,1,2,3,4';
+    const label = t(weekdays ? 'repeat_weekdays' : 'repeat_' + repeat.freq);
+    return repeat.every > 1 ? label + ' ×' + repeat.every : label;
 }
 
 function renderTask(task) {
@@ -199,6 +340,7 @@ function renderTask(task) {
                     <div class="task-footer">
                         <div class="task-meta">
                             <span class="task-date-display" data-task-id="${task.id}">${formatDate(task.date)}</span>
+                            ${task.repeat ? `<span>|</span><span>↻ ${repeatLabel(task.repeat)}</span>` : ''}
                             <span>|</span>
                             <span>${task.priority.toUpperCase()}</span>
                         </div>
@@ -217,9 +359,10 @@ function renderTask(task) {
 }
 
 function updateStats() {
-    const totalTasks = app.tasks.length;
-    const activeTasks = app.tasks.filter(t => !t.completed).length;
-    const totalProjects = app.projects.filter(p => !p.archived).length;
+    // Totals over every project, loaded or not (see app.refreshCounts)
+    const totalTasks = app.totals.tasks;
+    const activeTasks = app.totals.open;
+    const totalProjects = app.totals.projects;
 
     document.getElementById('total-tasks').textContent = totalTasks;
     document.getElementById('active-tasks').textContent = activeTasks;
@@ -262,79 +405,18 @@ function applySettings() {
     updateNetworkInfo();
 }
 
-function updateNetworkInfo() {
-    // Fetch current network status from ESP32
+// Renders the status pushed on /api/events; fetches it when there is none yet
+// or a fresh reading (RSSI) is wanted
+function updateNetworkInfo(refresh = false) {
+    if (!refresh && app && app.networkStatus) {
+        renderNetworkInfo(app.networkStatus);
+        return;
+    }
     fetch('/api/network/status')
         .then(response => response.json())
         .then(data => {
-            // INFO tab - Top status bar
-            const infoWiFi = document.getElementById('info-wifi-status');
-            const infoIP = document.getElementById('info-ip');
-            const infoMDNS = document.getElementById('info-mdns');
-            
-            if (infoWiFi) {
-                infoWiFi.textContent = data.mode === 'AP' ? 'AP Mode' : data.ssid;
-            }
-            
-            if (infoIP) {
-                infoIP.textContent = data.ip || '192.168.4.1';
-            }
-            
-            if (infoMDNS) {
-                infoMDNS.textContent = data.mdns || 'smartkraft-to2do.local';
-            }
-            
-            // CONNECTION tab - Accordion statuses
-            const apStatus = document.getElementById('ap-status');
-            const primaryStatus = document.getElementById('primary-status');
-            const backupStatus = document.getElementById('backup-status');
-            
-            if (apStatus) {
-                apStatus.textContent = data.mode === 'AP' ? 'Active' : 'Inactive';
-                apStatus.className = data.mode === 'AP' ? 'accordion-status active' : 'accordion-status';
-            }
-            
-            if (primaryStatus) {
-                if (data.mode === 'STA' && data.connected) {
-                    primaryStatus.textContent = 'Connected';
-                    primaryStatus.className = 'accordion-status connected';
-                } else {
-                    primaryStatus.textContent = 'Not Connected';
-                    primaryStatus.className = 'accordion-status';
-                }
-            }
-            
-            if (backupStatus) {
-                // Backup sadece configure edilmişse göster
-                backupStatus.textContent = app.networkSettings.backupSSID ? 'Configured' : 'Not Configured';
-                backupStatus.className = 'accordion-status';
-            }
-            
-            // CONNECTION tab - Current Connection Status
-            const currentMode = document.getElementById('current-mode');
-            const currentSSID = document.getElementById('current-ssid');
-            const currentIP = document.getElementById('current-ip');
-            const currentSignal = document.getElementById('current-signal');
-            
-            if (currentMode) {
-                currentMode.textContent = data.mode === 'AP' ? 'AP Mode' : 'WiFi Connected';
-            }
-            
-            if (currentSSID) {
-                currentSSID.textContent = data.mode === 'AP' ? '-' : (data.ssid || '-');
-            }
-            
-            if (currentIP) {
-                currentIP.textContent = data.ip || '192.168.4.1';
-            }
-            
-            if (currentSignal) {
-                if (data.mode === 'STA' && data.rssi) {
-                    currentSignal.textContent = data.rssi + ' dBm';
-                } else {
-                    currentSignal.textContent = '-';
-                }
-            }
+            if (app) app.networkStatus = data;
+            renderNetworkInfo(data);
         })
         .catch(error => {
             // Fallback to AP mode defaults
@@ -357,6 +439,77 @@ function updateNetworkInfo() {
         });
 }
 
+function renderNetworkInfo(data) {
+    // INFO tab - Top status bar
+    const infoWiFi = document.getElementById('info-wifi-status');
+    const infoIP = document.getElementById('info-ip');
+    const infoMDNS = document.getElementById('info-mdns');
+    
+    if (infoWiFi) {
+        infoWiFi.textContent = data.mode === 'AP' ? 'AP Mode' : data.ssid;
+    }
+    
+    if (infoIP) {
+        infoIP.textContent = data.ip || '192.168.4.1';
+    }
+    
+    if (infoMDNS) {
+        infoMDNS.textContent = data.mdns || 'smartkraft-to2do.local';
+    }
+    
+    // CONNECTION tab - Accordion statuses
+    const apStatus = document.getElementById('ap-status');
+    const primaryStatus = document.getElementById('primary-status');
+    const backupStatus = document.getElementById('backup-status');
+    
+    if (apStatus) {
+        apStatus.textContent = data.mode === 'AP' ? 'Active' : 'Inactive';
+        apStatus.className = data.mode === 'AP' ? 'accordion-status active' : 'accordion-status';
+    }
+    
+    if (primaryStatus) {
+        if (data.mode === 'STA' && data.connected) {
+            primaryStatus.textContent = 'Connected';
+            primaryStatus.className = 'accordion-status connected';
+        } else {
+            primaryStatus.textContent = 'Not Connected';
+            primaryStatus.className = 'accordion-status';
+        }
+    }
+    
+    if (backupStatus) {
+        // Backup sadece configure edilmişse göster
+        backupStatus.textContent = app.networkSettings.backupSSID ? 'Configured' : 'Not Configured';
+        backupStatus.className = 'accordion-status';
+    }
+    
+    // CONNECTION tab - Current Connection Status
+    const currentMode = document.getElementById('current-mode');
+    const currentSSID = document.getElementById('current-ssid');
+    const currentIP = document.getElementById('current-ip');
+    const currentSignal = document.getElementById('current-signal');
+    
+    if (currentMode) {
+        currentMode.textContent = data.mode === 'AP' ? 'AP Mode' : 'WiFi Connected';
+    }
+    
+    if (currentSSID) {
+        currentSSID.textContent = data.mode === 'AP' ? '-' : (data.ssid || '-');
+    }
+    
+    if (currentIP) {
+        currentIP.textContent = data.ip || '192.168.4.1';
+    }
+    
+    if (currentSignal) {
+        if (data.mode === 'STA' && data.rssi) {
+            currentSignal.textContent = data.rssi + ' dBm';
+        } else {
+            currentSignal.textContent = '-';
+        }
+    }
+}
+
 function showToast(message, type = 'success') {
     const existing = document.querySelector('.toast');
     if (existing) existing.remove();
@@ -3,6 +3,8 @@
 
 #include <WiFi.h>
 #include <ESPmDNS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include "Persistence_Manager.h"
 
 class WiFiManager {
@@ -10,19 +12,19 @@ private:
     PersistenceManager* persistence;
     
     // AP Mode configuration (loaded from persistence)
-    String apSSID = "SmartKraft-To2Do";
-    String apMDNS = "to2do";
+    String apSSID = SettingsDefaults::AP_SSID;
+    String apMDNS = SettingsDefaults::AP_MDNS;
     
     // Network credentials (loaded from persistence)
     String primarySSID = "";
     String primaryPassword = "";
     String primaryIP = "";
-    String primaryMDNS = "smartkraft-to2do";
+    String primaryMDNS = SettingsDefaults::PRIMARY_MDNS;
     
     String backupSSID = "";
     String backupPassword = "";
     String backupIP = "";
-    String backupMDNS = "smartkraft-to2do-backup";
+    String backupMDNS = SettingsDefaults::BACKUP_MDNS;
     
     // State flags
     bool isAPMode = false;
@@ -49,6 +51,32 @@ private:
     String currentConnectingMDNS = "";
     String currentConnectingSSID = "";
     
+    // loop() and applyNewSettings() (net task) rewrite the mode flags and the
+    // apSSID/apMDNS/currentConnecting* Strings while getStatusJSON() runs in
+    // async_tcp. Writers assign and readers copy under this mutex; it is never
+    // held across a scan, delay() or WiFi/MDNS call.
+    SemaphoreHandle_t stateMutex = xSemaphoreCreateMutex();
+    
+    class StateLock {
+    public:
+        explicit StateLock(SemaphoreHandle_t mutex) : mutex(mutex) {
+            xSemaphoreTake(mutex, portMAX_DELAY);
+        }
+        ~StateLock() {
+            xSemaphoreGive(mutex);
+        }
+        StateLock(const StateLock&) = delete;
+        StateLock& operator=(const StateLock&) = delete;
+    private:
+        SemaphoreHandle_t mutex;
+    };
+    
+    void setState(bool apMode, bool connected) {
+        StateLock lock(stateMutex);
+        isAPMode = apMode;
+        isConnected = connected;
+    }
+    
     // Scan for saved networks and return which one to connect - OPTIMIZED
     int scanForBestNetwork() {
         Serial.println("[WiFi] Scanning for networks...");
@@ -121,7 +149,7 @@ private:
         
         if (isAPMode) {
             WiFi.softAPdisconnect(true);
-            isAPMode = false;
+            setState(false, isConnected);
             delay(50);
             WiFi.mode(WIFI_STA);  // Switch back to STA mode
             delay(100);
@@ -163,8 +191,11 @@ private:
         
         tryingToConnect = true;
         connectionStartTime = millis();
-        currentConnectingSSID = ssid;
-        currentConnectingMDNS = mdns;
+        {
+            StateLock lock(stateMutex);
+            currentConnectingSSID = ssid;
+            currentConnectingMDNS = mdns;
+        }
         
         Serial.printf("[WiFi] Connection init took %lums\n", millis() - startTime);
     }
@@ -196,8 +227,7 @@ private:
         
         IPAddress IP = WiFi.softAPIP();
         
-        isAPMode = true;
-        isConnected = false;
+        setState(true, false);
         tryingToConnect = false;
         apModeStartTime = millis();
         lastScanTime = millis();
@@ -257,8 +287,7 @@ public:
                 if (WiFi.status() == WL_CONNECTED) {
                     delay(300);
                     
-                    isAPMode = false;
-                    isConnected = true;
+                    setState(false, true);
                     tryingToConnect = false;
                     connectionFailCount = 0;
                     lastConnectionCheck = millis();
@@ -300,12 +329,12 @@ public:
                     int availableNetwork = scanForBestNetwork();
                     if (availableNetwork > 0) {
                         connectionFailCount = 0;
-                        isConnected = false;
+                        setState(isAPMode, false);
                         Serial.println("[WiFi] Network found, reconnecting...");
                         startConnectionSequence(availableNetwork);
                     } else {
                         connectionFailCount = 0;
-                        isConnected = false;
+                        setState(isAPMode, false);
                         switchToAPMode();
                     }
                 }
@@ -336,8 +365,7 @@ public:
             if (status == WL_CONNECTED) {
                 delay(300);
                 
-                isAPMode = false;
-                isConnected = true;
+                setState(false, true);
                 tryingToConnect = false;
                 connectionFailCount = 0;
                 lastConnectionCheck = now;
@@ -367,78 +395,89 @@ public:
     }
     
     // Apply new network settings from user
-    void applyNewSettings(const String& apSSIDNew, const String& apMDNSNew,
-                          const String& priSSID, const String& priPass, 
-                          const String& priIP, const String& priMDNS,
-                          const String& bkpSSID, const String& bkpPass,
-                          const String& bkpIP, const String& bkpMDNS) {
-        
-        apSSID = apSSIDNew.isEmpty() ? "SmartKraft-To2Do" : apSSIDNew;
-        apMDNS = apMDNSNew.isEmpty() ? "to2do" : apMDNSNew;
+    void applyNewSettings(const NetworkSettings& network) {
+        {
+            StateLock lock(stateMutex);
+            apSSID = network.apSSID.isEmpty() ? SettingsDefaults::AP_SSID : network.apSSID;
+            apMDNS = network.apMDNS.isEmpty() ? SettingsDefaults::AP_MDNS : network.apMDNS;
+        }
         
-        primarySSID = priSSID;
-        primaryPassword = priPass;
-        primaryIP = priIP;
-        primaryMDNS = priMDNS.isEmpty() ? "smartkraft-to2do" : priMDNS;
+        primarySSID = network.primarySSID;
+        primaryPassword = network.primaryPassword;
+        primaryIP = network.primaryIP;
+        primaryMDNS = network.primaryMDNS.isEmpty() ? SettingsDefaults::PRIMARY_MDNS : network.primaryMDNS;
         
-        backupSSID = bkpSSID;
-        backupPassword = bkpPass;
-        backupIP = bkpIP;
-        backupMDNS = bkpMDNS.isEmpty() ? "smartkraft-to2do-backup" : bkpMDNS;
+        backupSSID = network.backupSSID;
+        backupPassword = network.backupPassword;
+        backupIP = network.backupIP;
+        backupMDNS = network.backupMDNS.isEmpty() ? SettingsDefaults::BACKUP_MDNS : network.backupMDNS;
         
         if (!primarySSID.isEmpty() || !backupSSID.isEmpty()) {
             startConnectionSequence();
         }
     }
     
-    // Load network settings from persistence
+    // Load network settings from persistence (typed copy kept by DataManager)
     void loadNetworkSettings() {
-        String networkJson = persistence->loadNetworkSettings();
-        
-        DynamicJsonDocument doc(2048);
-        DeserializationError error = deserializeJson(doc, networkJson);
+        const NetworkSettings& network = persistence->getDataManager()->getCachedNetworkSettings();
         
-        if (error) {
-            return;
+        {
+            StateLock lock(stateMutex);
+            apSSID = network.apSSID;
+            apMDNS = network.apMDNS;
         }
         
-        apSSID = doc["apSSID"] | "SmartKraft-To2Do";
-        apMDNS = doc["apMDNS"] | "to2do";
-        
-        primarySSID = doc["primarySSID"] | "";
-        primaryPassword = doc["primaryPassword"] | "";
-        primaryIP = doc["primaryIP"] | "";
-        primaryMDNS = doc["primaryMDNS"] | "smartkraft-to2do";
+        primarySSID = network.primarySSID;
+        primaryPassword = network.primaryPassword;
+        primaryIP = network.primaryIP;
+        primaryMDNS = network.primaryMDNS;
         
-        backupSSID = doc["backupSSID"] | "";
-        backupPassword = doc["backupPassword"] | "";
-        backupIP = doc["backupIP"] | "";
-        backupMDNS = doc["backupMDNS"] | "smartkraft-to2do-backup";
+        backupSSID = network.backupSSID;
+        backupPassword = network.backupPassword;
+        backupIP = network.backupIP;
+        backupMDNS = network.backupMDNS;
     }
     
-    // Get status as JSON
+    // Get status as JSON (called from async_tcp: copies the shared state first)
     String getStatusJSON() {
+        bool apMode, connected;
+        String apName, mdns;
+        {
+            StateLock lock(stateMutex);
+            apMode = isAPMode;
+            connected = isConnected;
+            apName = apSSID;
+            mdns = apMode ? apMDNS : currentConnectingMDNS;
+        }
+        
         String json = "{";
-        json += "\"mode\":\"" + String(isAPMode ? "AP" : "STA") + "\",";
-        json += "\"ssid\":\"" + String(isAPMode ? apSSID : WiFi.SSID()) + "\",";
-        json += "\"ip\":\"" + (isAPMode ? WiFi.softAPIP().toString() : WiFi.localIP().toString()) + "\",";
-        json += "\"mdns\":\"" + String(isAPMode ? apMDNS : currentConnectingMDNS) + ".local\",";
-        json += "\"rssi\":" + String(isAPMode ? 0 : WiFi.RSSI()) + ",";
-        json += "\"connected\":" + String(isConnected ? "true" : "false") + ",";
-        json += "\"apActive\":" + String(isAPMode ? "true" : "false");  // AP is OFF when WiFi connected
+        json += "\"mode\":\"" + String(apMode ? "AP" : "STA") + "\",";
+        json += "\"ssid\":\"" + String(apMode ? apName : WiFi.SSID()) + "\",";
+        json += "\"ip\":\"" + (apMode ? WiFi.softAPIP().toString() : WiFi.localIP().toString()) + "\",";
+        json += "\"mdns\":\"" + mdns + ".local\",";
+        json += "\"rssi\":" + String(apMode ? 0 : WiFi.RSSI()) + ",";
+        json += "\"connected\":" + String(connected ? "true" : "false") + ",";
+        json += "\"apActive\":" + String(apMode ? "true" : "false");  // AP is OFF when WiFi connected
         json += "}";
         return json;
     }
     
     // Public getters
-    bool isAP() const { return isAPMode; }
-    bool isWiFiConnected() const { return isConnected; }
+    bool isAP() const {
+        StateLock lock(stateMutex);
+        return isAPMode;
+    }
+    bool isWiFiConnected() const {
+        StateLock lock(stateMutex);
+        return isConnected;
+    }
     
     String getIP() const {
-        return isAPMode ? WiFi.softAPIP().toString() : WiFi.localIP().toString();
+        return isAP() ? WiFi.softAPIP().toString() : WiFi.localIP().toString();
     }
     
     String getMDNS() const {
+        StateLock lock(stateMutex);
         return String(isAPMode ? apMDNS : currentConnectingMDNS) + ".local";
     }
 };
@@ -0,0 +1,362 @@
+/*
+ * MANAGERS BENCHMARK (host)
+ * GET /api/bench/managers ile aynı ölçümler, PC'de google-benchmark ile:
+ * kaydetme (replaceAll), açılışta yükleme, bildirim sayaçları ve hafta
+ * listesi, arama, yedek dışa/içe aktarma - 10, 100, 1.000 ve 10.000 görev;
+ * ayrıca /api/time ve /api/language cevaplarını üreten TimeManager ve
+ * LanguageManager çağrıları. Her ölçüm iterasyon başına heap ayırma sayısını
+ * (allocs) ve bayt miktarını (allocBytes) da raporlar.
+ *
+ * Gerçek DataManager / NotificationManager / BackupManager kodu çalışır;
+ * dosyalar PosixBackend ile TO2DO_FS_ROOT (yoksa geçici bir dizin) altına
+ * yazılır. Mutlak süreler cihazdakiyle karşılaştırılamaz; bir değişikliğin
+ * önce/sonra farkını görmek için aynı makinede iki derlemeyi koşun:
+ *
+ *   ./to2do_bench --benchmark_out=before.json --benchmark_out_format=json
+ */
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <new>
+
+#include "Data_Manager.h"
+#include "Notification_Manager.h"
+#include "Backup_Manager.h"
+#include "Time_Manager.h"
+#include "Language_Manager.h"
+
+// ==================== ALLOCATION COUNTING ====================
+// Every heap allocation of the process passes through here: malloc itself on
+// glibc (operator new and ArduinoJson's allocator both end up in it),
+// operator new elsewhere
+
+namespace {
+std::atomic<uint64_t> allocationCount{0};
+std::atomic<uint64_t> allocationBytes{0};
+
+inline void noteAllocation(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+}
+}  // namespace
+
+#ifdef __GLIBC__
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+
+void* malloc(size_t size) {
+    noteAllocation(size);
+    return __libc_malloc(size);
+}
+void* calloc(size_t count, size_t size) {
+    noteAllocation(count * size);
+    return __libc_calloc(count, size);
+}
+void* realloc(void* pointer, size_t size) {
+    noteAllocation(size);
+    return __libc_realloc(pointer, size);
+}
+}
+#else
+void* operator new(size_t size) {
+    noteAllocation(size);
+    if (void* pointer = std::malloc(size ? size : 1)) return pointer;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { std::free(pointer); }
+#endif
+
+namespace {
+
+// Allocations between construction and report(), per iteration:
+//   Allocations allocations;  for (auto _ : state) {...}  allocations.report(state);
+class Allocations {
+public:
+    Allocations() : count(allocationCount.load()), bytes(allocationBytes.load()) {}
+
+    void report(benchmark::State& state) const {
+        double allocs = (double)(allocationCount.load() - count);
+        double allocBytes = (double)(allocationBytes.load() - bytes);
+        state.counters["allocs"] = benchmark::Counter(allocs, benchmark::Counter::kAvgIterations);
+        state.counters["allocBytes"] = benchmark::Counter(allocBytes, benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    uint64_t count;
+    uint64_t bytes;
+};
+
+const int TASKS_PER_PROJECT = 25;
+const DateCore::Day BASE_DAY = DateCore::daysFromCivil(2025, 10, 21);
+
+int projectCount(int n) {
+    return n / TASKS_PER_PROJECT > 0 ? n / TASKS_PER_PROJECT : 1;
+}
+
+// Same shape as Benchmark_Manager::fillTask, with varied titles for search
+void fillTask(JsonDocument& task, int i, int projectId) {
+    static const char* priorities[] = {"high", "medium", "low"};
+    static const char* words[] = {"report", "invoice", "garden", "meeting", "review", "backup",
+                                  "email", "budget", "dentist", "train", "paint", "server"};
+    DateCore::Day day = BASE_DAY + (i * 37) % 121 - 60;
+    char date[11];
+    DateCore::formatDate(day, date);
+
+    String title = String(words[i % 12]) + " " + words[(i * 7 + 3) % 12] + " " + String(i);
+    task.clear();
+    task["id"] = i + 1;
+    task["projectId"] = projectId;
+    task["title"] = title;
+    task["date"] = date;
+    task["completed"] = (i % 5) == 0;
+    task["priority"] = priorities[i % 3];
+}
+
+String dataDir(int n) {
+    return "/bench" + String(n) + "/";
+}
+
+// Writes an n-task data set into dir through DataManager::replaceAll
+bool saveDataset(const String& dir, int n, uint32_t* savedBytes = nullptr) {
+    int projects = projectCount(n);
+    JsonDocument projectList;
+    JsonArray projectArray = projectList.to<JsonArray>();
+    for (int p = 1; p <= projects; p++) {
+        JsonObject project = projectArray.add<JsonObject>();
+        project["id"] = p;
+        project["name"] = "Project " + String(p);
+        project["category"] = p % 2 ? "Work" : "Home";
+    }
+    JsonDocument settings;
+    settings.to<JsonObject>();
+
+    DataManager writer(dir.c_str());
+    JsonDocument task;
+    bool saved = writer.replaceAll(projectList.as<JsonArrayConst>(), settings.as<JsonObjectConst>(),
+                                   [&](int projectId, JsonArray tasks) {
+        for (int i = projectId - 1; i < n; i += projects) {
+            fillTask(task, i, projectId);
+            if (!tasks.add(task)) return false;
+        }
+        return true;
+    });
+    if (savedBytes) *savedBytes = writer.getStorageStats().lastSaveBytes;
+    return saved;
+}
+
+TimeManager& benchClock() {
+    static TimeManager timeManager;
+    static bool set = false;
+    if (!set) {
+        timeManager.setManualDate(2025, 10, 21, 12, 0);
+        set = true;
+    }
+    return timeManager;
+}
+
+// One saved and loaded data set per size, shared by the read benchmarks
+DataManager& loadedDataset(int n) {
+    static std::map<int, std::unique_ptr<DataManager>> loaded;
+    auto it = loaded.find(n);
+    if (it != loaded.end()) return *it->second;
+
+    String dir = dataDir(n);
+    saveDataset(dir, n);
+    auto data = std::make_unique<DataManager>(dir.c_str());
+    if (!data->loadFromFile() || data->getTaskCount() != (size_t)n) {
+        fprintf(stderr, "[Bench] dataset of %d tasks did not load\n", n);
+        abort();
+    }
+    return *(loaded[n] = std::move(data));
+}
+
+// Print sink that only counts, so export time excludes any storage
+class CountingPrint : public Print {
+public:
+    size_t bytes = 0;
+    size_t write(uint8_t) override { bytes++; return 1; }
+    size_t write(const uint8_t*, size_t size) override { bytes += size; return size; }
+};
+
+// ==================== BENCHMARKS ====================
+
+void BM_Save(benchmark::State& state) {
+    int n = (int)state.range(0);
+    String dir = "/save" + String(n) + "/";
+    uint32_t savedBytes = 0;
+    Allocations allocations;
+    for (auto _ : state) {
+        if (!saveDataset(dir, n, &savedBytes)) state.SkipWithError("replaceAll failed");
+    }
+    allocations.report(state);
+    state.counters["savedBytes"] = savedBytes;
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+void BM_Load(benchmark::State& state) {
+    int n = (int)state.range(0);
+    loadedDataset(n);  // makes sure the files exist
+    String dir = dataDir(n);
+    Allocations allocations;
+    for (auto _ : state) {
+        DataManager data(dir.c_str());
+        if (!data.loadFromFile()) state.SkipWithError("load failed");
+        benchmark::DoNotOptimize(data.getTaskCount());
+    }
+    allocations.report(state);
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+void BM_TaskCounts(benchmark::State& state) {
+    DataManager& data = loadedDataset((int)state.range(0));
+    Allocations allocations;
+    for (auto _ : state) {
+        NotificationManager notifications(&data);  // new instance: no cached counts
+        notifications.setTimeManager(&benchClock());
+        benchmark::DoNotOptimize(notifications.getTaskCounts());
+    }
+    allocations.report(state);
+}
+
+void BM_WeekNotifications(benchmark::State& state) {
+    DataManager& data = loadedDataset((int)state.range(0));
+    NotificationManager notifications(&data);
+    notifications.setTimeManager(&benchClock());
+    size_t bytes = 0;
+    Allocations allocations;
+    for (auto _ : state) {
+        bytes = notifications.getNotifications("week").length();
+    }
+    allocations.report(state);
+    state.counters["bytes"] = bytes;
+}
+
+void BM_Search(benchmark::State& state) {
+    DataManager& data = loadedDataset((int)state.range(0));
+    static const char* queries[] = {"rep", "invoice gar", "b", "server 42", "meet"};
+    size_t i = 0;
+    Allocations allocations;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(data.search(queries[i++ % 5], 20));
+    }
+    allocations.report(state);
+}
+
+void BM_Export(benchmark::State& state) {
+    int n = (int)state.range(0);
+    DataManager& data = loadedDataset(n);
+    BackupManager backup(&data);
+    size_t bytes = 0;
+    Allocations allocations;
+    for (auto _ : state) {
+        CountingPrint out;
+        if (!backup.exportBackup(out)) state.SkipWithError("export failed");
+        bytes = out.bytes;
+    }
+    allocations.report(state);
+    state.counters["bytes"] = bytes;
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+void BM_Import(benchmark::State& state) {
+    int n = (int)state.range(0);
+    String dir = "/import" + String(n) + "/";
+    saveDataset(dir, n);
+    DataManager data(dir.c_str());
+    data.loadFromFile();
+    BackupManager backup(&data);
+
+    String backupPath = dir + "backup.json";
+    File file = storage().open(backupPath, "w");
+    backup.exportBackup(file);
+    file.close();
+
+    Allocations allocations;
+    for (auto _ : state) {
+        File upload = storage().open(backupPath, "r");
+        String error;
+        if (!backup.importBackup(upload, error)) state.SkipWithError(error.c_str());
+        upload.close();
+    }
+    allocations.report(state);
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+// The strings GET /api/time answers with
+void BM_TimeStatus(benchmark::State& state) {
+    TimeManager& clock = benchClock();
+    Allocations allocations;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(clock.getFormattedDate());
+        benchmark::DoNotOptimize(clock.getFormattedTime());
+        benchmark::DoNotOptimize(clock.getLastSyncTime());
+        benchmark::DoNotOptimize(clock.getCurrentDateString());
+    }
+    allocations.report(state);
+}
+
+// POST /api/language and the JSON GET /api/language answers with
+void BM_Language(benchmark::State& state) {
+    static const char* languages[] = {"en", "DE", "tr"};
+    LanguageManager language;
+    size_t i = 0;
+    Allocations allocations;
+    for (auto _ : state) {
+        language.setLanguage(languages[i++ % 3]);
+        benchmark::DoNotOptimize(language.getLanguageInfo());
+    }
+    allocations.report(state);
+}
+
+void sizes(benchmark::internal::Benchmark* b) {
+    for (int n : {10, 100, 1000, 10000}) b->Arg(n);
+    b->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK(BM_Save)->Apply(sizes);
+BENCHMARK(BM_Load)->Apply(sizes);
+BENCHMARK(BM_TaskCounts)->Apply(sizes);
+BENCHMARK(BM_WeekNotifications)->Apply(sizes);
+BENCHMARK(BM_Search)->Apply(sizes);
+BENCHMARK(BM_Export)->Apply(sizes);
+BENCHMARK(BM_Import)->Apply(sizes);
+BENCHMARK(BM_TimeStatus);
+BENCHMARK(BM_Language);
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+    // A scratch directory unless the caller chose one
+    std::filesystem::path scratch;
+    if (!getenv("TO2DO_FS_ROOT")) {
+        scratch = std::filesystem::temp_directory_path() / ("to2do_bench_" + std::to_string(esp_random()));
+        setenv("TO2DO_FS_ROOT", scratch.c_str(), 1);
+    }
+    Serial.setOutput(nullptr);  // the managers log every save
+    if (!storage().begin(true)) {
+        fprintf(stderr, "[Bench] cannot create %s\n", getenv("TO2DO_FS_ROOT"));
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    if (!scratch.empty()) {
+        std::error_code error;
+        std::filesystem::remove_all(scratch, error);
+    }
+    return 0;
+}
@@ -0,0 +1,309 @@
+#ifndef TO2DO_HOST_ARDUINO_H
+#define TO2DO_HOST_ARDUINO_H
+
+/*
+ * HOST SHIM: Arduino.h
+ * Sketch başlıklarını (Data_Manager.h, Backup_Manager.h, ...) PC'de derlemek
+ * için Arduino çekirdeğinin kullanılan kısmı: String, Print, Stream, Serial,
+ * millis/micros, constrain ve esp_random. Davranış ESP32 çekirdeğini izler; sadece
+ * sketch'in çağırdığı üyeler var, eksik olan derleme hatası verir.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+
+using std::max;
+using std::min;
+
+#define DEC 10
+#define HEX 16
+
+// ==================== STRING ====================
+
+class String {
+public:
+    String() {}
+    String(const char* text) : value(text ? text : "") {}
+    String(const char* text, size_t length) : value(text ? std::string(text, length) : std::string()) {}
+    String(const std::string& text) : value(text) {}
+    explicit String(char c) : value(1, c) {}
+    explicit String(int number, unsigned char base = DEC) : value(integer((long long)number, base)) {}
+    explicit String(unsigned int number, unsigned char base = DEC) : value(integer((unsigned long long)number, base)) {}
+    explicit String(long number, unsigned char base = DEC) : value(integer((long long)number, base)) {}
+    explicit String(unsigned long number, unsigned char base = DEC) : value(integer((unsigned long long)number, base)) {}
+    explicit String(long long number, unsigned char base = DEC) : value(integer(number, base)) {}
+    explicit String(unsigned long long number, unsigned char base = DEC) : value(integer(number, base)) {}
+    explicit String(double number, unsigned int decimals = 2) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, number);
+        value = buffer;
+    }
+
+    const char* c_str() const { return value.c_str(); }
+    unsigned int length() const { return (unsigned int)value.size(); }
+    bool isEmpty() const { return value.empty(); }
+    bool reserve(unsigned int size) { value.reserve(size); return true; }
+
+    String& operator=(const char* text) { value = text ? text : ""; return *this; }
+    String& operator+=(const String& other) { value += other.value; return *this; }
+    String& operator+=(const char* text) { if (text) value += text; return *this; }
+    String& operator+=(char c) { value += c; return *this; }
+    String& operator+=(int number) { value += integer((long long)number, DEC); return *this; }
+    String& operator+=(unsigned int number) { value += integer((unsigned long long)number, DEC); return *this; }
+    String& operator+=(long number) { value += integer((long long)number, DEC); return *this; }
+    String& operator+=(unsigned long number) { value += integer((unsigned long long)number, DEC); return *this; }
+
+    bool concat(const String& other) { value += other.value; return true; }
+    bool concat(const char* text) { if (!text) return false; value += text; return true; }
+    bool concat(const char* text, unsigned int length) { if (!text) return false; value.append(text, length); return true; }
+    bool concat(char c) { value += c; return true; }
+
+    char charAt(unsigned int index) const { return index < value.size() ? value[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index) { return value[index]; }
+
+    bool equals(const String& other) const { return value == other.value; }
+    bool equals(const char* text) const { return value == (text ? text : ""); }
+    bool equalsIgnoreCase(const String& other) const {
+        return value.size() == other.value.size() &&
+               std::equal(value.begin(), value.end(), other.value.begin(),
+                          [](char a, char b) { return tolower((unsigned char)a) == tolower((unsigned char)b); });
+    }
+    bool startsWith(const String& prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+    bool startsWith(const String& prefix, unsigned int offset) const {
+        return offset <= value.size() && value.compare(offset, prefix.value.size(), prefix.value) == 0;
+    }
+    bool endsWith(const String& suffix) const {
+        return suffix.value.size() <= value.size() &&
+               value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+    }
+
+    int indexOf(char c, unsigned int from = 0) const { return position(value.find(c, from)); }
+    int indexOf(const String& text, unsigned int from = 0) const { return position(value.find(text.value, from)); }
+    int lastIndexOf(char c) const { return position(value.rfind(c)); }
+    int lastIndexOf(const String& text) const { return position(value.rfind(text.value)); }
+
+    String substring(unsigned int from) const { return from < value.size() ? String(value.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        if (from >= value.size()) return String();
+        return String(value.substr(from, std::min<size_t>(to, value.size()) - from));
+    }
+
+    void remove(unsigned int index) { if (index < value.size()) value.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < value.size()) value.erase(index, count); }
+    void replace(const String& find, const String& with) {
+        if (find.value.empty()) return;
+        for (size_t at = value.find(find.value); at != std::string::npos; at = value.find(find.value, at + with.value.size())) {
+            value.replace(at, find.value.size(), with.value);
+        }
+    }
+    void trim() {
+        size_t first = 0;
+        while (first < value.size() && isspace((unsigned char)value[first])) first++;
+        size_t last = value.size();
+        while (last > first && isspace((unsigned char)value[last - 1])) last--;
+        value = value.substr(first, last - first);
+    }
+    void toLowerCase() { for (char& c : value) c = (char)tolower((unsigned char)c); }
+    void toUpperCase() { for (char& c : value) c = (char)toupper((unsigned char)c); }
+    long toInt() const { return strtol(value.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(value.c_str(), nullptr); }
+
+    friend bool operator==(const String& a, const String& b) { return a.value == b.value; }
+    friend bool operator==(const String& a, const char* b) { return a.equals(b); }
+    friend bool operator==(const char* a, const String& b) { return b.equals(a); }
+    friend bool operator!=(const String& a, const String& b) { return a.value != b.value; }
+    friend bool operator!=(const String& a, const char* b) { return !a.equals(b); }
+    friend bool operator!=(const char* a, const String& b) { return !b.equals(a); }
+    friend bool operator<(const String& a, const String& b) { return a.value < b.value; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.value + b.value); }
+    friend String operator+(const String& a, const char* b) { return String(a.value + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String((a ? a : "") + b.value); }
+    friend String operator+(const String& a, char b) { return String(a.value + b); }
+    friend String operator+(const String& a, int b) { return a + String(b); }
+    friend String operator+(const String& a, unsigned int b) { return a + String(b); }
+    friend String operator+(const String& a, long b) { return a + String(b); }
+    friend String operator+(const String& a, unsigned long b) { return a + String(b); }
+
+private:
+    std::string value;
+
+    static int position(size_t at) { return at == std::string::npos ? -1 : (int)at; }
+
+    static std::string integer(unsigned long long number, unsigned char base) {
+        char buffer[72];
+        char* end = buffer + sizeof(buffer) - 1;
+        char* p = end;
+        *p = '\0';
+        do {
+            int digit = (int)(number % base);
+            *--p = (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+            number /= base;
+        } while (number);
+        return std::string(p);
+    }
+
+    static std::string integer(long long number, unsigned char base) {
+        if (number < 0 && base == DEC) {
+            return "-" + integer((unsigned long long)(-(number + 1)) + 1, base);
+        }
+        return integer((unsigned long long)number, base);
+    }
+};
+
+// Result type of the core's operator+; ArduinoJson names it in its string adapters
+class StringSumHelper : public String {
+public:
+    using String::String;
+};
+
+// ==================== PRINT / STREAM ====================
+
+class Print {
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+            if (!write(*buffer++)) break;
+            n++;
+        }
+        return n;
+    }
+    size_t write(const char* text) { return text ? write((const uint8_t*)text, strlen(text)) : 0; }
+    size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+    virtual void flush() {}
+
+    size_t print(const char* text) { return write(text); }
+    size_t print(const String& text) { return write((const uint8_t*)text.c_str(), text.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int n, int base = DEC) { return print(String(n, (unsigned char)base)); }
+    size_t print(unsigned int n, int base = DEC) { return print(String(n, (unsigned char)base)); }
+    size_t print(long n, int base = DEC) { return print(String(n, (unsigned char)base)); }
+    size_t print(unsigned long n, int base = DEC) { return print(String(n, (unsigned char)base)); }
+    size_t print(long long n, int base = DEC) { return print(String(n, (unsigned char)base)); }
+    size_t print(unsigned long long n, int base = DEC) { return print(String(n, (unsigned char)base)); }
+    size_t print(double n, int digits = 2) { return print(String(n, (unsigned int)digits)); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& value) { return print(value) + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        char small[128];
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(small, sizeof(small), format, args);
+        va_end(args);
+        if (length < 0) return 0;
+        if ((size_t)length < sizeof(small)) return write((const uint8_t*)small, length);
+
+        std::string large(length + 1, '\0');
+        va_start(args, format);
+        vsnprintf(&large[0], large.size(), format, args);
+        va_end(args);
+        return write((const uint8_t*)large.data(), length);
+    }
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long) {}
+
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t n = 0;
+        while (n < length) {
+            int c = read();
+            if (c < 0) break;
+            buffer[n++] = (char)c;
+        }
+        return n;
+    }
+    size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+
+    String readString() {
+        std::string text;
+        for (int c = read(); c >= 0; c = read()) text += (char)c;
+        return String(text);
+    }
+
+    String readStringUntil(char terminator) {
+        std::string text;
+        for (int c = read(); c >= 0 && c != terminator; c = read()) text += (char)c;
+        return String(text);
+    }
+};
+
+// ==================== SERIAL ====================
+
+// Log output of the managers; stderr by default, setOutput(nullptr) mutes it (benchmarks)
+class HostSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    void setOutput(FILE* file) { output = file; }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        return output ? fwrite(buffer, 1, size, output) : size;
+    }
+
+    explicit operator bool() const { return true; }
+
+private:
+    FILE* output = stderr;
+};
+
+inline HostSerial Serial;
+
+// ==================== TIME / RANDOM ====================
+
+inline std::chrono::steady_clock::time_point hostBootTime() {
+    static const std::chrono::steady_clock::time_point boot = std::chrono::steady_clock::now();
+    return boot;
+}
+
+inline unsigned long micros() {
+    return (unsigned long)(uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - hostBootTime()).count();
+}
+
+inline unsigned long millis() {
+    return (unsigned long)(uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - hostBootTime()).count();
+}
+
+inline void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+inline void yield() {}
+
+template <typename T>
+inline T constrain(T value, T low, T high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+inline uint32_t esp_random() {
+    static std::mt19937 generator(std::random_device{}());
+    return generator();
+}
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef TO2DO_HOST_FS_H
+#define TO2DO_HOST_FS_H
+
+/*
+ * HOST SHIM: FS.h
+ * ESP32 çekirdeğinin fs::FS / fs::File arayüzü, stdio ve std::filesystem
+ * üzerinde. Sketch yolları ("/t/3.mp") kök dizine göre çözülür; kökü
+ * PosixBackend (Storage_Backend.h) verir. File kopyaları aynı tanıtıcıyı
+ * paylaşır, son kopya kapanınca dosya kapanır - çekirdekteki gibi.
+ */
+
+#include <Arduino.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File : public Stream {
+public:
+    File() {}
+
+    // Regular file; mode as in fopen ("r", "w", "a", "r+", ...)
+    static File openFile(const std::string& hostPath, const std::string& path, const char* mode) {
+        std::string binary = mode;
+        if (binary.find('b') == std::string::npos) binary += 'b';
+        FILE* handle = fopen(hostPath.c_str(), binary.c_str());
+        if (!handle) return File();
+        File file;
+        file.handle = std::make_shared<Handle>();
+        file.handle->file = handle;
+        file.handle->path = path;
+        return file;
+    }
+
+    // Directory: openNextFile() walks its entries in name order
+    static File openDirectory(const std::string& hostPath, const std::string& path) {
+        File dir;
+        dir.handle = std::make_shared<Handle>();
+        dir.handle->path = path;
+        dir.handle->hostPath = hostPath;
+        dir.handle->directory = true;
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(hostPath, error)) {
+            dir.handle->entries.push_back(entry.path().filename().string());
+        }
+        std::sort(dir.handle->entries.begin(), dir.handle->entries.end());
+        return dir;
+    }
+
+    explicit operator bool() const { return handle && (handle->file || handle->directory); }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        return isOpenFile() ? fwrite(buffer, 1, size, handle->file) : 0;
+    }
+    using Print::write;
+
+    int available() override {
+        if (!isOpenFile()) return 0;
+        long remaining = (long)size() - (long)position();
+        return remaining > 0 ? (int)std::min<long>(remaining, INT32_MAX) : 0;
+    }
+
+    int read() override { return isOpenFile() ? fgetc(handle->file) : -1; }
+
+    size_t read(uint8_t* buffer, size_t size) { return readBytes((char*)buffer, size); }
+    size_t readBytes(char* buffer, size_t length) override {
+        return isOpenFile() ? fread(buffer, 1, length, handle->file) : 0;
+    }
+
+    int peek() override {
+        if (!isOpenFile()) return -1;
+        int c = fgetc(handle->file);
+        if (c >= 0) ungetc(c, handle->file);
+        return c;
+    }
+
+    void flush() override {
+        if (isOpenFile()) fflush(handle->file);
+    }
+
+    bool seek(uint32_t pos, SeekMode mode = SeekSet) {
+        static const int whence[] = {SEEK_SET, SEEK_CUR, SEEK_END};
+        return isOpenFile() && fseek(handle->file, (long)pos, whence[mode]) == 0;
+    }
+
+    size_t position() const {
+        return isOpenFile() ? (size_t)ftell(handle->file) : 0;
+    }
+
+    size_t size() const {
+        if (!isOpenFile()) return 0;
+        long here = ftell(handle->file);
+        fseek(handle->file, 0, SEEK_END);
+        long end = ftell(handle->file);
+        fseek(handle->file, here, SEEK_SET);
+        return end > 0 ? (size_t)end : 0;
+    }
+
+    void close() {
+        if (handle) handle->close();
+        handle.reset();
+    }
+
+    const char* path() const { return handle ? handle->path.c_str() : ""; }
+    const char* name() const {
+        if (!handle) return "";
+        size_t slash = handle->path.rfind('/');
+        return handle->path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+    }
+
+    bool isDirectory() const { return handle && handle->directory; }
+
+    File openNextFile(const char* mode = FILE_READ) {
+        if (!isDirectory() || handle->next >= handle->entries.size()) return File();
+        const std::string& entry = handle->entries[handle->next++];
+        std::string path = handle->path == "/" ? "/" + entry : handle->path + "/" + entry;
+        std::string hostPath = handle->hostPath + "/" + entry;
+        std::error_code error;
+        if (std::filesystem::is_directory(hostPath, error)) {
+            return openDirectory(hostPath, path);
+        }
+        return openFile(hostPath, path, mode);
+    }
+
+    void rewindDirectory() {
+        if (isDirectory()) handle->next = 0;
+    }
+
+private:
+    struct Handle {
+        FILE* file = nullptr;
+        std::string path;                   // as the sketch sees it
+        std::string hostPath;               // directories only
+        bool directory = false;
+        std::vector<std::string> entries;
+        size_t next = 0;
+
+        void close() {
+            if (file) fclose(file);
+            file = nullptr;
+            directory = false;
+        }
+        ~Handle() { close(); }
+    };
+
+    std::shared_ptr<Handle> handle;
+
+    bool isOpenFile() const { return handle && handle->file; }
+};
+
+class FS {
+public:
+    explicit FS(const std::string& root) : root(root) {}
+
+    const std::string& rootPath() const { return root; }
+
+    // "/t/3.mp" -> "<root>/t/3.mp"
+    std::string hostPath(const String& path) const {
+        const char* p = path.c_str();
+        while (*p == '/') p++;
+        return *p ? root + "/" + p : root;
+    }
+
+    File open(const String& path, const char* mode = FILE_READ, bool create = false) {
+        (void)create;
+        std::string host = hostPath(path);
+        std::error_code error;
+        if (mode[0] == 'r' && std::filesystem::is_directory(host, error)) {
+            return File::openDirectory(host, path.c_str());
+        }
+        return File::openFile(host, path.c_str(), mode);
+    }
+
+    bool exists(const String& path) const {
+        std::error_code error;
+        return std::filesystem::exists(hostPath(path), error);
+    }
+
+    bool remove(const String& path) {
+        std::error_code error;
+        std::string host = hostPath(path);
+        return !std::filesystem::is_directory(host, error) && std::filesystem::remove(host, error);
+    }
+
+    bool rename(const String& from, const String& to) {
+        return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+    }
+
+    bool mkdir(const String& path) {
+        std::error_code error;
+        return std::filesystem::create_directory(hostPath(path), error) || std::filesystem::is_directory(hostPath(path), error);
+    }
+
+    bool rmdir(const String& path) {
+        std::error_code error;
+        return std::filesystem::remove(hostPath(path), error);
+    }
+
+private:
+    std::string root;
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef TO2DO_HOST_ESP_TIMER_H
+#define TO2DO_HOST_ESP_TIMER_H
+
+/*
+ * HOST SHIM: esp_timer.h
+ * TimeManager'ın kullandığı 64 bit mikrosaniye saati (açılıştan beri).
+ */
+
+#include <Arduino.h>
+
+inline int64_t esp_timer_get_time() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - hostBootTime()).count();
+}
+
+#endif
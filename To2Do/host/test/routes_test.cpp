@@ -0,0 +1,97 @@
+/*
+ * ROUTES TEST (host)
+ * ESPAsyncWebServer bir yolu alt yollarıyla birlikte eşler ve isteği ilk
+ * kaydedilen uygun handler'a verir. Bu test setupServerRoutes() içindeki
+ * kayıtları To2Do.ino'dan okur, isteği kütüphanenin kuralıyla dağıtır ve
+ * her isteğin doğru handler'a gittiğini kontrol eder.
+ *
+ *   ctest --test-dir build --output-on-failure
+ */
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Route {
+    std::string path;
+    std::string method;  // "GET", "POST", ...
+    std::string handler; // function name, "<lambda>" for inline handlers
+};
+
+// route()/deferredRoute()/uploadRoute()/server.on() calls in registration order
+std::vector<Route> sketchRoutes() {
+    std::ifstream sketch(TO2DO_SKETCH_DIR "/To2Do.ino");
+    std::string source((std::istreambuf_iterator<char>(sketch)), std::istreambuf_iterator<char>());
+    size_t begin = source.find("void setupServerRoutes()");
+    size_t end = source.find("\n}\n", begin);
+    std::string body = source.substr(begin, end - begin);
+
+    static const std::regex call(
+        R"re((?:route|deferredRoute|server\.on)\("([^"]+)",\s*HTTP_(\w+),\s*(\w+|\[))re"
+        R"re(|uploadRoute\("([^"]+)",\s*\w+,\s*(\w+))re");
+    std::vector<Route> routes;
+    for (std::sregex_iterator it(body.begin(), body.end(), call), last; it != last; ++it) {
+        const std::smatch& m = *it;
+        if (m[1].matched) {
+            routes.push_back({m[1], m[2], m[3] == "[" ? "<lambda>" : m[3].str()});
+        } else {
+            routes.push_back({m[4], "POST", m[5]});
+        }
+    }
+    return routes;
+}
+
+// AsyncCallbackWebHandler::canHandle for a plain (non-wildcard) uri
+bool canHandle(const Route& route, const std::string& method, const std::string& url) {
+    if (route.method != method) return false;
+    return url == route.path || url.rfind(route.path + "/", 0) == 0;
+}
+
+// AsyncWebServer hands the request to the first handler that can take it
+std::string dispatch(const std::string& method, const std::string& url) {
+    for (const Route& route : sketchRoutes()) {
+        if (canHandle(route, method, url)) return route.handler;
+    }
+    return "<notFound>";
+}
+
+} // namespace
+
+TEST(RoutesTest, SketchRoutesAreFound) {
+    EXPECT_GT(sketchRoutes().size(), 40u);
+}
+
+TEST(RoutesTest, ChecklistVerbsReachChecklistHandlers) {
+    EXPECT_EQ(dispatch("POST", "/api/tasks/checklist"), "handleCreateChecklistItem");
+    EXPECT_EQ(dispatch("PATCH", "/api/tasks/checklist"), "handlePatchChecklistItem");
+    EXPECT_EQ(dispatch("DELETE", "/api/tasks/checklist"), "handleDeleteChecklistItem");
+}
+
+TEST(RoutesTest, TaskVerbsReachTaskHandlers) {
+    EXPECT_EQ(dispatch("GET", "/api/tasks"), "handleGetTasks");
+    EXPECT_EQ(dispatch("POST", "/api/tasks"), "handleCreateTask");
+    EXPECT_EQ(dispatch("PATCH", "/api/tasks"), "handlePatchTask");
+    EXPECT_EQ(dispatch("DELETE", "/api/tasks"), "handleDeleteTask");
+    EXPECT_EQ(dispatch("GET", "/api/tasks/graph"), "handleTaskGraph");
+}
+
+TEST(RoutesTest, TimeSyncReachesSyncHandler) {
+    EXPECT_EQ(dispatch("POST", "/api/time/sync"), "handleTimeSyncNow");
+    EXPECT_EQ(dispatch("POST", "/api/time"), "handleSetManualTime");
+    EXPECT_EQ(dispatch("GET", "/api/time"), "handleGetTime");
+}
+
+// Every registration must be reachable: no earlier route may swallow its path
+TEST(RoutesTest, NoRouteIsShadowed) {
+    std::vector<Route> routes = sketchRoutes();
+    for (size_t i = 0; i < routes.size(); i++) {
+        for (size_t j = 0; j < i; j++) {
+            EXPECT_FALSE(canHandle(routes[j], routes[i].method, routes[i].path))
+                << routes[i].method << " " << routes[i].path << " goes to " << routes[j].path;
+        }
+    }
+}
@@ -0,0 +1,140 @@
+/*
+ * SEARCH TEST (host)
+ * GET /api/search iki yoldan cevap verir: SearchIndex adayları ya da
+ * (index taşınca) tüm verinin taranması. Aynı sorgu iki yoldan da aynı
+ * sonucu vermeli - tek harfli tokenler ve UTF-8 dahil.
+ *
+ *   ctest --test-dir build --output-on-failure
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+
+#include "Data_Manager.h"
+
+namespace {
+
+// Titles, descriptions, checklists and project names with short tokens on purpose
+bool saveDataset(DataManager& data) {
+    static const char* titles[] = {"Plan B for the garden", "a quick report", "X-ray appointment",
+                                   "Invoice 42 for Q3", "buy 2 bags of soil", "Çiçek sulama",
+                                   "review PR 7", "email Bob about plan", "Z", "budget v2 draft"};
+    static const char* descriptions[] = {"", "call a b c", "bring the x-ray", "see invoice q3",
+                                         "", "her gün su", "", "b before c", "z z z", "v1 was late"};
+    static const char* checklist[] = {"a", "step 1", "ask about X", "print it", "b",
+                                      "şişe", "lint", "", "q", "sum up"};
+
+    JsonDocument projectList;
+    JsonArray projects = projectList.to<JsonArray>();
+    const char* names[] = {"Home & garden", "Work Q3", "A"};
+    for (int p = 1; p <= 3; p++) {
+        JsonObject project = projects.add<JsonObject>();
+        project["id"] = p;
+        project["name"] = names[p - 1];
+        project["category"] = "Work";
+    }
+    JsonDocument settings;
+    settings.to<JsonObject>();
+
+    return data.replaceAll(projectList.as<JsonArrayConst>(), settings.as<JsonObjectConst>(),
+                           [&](int projectId, JsonArray tasks) {
+        for (int i = projectId - 1; i < 30; i += 3) {
+            JsonObject task = tasks.add<JsonObject>();
+            task["id"] = i + 1;
+            task["projectId"] = projectId;
+            task["title"] = titles[i % 10];
+            task["description"] = descriptions[(i / 3) % 10];
+            JsonObject item = task["checklist"].to<JsonArray>().add<JsonObject>();
+            item["id"] = 1;
+            item["text"] = checklist[(i * 7) % 10];
+            item["completed"] = false;
+        }
+        return true;
+    });
+}
+
+class SearchTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        data = new DataManager("/search/");
+        ASSERT_TRUE(saveDataset(*data));
+    }
+
+    static void TearDownTestSuite() {
+        delete data;
+        data = nullptr;
+    }
+
+    static JsonDocument run(const char* query, bool scan) {
+        JsonDocument result;
+        EXPECT_FALSE(deserializeJson(result, data->search(query, 100, scan)));
+        return result;
+    }
+
+    static DataManager* data;
+};
+
+DataManager* SearchTest::data = nullptr;
+
+TEST_F(SearchTest, IndexAndScanAgree) {
+    static const char* queries[] = {"b", "a", "x", "z", "q", "2", "7", "plan b", "a b", "x ray",
+                                    "rep", "invoice q", "ç", "şi", "her g", "v", "v2", "gar",
+                                    "work q3", "step 1", "nothing", "B PLAN"};
+    for (const char* query : queries) {
+        SCOPED_TRACE(query);
+        JsonDocument indexed = run(query, false);
+        JsonDocument scanned = run(query, true);
+        EXPECT_TRUE(indexed["indexed"].as<bool>());
+        EXPECT_FALSE(scanned["indexed"].as<bool>());
+
+        String indexedHits, scannedHits;
+        serializeJson(indexed["tasks"], indexedHits);
+        serializeJson(scanned["tasks"], scannedHits);
+        EXPECT_EQ(std::string(indexedHits.c_str()), std::string(scannedHits.c_str()));
+        indexedHits = scannedHits = "";
+        serializeJson(indexed["projects"], indexedHits);
+        serializeJson(scanned["projects"], scannedHits);
+        EXPECT_EQ(std::string(indexedHits.c_str()), std::string(scannedHits.c_str()));
+        EXPECT_EQ(indexed["count"].as<int>(), scanned["count"].as<int>());
+    }
+}
+
+TEST_F(SearchTest, SingleLettersAreIndexed) {
+    JsonDocument result = run("b", false);
+    ASSERT_GT(result["count"].as<int>(), 0);
+    bool planB = false;
+    for (JsonObjectConst task : result["tasks"].as<JsonArrayConst>()) {
+        if (strcmp(task["title"] | "", "Plan B for the garden") == 0) planB = true;
+    }
+    EXPECT_TRUE(planB);
+
+    result = run("a", false);
+    ASSERT_EQ(result["projects"].size(), 1u);
+    EXPECT_EQ(result["projects"][0]["id"].as<int>(), 3);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+
+    // A scratch directory unless the caller chose one
+    std::filesystem::path scratch;
+    if (!getenv("TO2DO_FS_ROOT")) {
+        scratch = std::filesystem::temp_directory_path() / ("to2do_test_" + std::to_string(esp_random()));
+        setenv("TO2DO_FS_ROOT", scratch.c_str(), 1);
+    }
+    Serial.setOutput(nullptr);
+    if (!storage().begin(true)) {
+        fprintf(stderr, "[Test] cannot create %s\n", getenv("TO2DO_FS_ROOT"));
+        return 1;
+    }
+
+    int result = RUN_ALL_TESTS();
+
+    if (!scratch.empty()) {
+        std::error_code error;
+        std::filesystem::remove_all(scratch, error);
+    }
+    return result;
+}
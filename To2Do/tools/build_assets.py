@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""
+To2Do web asset generator
+
+Reads the raw-literal sources (Web_Interface.h, Web_CSS.h, Web_JavaScript_*.h),
+minifies them conservatively, gzips them and writes Web_Assets.h with one
+PROGMEM byte array per asset plus a content-hash ETag.
+
+Run after every change to a Web_*.h source and commit the regenerated header:
+
+    python3 tools/build_assets.py
+
+Only the Python standard library is used.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+SKETCH_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "To2Do")
+OUTPUT = "Web_Assets.h"
+
+# (url, content type, symbol, kind, source headers in load order)
+# app.js order matters: UI render helpers, then actions, then the core class
+ASSETS = [
+    ("/app.css", "text/css", "APP_CSS", "css", ["Web_CSS.h"]),
+    ("/lang.js", "application/javascript", "LANG_JS", "js", ["Web_JavaScript_Lang.h"]),
+    ("/lang-handler.js", "application/javascript", "LANG_HANDLER_JS", "js", ["Web_JavaScript_Lang_Handler.h"]),
+    ("/app.js", "application/javascript", "APP_JS", "js",
+     ["Web_JavaScript_UI.h", "Web_JavaScript_Actions.h", "Web_JavaScript_Core.h"]),
+    # Last: the page references the other assets by content hash
+    ("/", "text/html", "INDEX_HTML", "html", ["Web_Interface.h"]),
+]
+
+RAW_LITERAL = re.compile(r'R"(?P<delim>[^(\s]*)\((?P<body>.*?)\)(?P=delim)"', re.S)
+
+
+def read_literal(name):
+    with open(os.path.join(SKETCH_DIR, name), encoding="utf-8") as f:
+        source = f.read().replace("\r\n", "\n")
+    match = RAW_LITERAL.search(source)
+    if not match:
+        sys.exit("build_assets: no raw string literal in " + name)
+    return match.group("body")
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};,>])\s*", r"\1", text)
+    return text.replace(";}", "}").strip()
+
+
+def minify_lines(text):
+    # Line based on purpose: newlines are kept so ASI and template literals stay intact
+    lines = []
+    for line in text.split("\n"):
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    return minify_lines(text)
+
+
+def c_array(data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(rows)
+
+
+def main():
+    hashes = {}
+    blocks = []
+    table = []
+    report = []
+
+    for url, content_type, symbol, kind, sources in ASSETS:
+        text = "".join(read_literal(name) for name in sources)
+        raw_size = len(text.encode("utf-8"))
+
+        if kind == "css":
+            text = minify_css(text)
+        elif kind == "js":
+            text = minify_lines(text)
+        else:
+            text = minify_html(text)
+            for asset_url, asset_hash in hashes.items():
+                text = text.replace('"%s"' % asset_url, '"%s?v=%s"' % (asset_url, asset_hash))
+
+        body = text.encode("utf-8")
+        digest = hashlib.sha1(body).hexdigest()[:16]
+        hashes[url] = digest[:8]
+
+        # mtime=0 keeps the output byte-identical between runs
+        packed = gzip.compress(body, compresslevel=9, mtime=0)
+
+        blocks.append("// %s <- %s\nstatic const uint8_t ASSET_%s[] PROGMEM = {\n%s\n};\n"
+                      % (url, ", ".join(sources), symbol, c_array(packed)))
+        # Pages are revalidated, hashed asset URLs are cached for a year
+        cache = "no-cache" if kind == "html" else "public, max-age=31536000, immutable"
+        table.append('  {"%s", "%s", ASSET_%s, sizeof(ASSET_%s), "\\"%s\\"", "%s"},'
+                     % (url, content_type, symbol, symbol, digest, cache))
+        report.append((url, raw_size, len(packed)))
+
+    with open(os.path.join(SKETCH_DIR, OUTPUT), "w", encoding="utf-8", newline="\r\n") as f:
+        f.write("#ifndef WEB_ASSETS_H\n#define WEB_ASSETS_H\n\n")
+        f.write("// AUTO-GENERATED by tools/build_assets.py - do not edit.\n")
+        f.write("// Minified + gzip'ed web assets, served as-is with Content-Encoding: gzip.\n\n")
+        f.write("#include <Arduino.h>\n\n")
+        f.write("struct WebAsset {\n")
+        f.write("  const char* path;\n  const char* contentType;\n  const uint8_t* data;\n")
+        f.write("  size_t length;\n  const char* etag;\n  const char* cacheControl;\n};\n\n")
+        f.write("\n".join(blocks))
+        f.write("\nstatic const WebAsset WEB_ASSETS[] = {\n%s\n};\n\n" % "\n".join(table))
+        f.write("static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);\n\n")
+        f.write("#endif\n")
+
+    total_raw = sum(r[1] for r in report)
+    total_packed = sum(r[2] for r in report)
+    for url, raw_size, packed_size in report:
+        print("%-18s %7d -> %6d bytes (%.0f%%)" % (url, raw_size, packed_size, 100.0 * packed_size / raw_size))
+    print("%-18s %7d -> %6d bytes (%.0f%%)" % ("total", total_raw, total_packed, 100.0 * total_packed / total_raw))
+
+
+if __name__ == "__main__":
+    main()
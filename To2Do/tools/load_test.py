@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+"""
+To2Do concurrent-client load test
+
+Runs several clients against a device at the same time and reports latency
+per endpoint. Run it once per firmware build and compare:
+
+    python3 tools/load_test.py --host 192.168.4.1 --save before.json
+    python3 tools/load_test.py --host 192.168.4.1 --save after.json
+    python3 tools/load_test.py --compare before.json after.json
+
+After the run the device's own /api/metrics (handler latency, heap low
+water mark, flash bytes written) is saved next to the client-side numbers.
+
+Every request is read-only, except --post-todos. That option re-posts the
+device's own /api/todos document (the same data, so it is harmless) to
+produce the "big POST while others wait" case.
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import json
+import sys
+import threading
+import time
+import urllib.error
+import urllib.request
+
+READ_ENDPOINTS = [
+    "/api/health",
+    "/api/todos",
+    "/api/notifications/week",
+    "/api/settings",
+    "/app.css",
+]
+
+
+def request(host, path, body=None, timeout=30):
+    url = "http://%s%s" % (host, path)
+    data = body.encode("utf-8") if body is not None else None
+    req = urllib.request.Request(url, data=data, method="POST" if data else "GET")
+    if data:
+        req.add_header("Content-Type", "application/json")
+    start = time.perf_counter()
+    try:
+        with urllib.request.urlopen(req, timeout=timeout) as resp:
+            resp.read()
+            status = resp.status
+    except urllib.error.HTTPError as err:
+        status = err.code
+    except Exception:
+        status = None
+    return status, (time.perf_counter() - start) * 1000.0
+
+
+def percentile(values, fraction):
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(round(fraction * (len(ordered) - 1))))
+    return ordered[index]
+
+
+def device_metrics(host):
+    """Server-side view of the run: handler time per route, heap, flash writes"""
+    try:
+        with urllib.request.urlopen("http://%s/api/metrics" % host, timeout=30) as resp:
+            metrics = json.loads(resp.read().decode("utf-8"))
+    except Exception as err:
+        print("No /api/metrics from the device: %s" % err)
+        return None
+    routes = {}
+    for route in metrics["routes"]:
+        if route["count"]:
+            routes[route["method"] + " " + route["path"]] = round(route["sumUs"] / route["count"] / 1000.0, 2)
+    return {
+        "heapMinFree": metrics["heap"]["minFree"],
+        "heapLargestBlock": metrics["heap"]["largestBlock"],
+        "flashBytesWritten": metrics["storage"]["bytesWritten"],
+        "handlerAvgMs": routes,
+    }
+
+
+def run(args):
+    todos = None
+    if args.post_todos:
+        with urllib.request.urlopen("http://%s/api/todos" % args.host, timeout=30) as resp:
+            todos = resp.read().decode("utf-8")
+        print("Re-posting /api/todos (%d bytes) from one client" % len(todos))
+
+    results = {}
+    lock = threading.Lock()
+
+    def record(name, status, elapsed):
+        with lock:
+            entry = results.setdefault(name, {"ms": [], "errors": 0})
+            if status is None or status >= 500:
+                entry["errors"] += 1
+            else:
+                entry["ms"].append(elapsed)
+
+    def reader(client):
+        for i in range(args.requests):
+            path = READ_ENDPOINTS[(client + i) % len(READ_ENDPOINTS)]
+            status, elapsed = request(args.host, path)
+            record("GET " + path, status, elapsed)
+
+    def poster():
+        for _ in range(max(1, args.requests // 4)):
+            status, elapsed = request(args.host, "/api/todos", todos)
+            record("POST /api/todos", status, elapsed)
+
+    threads = [threading.Thread(target=reader, args=(c,)) for c in range(args.clients)]
+    if todos is not None:
+        threads.append(threading.Thread(target=poster))
+
+    start = time.perf_counter()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    wall = time.perf_counter() - start
+
+    summary = {"host": args.host, "clients": args.clients, "wallSeconds": round(wall, 2), "endpoints": {}}
+    for name, entry in sorted(results.items()):
+        ms = entry["ms"]
+        summary["endpoints"][name] = {
+            "count": len(ms),
+            "errors": entry["errors"],
+            "p50": round(percentile(ms, 0.50), 1),
+            "p95": round(percentile(ms, 0.95), 1),
+            "max": round(max(ms), 1) if ms else 0.0,
+        }
+    summary["device"] = device_metrics(args.host)
+    return summary
+
+
+def print_summary(summary):
+    print("%d clients, %.2f s" % (summary["clients"], summary["wallSeconds"]))
+    print("%-32s %6s %6s %9s %9s %9s" % ("endpoint", "count", "errors", "p50 ms", "p95 ms", "max ms"))
+    for name, row in summary["endpoints"].items():
+        print("%-32s %6d %6d %9.1f %9.1f %9.1f" % (name, row["count"], row["errors"], row["p50"], row["p95"], row["max"]))
+    device = summary.get("device")
+    if device:
+        print("device: heap min free %d B, largest block %d B, %d B written to flash"
+              % (device["heapMinFree"], device["heapLargestBlock"], device["flashBytesWritten"]))
+
+
+def compare(before_path, after_path):
+    with open(before_path) as f:
+        before = json.load(f)
+    with open(after_path) as f:
+        after = json.load(f)
+    print("%-32s %12s %12s %12s %12s" % ("endpoint", "p50 before", "p50 after", "p95 before", "p95 after"))
+    for name in sorted(set(before["endpoints"]) | set(after["endpoints"])):
+        b = before["endpoints"].get(name, {})
+        a = after["endpoints"].get(name, {})
+        print("%-32s %12s %12s %12s %12s" % (name, b.get("p50", "-"), a.get("p50", "-"), b.get("p95", "-"), a.get("p95", "-")))
+
+    # Counters are cumulative since boot: compare runs made right after a reboot
+    bd = before.get("device") or {}
+    ad = after.get("device") or {}
+    if bd or ad:
+        print()
+        print("%-32s %12s %12s" % ("device", "before", "after"))
+        for key in ("heapMinFree", "heapLargestBlock", "flashBytesWritten"):
+            print("%-32s %12s %12s" % (key, bd.get(key, "-"), ad.get(key, "-")))
+        bh = bd.get("handlerAvgMs", {})
+        ah = ad.get("handlerAvgMs", {})
+        for name in sorted(set(bh) | set(ah)):
+            print("%-32s %12s %12s" % ("avg ms " + name, bh.get(name, "-"), ah.get(name, "-")))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="To2Do concurrent-client load test")
+    parser.add_argument("--host", default="192.168.4.1", help="device address (default: AP mode IP)")
+    parser.add_argument("--clients", type=int, default=4, help="concurrent reader clients")
+    parser.add_argument("--requests", type=int, default=40, help="requests per client")
+    parser.add_argument("--post-todos", action="store_true", help="add a client re-posting /api/todos")
+    parser.add_argument("--save", help="write the summary as JSON")
+    parser.add_argument("--compare", nargs=2, metavar=("BEFORE", "AFTER"), help="compare two saved runs")
+    args = parser.parse_args()
+
+    if args.compare:
+        compare(*args.compare)
+        return 0
+
+    summary = run(args)
+    print_summary(summary)
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(summary, f, indent=2)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())